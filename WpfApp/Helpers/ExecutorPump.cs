@@ -0,0 +1,48 @@
+﻿using System;
+using System.Windows.Threading;
+using CwAPI3D.Net.Bridge;
+
+namespace WpfApp.Helpers
+{
+  /// <summary>
+  /// Drains a CadThreadExecutor through the Dispatcher of the CAD thread: whenever a background thread queues a CAD
+  /// call, RunPending is scheduled as a dispatcher operation and runs between UI messages, so the CAD thread never
+  /// blocks waiting for work.
+  /// </summary>
+  public sealed class ExecutorPump : IDisposable
+  {
+    private readonly CadThreadExecutor _executor;
+    private readonly Dispatcher _dispatcher;
+    private bool _disposed;
+
+    public ExecutorPump(CadThreadExecutor executor, Dispatcher dispatcher)
+    {
+      _executor = executor ?? throw new ArgumentNullException(nameof(executor));
+      _dispatcher = dispatcher ?? throw new ArgumentNullException(nameof(dispatcher));
+      if (dispatcher.Thread.ManagedThreadId != executor.OwnerThreadId)
+        throw new ArgumentException("The dispatcher must belong to the executor's owner thread.", nameof(dispatcher));
+
+      _executor.WorkAvailable += OnWorkAvailable;
+      // Calls queued before the pump subscribed raised WorkAvailable with nobody listening.
+      _dispatcher.BeginInvoke(new Action(RunPending));
+    }
+
+    // Raised on the queuing thread; BeginInvoke only posts a message, so the producer never waits for the drain.
+    private void OnWorkAvailable(object sender, EventArgs e)
+    {
+      _dispatcher.BeginInvoke(new Action(RunPending));
+    }
+
+    private void RunPending()
+    {
+      if (!_disposed)
+        _executor.RunPending();
+    }
+
+    public void Dispose()
+    {
+      _executor.WorkAvailable -= OnWorkAvailable;
+      _disposed = true;
+    }
+  }
+}
@@ -12,6 +12,9 @@ using System.Windows.Media;
 using System.Windows.Media.Imaging;
 using System.Windows.Navigation;
 using System.Windows.Shapes;
+using CwAPI3D.Net.Bridge;
+using WpfApp.Helpers;
+using WpfApp.ViewModels;
 
 namespace WpfApp
 {
@@ -20,9 +23,25 @@ namespace WpfApp
   /// </summary>
   public partial class MainWindow : Window
   {
-    public MainWindow()
+    private readonly ExecutorPump _pump;
+    private readonly MainViewModel _viewModel;
+
+    /// <summary>
+    /// Creates the window on the CAD thread, which owns the factory's executor.
+    /// </summary>
+    public MainWindow(CwApi3DFactory wrapper)
     {
       InitializeComponent();
+      _pump = new ExecutorPump(wrapper.Executor, Dispatcher);
+      _viewModel = new MainViewModel(wrapper.GetElementController());
+      DataContext = _viewModel;
+      Closed += OnClosed;
+    }
+
+    private void OnClosed(object sender, EventArgs e)
+    {
+      _viewModel.Cancel();
+      _pump.Dispose();
     }
 
     private void Button_Click(object sender, RoutedEventArgs e)
@@ -1,13 +1,19 @@
-﻿using System.ComponentModel;
+﻿using System;
+using System.ComponentModel;
 using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Tasks;
 using System.Windows;
 using System.Windows.Input;
+using CwAPI3D.Net.Bridge;
 using WpfApp.Helpers;
 
 namespace WpfApp.ViewModels
 {
   public class MainViewModel : INotifyPropertyChanged
   {
+    private readonly ElementController _elementController;
+    private readonly CancellationTokenSource _cancellation = new CancellationTokenSource();
     private string _userInput;
 
     public string UserInput
@@ -22,14 +28,40 @@ namespace WpfApp.ViewModels
 
     public ICommand RunCommand { get; }
 
-    public MainViewModel()
+    public MainViewModel(ElementController elementController)
     {
+      _elementController = elementController ?? throw new ArgumentNullException(nameof(elementController));
       RunCommand = new RelayCommand(OnRun);
     }
 
-    private void OnRun()
+    /// <summary>
+    /// Cancels the CAD calls still queued, e.g. when the window closes.
+    /// </summary>
+    public void Cancel()
     {
-      MessageBox.Show($"You entered: {UserInput}", "Plugin Executed", MessageBoxButton.OK, MessageBoxImage.Information);
+      _cancellation.Cancel();
+    }
+
+    private async void OnRun()
+    {
+      int visible;
+      try
+      {
+        // The query runs on a background thread. Its CAD call is queued on the executor, and the window's
+        // ExecutorPump runs it on the CAD thread between UI messages, so the dialog stays responsive.
+        visible = await Task.Run(async () =>
+        {
+          var ids = await _elementController.GetVisibleIdentifiableElementIDsAsync(_cancellation.Token);
+          return ids.Count;
+        });
+      }
+      catch (OperationCanceledException)
+      {
+        return;
+      }
+
+      MessageBox.Show($"You entered: {UserInput}\n{visible} elements are visible.", "Plugin Executed",
+        MessageBoxButton.OK, MessageBoxImage.Information);
     }
 
     public event PropertyChangedEventHandler PropertyChanged;
@@ -39,4 +71,4 @@ namespace WpfApp.ViewModels
       PropertyChanged?.Invoke(this, new PropertyChangedEventArgs(name));
     }
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,137 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Text;
+using System.Text.RegularExpressions;
+
+namespace ManagedBenchmarks
+{
+    /// <summary>
+    /// Minimal Stopwatch-based runner. Each benchmark body processes a fixed batch of items per call; the runner
+    /// grows the number of calls until a run lasts at least the minimum time, like the native suite does.
+    /// Results are written in the same JSON schema as cwapi3d_benchmarks so benchmarks/compare.py handles both.
+    /// </summary>
+    public sealed class BenchmarkRunner
+    {
+        private const long MaxIterations = 1000000000;
+
+        private readonly List<Tuple<string, int, Action>> _benchmarks = new List<Tuple<string, int, Action>>();
+        private readonly List<Result> _results = new List<Result>();
+
+        private sealed class Result
+        {
+            public string Name;
+            public long Iterations;
+            public double NanosecondsPerIteration;
+            public double ItemsPerSecond;
+        }
+
+        public double MinTimeSeconds { get; set; } = 0.5;
+
+        public Regex Filter { get; set; }
+
+        /// <summary>
+        /// Registers a benchmark whose body processes <paramref name="itemsPerIteration"/> items per call.
+        /// </summary>
+        public void Add(string name, int itemsPerIteration, Action body)
+        {
+            _benchmarks.Add(Tuple.Create(name, itemsPerIteration, body));
+        }
+
+        public void Run()
+        {
+            Console.WriteLine("{0,-48} {1,14} {2,12}", "Benchmark", "Time", "Iterations");
+            Console.WriteLine(new string('-', 76));
+
+            foreach (var benchmark in _benchmarks.Where(b => Filter == null || Filter.IsMatch(b.Item1)))
+            {
+                var body = benchmark.Item3;
+                body(); // JIT and warm the caches before timing.
+
+                long iterations = 1;
+                double seconds;
+                for (;;)
+                {
+                    seconds = Measure(body, iterations);
+                    if (seconds >= MinTimeSeconds || iterations >= MaxIterations)
+                        break;
+
+                    // Same growth rule as the native runner: aim 40% past the minimum time, at most 10x per step.
+                    var multiplier = seconds <= MinTimeSeconds / 10 ? 10.0 : MinTimeSeconds * 1.4 / Math.Max(seconds, 1e-9);
+                    iterations = Math.Min(MaxIterations, Math.Max(iterations + 1, (long)(iterations * Math.Min(multiplier, 10.0))));
+                }
+
+                var result = new Result
+                {
+                    Name = benchmark.Item1,
+                    Iterations = iterations,
+                    NanosecondsPerIteration = seconds * 1e9 / iterations,
+                    ItemsPerSecond = benchmark.Item2 * iterations / seconds
+                };
+                _results.Add(result);
+                Console.WriteLine("{0,-48} {1,11:F1} ns {2,12}  items/s={3:E3}",
+                    result.Name, result.NanosecondsPerIteration, result.Iterations, result.ItemsPerSecond);
+            }
+        }
+
+        private static double Measure(Action body, long iterations)
+        {
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+            var stopwatch = Stopwatch.StartNew();
+            for (long i = 0; i < iterations; ++i)
+                body();
+            stopwatch.Stop();
+            return stopwatch.Elapsed.TotalSeconds;
+        }
+
+        /// <summary>
+        /// Writes the results in the Google Benchmark JSON schema. Stopwatch measures wall time only, so cpu_time
+        /// repeats real_time.
+        /// </summary>
+        public void WriteJson(string path)
+        {
+            var invariant = CultureInfo.InvariantCulture;
+            var json = new StringBuilder();
+            json.AppendLine("{");
+            json.AppendLine("  \"context\": {");
+            json.AppendFormat(invariant, "    \"date\": \"{0:yyyy-MM-ddTHH:mm:sszzz}\",\n", DateTime.Now);
+            json.AppendFormat(invariant, "    \"host_name\": \"{0}\",\n", Escape(Environment.MachineName));
+            json.AppendFormat(invariant, "    \"executable\": \"{0}\",\n", Escape(Process.GetCurrentProcess().MainModule.FileName));
+            json.AppendFormat(invariant, "    \"num_cpus\": {0},\n", Environment.ProcessorCount);
+#if DEBUG
+            json.AppendLine("    \"library_build_type\": \"debug\",");
+#else
+            json.AppendLine("    \"library_build_type\": \"release\",");
+#endif
+            json.AppendFormat(invariant, "    \"clr_version\": \"{0}\"\n", Environment.Version);
+            json.AppendLine("  },");
+            json.AppendLine("  \"benchmarks\": [");
+            for (var i = 0; i < _results.Count; ++i)
+            {
+                var result = _results[i];
+                json.AppendLine("    {");
+                json.AppendFormat(invariant, "      \"name\": \"{0}\",\n", Escape(result.Name));
+                json.AppendFormat(invariant, "      \"run_name\": \"{0}\",\n", Escape(result.Name));
+                json.AppendLine("      \"run_type\": \"iteration\",");
+                json.AppendFormat(invariant, "      \"iterations\": {0},\n", result.Iterations);
+                json.AppendFormat(invariant, "      \"real_time\": {0:R},\n", result.NanosecondsPerIteration);
+                json.AppendFormat(invariant, "      \"cpu_time\": {0:R},\n", result.NanosecondsPerIteration);
+                json.AppendLine("      \"time_unit\": \"ns\",");
+                json.AppendFormat(invariant, "      \"items_per_second\": {0:R}\n", result.ItemsPerSecond);
+                json.AppendLine(i + 1 < _results.Count ? "    }," : "    }");
+            }
+            json.AppendLine("  ]");
+            json.AppendLine("}");
+            File.WriteAllText(path, json.ToString().Replace("\r\n", "\n"));
+        }
+
+        private static string Escape(string text)
+        {
+            return text.Replace("\\", "\\\\").Replace("\"", "\\\"");
+        }
+    }
+}
@@ -0,0 +1,52 @@
+using CwAPI3D.Net.Bridge;
+using System;
+using System.Threading.Tasks;
+
+namespace ManagedBenchmarks
+{
+    /// <summary>
+    /// Benchmarks for <see cref="CadThreadExecutor"/>: the cost of queuing a call from worker threads and running it
+    /// on the owner thread (the benchmark thread stands in for the CAD thread), and of an inline call on the owner
+    /// thread. Every body issues <see cref="CallsPerBatch"/> calls.
+    /// </summary>
+    public static class ExecutorBenchmarks
+    {
+        public const int CallsPerBatch = 1024;
+
+        private static CadThreadExecutor _executor;
+        private static int _counter;
+
+        // Written by every benchmark so the JIT cannot drop the work.
+        internal static int _sink;
+
+        private static int Increment() => ++_counter;
+
+        private static Task Produce(int producers)
+        {
+            var workers = new Task[producers];
+            for (var p = 0; p < producers; ++p)
+            {
+                workers[p] = Task.Run(async () =>
+                {
+                    for (var i = 0; i < CallsPerBatch / producers; ++i)
+                        _sink = await _executor.InvokeAsync(Increment).ConfigureAwait(false);
+                });
+            }
+            return Task.WhenAll(workers);
+        }
+
+        public static void Register(BenchmarkRunner runner)
+        {
+            // Must be created on the thread that drains it: the one running the benchmarks.
+            _executor = new CadThreadExecutor();
+
+            runner.Add("Managed_Executor_InlineCall", CallsPerBatch, () =>
+            {
+                for (var i = 0; i < CallsPerBatch; ++i)
+                    _sink = _executor.InvokeAsync(Increment).Result;
+            });
+            runner.Add("Managed_Executor_OneProducer", CallsPerBatch, () => _executor.RunUntilComplete(Produce(1)));
+            runner.Add("Managed_Executor_FourProducers", CallsPerBatch, () => _executor.RunUntilComplete(Produce(4)));
+        }
+    }
+}
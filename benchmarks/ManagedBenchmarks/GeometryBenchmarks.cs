@@ -0,0 +1,209 @@
+using CwAPI3D.Net.Bridge;
+using CwAPI3D.Net.Bridge.Detail;
+using System;
+
+namespace ManagedBenchmarks
+{
+    /// <summary>
+    /// Benchmarks for the bridge's geometry types as seen from C#: the reference types, their value-type
+    /// variants, conversions between the two and to the CAD API's vector3D, and PointBuffer round trips.
+    /// Every body processes <see cref="BatchSize"/> items so the delegate call is amortised.
+    /// </summary>
+    public static class GeometryBenchmarks
+    {
+        public const int BatchSize = 256;
+
+        private static readonly Vector3D[] Vectors = new Vector3D[BatchSize];
+        private static readonly Vector3D[] OtherVectors = new Vector3D[BatchSize];
+        private static readonly Point3D[] Points = new Point3D[BatchSize];
+        private static readonly Point3D[] OtherPoints = new Point3D[BatchSize];
+        private static readonly Plane3D[] Planes = new Plane3D[BatchSize];
+        private static readonly Vector3DValue[] VectorValues = new Vector3DValue[BatchSize];
+        private static readonly Vector3DValue[] OtherVectorValues = new Vector3DValue[BatchSize];
+        private static readonly Point3DValue[] PointValues = new Point3DValue[BatchSize];
+        private static readonly Point3DValue[] OtherPointValues = new Point3DValue[BatchSize];
+        private static readonly Plane3DValue[] PlaneValues = new Plane3DValue[BatchSize];
+        private static readonly Point3D[] ConvertedPoints = new Point3D[BatchSize];
+        private static readonly Vector3D[] ConvertedVectors = new Vector3D[BatchSize];
+        private static readonly Point3DValue[] ConvertedPointValues = new Point3DValue[BatchSize];
+        private static readonly Vector3DValue[] ConvertedVectorValues = new Vector3DValue[BatchSize];
+        private static readonly PointBuffer SharedBuffer;
+        private static double[] _distances;
+
+        // Written by every benchmark so the JIT cannot drop the work.
+        internal static double _sink;
+        internal static object _objectSink;
+
+        static GeometryBenchmarks()
+        {
+            var random = new Random(42);
+            Func<double> coordinate = () => random.NextDouble() * 200.0 - 100.0;
+            for (var i = 0; i < BatchSize; ++i)
+            {
+                Vectors[i] = new Vector3D(coordinate(), coordinate(), coordinate());
+                OtherVectors[i] = new Vector3D(coordinate(), coordinate(), coordinate());
+                Points[i] = new Point3D(coordinate(), coordinate(), coordinate());
+                OtherPoints[i] = new Point3D(coordinate(), coordinate(), coordinate());
+                Planes[i] = new Plane3D(Points[i], Vectors[i]);
+                VectorValues[i] = Vectors[i];
+                OtherVectorValues[i] = OtherVectors[i];
+                PointValues[i] = Points[i];
+                OtherPointValues[i] = OtherPoints[i];
+                PlaneValues[i] = Planes[i];
+            }
+            SharedBuffer = PointBuffer.FromArray(PointValues);
+        }
+
+        public static void Register(BenchmarkRunner runner)
+        {
+            // Reference types: one heap allocation per result.
+            runner.Add("Managed_Vector3D_Add", BatchSize, () =>
+            {
+                for (var i = 0; i < BatchSize; ++i)
+                    _objectSink = Vectors[i] + OtherVectors[i];
+            });
+            runner.Add("Managed_Vector3D_CrossProduct", BatchSize, () =>
+            {
+                for (var i = 0; i < BatchSize; ++i)
+                    _objectSink = Vectors[i].CrossProduct(OtherVectors[i]);
+            });
+            runner.Add("Managed_Vector3D_DotProduct", BatchSize, () =>
+            {
+                var sum = 0.0;
+                for (var i = 0; i < BatchSize; ++i)
+                    sum += Vectors[i].DotProduct(OtherVectors[i]);
+                _sink = sum;
+            });
+            runner.Add("Managed_Vector3D_Normalize", BatchSize, () =>
+            {
+                for (var i = 0; i < BatchSize; ++i)
+                    _objectSink = Vectors[i].Normalize();
+            });
+            runner.Add("Managed_Point3D_DistanceTo", BatchSize, () =>
+            {
+                var sum = 0.0;
+                for (var i = 0; i < BatchSize; ++i)
+                    sum += Points[i].DistanceTo(OtherPoints[i]);
+                _sink = sum;
+            });
+            runner.Add("Managed_Plane3D_FromPointNormal", BatchSize, () =>
+            {
+                for (var i = 0; i < BatchSize; ++i)
+                    _objectSink = new Plane3D(Points[i], Vectors[i]);
+            });
+            runner.Add("Managed_Plane3D_DistanceTo", BatchSize, () =>
+            {
+                var sum = 0.0;
+                for (var i = 0; i < BatchSize; ++i)
+                    sum += Planes[i].DistanceTo(OtherPoints[i]);
+                _sink = sum;
+            });
+            runner.Add("Managed_Plane3D_IntersectLine", BatchSize, () =>
+            {
+                for (var i = 0; i < BatchSize; ++i)
+                {
+                    Planes[i].IntersectLine(Points[i], OtherPoints[i], out var intersection);
+                    _objectSink = intersection;
+                }
+            });
+
+            // Value types: no allocation.
+            runner.Add("Managed_Vector3DValue_Add", BatchSize, () =>
+            {
+                var sum = new Vector3DValue();
+                for (var i = 0; i < BatchSize; ++i)
+                    sum += VectorValues[i] + OtherVectorValues[i];
+                _sink = sum.X;
+            });
+            runner.Add("Managed_Vector3DValue_CrossProduct", BatchSize, () =>
+            {
+                var sum = 0.0;
+                for (var i = 0; i < BatchSize; ++i)
+                {
+                    Vector3DValue.CrossProduct(ref VectorValues[i], ref OtherVectorValues[i], out var result);
+                    sum += result.X;
+                }
+                _sink = sum;
+            });
+            runner.Add("Managed_Vector3DValue_DotProduct", BatchSize, () =>
+            {
+                var sum = 0.0;
+                for (var i = 0; i < BatchSize; ++i)
+                    sum += Vector3DValue.DotProduct(ref VectorValues[i], ref OtherVectorValues[i]);
+                _sink = sum;
+            });
+            runner.Add("Managed_Vector3DValue_Normalize", BatchSize, () =>
+            {
+                var sum = 0.0;
+                for (var i = 0; i < BatchSize; ++i)
+                {
+                    Vector3DValue.Normalize(ref VectorValues[i], out var result);
+                    sum += result.X;
+                }
+                _sink = sum;
+            });
+            runner.Add("Managed_Point3DValue_DistanceTo", BatchSize, () =>
+            {
+                var sum = 0.0;
+                for (var i = 0; i < BatchSize; ++i)
+                    sum += Point3DValue.Distance(ref PointValues[i], ref OtherPointValues[i]);
+                _sink = sum;
+            });
+            runner.Add("Managed_Plane3DValue_DistanceTo", BatchSize, () =>
+            {
+                var sum = 0.0;
+                for (var i = 0; i < BatchSize; ++i)
+                    sum += PlaneValues[i].DistanceTo(ref OtherPointValues[i]);
+                _sink = sum;
+            });
+
+            // Conversions between the two representations.
+            runner.Add("Managed_Convert_Point3DToValue", BatchSize, () =>
+            {
+                var sum = 0.0;
+                for (var i = 0; i < BatchSize; ++i)
+                {
+                    Point3DValue value = Points[i];
+                    sum += value.X;
+                }
+                _sink = sum;
+            });
+            runner.Add("Managed_Convert_ValueToPoint3D", BatchSize, () =>
+            {
+                for (var i = 0; i < BatchSize; ++i)
+                    _objectSink = (Point3D)PointValues[i];
+            });
+
+            // Conversions to and from the CAD API's vector3D, done on the bridge side by ConversionHooks.
+            runner.Add("Managed_Convert_Point3DToNative", BatchSize, () => _sink = ConversionHooks.ToNative(Points));
+            runner.Add("Managed_Convert_Point3DFromNative", BatchSize, () => ConversionHooks.FromNative(ConvertedPoints));
+            runner.Add("Managed_Convert_Vector3DToNative", BatchSize, () => _sink = ConversionHooks.ToNative(Vectors));
+            runner.Add("Managed_Convert_Vector3DFromNative", BatchSize, () => ConversionHooks.FromNative(ConvertedVectors));
+            runner.Add("Managed_Convert_Point3DValueToNative", BatchSize, () => _sink = ConversionHooks.ToNative(PointValues));
+            runner.Add("Managed_Convert_Point3DValueFromNative", BatchSize, () => ConversionHooks.FromNative(ConvertedPointValues));
+            runner.Add("Managed_Convert_Vector3DValueToNative", BatchSize, () => _sink = ConversionHooks.ToNative(VectorValues));
+            runner.Add("Managed_Convert_Vector3DValueFromNative", BatchSize, () => ConversionHooks.FromNative(ConvertedVectorValues));
+
+            // Structure-of-arrays buffers: the bulk path.
+            runner.Add("Managed_PointBuffer_FromArray", BatchSize, () =>
+            {
+                using (var buffer = PointBuffer.FromArray(PointValues))
+                    _sink = buffer.Count;
+            });
+            runner.Add("Managed_PointBuffer_ToArray", BatchSize, () =>
+            {
+                _objectSink = SharedBuffer.ToArray();
+            });
+            runner.Add("Managed_PointBuffer_DistanceTo", BatchSize, () =>
+            {
+                SharedBuffer.DistanceTo(PointValues[0], ref _distances);
+                _sink = _distances[0];
+            });
+            runner.Add("Managed_Plane3D_DistanceTo_Buffer", BatchSize, () =>
+            {
+                Planes[0].DistanceTo(SharedBuffer, ref _distances);
+                _sink = _distances[0];
+            });
+        }
+    }
+}
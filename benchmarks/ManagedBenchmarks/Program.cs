@@ -0,0 +1,46 @@
+using System;
+using System.Globalization;
+using System.Text.RegularExpressions;
+
+namespace ManagedBenchmarks
+{
+    /// <summary>
+    /// Usage: ManagedBenchmarks.exe [--filter REGEX] [--min-time SECONDS] [--out FILE.json]
+    /// </summary>
+    internal static class Program
+    {
+        private static int Main(string[] args)
+        {
+            var runner = new BenchmarkRunner();
+            string outputPath = null;
+
+            for (var i = 0; i < args.Length; ++i)
+            {
+                var hasValue = i + 1 < args.Length;
+                switch (args[i])
+                {
+                    case "--filter" when hasValue:
+                        runner.Filter = new Regex(args[++i]);
+                        break;
+                    case "--min-time" when hasValue:
+                        runner.MinTimeSeconds = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "--out" when hasValue:
+                        outputPath = args[++i];
+                        break;
+                    default:
+                        Console.Error.WriteLine("Usage: ManagedBenchmarks.exe [--filter REGEX] [--min-time SECONDS] [--out FILE.json]");
+                        return 2;
+                }
+            }
+
+            GeometryBenchmarks.Register(runner);
+            ExecutorBenchmarks.Register(runner);
+            runner.Run();
+
+            if (outputPath != null)
+                runner.WriteJson(outputPath);
+            return 0;
+        }
+    }
+}
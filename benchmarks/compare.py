@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Compare two benchmark JSON files (Google Benchmark schema) and flag regressions.
+
+Both the native suite (cwapi3d_benchmarks --benchmark_out=...) and the managed suite
+(ManagedBenchmarks.exe --out ...) write this schema, so either can be compared against a baseline:
+
+    python benchmarks/compare.py baseline.json contender.json --threshold 0.05
+
+Exits with status 1 when any benchmark is slower than the baseline by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+TIME_UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    with open(path, encoding="utf-8") as handle:
+        document = json.load(handle)
+
+    results = {}
+    for entry in document.get("benchmarks", []):
+        # Aggregates (mean/median/stddev) are reported separately from iterations; keep plain runs only.
+        if entry.get("run_type", "iteration") != "iteration":
+            continue
+        scale = TIME_UNIT_TO_NS[entry.get("time_unit", "ns")]
+        results[entry["name"]] = {
+            "real_time": entry["real_time"] * scale,
+            "cpu_time": entry["cpu_time"] * scale,
+        }
+    return document.get("context", {}), results
+
+
+def format_time(nanoseconds):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= scale:
+            return "{:.3f} {}".format(nanoseconds / scale, unit)
+    return "{:.1f} ns".format(nanoseconds)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="JSON results of the reference run")
+    parser.add_argument("contender", help="JSON results of the run to check")
+    parser.add_argument("--threshold", type=float, default=0.05,
+                        help="relative slowdown that counts as a regression (default: 0.05 = 5%%)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="cpu_time",
+                        help="time to compare (default: cpu_time)")
+    parser.add_argument("--filter", default="", help="only compare benchmarks whose name contains this text")
+    args = parser.parse_args()
+
+    baseline_context, baseline = load(args.baseline)
+    contender_context, contender = load(args.contender)
+
+    for key in ("simd_level", "library_build_type"):
+        if key in baseline_context and baseline_context.get(key) != contender_context.get(key):
+            print("warning: {} differs (baseline {}, contender {})".format(
+                key, baseline_context.get(key), contender_context.get(key)))
+
+    names = [name for name in baseline if name in contender and args.filter in name]
+    width = max([len("Benchmark")] + [len(name) for name in names])
+    print("{:<{w}}  {:>14}  {:>14}  {:>9}".format("Benchmark", "Baseline", "Contender", "Change", w=width))
+    print("-" * (width + 43))
+
+    regressions = []
+    for name in names:
+        old = baseline[name][args.metric]
+        new = contender[name][args.metric]
+        change = (new - old) / old if old > 0 else 0.0
+        marker = ""
+        if change > args.threshold:
+            marker = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            marker = "  improved"
+        print("{:<{w}}  {:>14}  {:>14}  {:>+8.1%}{}".format(
+            name, format_time(old), format_time(new), change, marker, w=width))
+
+    missing = sorted(name for name in baseline if name not in contender and args.filter in name)
+    added = sorted(name for name in contender if name not in baseline and args.filter in name)
+    if missing:
+        print("\nMissing from contender:\n  " + "\n  ".join(missing))
+    if added:
+        print("\nNew in contender (no baseline):\n  " + "\n  ".join(added))
+
+    if regressions:
+        print("\n{} benchmark(s) regressed by more than {:.0%} ({}).".format(
+            len(regressions), args.threshold, args.metric))
+        return 1
+    print("\nNo regressions above {:.0%} ({}).".format(args.threshold, args.metric))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
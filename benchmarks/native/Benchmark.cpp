@@ -0,0 +1,364 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge::Benchmarks;
+
+  std::vector<std::unique_ptr<Benchmark>>& registry()
+  {
+    static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+    return benchmarks;
+  }
+
+  std::vector<std::pair<std::string, std::string>>& customContext()
+  {
+    static std::vector<std::pair<std::string, std::string>> context;
+    return context;
+  }
+
+  struct Result
+  {
+    std::string name;
+    std::string runName;
+    std::int64_t iterations = 0;
+    double realNanoseconds = 0.0;
+    double cpuNanoseconds = 0.0;
+    double itemsPerSecond = 0.0;
+    double bytesPerSecond = 0.0;
+    std::string label;
+    std::map<std::string, double> counters;
+  };
+
+  struct Options
+  {
+    std::string filter = ".";
+    double minTime = 0.5;
+    std::string outPath;
+    std::string format = "console";
+  };
+
+  constexpr std::int64_t MaxIterations = 1000000000;
+
+  std::string jsonEscape(const std::string& text)
+  {
+    std::ostringstream out;
+    for (const char c : text)
+    {
+      switch (c)
+      {
+      case '"': out << "\\\""; break;
+      case '\\': out << "\\\\"; break;
+      case '\n': out << "\\n"; break;
+      case '\t': out << "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        else
+          out << c;
+      }
+    }
+    return out.str();
+  }
+
+  std::string runName(const Benchmark& benchmark, const std::vector<std::int64_t>& args)
+  {
+    std::string name = benchmark.name();
+    for (const std::int64_t arg : args)
+    {
+      name += '/';
+      name += std::to_string(arg);
+    }
+    return name;
+  }
+
+  std::string currentDate()
+  {
+    const std::time_t now = std::time(nullptr);
+    std::tm local{};
+#if defined(_WIN32)
+    localtime_s(&local, &now);
+#else
+    localtime_r(&now, &local);
+#endif
+    std::ostringstream out;
+    out << std::put_time(&local, "%Y-%m-%dT%H:%M:%S%z");
+    return out.str();
+  }
+
+  std::string hostName()
+  {
+    for (const char* variable : {"COMPUTERNAME", "HOSTNAME"})
+    {
+      if (const char* value = std::getenv(variable))
+        return value;
+    }
+    return "unknown";
+  }
+
+  bool parseFlag(const std::string& argument, const char* flag, std::string& value)
+  {
+    const std::string prefix = std::string("--") + flag + "=";
+    if (argument.rfind(prefix, 0) != 0)
+      return false;
+    value = argument.substr(prefix.size());
+    return true;
+  }
+
+  Result run(const Benchmark& benchmark, const std::vector<std::int64_t>& args, double minTime)
+  {
+    std::int64_t iterations = 1;
+    for (;;)
+    {
+      State state(iterations, args);
+      benchmark.function()(state);
+
+      const double seconds = state.realSeconds();
+      const bool longEnough = seconds >= minTime || iterations >= MaxIterations;
+      if (longEnough)
+      {
+        Result result;
+        result.name = runName(benchmark, args);
+        result.runName = result.name;
+        result.iterations = iterations;
+        result.realNanoseconds = seconds * 1e9 / static_cast<double>(iterations);
+        result.cpuNanoseconds = state.cpuSeconds() * 1e9 / static_cast<double>(iterations);
+        if (seconds > 0.0)
+        {
+          result.itemsPerSecond = static_cast<double>(state.itemsProcessed()) / seconds;
+          result.bytesPerSecond = static_cast<double>(state.bytesProcessed()) / seconds;
+        }
+        result.label = state.label();
+        result.counters = state.counters;
+        return result;
+      }
+
+      // Same growth rule as Google Benchmark: aim 40% past the minimum time, grow at most 10x per round.
+      const double multiplier = seconds <= 0.0 ? 10.0 : std::min(10.0, minTime * 1.4 / seconds);
+      iterations = std::min(MaxIterations, std::max(iterations + 1,
+        static_cast<std::int64_t>(static_cast<double>(iterations) * multiplier)));
+    }
+  }
+
+  void writeConsole(std::ostream& out, const std::vector<Result>& results)
+  {
+    std::size_t width = 9;
+    for (const Result& result : results)
+      width = std::max(width, result.name.size());
+
+    out << std::left << std::setw(static_cast<int>(width)) << "Benchmark" << std::right
+        << std::setw(15) << "Time" << std::setw(15) << "CPU" << std::setw(13) << "Iterations" << "\n"
+        << std::string(width + 43, '-') << "\n";
+    for (const Result& result : results)
+    {
+      out << std::left << std::setw(static_cast<int>(width)) << result.name << std::right << std::fixed
+          << std::setprecision(1) << std::setw(12) << result.realNanoseconds << " ns"
+          << std::setw(12) << result.cpuNanoseconds << " ns" << std::setw(13) << result.iterations;
+      if (result.itemsPerSecond > 0.0)
+        out << "  items/s=" << std::scientific << std::setprecision(3) << result.itemsPerSecond;
+      out << std::defaultfloat << std::setprecision(10);
+      for (const auto& [name, value] : result.counters)
+        out << "  " << name << "=" << value;
+      if (!result.label.empty())
+        out << "  " << result.label;
+      out << "\n";
+    }
+  }
+
+  void writeJson(std::ostream& out, const std::vector<Result>& results, const char* executable)
+  {
+    out << "{\n  \"context\": {\n";
+    out << "    \"date\": \"" << jsonEscape(currentDate()) << "\",\n";
+    out << "    \"host_name\": \"" << jsonEscape(hostName()) << "\",\n";
+    out << "    \"executable\": \"" << jsonEscape(executable) << "\",\n";
+    out << "    \"num_cpus\": " << std::max(1u, std::thread::hardware_concurrency()) << ",\n";
+#if defined(NDEBUG)
+    out << "    \"library_build_type\": \"release\"";
+#else
+    out << "    \"library_build_type\": \"debug\"";
+#endif
+    for (const auto& [key, value] : customContext())
+      out << ",\n    \"" << jsonEscape(key) << "\": \"" << jsonEscape(value) << "\"";
+    out << "\n  },\n  \"benchmarks\": [";
+
+    out << std::setprecision(17);
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+      const Result& result = results[i];
+      out << (i == 0 ? "\n" : ",\n") << "    {\n";
+      out << "      \"name\": \"" << jsonEscape(result.name) << "\",\n";
+      out << "      \"run_name\": \"" << jsonEscape(result.runName) << "\",\n";
+      out << "      \"run_type\": \"iteration\",\n";
+      out << "      \"iterations\": " << result.iterations << ",\n";
+      out << "      \"real_time\": " << result.realNanoseconds << ",\n";
+      out << "      \"cpu_time\": " << result.cpuNanoseconds << ",\n";
+      out << "      \"time_unit\": \"ns\"";
+      if (result.itemsPerSecond > 0.0)
+        out << ",\n      \"items_per_second\": " << result.itemsPerSecond;
+      if (result.bytesPerSecond > 0.0)
+        out << ",\n      \"bytes_per_second\": " << result.bytesPerSecond;
+      for (const auto& [name, value] : result.counters)
+        out << ",\n      \"" << jsonEscape(name) << "\": " << value;
+      if (!result.label.empty())
+        out << ",\n      \"label\": \"" << jsonEscape(result.label) << "\"";
+      out << "\n    }";
+    }
+    out << "\n  ]\n}\n";
+  }
+}
+
+namespace CwAPI3D::Net::Bridge::Benchmarks
+{
+  State::State(std::int64_t maxIterations, std::vector<std::int64_t> args)
+    : m_maxIterations(maxIterations), m_args(std::move(args))
+  {
+  }
+
+  State::Iterator State::begin()
+  {
+    m_remaining = m_maxIterations;
+    ResumeTiming();
+    return Iterator(this);
+  }
+
+  void State::PauseTiming()
+  {
+    if (!m_running)
+      return;
+    m_realSeconds += std::chrono::duration<double>(Clock::now() - m_realStart).count();
+    m_cpuSeconds += static_cast<double>(std::clock() - m_cpuStart) / CLOCKS_PER_SEC;
+    m_running = false;
+  }
+
+  void State::ResumeTiming()
+  {
+    if (m_running)
+      return;
+    m_cpuStart = std::clock();
+    m_realStart = Clock::now();
+    m_running = true;
+  }
+
+  void State::finishTiming()
+  {
+    PauseTiming();
+  }
+
+  Benchmark::Benchmark(std::string name, BenchmarkFunction function)
+    : m_name(std::move(name)), m_function(std::move(function))
+  {
+  }
+
+  Benchmark* Benchmark::Arg(std::int64_t value)
+  {
+    m_argSets.push_back({value});
+    return this;
+  }
+
+  Benchmark* Benchmark::Args(std::vector<std::int64_t> values)
+  {
+    m_argSets.push_back(std::move(values));
+    return this;
+  }
+
+  Benchmark* Benchmark::Range(std::int64_t low, std::int64_t high)
+  {
+    for (std::int64_t value = low; value < high; value *= 8)
+      Arg(value);
+    return Arg(high);
+  }
+
+  Benchmark* RegisterBenchmark(std::string name, BenchmarkFunction function)
+  {
+    registry().push_back(std::make_unique<Benchmark>(std::move(name), std::move(function)));
+    return registry().back().get();
+  }
+
+  void AddCustomContext(const std::string& key, const std::string& value)
+  {
+    customContext().emplace_back(key, value);
+  }
+
+  int RunSpecifiedBenchmarks(int argc, char** argv)
+  {
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+      const std::string argument = argv[i];
+      std::string value;
+      if (parseFlag(argument, "benchmark_filter", value))
+        options.filter = value;
+      else if (parseFlag(argument, "benchmark_min_time", value))
+        options.minTime = std::strtod(value.c_str(), nullptr);
+      else if (parseFlag(argument, "benchmark_out", value))
+        options.outPath = value;
+      else if (parseFlag(argument, "benchmark_format", value))
+        options.format = value;
+      else
+      {
+        std::cerr << "Unknown argument: " << argument << "\n"
+                  << "Usage: " << argv[0] << " [--benchmark_filter=<regex>] [--benchmark_min_time=<seconds>]"
+                  << " [--benchmark_out=<file.json>] [--benchmark_format=console|json]\n";
+        return 2;
+      }
+    }
+
+    std::regex filter;
+    try
+    {
+      filter = std::regex(options.filter);
+    }
+    catch (const std::regex_error& error)
+    {
+      std::cerr << "Invalid --benchmark_filter: " << error.what() << "\n";
+      return 2;
+    }
+
+    std::vector<Result> results;
+    for (const auto& benchmark : registry())
+    {
+      std::vector<std::vector<std::int64_t>> argSets = benchmark->argSets();
+      if (argSets.empty())
+        argSets.emplace_back();
+
+      for (const auto& args : argSets)
+      {
+        if (!std::regex_search(runName(*benchmark, args), filter))
+          continue;
+        results.push_back(run(*benchmark, args, options.minTime));
+        if (options.format == "console")
+          std::cerr << "." << std::flush;
+      }
+    }
+    if (options.format == "console")
+      std::cerr << "\n";
+
+    if (options.format == "json")
+      writeJson(std::cout, results, argv[0]);
+    else
+      writeConsole(std::cout, results);
+
+    if (!options.outPath.empty())
+    {
+      std::ofstream file(options.outPath);
+      if (!file)
+      {
+        std::cerr << "Cannot write " << options.outPath << "\n";
+        return 1;
+      }
+      writeJson(file, results, argv[0]);
+    }
+    return 0;
+  }
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Minimal benchmark harness with the Google Benchmark programming model (`for (auto _ : state)`,
+// DoNotOptimize, Arg/Range) and its JSON output schema, so results can be compared with
+// benchmarks/compare.py or Google's own tools. Self-contained to keep the build free of external
+// dependencies.
+namespace CwAPI3D::Net::Bridge::Benchmarks
+{
+  class State
+  {
+  public:
+    State(std::int64_t maxIterations, std::vector<std::int64_t> args);
+
+    class Iterator
+    {
+    public:
+      /// Loop variable of `for (auto _ : state)`; marked so compilers do not report it as unused.
+      struct [[maybe_unused]] Value
+      {
+      };
+
+      explicit Iterator(State* state) : m_state(state) {}
+
+      Value operator*() const { return Value(); }
+      Iterator& operator++()
+      {
+        --m_state->m_remaining;
+        return *this;
+      }
+      bool operator!=(const Iterator&)
+      {
+        if (m_state->m_remaining > 0)
+          return true;
+        m_state->finishTiming();
+        return false;
+      }
+
+    private:
+      State* m_state;
+    };
+
+    Iterator begin();
+    Iterator end() { return Iterator(this); }
+
+    /// Argument i of the current run, as passed to Benchmark::Arg/Args/Range.
+    std::int64_t range(std::size_t index = 0) const { return m_args.at(index); }
+
+    /// Excludes setup work inside the loop from the measurement.
+    void PauseTiming();
+    void ResumeTiming();
+
+    void SetItemsProcessed(std::int64_t items) { m_itemsProcessed = items; }
+    void SetBytesProcessed(std::int64_t bytes) { m_bytesProcessed = bytes; }
+    void SetLabel(std::string label) { m_label = std::move(label); }
+
+    std::int64_t iterations() const { return m_maxIterations; }
+
+    /// User counters, reported as-is next to the timings (Google Benchmark's state.counters["name"] = value).
+    std::map<std::string, double> counters;
+
+    double realSeconds() const { return m_realSeconds; }
+    double cpuSeconds() const { return m_cpuSeconds; }
+    std::int64_t itemsProcessed() const { return m_itemsProcessed; }
+    std::int64_t bytesProcessed() const { return m_bytesProcessed; }
+    const std::string& label() const { return m_label; }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    void finishTiming();
+
+    std::int64_t m_maxIterations;
+    std::int64_t m_remaining = 0;
+    std::vector<std::int64_t> m_args;
+    bool m_running = false;
+    Clock::time_point m_realStart;
+    std::clock_t m_cpuStart = 0;
+    double m_realSeconds = 0.0;
+    double m_cpuSeconds = 0.0;
+    std::int64_t m_itemsProcessed = 0;
+    std::int64_t m_bytesProcessed = 0;
+    std::string m_label;
+  };
+
+  using BenchmarkFunction = std::function<void(State&)>;
+
+  /// A registered benchmark. The setters return this so registrations can be chained.
+  class Benchmark
+  {
+  public:
+    Benchmark(std::string name, BenchmarkFunction function);
+
+    Benchmark* Arg(std::int64_t value);
+    Benchmark* Args(std::vector<std::int64_t> values);
+    /// Adds arguments low, low*8, low*64, ... up to and including high.
+    Benchmark* Range(std::int64_t low, std::int64_t high);
+
+    const std::string& name() const { return m_name; }
+    const BenchmarkFunction& function() const { return m_function; }
+    const std::vector<std::vector<std::int64_t>>& argSets() const { return m_argSets; }
+
+  private:
+    std::string m_name;
+    BenchmarkFunction m_function;
+    std::vector<std::vector<std::int64_t>> m_argSets;
+  };
+
+  Benchmark* RegisterBenchmark(std::string name, BenchmarkFunction function);
+
+  /// Adds a key/value pair to the "context" object of the JSON output.
+  void AddCustomContext(const std::string& key, const std::string& value);
+
+  /// Parses --benchmark_filter, --benchmark_min_time, --benchmark_out and --benchmark_format,
+  /// runs the matching benchmarks and returns the process exit code.
+  int RunSpecifiedBenchmarks(int argc, char** argv);
+
+  template <class T>
+  inline void DoNotOptimize(T const& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    // Publishing the address makes the value observable without copying it into a register.
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#endif
+  }
+
+  inline void ClobberMemory()
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    _ReadWriteBarrier();
+#endif
+  }
+}
+
+#define CWAPI3D_BENCHMARK_CONCAT_(a, b) a##b
+#define CWAPI3D_BENCHMARK_CONCAT(a, b) CWAPI3D_BENCHMARK_CONCAT_(a, b)
+
+/// Registers a function void(State&) under its own name.
+#define CWAPI3D_BENCHMARK(function)                                                                                 \
+  static ::CwAPI3D::Net::Bridge::Benchmarks::Benchmark* CWAPI3D_BENCHMARK_CONCAT(benchmarkRegistration_, __LINE__) = \
+    ::CwAPI3D::Net::Bridge::Benchmarks::RegisterBenchmark(#function, function)
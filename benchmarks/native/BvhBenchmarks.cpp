@@ -0,0 +1,205 @@
+// Benchmarks for the bounding-volume hierarchy behind ElementBoundsTree: building it serially and on all cores,
+// and the box, nearest, ray and half-space queries against the linear scan over every element's bounds that a
+// caller iterating GetAllIdentifiableElementIDs would otherwise run.
+#include "Benchmark.h"
+
+#include <native/Bvh.h>
+
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+  using Core::Vec3d;
+  using Native::Aabb;
+  using Native::Bvh;
+
+  /// Bounds of `count` beams and panels scattered over a building-sized volume: mostly long thin boxes along one
+  /// axis, as a timber frame produces, with IDs 1..count.
+  struct Model
+  {
+    explicit Model(std::size_t count)
+    {
+      std::mt19937 random(7);
+      const double side = 1000.0 * std::cbrt(static_cast<double>(count));
+      std::uniform_real_distribution<double> position(0.0, side);
+      std::uniform_real_distribution<double> length(500.0, 6000.0);
+      std::uniform_int_distribution<int> axis(0, 2);
+      ids.resize(count);
+      boxes.resize(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        ids[i] = static_cast<std::int32_t>(i + 1);
+        const Vec3d start{position(random), position(random), position(random)};
+        Vec3d extent{120.0, 240.0, 120.0};
+        switch (axis(random))
+        {
+        case 0: extent.x = length(random); break;
+        case 1: extent.y = length(random); break;
+        default: extent.z = length(random); break;
+        }
+        boxes[i] = Aabb{start, start + extent};
+      }
+      bounds = side;
+    }
+
+    std::vector<std::int32_t> ids;
+    std::vector<Aabb> boxes;
+    double bounds = 0.0;
+  };
+
+  /// One model and tree per element count, shared by the query benchmarks.
+  struct Fixture
+  {
+    explicit Fixture(std::size_t count) : model(count), tree(Bvh::build(model.ids.data(), model.boxes.data(), count, true)) {}
+
+    Model model;
+    Bvh tree;
+  };
+
+  Fixture& fixtureFor(std::int64_t count)
+  {
+    static std::map<std::int64_t, std::unique_ptr<Fixture>> fixtures;
+    auto& fixture = fixtures[count];
+    if (!fixture)
+      fixture = std::make_unique<Fixture>(static_cast<std::size_t>(count));
+    return *fixture;
+  }
+
+  /// Query points spread over the model, the same sequence for every benchmark.
+  std::vector<Vec3d> queryPoints(double side)
+  {
+    std::mt19937 random(11);
+    std::uniform_real_distribution<double> position(0.0, side);
+    std::vector<Vec3d> points(1024);
+    for (Vec3d& point : points)
+      point = {position(random), position(random), position(random)};
+    return points;
+  }
+
+  bool overlaps(const Aabb& a, const Aabb& b)
+  {
+    return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y &&
+           a.min.z <= b.max.z && b.min.z <= a.max.z;
+  }
+
+  void BM_Bvh_Build(State& state)
+  {
+    const Model model(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+      DoNotOptimize(Bvh::build(model.ids.data(), model.boxes.data(), model.ids.size(), false).nodeCount());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Bvh_BuildParallel(State& state)
+  {
+    const Model model(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+      DoNotOptimize(Bvh::build(model.ids.data(), model.boxes.data(), model.ids.size(), true).nodeCount());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  /// A 5 m cube around each query point, e.g. a clash pre-filter around one element.
+  Aabb queryBox(const Vec3d& point)
+  {
+    return Aabb{point - Vec3d{2500.0, 2500.0, 2500.0}, point + Vec3d{2500.0, 2500.0, 2500.0}};
+  }
+
+  void BM_Bvh_QueryBox(State& state)
+  {
+    const Fixture& fixture = fixtureFor(state.range(0));
+    const std::vector<Vec3d> points = queryPoints(fixture.model.bounds);
+    std::vector<std::int32_t> found;
+    std::size_t next = 0;
+    for (auto _ : state)
+    {
+      found.clear();
+      fixture.tree.queryBox(queryBox(points[next++ % points.size()]), found);
+      DoNotOptimize(found.size());
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Bvh_QueryBoxLinear(State& state)
+  {
+    const Fixture& fixture = fixtureFor(state.range(0));
+    const std::vector<Vec3d> points = queryPoints(fixture.model.bounds);
+    std::vector<std::int32_t> found;
+    std::size_t next = 0;
+    for (auto _ : state)
+    {
+      found.clear();
+      const Aabb box = queryBox(points[next++ % points.size()]);
+      for (std::size_t i = 0; i < fixture.model.boxes.size(); ++i)
+      {
+        if (overlaps(fixture.model.boxes[i], box))
+          found.push_back(fixture.model.ids[i]);
+      }
+      DoNotOptimize(found.size());
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Bvh_Nearest(State& state)
+  {
+    const Fixture& fixture = fixtureFor(state.range(0));
+    const std::vector<Vec3d> points = queryPoints(fixture.model.bounds);
+    std::size_t next = 0;
+    for (auto _ : state)
+    {
+      std::int32_t id = 0;
+      double distance = 0.0;
+      DoNotOptimize(fixture.tree.nearest(points[next++ % points.size()], INFINITY, id, distance));
+      DoNotOptimize(id);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Bvh_RayCast(State& state)
+  {
+    const Fixture& fixture = fixtureFor(state.range(0));
+    const std::vector<Vec3d> points = queryPoints(fixture.model.bounds);
+    // Picking rays from a view above the model, tilted so they cross many boxes.
+    const Vec3d direction = Vec3d{0.3, 0.2, -1.0} / std::sqrt(0.09 + 0.04 + 1.0);
+    std::size_t next = 0;
+    for (auto _ : state)
+    {
+      Vec3d origin = points[next++ % points.size()];
+      origin.z = fixture.model.bounds + 1000.0;
+      Bvh::RayHit hit{};
+      DoNotOptimize(fixture.tree.rayCast(origin, direction, INFINITY, hit));
+      DoNotOptimize(hit.id);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Bvh_HalfSpaceStraddling(State& state)
+  {
+    const Fixture& fixture = fixtureFor(state.range(0));
+    // A cutting plane through the middle of the model, e.g. for a section view.
+    const auto plane = Core::Planed::fromPointNormal(Vec3d{0.0, 0.0, fixture.model.bounds / 2}, Vec3d{0.1, 0.0, 1.0});
+    std::vector<std::int32_t> found;
+    for (auto _ : state)
+    {
+      found.clear();
+      fixture.tree.queryHalfSpace(*plane, Bvh::HalfSpaceMode::Straddling, found);
+      DoNotOptimize(found.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+}
+
+CWAPI3D_BENCHMARK(BM_Bvh_Build)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Bvh_BuildParallel)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Bvh_QueryBox)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Bvh_QueryBoxLinear)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Bvh_Nearest)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Bvh_RayCast)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Bvh_HalfSpaceStraddling)->Arg(100'000)->Arg(1'000'000);
@@ -0,0 +1,126 @@
+// Benchmarks for the polygon clipping behind PolygonClipping: panel outlines clipped against one cut plane and
+// against the six planes of a box, against clipping each outline in its own freshly allocated vertex list.
+#include "Benchmark.h"
+
+#include <core/Vec3.h>
+#include <native/PolygonClipping.h>
+#include <native/SoaBuffer.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+  using Core::Vec3d;
+  using Native::Kernels::PlaneCoefficients;
+
+  /// `count` convex panel outlines of 4 to 12 vertices, scattered over a 100 m cube in random orientations.
+  struct Panels
+  {
+    explicit Panels(std::size_t count)
+    {
+      std::mt19937 random(5);
+      std::uniform_real_distribution<double> position(0.0, 100000.0);
+      std::uniform_real_distribution<double> size(500.0, 3000.0);
+      std::uniform_real_distribution<double> unit(-1.0, 1.0);
+      std::uniform_int_distribution<int> corners(4, 12);
+      offsets.push_back(0);
+      for (std::size_t p = 0; p < count; ++p)
+      {
+        const Vec3d centre{position(random), position(random), position(random)};
+        const Vec3d u = Core::normalize(Vec3d{unit(random), unit(random), unit(random)} + Vec3d{0.0, 0.0, 2.0});
+        const Vec3d v = Core::normalize(Core::cross(u, Vec3d{1.0, 0.0, 0.0}));
+        const double radius = size(random);
+        const int n = corners(random);
+        for (int i = 0; i < n; ++i)
+        {
+          const double angle = 2.0 * 3.14159265358979323846 * i / n;
+          const Vec3d vertex = centre + u * (radius * std::cos(angle)) + v * (radius * std::sin(angle));
+          vertices.push_back(vertex.x, vertex.y, vertex.z);
+        }
+        offsets.push_back(static_cast<std::int32_t>(vertices.size()));
+      }
+    }
+
+    Native::SoaBuffer vertices;
+    std::vector<std::int32_t> offsets;
+  };
+
+  /// A cut plane through the middle of the model.
+  const PlaneCoefficients CutPlane{0.6, 0.0, 0.8, -70000.0};
+
+  /// The inward-facing faces of a box over the middle of the model.
+  const PlaneCoefficients BoxPlanes[] = {
+    {1.0, 0.0, 0.0, -25000.0}, {-1.0, 0.0, 0.0, 75000.0},
+    {0.0, 1.0, 0.0, -25000.0}, {0.0, -1.0, 0.0, 75000.0},
+    {0.0, 0.0, 1.0, -25000.0}, {0.0, 0.0, -1.0, 75000.0},
+  };
+
+  void clipBenchmark(State& state, const PlaneCoefficients* planes, std::size_t planeCount)
+  {
+    const Panels panels(static_cast<std::size_t>(state.range(0)));
+    const std::size_t polygonCount = panels.offsets.size() - 1;
+    Native::SoaBuffer out;
+    std::vector<std::int32_t> outOffsets(panels.offsets.size());
+    for (auto _ : state)
+    {
+      DoNotOptimize(Native::Kernels::clipPolygons(panels.vertices.view(), panels.offsets.data(), polygonCount,
+        planes, planeCount, 1e-10, out, outOffsets.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Clip_OnePlane(State& state)
+  {
+    clipBenchmark(state, &CutPlane, 1);
+  }
+
+  void BM_Clip_Box(State& state)
+  {
+    clipBenchmark(state, BoxPlanes, 6);
+  }
+
+  /// Clipping one outline at a time, each in its own list, as a caller holding a Point3D list per panel does.
+  void BM_Clip_OnePlanePerPolygon(State& state)
+  {
+    const Panels panels(static_cast<std::size_t>(state.range(0)));
+    const std::size_t polygonCount = panels.offsets.size() - 1;
+    const auto& plane = CutPlane;
+    for (auto _ : state)
+    {
+      std::vector<std::vector<Vec3d>> results;
+      for (std::size_t p = 0; p < polygonCount; ++p)
+      {
+        std::vector<Vec3d> polygon;
+        for (std::int32_t i = panels.offsets[p]; i < panels.offsets[p + 1]; ++i)
+          polygon.push_back(Vec3d{panels.vertices.x()[i], panels.vertices.y()[i], panels.vertices.z()[i]});
+
+        std::vector<Vec3d> clipped;
+        for (std::size_t i = 0; i < polygon.size(); ++i)
+        {
+          const Vec3d& a = polygon[i];
+          const Vec3d& b = polygon[(i + 1) % polygon.size()];
+          const double da = plane.nx * a.x + plane.ny * a.y + plane.nz * a.z + plane.d;
+          const double db = plane.nx * b.x + plane.ny * b.y + plane.nz * b.z + plane.d;
+          if (da >= 0.0)
+            clipped.push_back(a);
+          if ((da >= 0.0) != (db >= 0.0))
+            clipped.push_back(a + (b - a) * (da / (da - db)));
+        }
+        results.push_back(std::move(clipped));
+      }
+      DoNotOptimize(results.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+}
+
+CWAPI3D_BENCHMARK(BM_Clip_OnePlane)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+CWAPI3D_BENCHMARK(BM_Clip_Box)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+CWAPI3D_BENCHMARK(BM_Clip_OnePlanePerPolygon)->Arg(1'000)->Arg(10'000)->Arg(100'000);
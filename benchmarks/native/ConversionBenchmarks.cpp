@@ -0,0 +1,132 @@
+// Benchmarks for the copies the bridge performs when crossing between layouts: vector3D arrays (the layout
+// of Point3DValue::CopyToNative/FromNative) to and from structure-of-arrays buffers (PointBuffer::FromArray/CopyTo),
+// and element ID lists read into a growing list one element at a time (the original ConvertToManagedList) versus
+// copied into a presized buffer by Interop::Detail::copyElementIds, both against the mock list.
+#include "Benchmark.h"
+
+#include <interop/ElementIdListInteropImpl.h>
+#include <mock/MockElementIdList.h>
+#include <native/SoaBuffer.h>
+
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::ClobberMemory;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+
+  constexpr std::int64_t MinCount = 64;
+  constexpr std::int64_t MaxCount = 1 << 20;
+
+  /// Same layout as CwAPI3D::vector3D.
+  struct Vector3D
+  {
+    double x;
+    double y;
+    double z;
+  };
+
+  void BM_Conversion_AosToNative(State& state)
+  {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    std::vector<Vector3D> source(count, Vector3D{1.0, 2.0, 3.0});
+    std::vector<Vector3D> destination(count);
+    for (auto _ : state)
+    {
+      std::memcpy(destination.data(), source.data(), count * sizeof(Vector3D));
+      ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(Vector3D)));
+  }
+
+  void BM_Conversion_AosToSoa(State& state)
+  {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    std::vector<Vector3D> source(count, Vector3D{1.0, 2.0, 3.0});
+    Native::SoaBuffer destination(count);
+    destination.resize(count);
+    for (auto _ : state)
+    {
+      double* x = destination.x();
+      double* y = destination.y();
+      double* z = destination.z();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        x[i] = source[i].x;
+        y[i] = source[i].y;
+        z[i] = source[i].z;
+      }
+      ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Conversion_SoaToAos(State& state)
+  {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    Native::SoaBuffer source(count);
+    source.resize(count);
+    std::vector<Vector3D> destination(count);
+    for (auto _ : state)
+    {
+      const double* x = source.x();
+      const double* y = source.y();
+      const double* z = source.z();
+      for (std::size_t i = 0; i < count; ++i)
+        destination[i] = Vector3D{x[i], y[i], z[i]};
+      ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  /// A mock list holding IDs 1..count.
+  Mock::MockElementIdList makeIdList(std::size_t count)
+  {
+    std::vector<Mock::ElementId> ids(count);
+    std::iota(ids.begin(), ids.end(), Mock::ElementId{1});
+    return Mock::MockElementIdList(std::move(ids));
+  }
+
+  /// The original ConvertToManagedList: a new List<int> grown by one Add per at(i).
+  void BM_Conversion_IdListAdd(State& state)
+  {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    Mock::MockElementIdList list = makeIdList(count);
+    for (auto _ : state)
+    {
+      std::vector<std::int32_t> managed;
+      const std::uint64_t size = list.count();
+      for (std::uint64_t i = 0; i < size; ++i)
+        managed.push_back(static_cast<std::int32_t>(list.at(i)));
+      DoNotOptimize(managed.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  /// What the bridge does now: Interop::Detail::copyElementIds into a buffer sized from count().
+  void BM_Conversion_IdListCopy(State& state)
+  {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    Mock::MockElementIdList list = makeIdList(count);
+    for (auto _ : state)
+    {
+      std::vector<std::int32_t> managed(Interop::Detail::elementIdCount(&list));
+      DoNotOptimize(Interop::Detail::copyElementIds(&list, managed.data(), static_cast<std::uint32_t>(managed.size())));
+      DoNotOptimize(managed.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+}
+
+CWAPI3D_BENCHMARK(BM_Conversion_AosToNative)->Range(MinCount, MaxCount);
+CWAPI3D_BENCHMARK(BM_Conversion_AosToSoa)->Range(MinCount, MaxCount);
+CWAPI3D_BENCHMARK(BM_Conversion_SoaToAos)->Range(MinCount, MaxCount);
+CWAPI3D_BENCHMARK(BM_Conversion_IdListAdd)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Conversion_IdListCopy)->Arg(1'000)->Arg(100'000)->Arg(1'000'000);
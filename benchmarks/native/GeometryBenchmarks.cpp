@@ -0,0 +1,214 @@
+// Benchmarks for the core math that Vector3D, Point3D and Plane3D (and their value-type variants) forward to.
+// Each iteration processes a fixed batch of inputs so the compiler cannot fold the work into constants.
+#include "Benchmark.h"
+
+#include <core/Geometry.h>
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+
+  constexpr std::size_t BatchSize = 256;
+
+  struct Inputs
+  {
+    std::array<Core::Vec3d, BatchSize> a;
+    std::array<Core::Vec3d, BatchSize> b;
+    std::array<Core::Vec3d, BatchSize> c;
+    std::array<double, BatchSize> scalars;
+    std::vector<Core::Planed> planes;
+  };
+
+  Core::Planed makePlane(std::mt19937& random)
+  {
+    std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+    for (;;)
+    {
+      const Core::Vec3d point{coordinate(random), coordinate(random), coordinate(random)};
+      const Core::Vec3d normal{coordinate(random), coordinate(random), coordinate(random)};
+      if (auto plane = Core::Planed::fromPointNormal(point, normal))
+        return *plane;
+    }
+  }
+
+  const Inputs& inputs()
+  {
+    static const Inputs data = [] {
+      std::mt19937 random(42);
+      std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+      std::uniform_real_distribution<double> scalar(0.5, 2.0);
+      Inputs result{};
+      result.planes.reserve(BatchSize);
+      for (std::size_t i = 0; i < BatchSize; ++i)
+      {
+        result.a[i] = {coordinate(random), coordinate(random), coordinate(random)};
+        result.b[i] = {coordinate(random), coordinate(random), coordinate(random)};
+        result.c[i] = {coordinate(random), coordinate(random), coordinate(random)};
+        result.scalars[i] = scalar(random);
+        result.planes.push_back(makePlane(random));
+      }
+      return result;
+    }();
+    return data;
+  }
+
+  template <class Operation>
+  void runBatch(State& state, Operation operation)
+  {
+    const Inputs& data = inputs();
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < BatchSize; ++i)
+        DoNotOptimize(operation(data, i));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BatchSize));
+  }
+
+  void BM_Vector_Add(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.a[i] + d.b[i]; });
+  }
+
+  void BM_Vector_Subtract(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.a[i] - d.b[i]; });
+  }
+
+  void BM_Vector_Multiply(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.a[i] * d.scalars[i]; });
+  }
+
+  void BM_Vector_Divide(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.a[i] / d.scalars[i]; });
+  }
+
+  void BM_Vector_Negate(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return -d.a[i]; });
+  }
+
+  void BM_Vector_DotProduct(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::dot(d.a[i], d.b[i]); });
+  }
+
+  void BM_Vector_CrossProduct(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::cross(d.a[i], d.b[i]); });
+  }
+
+  void BM_Vector_Magnitude(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::magnitude(d.a[i]); });
+  }
+
+  void BM_Vector_Normalize(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::normalize(d.a[i]); });
+  }
+
+  void BM_Vector_AngleTo(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::angle(d.a[i], d.b[i]); });
+  }
+
+  void BM_Vector_Equals(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::approxEqual(d.a[i], d.b[i]); });
+  }
+
+  void BM_Point_DistanceTo(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::distance(d.a[i], d.b[i]); });
+  }
+
+  void BM_Point_DistanceSquaredTo(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::distanceSquared(d.a[i], d.b[i]); });
+  }
+
+  void BM_Plane_FromPointNormal(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::Planed::fromPointNormal(d.a[i], d.b[i]); });
+  }
+
+  void BM_Plane_FromPoints(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return Core::Planed::fromPoints(d.a[i], d.b[i], d.c[i]); });
+  }
+
+  void BM_Plane_FromCoefficients(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) {
+      return Core::Planed::fromCoefficients(d.a[i].x, d.a[i].y, d.a[i].z, d.scalars[i]);
+    });
+  }
+
+  void BM_Plane_DistanceTo(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.planes[i].distanceTo(d.a[i]); });
+  }
+
+  void BM_Plane_ContainsPoint(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.planes[i].contains(d.a[i]); });
+  }
+
+  void BM_Plane_ProjectPoint(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.planes[i].project(d.a[i]); });
+  }
+
+  void BM_Plane_IntersectLine(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.planes[i].intersectSegment(d.a[i], d.b[i]); });
+  }
+
+  void BM_Plane_IsParallelTo(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.planes[i].isParallelTo(d.planes[BatchSize - 1 - i]); });
+  }
+
+  void BM_Plane_IntersectPlane(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.planes[i].intersect(d.planes[BatchSize - 1 - i]); });
+  }
+
+  void BM_Plane_Equals(State& state)
+  {
+    runBatch(state, [](const Inputs& d, std::size_t i) { return d.planes[i].approxEquals(d.planes[BatchSize - 1 - i]); });
+  }
+}
+
+CWAPI3D_BENCHMARK(BM_Vector_Add);
+CWAPI3D_BENCHMARK(BM_Vector_Subtract);
+CWAPI3D_BENCHMARK(BM_Vector_Multiply);
+CWAPI3D_BENCHMARK(BM_Vector_Divide);
+CWAPI3D_BENCHMARK(BM_Vector_Negate);
+CWAPI3D_BENCHMARK(BM_Vector_DotProduct);
+CWAPI3D_BENCHMARK(BM_Vector_CrossProduct);
+CWAPI3D_BENCHMARK(BM_Vector_Magnitude);
+CWAPI3D_BENCHMARK(BM_Vector_Normalize);
+CWAPI3D_BENCHMARK(BM_Vector_AngleTo);
+CWAPI3D_BENCHMARK(BM_Vector_Equals);
+CWAPI3D_BENCHMARK(BM_Point_DistanceTo);
+CWAPI3D_BENCHMARK(BM_Point_DistanceSquaredTo);
+CWAPI3D_BENCHMARK(BM_Plane_FromPointNormal);
+CWAPI3D_BENCHMARK(BM_Plane_FromPoints);
+CWAPI3D_BENCHMARK(BM_Plane_FromCoefficients);
+CWAPI3D_BENCHMARK(BM_Plane_DistanceTo);
+CWAPI3D_BENCHMARK(BM_Plane_ContainsPoint);
+CWAPI3D_BENCHMARK(BM_Plane_ProjectPoint);
+CWAPI3D_BENCHMARK(BM_Plane_IntersectLine);
+CWAPI3D_BENCHMARK(BM_Plane_IsParallelTo);
+CWAPI3D_BENCHMARK(BM_Plane_IntersectPlane);
+CWAPI3D_BENCHMARK(BM_Plane_Equals);
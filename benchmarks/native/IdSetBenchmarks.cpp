@@ -0,0 +1,167 @@
+// Benchmarks for the compressed ID set behind ElementIdSet: building a set from a query result and combining two
+// query results, against the sorted-vector and hash-set code a managed caller would otherwise run. Dense inputs
+// (IDs drawn from a contiguous range, as in a real model) exercise the SIMD bitmap kernels once per instruction set;
+// sparse inputs exercise the sorted-array containers.
+#include "Benchmark.h"
+
+#include <native/IdSet.h>
+#include <native/SoaKernels.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+  using Native::Kernels::SimdLevel;
+
+  /// About `count` IDs picked at random from [0, range), in random order, like a visibility or activity query.
+  std::vector<std::uint32_t> randomIds(std::size_t count, std::uint32_t range, unsigned seed)
+  {
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<std::uint32_t> id(0, range - 1);
+    std::vector<std::uint32_t> ids(count);
+    for (std::uint32_t& value : ids)
+      value = id(random);
+    return ids;
+  }
+
+  /// Two overlapping query results over a model of `count` elements. Dense results pick 70% and 40% of the
+  /// IDs; sparse results spread the same number of IDs over the whole 31-bit range.
+  struct SetData
+  {
+    SetData(std::size_t count, bool dense)
+    {
+      const std::uint32_t range = dense ? static_cast<std::uint32_t>(count) : 0x7fffffffu;
+      first = randomIds(count * 7 / 10, range, 1);
+      second = randomIds(count * 4 / 10, range, 2);
+      a.addMany(first.data(), first.size());
+      b.addMany(second.data(), second.size());
+    }
+
+    std::vector<std::uint32_t> first;
+    std::vector<std::uint32_t> second;
+    Native::IdSet a;
+    Native::IdSet b;
+  };
+
+  const char* levelName(SimdLevel level)
+  {
+    switch (level)
+    {
+    case SimdLevel::Avx2: return "avx2";
+    case SimdLevel::Sse2: return "sse2";
+    default: return "scalar";
+    }
+  }
+
+  template <class Operation>
+  void registerSetOperation(const std::string& name, Operation operation)
+  {
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2})
+    {
+      const SimdLevel previous = Native::Kernels::activeSimdLevel();
+      const bool available = Native::Kernels::setSimdLevel(level) == level;
+      Native::Kernels::setSimdLevel(previous);
+      if (!available)
+        continue;
+
+      Benchmarks::RegisterBenchmark("BM_IdSet_" + name + "/" + levelName(level), [level, operation](State& state) {
+        SetData data(static_cast<std::size_t>(state.range(0)), true);
+        const SimdLevel previous = Native::Kernels::setSimdLevel(level);
+        for (auto _ : state)
+          DoNotOptimize(operation(data.a, data.b).size());
+        Native::Kernels::setSimdLevel(previous);
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.a.size() + data.b.size()));
+      })->Arg(50000)->Arg(500000);
+    }
+  }
+
+  const bool registered = [] {
+    registerSetOperation("Intersect", [](const Native::IdSet& a, const Native::IdSet& b) { return Native::IdSet::intersectionOf(a, b); });
+    registerSetOperation("Union", [](const Native::IdSet& a, const Native::IdSet& b) { return Native::IdSet::unionOf(a, b); });
+    registerSetOperation("Difference", [](const Native::IdSet& a, const Native::IdSet& b) { return Native::IdSet::differenceOf(a, b); });
+    return true;
+  }();
+
+  void BM_IdSet_IntersectSparse(State& state)
+  {
+    SetData data(static_cast<std::size_t>(state.range(0)), false);
+    for (auto _ : state)
+      DoNotOptimize(Native::IdSet::intersectionOf(data.a, data.b).size());
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.a.size() + data.b.size()));
+  }
+  CWAPI3D_BENCHMARK(BM_IdSet_IntersectSparse)->Arg(50000)->Arg(500000);
+
+  void BM_IdSet_FromIds(State& state)
+  {
+    const std::vector<std::uint32_t> ids = randomIds(static_cast<std::size_t>(state.range(0)), static_cast<std::uint32_t>(state.range(0)), 3);
+    for (auto _ : state)
+    {
+      Native::IdSet set;
+      set.addMany(ids.data(), ids.size());
+      DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+  CWAPI3D_BENCHMARK(BM_IdSet_FromIds)->Arg(50000)->Arg(500000);
+
+  void BM_IdSet_Contains(State& state)
+  {
+    SetData data(static_cast<std::size_t>(state.range(0)), true);
+    std::size_t found = 0;
+    for (auto _ : state)
+    {
+      for (const std::uint32_t id : data.second)
+        found += data.a.contains(id) ? 1 : 0;
+    }
+    DoNotOptimize(found);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.second.size()));
+  }
+  CWAPI3D_BENCHMARK(BM_IdSet_Contains)->Arg(50000)->Arg(500000);
+
+  // Baselines: what combining two List<int> query results costs without the set, i.e. sorting both and merging,
+  // or LINQ's Intersect, which hashes one side.
+  void BM_SortedVector_Intersect(State& state)
+  {
+    SetData data(static_cast<std::size_t>(state.range(0)), true);
+    std::vector<std::uint32_t> out;
+    for (auto _ : state)
+    {
+      std::vector<std::uint32_t> first = data.first;
+      std::vector<std::uint32_t> second = data.second;
+      std::sort(first.begin(), first.end());
+      std::sort(second.begin(), second.end());
+      out.clear();
+      std::set_intersection(first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(out));
+      DoNotOptimize(out.size());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.first.size() + data.second.size()));
+  }
+  CWAPI3D_BENCHMARK(BM_SortedVector_Intersect)->Arg(50000)->Arg(500000);
+
+  void BM_HashSet_Intersect(State& state)
+  {
+    SetData data(static_cast<std::size_t>(state.range(0)), true);
+    std::vector<std::uint32_t> out;
+    for (auto _ : state)
+    {
+      std::unordered_set<std::uint32_t> second(data.second.begin(), data.second.end());
+      out.clear();
+      for (const std::uint32_t id : data.first)
+      {
+        if (second.erase(id) != 0)
+          out.push_back(id);
+      }
+      DoNotOptimize(out.size());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.first.size() + data.second.size()));
+  }
+  CWAPI3D_BENCHMARK(BM_HashSet_Intersect)->Arg(50000)->Arg(500000);
+}
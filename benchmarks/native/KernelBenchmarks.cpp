@@ -0,0 +1,115 @@
+// Benchmarks for the structure-of-arrays batch kernels behind PointBuffer, VectorBuffer, Plane3D::Classify and
+// SegmentPlaneIntersection, once per instruction set the CPU supports.
+#include "Benchmark.h"
+
+#include <native/SoaBuffer.h>
+#include <native/SoaKernels.h>
+
+#include <memory>
+#include <random>
+#include <string>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+  using Native::Kernels::SimdLevel;
+
+  constexpr std::int64_t MinCount = 64;
+  constexpr std::int64_t MaxCount = 1 << 20;
+
+  Native::SoaBuffer randomBuffer(std::size_t count, unsigned seed)
+  {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+    Native::SoaBuffer buffer(count);
+    for (std::size_t i = 0; i < count; ++i)
+      buffer.push_back(coordinate(random), coordinate(random), coordinate(random));
+    return buffer;
+  }
+
+  const char* levelName(SimdLevel level)
+  {
+    switch (level)
+    {
+    case SimdLevel::Avx2: return "avx2";
+    case SimdLevel::Sse2: return "sse2";
+    default: return "scalar";
+    }
+  }
+
+  /// Inputs shared by all kernels for one element count.
+  struct KernelData
+  {
+    explicit KernelData(std::size_t count)
+      : a(randomBuffer(count, 1)), b(randomBuffer(count, 2)), out(count), scalars(new double[count]),
+        hits(new bool[count]), sides(new Native::Kernels::PlaneSide[count])
+    {
+      out.resize(count);
+    }
+
+    Native::SoaBuffer a;
+    Native::SoaBuffer b;
+    Native::SoaBuffer out;
+    std::unique_ptr<double[]> scalars;
+    std::unique_ptr<bool[]> hits;
+    std::unique_ptr<Native::Kernels::PlaneSide[]> sides;
+  };
+
+  template <class Kernel>
+  void registerKernel(const std::string& name, Kernel kernel)
+  {
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2})
+    {
+      // Skip levels this CPU cannot run; setSimdLevel reports the level actually applied.
+      const SimdLevel previous = Native::Kernels::activeSimdLevel();
+      const bool available = Native::Kernels::setSimdLevel(level) == level;
+      Native::Kernels::setSimdLevel(previous);
+      if (!available)
+        continue;
+
+      Benchmarks::RegisterBenchmark("BM_Kernel_" + name + "/" + levelName(level), [level, kernel](State& state) {
+        const std::size_t count = static_cast<std::size_t>(state.range(0));
+        KernelData data(count);
+        const SimdLevel previous = Native::Kernels::setSimdLevel(level);
+        for (auto _ : state)
+          kernel(data);
+        Native::Kernels::setSimdLevel(previous);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+      })->Range(MinCount, MaxCount);
+    }
+  }
+
+  const bool registered = [] {
+    const Native::Kernels::PlaneCoefficients plane{0.6, 0.0, 0.8, -10.0};
+
+    registerKernel("Add", [](KernelData& d) { Native::Kernels::add(d.a.view(), d.b.view(), d.out.view()); });
+    registerKernel("Subtract", [](KernelData& d) { Native::Kernels::subtract(d.a.view(), d.b.view(), d.out.view()); });
+    registerKernel("Scale", [](KernelData& d) { Native::Kernels::scale(d.a.view(), 1.5, d.out.view()); });
+    registerKernel("Translate", [](KernelData& d) { Native::Kernels::translate(d.a.view(), 1.0, 2.0, 3.0, d.out.view()); });
+    registerKernel("Dot", [](KernelData& d) { Native::Kernels::dot(d.a.view(), d.b.view(), d.scalars.get()); });
+    registerKernel("Cross", [](KernelData& d) { Native::Kernels::cross(d.a.view(), d.b.view(), d.out.view()); });
+    registerKernel("Magnitude", [](KernelData& d) { Native::Kernels::magnitude(d.a.view(), d.scalars.get()); });
+    registerKernel("Normalize", [](KernelData& d) { Native::Kernels::normalize(d.a.view(), 1e-10, d.out.view()); });
+    registerKernel("DistanceToPoint", [](KernelData& d) {
+      Native::Kernels::distanceToPoint(d.a.view(), 1.0, 2.0, 3.0, d.scalars.get());
+    });
+    registerKernel("PlaneDistance", [plane](KernelData& d) {
+      Native::Kernels::planeDistance(d.a.view(), plane.nx, plane.ny, plane.nz, plane.d, d.scalars.get());
+    });
+    registerKernel("PlaneProject", [plane](KernelData& d) {
+      Native::Kernels::planeProject(d.a.view(), plane.nx, plane.ny, plane.nz, plane.d, d.out.view());
+    });
+    registerKernel("PlaneClassify", [plane](KernelData& d) {
+      DoNotOptimize(Native::Kernels::classifyPlane(d.a.view(), plane.nx, plane.ny, plane.nz, plane.d, 1e-10, d.sides.get()).front);
+    });
+    registerKernel("SegmentPlane", [plane](KernelData& d) {
+      DoNotOptimize(Native::Kernels::intersectSegmentsPlane(d.a.view(), d.b.view(), plane, 1e-10, d.hits.get(), d.out.view(), false));
+    });
+    registerKernel("SegmentPlaneParallel", [plane](KernelData& d) {
+      DoNotOptimize(Native::Kernels::intersectSegmentsPlane(d.a.view(), d.b.view(), plane, 1e-10, d.hits.get(), d.out.view(), true));
+    });
+    return true;
+  }();
+}
@@ -0,0 +1,739 @@
+// Scale benchmarks against the in-process mock controller factory: the native half of ElementController's
+// query, move, copy, delete, ID set, beam creation, command batch and filter paths and of the attribute and
+// geometry controllers' bulk reads (marshalling through Interop::Detail plus the controller calls) at up to a
+// million elements.
+#include "Benchmark.h"
+
+#include <interop/AttributeInteropImpl.h>
+#include <interop/BeamCreationInteropImpl.h>
+#include <interop/CommandBatchInteropImpl.h>
+#include <interop/ElementIdListInteropImpl.h>
+#include <interop/ElementFilterInteropImpl.h>
+#include <interop/ElementIdSetInteropImpl.h>
+#include <interop/GeometryInteropImpl.h>
+#include <mock/MockControllerFactory.h>
+#include <native/ElementFilter.h>
+#include <native/ListPool.h>
+#include <native/SoaBuffer.h>
+#include <native/StringTable.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+
+  /// One populated model per element count, shared by all benchmarks; they leave the element count unchanged.
+  Mock::MockControllerFactory& factoryFor(std::int64_t elementCount)
+  {
+    static std::map<std::int64_t, std::unique_ptr<Mock::MockControllerFactory>> factories;
+    auto& factory = factories[elementCount];
+    if (!factory)
+    {
+      factory = std::make_unique<Mock::MockControllerFactory>(static_cast<std::size_t>(elementCount));
+      factory->store().setUndoLimit(0);
+    }
+    return *factory;
+  }
+
+  /// What ElementController::GetVisibleIdentifiableElementIDsInto does below the managed boundary.
+  std::uint32_t queryVisible(Mock::MockControllerFactory& factory, std::vector<std::int32_t>& buffer)
+  {
+    Mock::MockElementIdList* list = factory.getElementController()->getVisibleIdentifiableElementIDs();
+    const std::uint32_t count = Interop::Detail::elementIdCount(list);
+    if (buffer.size() < count)
+      buffer.resize(count);
+    return Interop::Detail::copyElementIds(list, buffer.data(), count);
+  }
+
+  /// What ElementController::ConvertToNativeList does: fill a pooled native list from managed IDs.
+  void fillList(Mock::MockElementIdList& list, const std::vector<std::int32_t>& ids, std::uint32_t count)
+  {
+    list.clear();
+    Interop::Detail::appendElementIds<Mock::MockElementIdList, Mock::ElementId>(&list, ids.data(), count);
+  }
+
+  void BM_Mock_Populate(State& state)
+  {
+    for (auto _ : state)
+    {
+      Mock::MockControllerFactory factory(static_cast<std::size_t>(state.range(0)));
+      DoNotOptimize(factory.store().size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Mock_QueryVisible(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    std::vector<std::int32_t> buffer;
+    for (auto _ : state)
+      DoNotOptimize(queryVisible(factory, buffer));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  /// What enumerating ElementController::EnumerateAllIdentifiableElementIDs does: one reused page of IDs at a time.
+  /// With `stopAt` set, the walk ends at the first ID of at least that value, like a LINQ First() over the result.
+  std::int64_t walkAllPaged(Mock::MockControllerFactory& factory, std::vector<std::int32_t>& page, std::int32_t stopAt)
+  {
+    Mock::MockElementIdList* list = factory.getElementController()->getAllIdentifiableElementIDs();
+    std::int64_t sum = 0;
+    std::uint32_t first = 0;
+    while (const std::uint32_t copied = Interop::Detail::copyElementIdRange(list, first, page.data(),
+                                                                            static_cast<std::uint32_t>(page.size())))
+    {
+      for (std::uint32_t i = 0; i < copied; ++i)
+      {
+        sum += page[i];
+        if (page[i] >= stopAt)
+          return sum;
+      }
+      first += copied;
+    }
+    return sum;
+  }
+
+  void BM_Mock_EnumerateAllArray(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    for (auto _ : state)
+    {
+      Mock::MockElementIdList* list = factory.getElementController()->getAllIdentifiableElementIDs();
+      // GetAllIdentifiableElementIDs materializes the whole result before the caller sees the first ID.
+      std::vector<std::int32_t> ids(Interop::Detail::elementIdCount(list));
+      Interop::Detail::copyElementIds(list, ids.data(), static_cast<std::uint32_t>(ids.size()));
+      std::int64_t sum = 0;
+      for (const std::int32_t id : ids)
+        sum += id;
+      DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Mock_EnumerateAllPaged(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    std::vector<std::int32_t> page(4096);
+    for (auto _ : state)
+      DoNotOptimize(walkAllPaged(factory, page, std::numeric_limits<std::int32_t>::max()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_Mock_EnumerateAllPagedFirst(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    std::vector<std::int32_t> page(4096);
+    for (auto _ : state)
+      DoNotOptimize(walkAllPaged(factory, page, 100));
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Mock_MoveVisible(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    std::vector<std::int32_t> buffer;
+    const std::uint32_t count = queryVisible(factory, buffer);
+    Mock::MockElementIdList list;
+    for (auto _ : state)
+    {
+      fillList(list, buffer, count);
+      factory.getElementController()->moveElement(&list, Core::Vec3d{10.0, 0.0, 0.0});
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+  }
+
+  void BM_Mock_MoveVisibleWithUndo(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    std::vector<std::int32_t> buffer;
+    const std::uint32_t count = queryVisible(factory, buffer);
+    Mock::MockElementIdList list;
+    factory.store().setUndoLimit(1);
+    for (auto _ : state)
+    {
+      fillList(list, buffer, count);
+      factory.getElementController()->moveElement(&list, Core::Vec3d{10.0, 0.0, 0.0});
+      factory.getElementController()->makeUndo();
+    }
+    factory.store().setUndoLimit(0);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+  }
+
+  /// Copies a tenth of the model; the copies are deleted again outside the timed region.
+  void BM_Mock_CopyElements(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    std::vector<std::int32_t> buffer;
+    const std::uint32_t count = queryVisible(factory, buffer) / 10;
+    Mock::MockElementIdList list;
+    std::vector<std::int32_t> copies;
+    Mock::MockElementIdList copyList;
+    for (auto _ : state)
+    {
+      fillList(list, buffer, count);
+      Mock::MockElementIdList* created = factory.getElementController()->copyElements(&list, Core::Vec3d{0.0, 0.0, 500.0});
+      copies.resize(Interop::Detail::elementIdCount(created));
+      Interop::Detail::copyElementIds(created, copies.data(), static_cast<std::uint32_t>(copies.size()));
+
+      state.PauseTiming();
+      fillList(copyList, copies, static_cast<std::uint32_t>(copies.size()));
+      factory.getElementController()->deleteElements(&copyList);
+      state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+  }
+
+  /// Deletes a tenth of the model; the elements to delete are created outside the timed region.
+  void BM_Mock_DeleteElements(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    std::vector<std::int32_t> buffer;
+    const std::uint32_t count = queryVisible(factory, buffer) / 10;
+    Mock::MockElementIdList list;
+    std::vector<std::int32_t> copies;
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      fillList(list, buffer, count);
+      Mock::MockElementIdList* created = factory.getElementController()->copyElements(&list, Core::Vec3d{0.0, 0.0, 500.0});
+      copies.resize(Interop::Detail::elementIdCount(created));
+      Interop::Detail::copyElementIds(created, copies.data(), static_cast<std::uint32_t>(copies.size()));
+      state.ResumeTiming();
+
+      fillList(list, copies, static_cast<std::uint32_t>(copies.size()));
+      factory.getElementController()->deleteElements(&list);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+  }
+
+  /// Visible & active, handed back to the controller as a list: ElementController's ElementIdSet path.
+  void BM_Mock_VisibleActiveSet(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    Mock::MockElementIdList list;
+    for (auto _ : state)
+    {
+      Native::IdSet visible;
+      Native::IdSet active;
+      Interop::Detail::collectElementIds(factory.getElementController()->getVisibleIdentifiableElementIDs(), visible);
+      Interop::Detail::collectElementIds(factory.getElementController()->getActiveIdentifiableElementIDs(), active);
+      visible.intersectWith(active);
+      list.clear();
+      Interop::Detail::appendElementIds<Mock::MockElementIdList, Mock::ElementId>(&list, visible);
+      DoNotOptimize(list.count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  /// The same through managed-style arrays: copy both results out, intersect them and copy the result back in.
+  void BM_Mock_VisibleActiveArrays(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    Mock::MockElementIdList list;
+    std::vector<std::int32_t> visible;
+    std::vector<std::int32_t> active;
+    std::vector<std::int32_t> both;
+    for (auto _ : state)
+    {
+      Mock::MockElementIdList* visibleList = factory.getElementController()->getVisibleIdentifiableElementIDs();
+      Mock::MockElementIdList* activeList = factory.getElementController()->getActiveIdentifiableElementIDs();
+      visible.resize(Interop::Detail::elementIdCount(visibleList));
+      active.resize(Interop::Detail::elementIdCount(activeList));
+      Interop::Detail::copyElementIds(visibleList, visible.data(), static_cast<std::uint32_t>(visible.size()));
+      Interop::Detail::copyElementIds(activeList, active.data(), static_cast<std::uint32_t>(active.size()));
+      std::sort(visible.begin(), visible.end());
+      std::sort(active.begin(), active.end());
+      both.clear();
+      std::set_intersection(visible.begin(), visible.end(), active.begin(), active.end(), std::back_inserter(both));
+      fillList(list, both, static_cast<std::uint32_t>(both.size()));
+      DoNotOptimize(list.count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  /// Beam parameters as a framing generator would produce them, in both point layouts the batch API accepts.
+  struct BeamInputs
+  {
+    explicit BeamInputs(std::size_t count) : widths(count), heights(count), packed(count * 9), soa(9)
+    {
+      std::mt19937 random(7);
+      std::uniform_real_distribution<double> coordinate(-10000.0, 10000.0);
+      for (auto& column : soa)
+        column.resize(count);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        widths[i] = 100.0;
+        heights[i] = 200.0;
+        for (std::size_t c = 0; c < 9; ++c)
+        {
+          packed[i * 9 + c] = coordinate(random);
+          soa[c][i] = packed[i * 9 + c];
+        }
+      }
+    }
+
+    /// Point `point` (0..2) of beam i, as the single-call API receives it: one vector3D per argument.
+    Core::Vec3d vector(std::size_t i, std::size_t point) const
+    {
+      const double* xyz = &packed[i * 9 + point * 3];
+      return Core::Vec3d{xyz[0], xyz[1], xyz[2]};
+    }
+
+    std::vector<double> widths;
+    std::vector<double> heights;
+    /// p1, p2, p3 of every beam as nine packed doubles.
+    std::vector<double> packed;
+    /// x1, y1, z1, x2, ... as separate arrays.
+    std::vector<std::vector<double>> soa;
+  };
+
+  template <class CreateAll>
+  void runBeamCreation(State& state, CreateAll createAll)
+  {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const BeamInputs inputs(count);
+    std::vector<std::int32_t> ids(count);
+    Mock::MockControllerFactory factory;
+    factory.store().setUndoLimit(0);
+    for (auto _ : state)
+    {
+      createAll(*factory.getElementController(), inputs, ids.data());
+
+      state.PauseTiming();
+      factory.store().reset();
+      state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  /// One controller call per beam, each marshalling three vectors: the shape of CreateRectangularBeamPoints.
+  void BM_Mock_CreateBeamsSingle(State& state)
+  {
+    runBeamCreation(state, [](Mock::MockElementController& controller, const BeamInputs& inputs, std::int32_t* ids) {
+      for (std::size_t i = 0; i < inputs.widths.size(); ++i)
+      {
+        ids[i] = static_cast<std::int32_t>(controller.createRectangularBeamPoints(
+          inputs.widths[i], inputs.heights[i], inputs.vector(i, 0), inputs.vector(i, 1), inputs.vector(i, 2)));
+      }
+    });
+  }
+
+  /// Interop::CreateBeams over packed vector3D arrays (CreateRectangularBeams with Vector3DValue arrays).
+  void BM_Mock_CreateBeamsBatchPacked(State& state)
+  {
+    runBeamCreation(state, [](Mock::MockElementController& controller, const BeamInputs& inputs, std::int32_t* ids) {
+      const double* packed = inputs.packed.data();
+      Interop::BeamBatch batch{};
+      batch.profile = Interop::BeamProfile::Rectangular;
+      batch.widths = inputs.widths.data();
+      batch.heights = inputs.heights.data();
+      batch.p1 = {packed + 0, packed + 1, packed + 2, 9u};
+      batch.p2 = {packed + 3, packed + 4, packed + 5, 9u};
+      batch.p3 = {packed + 6, packed + 7, packed + 8, 9u};
+      batch.count = static_cast<std::uint32_t>(inputs.widths.size());
+      Interop::Detail::createBeams(&controller, batch, ids, [](double x, double y, double z) { return Core::Vec3d{x, y, z}; });
+    });
+  }
+
+  /// Interop::CreateBeams over separate coordinate arrays (CreateRectangularBeams with PointBuffers).
+  void BM_Mock_CreateBeamsBatchSoa(State& state)
+  {
+    runBeamCreation(state, [](Mock::MockElementController& controller, const BeamInputs& inputs, std::int32_t* ids) {
+      const auto& soa = inputs.soa;
+      Interop::BeamBatch batch{};
+      batch.profile = Interop::BeamProfile::Rectangular;
+      batch.widths = inputs.widths.data();
+      batch.heights = inputs.heights.data();
+      batch.p1 = {soa[0].data(), soa[1].data(), soa[2].data(), 1u};
+      batch.p2 = {soa[3].data(), soa[4].data(), soa[5].data(), 1u};
+      batch.p3 = {soa[6].data(), soa[7].data(), soa[8].data(), 1u};
+      batch.count = static_cast<std::uint32_t>(inputs.widths.size());
+      Interop::Detail::createBeams(&controller, batch, ids, [](double x, double y, double z) { return Core::Vec3d{x, y, z}; });
+    });
+  }
+
+  /// One recorded call of a batch script.
+  struct ScriptStep
+  {
+    Native::CommandKind kind;
+    std::vector<std::int32_t> ids;
+    Core::Vec3d vector;
+  };
+
+  /// A nightly-script shape: per group of eight elements, two moves, two overlapping joins, a copy of two elements
+  /// and a move of two elements that are deleted right after.
+  std::vector<ScriptStep> batchScript(const std::vector<std::int32_t>& ids, std::size_t groups)
+  {
+    std::vector<ScriptStep> script;
+    for (std::size_t g = 0; g < groups; ++g)
+    {
+      const auto group = ids.begin() + static_cast<std::ptrdiff_t>(g * 8);
+      const auto slice = [&group](std::ptrdiff_t first, std::ptrdiff_t last) { return std::vector<std::int32_t>(group + first, group + last); };
+      script.push_back({Native::CommandKind::Move, slice(0, 8), Core::Vec3d{10.0, 0.0, 0.0}});
+      script.push_back({Native::CommandKind::Move, slice(0, 8), Core::Vec3d{0.0, 10.0, 0.0}});
+      script.push_back({Native::CommandKind::Join, slice(0, 5), Core::Vec3d{}});
+      script.push_back({Native::CommandKind::Join, slice(4, 8), Core::Vec3d{}});
+      script.push_back({Native::CommandKind::Copy, slice(0, 2), Core::Vec3d{0.0, 0.0, 500.0}});
+      script.push_back({Native::CommandKind::Move, slice(6, 8), Core::Vec3d{0.0, 0.0, 10.0}});
+      script.push_back({Native::CommandKind::Delete, slice(6, 8), Core::Vec3d{}});
+    }
+    return script;
+  }
+
+  template <class RunScript>
+  void runScript(State& state, RunScript runAll)
+  {
+    const std::size_t groups = static_cast<std::size_t>(state.range(0));
+    std::uint32_t calls = 0;
+    std::size_t steps = 0;
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      Mock::MockControllerFactory factory(groups * 10);
+      factory.store().setUndoLimit(0);
+      std::vector<std::int32_t> ids;
+      queryVisible(factory, ids);
+      const std::vector<ScriptStep> script = batchScript(ids, groups);
+      steps = script.size();
+      state.ResumeTiming();
+
+      calls = runAll(*factory.getElementController(), script);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(steps));
+    state.SetLabel("controller calls: " + std::to_string(calls) + " for " + std::to_string(steps) + " steps");
+  }
+
+  /// Every step straight to the controller, as a script calling ElementController does.
+  void BM_Mock_ScriptDirect(State& state)
+  {
+    runScript(state, [](Mock::MockElementController& controller, const std::vector<ScriptStep>& script) {
+      Mock::MockElementIdList list;
+      for (const ScriptStep& step : script)
+      {
+        fillList(list, step.ids, static_cast<std::uint32_t>(step.ids.size()));
+        switch (step.kind)
+        {
+        case Native::CommandKind::Move:
+          controller.moveElement(&list, step.vector);
+          break;
+        case Native::CommandKind::Copy:
+          DoNotOptimize(controller.copyElements(&list, step.vector));
+          break;
+        case Native::CommandKind::Delete:
+          controller.deleteElements(&list);
+          break;
+        case Native::CommandKind::Join:
+          controller.joinElements(&list);
+          break;
+        case Native::CommandKind::JoinTopLevel:
+          controller.joinTopLevelElements(&list);
+          break;
+        }
+      }
+      return static_cast<std::uint32_t>(script.size());
+    });
+  }
+
+  /// The same steps recorded into a CommandQueue, coalesced and flushed (CommandBatch::Flush). Mock controller calls
+  /// are about as cheap as the coalescing itself, so compare the controller call counts in the label rather than time.
+  void BM_Mock_ScriptBatched(State& state)
+  {
+    runScript(state, [](Mock::MockElementController& controller, const std::vector<ScriptStep>& script) {
+      Native::CommandQueue queue;
+      for (const ScriptStep& step : script)
+        queue.record(step.kind, step.ids.data(), static_cast<std::uint32_t>(step.ids.size()), step.vector);
+      queue.coalesce();
+
+      Mock::MockElementIdList scratch;
+      Native::CopyResults copies;
+      return Interop::Detail::flushCommands<Mock::MockElementController, Mock::MockElementIdList, Mock::ElementId>(
+        &controller, &scratch, queue, copies, [](double x, double y, double z) { return Core::Vec3d{x, y, z}; });
+    });
+  }
+
+  std::vector<std::int32_t> allIds(Mock::MockControllerFactory& factory)
+  {
+    std::vector<std::int32_t> ids;
+    Mock::MockElementIdList* list = factory.getElementController()->getAllIdentifiableElementIDs();
+    ids.resize(Interop::Detail::elementIdCount(list));
+    Interop::Detail::copyElementIds(list, ids.data(), static_cast<std::uint32_t>(ids.size()));
+    return ids;
+  }
+
+  /// What AttributeController::GetAttributes does below the managed boundary for all five columns: one call per
+  /// element and column, interned into one string table. Only the distinct strings are marshalled afterwards.
+  void BM_Mock_FetchAttributes(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    const std::vector<std::int32_t> ids = allIds(factory);
+    std::vector<std::int32_t> columns(Interop::AttributeColumnCount * ids.size());
+    Interop::AttributeRequest request{ids.data(), static_cast<std::uint32_t>(ids.size()), {}};
+    for (std::uint32_t c = 0; c < Interop::AttributeColumnCount; ++c)
+      request.columns[c] = columns.data() + c * ids.size();
+
+    Native::StringTable strings;
+    for (auto _ : state)
+    {
+      strings.clear();
+      DoNotOptimize(Interop::Detail::fetchAttributes<Mock::ElementId>(factory.getAttributeController(), request, strings));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel("strings marshalled: " + std::to_string(strings.size()));
+  }
+
+  /// The same reads one string at a time, as a bridge with a GetName(id) per element does: every value is copied
+  /// out, and would be marshalled, on its own.
+  void BM_Mock_FetchAttributesPerElement(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    const std::vector<std::int32_t> ids = allIds(factory);
+    Mock::MockAttributeController* controller = factory.getAttributeController();
+    std::vector<std::string> values(Interop::AttributeColumnCount * ids.size());
+    for (auto _ : state)
+    {
+      for (std::uint32_t c = 0; c < Interop::AttributeColumnCount; ++c)
+      {
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+          values[c * ids.size() + i] = Interop::Detail::attributeText<Mock::ElementId>(
+            controller, static_cast<Interop::AttributeColumn>(c), static_cast<Mock::ElementId>(ids[i]));
+        }
+      }
+      DoNotOptimize(values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel("strings marshalled: " + std::to_string(values.size()));
+  }
+
+  constexpr const char* FilterExpression = "visible AND active AND material == 'Material 7'";
+
+  /// What ElementController::FilterElementIDSet does below the managed boundary: both queries become sets, and the
+  /// material is read only for elements in their intersection. Only the matches would be marshalled.
+  void BM_Mock_FilterNative(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    Native::ElementFilter filter;
+    Native::ElementFilter::ParseError error{};
+    filter.parse(FilterExpression, error);
+
+    Native::IdSet result;
+    std::uint32_t evaluated = 0;
+    for (auto _ : state)
+    {
+      evaluated = Interop::Detail::filterElements<Mock::ElementId>(factory.getElementController(),
+        factory.getAttributeController(), filter, result);
+      DoNotOptimize(result.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel("evaluated: " + std::to_string(evaluated) + ", IDs marshalled: " + std::to_string(result.size()));
+  }
+
+  /// The same filter as a managed caller without it writes it: both queries are copied out, intersected, and the
+  /// material of every remaining element is read and marshalled one string at a time.
+  void BM_Mock_FilterPerElement(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    Mock::MockAttributeController* attributes = factory.getAttributeController();
+    std::vector<std::int32_t> visible;
+    std::vector<std::int32_t> active;
+    std::vector<std::int32_t> both;
+    std::vector<std::int32_t> result;
+    std::string material;
+    std::size_t marshalled = 0;
+    for (auto _ : state)
+    {
+      visible.resize(queryVisible(factory, visible));
+      Mock::MockElementIdList* list = factory.getElementController()->getActiveIdentifiableElementIDs();
+      active.resize(Interop::Detail::elementIdCount(list));
+      Interop::Detail::copyElementIds(list, active.data(), static_cast<std::uint32_t>(active.size()));
+      std::sort(visible.begin(), visible.end());
+      std::sort(active.begin(), active.end());
+
+      both.clear();
+      std::set_intersection(visible.begin(), visible.end(), active.begin(), active.end(), std::back_inserter(both));
+      result.clear();
+      for (const std::int32_t id : both)
+      {
+        material = attributes->getElementMaterialName(static_cast<Mock::ElementId>(id))->narrowData();
+        if (material == "Material 7") result.push_back(id);
+      }
+      marshalled = visible.size() + active.size() + both.size();
+      DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel("IDs and strings marshalled: " + std::to_string(marshalled));
+  }
+
+  /// What GeometryController::GetSnapshot does below the managed boundary for all nine fields: one pass per field,
+  /// written straight into the coordinate arrays of six SoA buffers and three scalar arrays.
+  void BM_Mock_FetchGeometry(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    const std::vector<std::int32_t> ids = allIds(factory);
+    Native::SoaBuffer vectors[Interop::GeometryVectorCount];
+    std::vector<double> scalars(Interop::GeometryScalarCount * ids.size());
+    Interop::GeometryRequest request{ids.data(), static_cast<std::uint32_t>(ids.size()), {}, {}};
+    for (std::uint32_t v = 0; v < Interop::GeometryVectorCount; ++v)
+    {
+      vectors[v].resize(ids.size());
+      request.vectors[v] = vectors[v].view();
+    }
+    for (std::uint32_t s = 0; s < Interop::GeometryScalarCount; ++s)
+      request.scalars[s] = scalars.data() + s * ids.size();
+
+    for (auto _ : state)
+    {
+      DoNotOptimize(Interop::Detail::fetchGeometry<Mock::ElementId>(factory.getGeometryController(), request,
+        [](const Core::Vec3d& vector, double& x, double& y, double& z) {
+          x = vector.x;
+          y = vector.y;
+          z = vector.z;
+        }));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel("transitions: 1");
+  }
+
+  /// The same reads as a bridge without snapshots makes them: nine calls per element, each of which would be its
+  /// own managed->native transition, gathered into one record per element.
+  void BM_Mock_FetchGeometryPerElement(State& state)
+  {
+    struct Record
+    {
+      Core::Vec3d p1, p2, p3, xl, yl, zl;
+      double width, height, length;
+    };
+
+    Mock::MockControllerFactory& factory = factoryFor(state.range(0));
+    const std::vector<std::int32_t> ids = allIds(factory);
+    Mock::MockGeometryController* controller = factory.getGeometryController();
+    std::vector<Record> records(ids.size());
+    for (auto _ : state)
+    {
+      for (std::size_t i = 0; i < ids.size(); ++i)
+      {
+        const auto id = static_cast<Mock::ElementId>(ids[i]);
+        records[i] = {controller->getP1(id), controller->getP2(id), controller->getP3(id), controller->getXL(id),
+          controller->getYL(id), controller->getZL(id), controller->getWidth(id), controller->getHeight(id),
+          controller->getLength(id)};
+      }
+      DoNotOptimize(records.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel("transitions: " + std::to_string(9 * ids.size()));
+  }
+
+  /// ElementIdListPool::DefaultMaxRetained, and a number of concurrently rented lists that overflows it.
+  constexpr std::size_t PoolMaxRetained = 16;
+  constexpr std::size_t PoolBurst = 24;
+
+  /// Heap bytes held by the lists the pool keeps idle.
+  double retainedBytes(const Native::ListPool<Mock::MockElementIdList>& pool)
+  {
+    std::size_t bytes = 0;
+    pool.forEachIdle([&](const Mock::MockElementIdList& list) {
+      bytes += sizeof(list) + list.ids().capacity() * sizeof(Mock::ElementId);
+    });
+    return static_cast<double>(bytes);
+  }
+
+  /// Soak test of the pool core behind ElementIdListPool: range(0) calls that each rent a list, fill it with up to
+  /// 4096 IDs, read it back and return it, as ElementController::ConvertToNativeList and the bulk ID calls do.
+  /// Every 1000th call holds PoolBurst lists at once to overflow the pool. LiveLists and RetainedBytes are taken
+  /// halfway and at the end; equal values, with RetainedBytes under RetainedBytesLimit, mean the pool neither leaks
+  /// lists nor keeps growing.
+  void BM_Mock_IdListPoolSoak(State& state)
+  {
+    Mock::MockControllerFactory& factory = factoryFor(0);
+    const std::int64_t calls = state.range(0);
+    std::mt19937 random(42);
+    std::uniform_int_distribution<std::uint32_t> sizes(1, 4096);
+    std::vector<std::int32_t> ids(4096);
+    for (std::size_t i = 0; i < ids.size(); ++i)
+      ids[i] = static_cast<std::int32_t>(i);
+    std::vector<std::int32_t> readBack(ids.size());
+    std::vector<Mock::MockElementIdList*> held;
+    held.reserve(PoolBurst);
+
+    const std::int64_t liveBefore = Mock::MockElementIdList::liveCount();
+    double liveAtHalf = 0.0;
+    double bytesAtHalf = 0.0;
+    for (auto _ : state)
+    {
+      Native::ListPool<Mock::MockElementIdList> pool(PoolMaxRetained);
+      for (std::int64_t call = 0; call < calls; ++call)
+      {
+        const std::size_t rentals = call % 1000 == 999 ? PoolBurst : 1;
+        for (std::size_t i = 0; i < rentals; ++i)
+        {
+          Mock::MockElementIdList* list = pool.rent();
+          if (!list)
+            list = factory.createEmptyElementIDList();
+          const std::uint32_t count = sizes(random);
+          fillList(*list, ids, count);
+          DoNotOptimize(Interop::Detail::copyElementIds(list, readBack.data(), count));
+          held.push_back(list);
+        }
+        for (Mock::MockElementIdList* list : held)
+        {
+          list->clear();
+          if (!pool.keep(list))
+            list->destroy();
+        }
+        held.clear();
+
+        if (call == calls / 2)
+        {
+          liveAtHalf = static_cast<double>(Mock::MockElementIdList::liveCount() - liveBefore);
+          bytesAtHalf = retainedBytes(pool);
+        }
+      }
+
+      state.counters["CreatedCount"] = static_cast<double>(pool.created());
+      state.counters["RentedCount"] = static_cast<double>(pool.rented());
+      state.counters["LiveLists"] = static_cast<double>(Mock::MockElementIdList::liveCount() - liveBefore);
+      state.counters["RetainedBytes"] = retainedBytes(pool);
+      while (Mock::MockElementIdList* list = pool.takeIdle())
+        list->destroy();
+    }
+    state.counters["LiveListsAtHalf"] = liveAtHalf;
+    state.counters["RetainedBytesAtHalf"] = bytesAtHalf;
+    state.counters["RetainedBytesLimit"] = static_cast<double>(
+      PoolMaxRetained * (sizeof(Mock::MockElementIdList) + ids.size() * sizeof(Mock::ElementId)));
+    state.SetItemsProcessed(state.iterations() * calls);
+  }
+}
+
+CWAPI3D_BENCHMARK(BM_Mock_Populate)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_QueryVisible)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_EnumerateAllArray)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_EnumerateAllPaged)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_EnumerateAllPagedFirst)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_MoveVisible)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_MoveVisibleWithUndo)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_CopyElements)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_DeleteElements)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_VisibleActiveSet)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_VisibleActiveArrays)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_CreateBeamsSingle)->Arg(1'000)->Arg(20'000)->Arg(50'000);
+CWAPI3D_BENCHMARK(BM_Mock_CreateBeamsBatchPacked)->Arg(1'000)->Arg(20'000)->Arg(50'000);
+CWAPI3D_BENCHMARK(BM_Mock_CreateBeamsBatchSoa)->Arg(1'000)->Arg(20'000)->Arg(50'000);
+CWAPI3D_BENCHMARK(BM_Mock_ScriptDirect)->Arg(100)->Arg(1'000)->Arg(10'000);
+CWAPI3D_BENCHMARK(BM_Mock_ScriptBatched)->Arg(100)->Arg(1'000)->Arg(10'000);
+CWAPI3D_BENCHMARK(BM_Mock_FetchAttributes)->Arg(10'000)->Arg(300'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_FetchAttributesPerElement)->Arg(10'000)->Arg(300'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_FilterNative)->Arg(10'000)->Arg(300'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_FilterPerElement)->Arg(10'000)->Arg(300'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_FetchGeometry)->Arg(10'000)->Arg(300'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_FetchGeometryPerElement)->Arg(10'000)->Arg(300'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_Mock_IdListPoolSoak)->Arg(1'000'000);
@@ -0,0 +1,122 @@
+// Benchmarks for the batch plane solvers behind PlaneIntersection: every pair of faces in a connection group
+// intersected into lines, and plane triples into points, against Core::Plane::intersect called per pair.
+#include "Benchmark.h"
+
+#include <core/Plane.h>
+#include <native/SoaBuffer.h>
+#include <native/SoaKernels.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+  using Core::Vec3d;
+  using Native::Kernels::PlaneIntersectionStatus;
+
+  /// The faces of `count` / 6 beams: three axis-aligned normals per beam, each with an opposite face, plus a
+  /// small random tilt so that only the genuinely opposite faces are parallel.
+  struct Faces
+  {
+    explicit Faces(std::size_t count)
+    {
+      std::mt19937 random(9);
+      std::uniform_real_distribution<double> position(0.0, 20000.0);
+      std::uniform_real_distribution<double> tilt(-0.2, 0.2);
+      while (planes.size() < count)
+      {
+        const Vec3d origin{position(random), position(random), position(random)};
+        const Vec3d axes[] = {{1.0, tilt(random), tilt(random)}, {tilt(random), 1.0, tilt(random)}, {tilt(random), tilt(random), 1.0}};
+        for (const Vec3d& axis : axes)
+        {
+          planes.push_back(*Core::Planed::fromPointNormal(origin, axis));
+          planes.push_back(*Core::Planed::fromPointNormal(origin + axis * 120.0, -axis));
+        }
+      }
+      planes.erase(planes.begin() + static_cast<std::ptrdiff_t>(count), planes.end());
+      for (const Core::Planed& plane : planes)
+      {
+        nx.push_back(plane.normal().x);
+        ny.push_back(plane.normal().y);
+        nz.push_back(plane.normal().z);
+        d.push_back(plane.d());
+      }
+    }
+
+    Native::Kernels::ConstPlaneView view() const { return {nx.data(), ny.data(), nz.data(), d.data(), nx.size()}; }
+
+    std::vector<Core::Planed> planes;
+    std::vector<double> nx, ny, nz, d;
+  };
+
+  void pairsBenchmark(State& state, bool parallel)
+  {
+    const Faces faces(static_cast<std::size_t>(state.range(0)));
+    const std::size_t pairs = faces.planes.size() * faces.planes.size();
+    Native::SoaBuffer points(pairs), directions(pairs);
+    points.resize(pairs);
+    directions.resize(pairs);
+    std::vector<PlaneIntersectionStatus> status(pairs);
+    for (auto _ : state)
+    {
+      DoNotOptimize(Native::Kernels::intersectPlanePairs(faces.view(), faces.view(), 1e-10, points.view(),
+        directions.view(), status.data(), parallel));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(pairs));
+  }
+
+  void BM_PlanePairs_Batch(State& state)
+  {
+    pairsBenchmark(state, false);
+  }
+
+  void BM_PlanePairs_BatchParallel(State& state)
+  {
+    pairsBenchmark(state, true);
+  }
+
+  void BM_PlanePairs_PerPair(State& state)
+  {
+    const Faces faces(static_cast<std::size_t>(state.range(0)));
+    const std::size_t count = faces.planes.size();
+    for (auto _ : state)
+    {
+      std::size_t intersecting = 0;
+      for (std::size_t j = 0; j < count; ++j)
+      {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          const auto line = faces.planes[i].intersect(faces.planes[j]);
+          intersecting += line ? 1 : 0;
+          DoNotOptimize(line);
+        }
+      }
+      DoNotOptimize(intersecting);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count * count));
+  }
+
+  void BM_PlaneTriples_Batch(State& state)
+  {
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    const Faces a(count), b(count + 1), c(count + 2);
+    const Native::Kernels::ConstPlaneView bView{b.nx.data() + 1, b.ny.data() + 1, b.nz.data() + 1, b.d.data() + 1, count};
+    const Native::Kernels::ConstPlaneView cView{c.nx.data() + 2, c.ny.data() + 2, c.nz.data() + 2, c.d.data() + 2, count};
+    Native::SoaBuffer points(count);
+    points.resize(count);
+    std::vector<PlaneIntersectionStatus> status(count);
+    for (auto _ : state)
+      DoNotOptimize(Native::Kernels::intersectPlaneTriples(a.view(), bView, cView, 1e-10, points.view(), status.data(), false));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+}
+
+CWAPI3D_BENCHMARK(BM_PlanePairs_Batch)->Arg(64)->Arg(256)->Arg(1024);
+CWAPI3D_BENCHMARK(BM_PlanePairs_BatchParallel)->Arg(64)->Arg(256)->Arg(1024);
+CWAPI3D_BENCHMARK(BM_PlanePairs_PerPair)->Arg(64)->Arg(256)->Arg(1024);
+CWAPI3D_BENCHMARK(BM_PlaneTriples_Batch)->Arg(1'024)->Arg(65'536);
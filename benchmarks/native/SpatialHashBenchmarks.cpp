@@ -0,0 +1,140 @@
+// Benchmarks for the hash grid behind SpatialPointHash: welding beam endpoints, point and radius lookups, and the
+// old XOR-of-coordinates point hash against the quantized Core::hashPoint in a hash set.
+#include "Benchmark.h"
+
+#include <core/Hash.h>
+#include <native/SoaBuffer.h>
+#include <native/SpatialHash.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+  using Core::Vec3d;
+
+  constexpr double Tolerance = 0.1;
+
+  /// Endpoints of `count` / 2 beams on a storey grid: beams meet at shared nodes on a 625 mm raster, each endpoint
+  /// a little off its node as modelled geometry is, so most endpoints weld to a node shared with other beams.
+  Native::SoaBuffer endpoints(std::size_t count)
+  {
+    std::mt19937 random(13);
+    std::uniform_int_distribution<int> node(0, 99);
+    std::uniform_real_distribution<double> noise(-Tolerance / 4, Tolerance / 4);
+    Native::SoaBuffer points(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      points.push_back(node(random) * 625.0 + noise(random), node(random) * 625.0 + noise(random),
+        node(random) % 10 * 2750.0 + noise(random));
+    }
+    return points;
+  }
+
+  void BM_SpatialHash_Weld(State& state)
+  {
+    const Native::SoaBuffer points = endpoints(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::int32_t> indices(points.size());
+    for (auto _ : state)
+    {
+      Native::SpatialHash hash(Tolerance);
+      DoNotOptimize(hash.weld(points.view(), indices.data()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  }
+
+  void BM_SpatialHash_Find(State& state)
+  {
+    const Native::SoaBuffer points = endpoints(static_cast<std::size_t>(state.range(0)));
+    Native::SpatialHash hash(Tolerance);
+    hash.insert(points.view());
+    std::size_t next = 0;
+    for (auto _ : state)
+    {
+      const std::size_t i = next++ % points.size();
+      DoNotOptimize(hash.find(Vec3d{points.x()[i], points.y()[i], points.z()[i]}));
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_SpatialHash_QueryRadius(State& state)
+  {
+    const Native::SoaBuffer points = endpoints(static_cast<std::size_t>(state.range(0)));
+    Native::SpatialHash hash(Tolerance);
+    hash.insert(points.view());
+    std::vector<std::int32_t> found;
+    std::size_t next = 0;
+    for (auto _ : state)
+    {
+      const std::size_t i = next++ % points.size();
+      found.clear();
+      hash.queryRadius(Vec3d{points.x()[i], points.y()[i], points.z()[i]}, 1.0, found);
+      DoNotOptimize(found.size());
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  /// .NET's Double.GetHashCode: the two halves of the bit pattern XORed.
+  std::int32_t dotNetHash(double value)
+  {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof bits);
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(bits) ^ static_cast<std::uint32_t>(bits >> 32));
+  }
+
+  struct XorHash
+  {
+    std::size_t operator()(const Vec3d& p) const
+    {
+      return static_cast<std::uint32_t>(dotNetHash(p.x) ^ dotNetHash(p.y) ^ dotNetHash(p.z));
+    }
+  };
+
+  struct QuantizedHash
+  {
+    std::size_t operator()(const Vec3d& p) const { return static_cast<std::uint32_t>(Core::hashPoint(p)); }
+  };
+
+  /// The grid nodes themselves, exactly: deduplicating them in a hash set only measures the hash's spread.
+  template <class Hash>
+  void hashSetBenchmark(State& state)
+  {
+    std::vector<Vec3d> nodes;
+    for (int x = 0; x < 100; ++x)
+    {
+      for (int y = 0; y < 100; ++y)
+      {
+        for (int z = 0; z < 10; ++z)
+          nodes.push_back(Vec3d{x * 625.0, y * 625.0, z * 2750.0});
+      }
+    }
+    for (auto _ : state)
+    {
+      std::unordered_set<Vec3d, Hash> set(nodes.begin(), nodes.end());
+      DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(nodes.size()));
+  }
+
+  void BM_PointHash_XorSet(State& state)
+  {
+    hashSetBenchmark<XorHash>(state);
+  }
+
+  void BM_PointHash_QuantizedSet(State& state)
+  {
+    hashSetBenchmark<QuantizedHash>(state);
+  }
+}
+
+CWAPI3D_BENCHMARK(BM_SpatialHash_Weld)->Arg(100'000)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_SpatialHash_Find)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_SpatialHash_QueryRadius)->Arg(1'000'000);
+CWAPI3D_BENCHMARK(BM_PointHash_XorSet);
+CWAPI3D_BENCHMARK(BM_PointHash_QuantizedSet);
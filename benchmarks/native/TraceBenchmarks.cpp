@@ -0,0 +1,161 @@
+// Benchmarks for the call tracer behind BridgeTrace: what one traced bridge call costs with recording off and on,
+// with and without the native/marshalling split, and how fast the rings export as Chrome trace JSON.
+#include "Benchmark.h"
+
+#include <native/Trace.h>
+
+#include <cstdint>
+#include <ostream>
+#include <streambuf>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Benchmarks::DoNotOptimize;
+  using Benchmarks::State;
+  namespace Trace = Native::Trace;
+
+  /// The instrumentation a bridge method runs, around a stand-in for its body.
+  void tracedCall(std::int64_t& value)
+  {
+    const bool active = Trace::enabled();
+    if (active)
+      Trace::begin(Trace::Point::ElementController_MoveElement_IdList);
+    DoNotOptimize(++value);
+    if (active)
+      Trace::end();
+  }
+
+  /// A method whose CAD call ends the method, the common case: the end of the call also ends its native span.
+  void tracedNativeCall(std::int64_t& value)
+  {
+    const bool active = Trace::enabled();
+    if (active)
+      Trace::begin(Trace::Point::ElementController_MoveElement_List);
+    DoNotOptimize(++value);
+    if (active)
+      Trace::enterNative();
+    DoNotOptimize(++value);
+    if (active)
+      Trace::end();
+  }
+
+  /// A method that marshals the CAD call's result, so it leaves the native span early (NativeTraceScope::leave).
+  void tracedNativeLeaveCall(std::int64_t& value)
+  {
+    const bool active = Trace::enabled();
+    if (active)
+      Trace::begin(Trace::Point::ElementController_MoveElement_List);
+    DoNotOptimize(++value);
+    if (active)
+      Trace::enterNative();
+    DoNotOptimize(++value);
+    if (active)
+      Trace::leaveNative();
+    DoNotOptimize(++value);
+    if (active)
+      Trace::end();
+  }
+
+  void BM_Trace_Untraced(State& state)
+  {
+    std::int64_t value = 0;
+    for (auto _ : state)
+      DoNotOptimize(++value);
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Trace_Disabled(State& state)
+  {
+    Trace::setEnabled(false);
+    std::int64_t value = 0;
+    for (auto _ : state)
+      tracedCall(value);
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Trace_Enabled(State& state)
+  {
+    Trace::setEnabled(true);
+    std::int64_t value = 0;
+    for (auto _ : state)
+      tracedCall(value);
+    Trace::setEnabled(false);
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Trace_EnabledWithNative(State& state)
+  {
+    Trace::setEnabled(true);
+    std::int64_t value = 0;
+    for (auto _ : state)
+      tracedNativeCall(value);
+    Trace::setEnabled(false);
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void BM_Trace_EnabledWithNativeLeave(State& state)
+  {
+    Trace::setEnabled(true);
+    std::int64_t value = 0;
+    for (auto _ : state)
+      tracedNativeLeaveCall(value);
+    Trace::setEnabled(false);
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  /// One read of the trace clock; every traced call takes one per boundary it records.
+  void BM_Trace_Timestamp(State& state)
+  {
+    for (auto _ : state)
+      DoNotOptimize(Trace::now());
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  /// Discards everything written to it, so the export is measured without file I/O.
+  class NullBuffer : public std::streambuf
+  {
+  protected:
+    int_type overflow(int_type c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+  };
+
+  void BM_Trace_ExportChromeTrace(State& state)
+  {
+    Trace::clear();
+    Trace::setEnabled(true);
+    std::int64_t value = 0;
+    for (std::size_t i = 0; i < Trace::EventsPerThread; ++i)
+      tracedNativeCall(value);
+    Trace::setEnabled(false);
+
+    NullBuffer buffer;
+    std::ostream out(&buffer);
+    for (auto _ : state)
+      Trace::writeChromeTrace(out);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Trace::eventCount()));
+  }
+
+  void BM_Trace_Statistics(State& state)
+  {
+    Trace::clear();
+    Trace::setEnabled(true);
+    std::int64_t value = 0;
+    for (std::size_t i = 0; i < Trace::EventsPerThread; ++i)
+      tracedNativeCall(value);
+    Trace::setEnabled(false);
+
+    for (auto _ : state)
+      DoNotOptimize(Trace::statistics().size());
+    state.SetItemsProcessed(state.iterations());
+  }
+}
+
+CWAPI3D_BENCHMARK(BM_Trace_Untraced);
+CWAPI3D_BENCHMARK(BM_Trace_Disabled);
+CWAPI3D_BENCHMARK(BM_Trace_Enabled);
+CWAPI3D_BENCHMARK(BM_Trace_EnabledWithNative);
+CWAPI3D_BENCHMARK(BM_Trace_EnabledWithNativeLeave);
+CWAPI3D_BENCHMARK(BM_Trace_Timestamp);
+CWAPI3D_BENCHMARK(BM_Trace_ExportChromeTrace);
+CWAPI3D_BENCHMARK(BM_Trace_Statistics);
@@ -0,0 +1,14 @@
+#include "Benchmark.h"
+
+#include <native/SoaKernels.h>
+
+int main(int argc, char** argv)
+{
+  using CwAPI3D::Net::Bridge::Native::Kernels::SimdLevel;
+
+  const SimdLevel level = CwAPI3D::Net::Bridge::Native::Kernels::activeSimdLevel();
+  CwAPI3D::Net::Bridge::Benchmarks::AddCustomContext("simd_level",
+    level == SimdLevel::Avx2 ? "avx2" : (level == SimdLevel::Sse2 ? "sse2" : "scalar"));
+
+  return CwAPI3D::Net::Bridge::Benchmarks::RunSpecifiedBenchmarks(argc, argv);
+}
@@ -0,0 +1,293 @@
+#include "PluginLoader.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Diagnostics;
+using namespace System::IO;
+using namespace System::Reflection;
+using namespace System::Runtime::CompilerServices;
+using namespace System::Threading;
+using namespace System::Threading::Tasks;
+using namespace System::Xml;
+
+namespace
+{
+  String^ RequiredAttribute(XmlElement^ element, String^ name)
+  {
+    String^ value = element->GetAttribute(name);
+    if (String::IsNullOrWhiteSpace(value))
+      throw gcnew FormatException(String::Format("<{0}> requires the attribute '{1}'.", element->Name, name));
+    return value->Trim();
+  }
+
+  /// Delegates already bound, keyed by assembly path, type and method, so a second initialization of the same
+  /// plugin skips reflection entirely.
+  ref class EntryPointCache abstract sealed
+  {
+  public:
+    static initonly ConcurrentDictionary<String^, Caller::PluginEntryPoint^>^ Bound =
+      gcnew ConcurrentDictionary<String^, Caller::PluginEntryPoint^>(StringComparer::OrdinalIgnoreCase);
+  };
+
+  double Milliseconds(long long ticks)
+  {
+    return ticks * 1000.0 / Stopwatch::Frequency;
+  }
+}
+
+namespace Caller
+{
+  PluginConfig^ PluginConfig::Load(String^ pluginDirectory)
+  {
+    auto config = gcnew PluginConfig();
+    config->Plugins = gcnew List<PluginDescriptor^>();
+    config->PreJitAssemblies = gcnew List<String^>();
+    config->Timing = true;
+
+    String^ path = Path::Combine(pluginDirectory, FileName);
+    if (!File::Exists(path))
+    {
+      auto plugin = gcnew PluginDescriptor();
+      plugin->Assembly = "sharpLib";
+      plugin->Type = "sharpLib.Initializer";
+      plugin->Method = "Run";
+      config->Plugins->Add(plugin);
+      return config;
+    }
+
+    auto document = gcnew XmlDocument();
+    document->Load(path);
+    XmlElement^ root = document->DocumentElement;
+    if (root == nullptr || root->Name != "plugins")
+      throw gcnew FormatException(path + " must have a <plugins> root element.");
+
+    if (root->HasAttribute("timing"))
+      config->Timing = XmlConvert::ToBoolean(root->GetAttribute("timing")->Trim());
+    for each (String^ name in root->GetAttribute("preJit")->Split(gcnew array<wchar_t>{',', ';'},
+      StringSplitOptions::RemoveEmptyEntries))
+    {
+      if (!String::IsNullOrWhiteSpace(name))
+        config->PreJitAssemblies->Add(name->Trim());
+    }
+
+    for each (XmlNode^ node in root->ChildNodes)
+    {
+      auto element = dynamic_cast<XmlElement^>(node);
+      if (element == nullptr || element->Name != "plugin")
+        continue;
+
+      auto plugin = gcnew PluginDescriptor();
+      plugin->Assembly = RequiredAttribute(element, "assembly");
+      plugin->Type = RequiredAttribute(element, "type");
+      plugin->Method = element->HasAttribute("method") ? RequiredAttribute(element, "method") : "Run";
+      config->Plugins->Add(plugin);
+    }
+    if (config->Plugins->Count == 0)
+      throw gcnew FormatException(path + " lists no <plugin>.");
+    return config;
+  }
+
+  /// <summary>
+  /// Loads one plugin assembly and binds its entry point, recording how long each step took.
+  /// </summary>
+  ref class PluginLoader::Binding sealed
+  {
+  public:
+    PluginDescriptor^ Plugin;
+    String^ AssemblyPath;
+    PluginEntryPoint^ EntryPoint;
+    Exception^ Error;
+    bool Cached;
+    long long LoadTicks;
+    long long ResolveTicks;
+    long long BindTicks;
+    long long CallTicks;
+
+    void Bind()
+    {
+      try
+      {
+        String^ key = String::Join("|", AssemblyPath, Plugin->Type, Plugin->Method);
+        if (EntryPointCache::Bound->TryGetValue(key, EntryPoint))
+        {
+          Cached = true;
+          return;
+        }
+
+        auto watch = Stopwatch::StartNew();
+        Assembly^ assembly = Assembly::LoadFrom(AssemblyPath);
+        LoadTicks = watch->ElapsedTicks;
+
+        watch->Restart();
+        Type^ type = assembly->GetType(Plugin->Type, true);
+        MethodInfo^ method = type->GetMethod(Plugin->Method, BindingFlags::Public | BindingFlags::Static, nullptr,
+          gcnew array<Type^>{IntPtr::typeid}, nullptr);
+        if (method == nullptr || method->ReturnType != bool::typeid)
+          throw gcnew MissingMethodException(String::Format("{0} has no public static bool {1}(IntPtr).", Plugin->Type,
+            Plugin->Method));
+        ResolveTicks = watch->ElapsedTicks;
+
+        watch->Restart();
+        EntryPoint = safe_cast<PluginEntryPoint^>(Delegate::CreateDelegate(PluginEntryPoint::typeid, method));
+        BindTicks = watch->ElapsedTicks;
+        EntryPointCache::Bound->TryAdd(key, EntryPoint);
+      }
+      catch (Exception^ e)
+      {
+        Error = e;
+      }
+    }
+  };
+
+  PluginLoader::PluginLoader(String^ pluginDirectory, PluginConfig^ config)
+  {
+    if (pluginDirectory == nullptr)
+      throw gcnew ArgumentNullException("pluginDirectory");
+    if (config == nullptr)
+      throw gcnew ArgumentNullException("config");
+
+    m_directory = pluginDirectory;
+    m_config = config;
+  }
+
+  bool PluginLoader::Run(IntPtr nativeFactory)
+  {
+    auto total = Stopwatch::StartNew();
+    StartPreJit();
+
+    const int count = m_config->Plugins->Count;
+    auto bindings = gcnew array<Binding^>(count);
+    auto tasks = gcnew array<Task^>(count);
+    for (int i = 0; i < count; ++i)
+    {
+      bindings[i] = gcnew Binding();
+      bindings[i]->Plugin = m_config->Plugins[i];
+      bindings[i]->AssemblyPath = Path::Combine(m_directory, m_config->Plugins[i]->Assembly + ".dll");
+      tasks[i] = Task::Run(gcnew Action(bindings[i], &Binding::Bind));
+    }
+    Task::WaitAll(tasks);
+
+    // The entry points use the CAD API, which may only be called on this thread.
+    bool started = true;
+    for each (Binding^ binding in bindings)
+    {
+      if (binding->Error != nullptr)
+      {
+        Console::WriteLine("Error loading {0}: {1}", binding->AssemblyPath, binding->Error->Message);
+        started = false;
+        continue;
+      }
+
+      auto watch = Stopwatch::StartNew();
+      try
+      {
+        started &= binding->EntryPoint->Invoke(nativeFactory);
+      }
+      catch (Exception^ e)
+      {
+        Console::WriteLine("Error in {0}.{1}: {2}", binding->Plugin->Type, binding->Plugin->Method, e->Message);
+        started = false;
+      }
+      binding->CallTicks = watch->ElapsedTicks;
+    }
+
+    if (m_config->Timing)
+      Report(bindings, Milliseconds(total->ElapsedTicks));
+    return started;
+  }
+
+  void PluginLoader::StartPreJit()
+  {
+    if (m_config->PreJitAssemblies->Count == 0)
+      return;
+
+    auto paths = gcnew List<String^>();
+    for each (String^ name in m_config->PreJitAssemblies)
+      paths->Add(Path::Combine(m_directory, name + ".dll"));
+
+    // Below normal priority, so compiling ahead never delays loading the plugins themselves.
+    auto thread = gcnew Thread(gcnew ParameterizedThreadStart(&PluginLoader::PreJit));
+    thread->IsBackground = true;
+    thread->Priority = ThreadPriority::BelowNormal;
+    thread->Name = "Plugin pre-JIT";
+    thread->Start(paths);
+  }
+
+  void PluginLoader::PreJit(Object^ state)
+  {
+    const BindingFlags flags = BindingFlags::DeclaredOnly | BindingFlags::Public | BindingFlags::NonPublic |
+                               BindingFlags::Instance | BindingFlags::Static;
+
+    for each (String^ path in safe_cast<List<String^>^>(state))
+    {
+      auto watch = Stopwatch::StartNew();
+      int prepared = 0;
+      try
+      {
+        array<Type^>^ types;
+        try
+        {
+          types = Assembly::LoadFrom(path)->GetTypes();
+        }
+        catch (ReflectionTypeLoadException^ e)
+        {
+          types = e->Types;
+        }
+
+        for each (Type^ type in types)
+        {
+          if (type == nullptr || type->ContainsGenericParameters)
+            continue;
+          for each (MethodBase^ method in type->GetMethods(flags))
+            prepared += Prepare(method);
+          for each (MethodBase^ constructor in type->GetConstructors(flags))
+            prepared += Prepare(constructor);
+        }
+      }
+      catch (Exception^ e)
+      {
+        Console::WriteLine("Pre-JIT of {0} failed: {1}", path, e->Message);
+        continue;
+      }
+      Console::WriteLine("Pre-JIT: {0} methods of {1} in {2:F1} ms", prepared, Path::GetFileName(path),
+        Milliseconds(watch->ElapsedTicks));
+    }
+  }
+
+  int PluginLoader::Prepare(MethodBase^ method)
+  {
+    if (method->IsAbstract || method->ContainsGenericParameters)
+      return 0;
+    // Runtime-implemented methods (delegate Invoke) and P/Invoke stubs have no IL to compile.
+    const MethodImplAttributes implementation = method->GetMethodImplementationFlags();
+    if ((implementation & MethodImplAttributes::CodeTypeMask) != MethodImplAttributes::IL ||
+        (method->Attributes & MethodAttributes::PinvokeImpl) == MethodAttributes::PinvokeImpl)
+      return 0;
+
+    try
+    {
+      RuntimeHelpers::PrepareMethod(method->MethodHandle);
+      return 1;
+    }
+    catch (Exception^)
+    {
+      // Methods the JIT rejects are compiled on first call instead, as before.
+      return 0;
+    }
+  }
+
+  void PluginLoader::Report(array<Binding^>^ bindings, double totalMilliseconds)
+  {
+    Console::WriteLine("Plugin startup (ms):");
+    for each (Binding^ binding in bindings)
+    {
+      if (binding->Error != nullptr)
+        continue;
+      Console::WriteLine("  {0,-24} load {1,8:F1}  resolve {2,7:F1}  bind {3,6:F1}  first call {4,8:F1}{5}",
+        binding->Plugin->Assembly, Milliseconds(binding->LoadTicks), Milliseconds(binding->ResolveTicks),
+        Milliseconds(binding->BindTicks), Milliseconds(binding->CallTicks), binding->Cached ? "  (cached)" : "");
+    }
+    Console::WriteLine("  total {0:F1}", totalMilliseconds);
+  }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+namespace Caller
+{
+  /// <summary>
+  /// The signature every managed entry point must have: it receives the native ControllerFactory and returns
+  /// whether the plugin started.
+  /// </summary>
+  public delegate bool PluginEntryPoint(System::IntPtr nativeFactory);
+
+  /// <summary>
+  /// One managed plugin listed in the configuration file.
+  /// </summary>
+  ref class PluginDescriptor sealed
+  {
+  public:
+    /// <summary>The assembly file name without extension, resolved relative to the plugin directory.</summary>
+    System::String^ Assembly;
+    /// <summary>The full name of the type that declares the entry point.</summary>
+    System::String^ Type;
+    /// <summary>The name of the public static entry point method.</summary>
+    System::String^ Method;
+  };
+
+  /// <summary>
+  /// The loader configuration, read from plugins.xml in the plugin directory.
+  /// </summary>
+  /// <remarks>
+  /// <code>
+  /// &lt;plugins preJit="csharp_bridge" timing="true"&gt;
+  ///   &lt;plugin assembly="sharpLib" type="sharpLib.Initializer" method="Run" /&gt;
+  /// &lt;/plugins&gt;
+  /// </code>
+  /// Without the file, the loader starts sharpLib.Initializer.Run from sharpLib.dll, pre-JITs nothing and prints
+  /// the timing report.
+  /// </remarks>
+  ref class PluginConfig sealed
+  {
+  public:
+    /// <summary>The file name the configuration is read from.</summary>
+    static initonly System::String^ FileName = "plugins.xml";
+
+    /// <summary>The plugins, started in this order.</summary>
+    System::Collections::Generic::List<PluginDescriptor^>^ Plugins;
+    /// <summary>Assemblies whose methods are compiled on a background thread while the plugins load.</summary>
+    System::Collections::Generic::List<System::String^>^ PreJitAssemblies;
+    /// <summary>Whether the startup timing report is printed.</summary>
+    bool Timing;
+
+    /// <summary>
+    /// Reads the configuration from the plugin directory, or returns the default configuration when the file does
+    /// not exist.
+    /// </summary>
+    /// <param name="pluginDirectory">The directory the plugin was loaded from.</param>
+    /// <returns>The configuration.</returns>
+    /// <exception cref="System::FormatException">Thrown when a plugin entry lacks an attribute.</exception>
+    static PluginConfig^ Load(System::String^ pluginDirectory);
+  };
+
+  /// <summary>
+  /// Loads the configured managed plugins and calls their entry points.
+  /// </summary>
+  /// <remarks>
+  /// Assemblies are loaded and their entry points bound on thread-pool threads, concurrently; each entry point is
+  /// bound once to a PluginEntryPoint delegate, so calling it costs a delegate call instead of a reflection
+  /// lookup. The entry points themselves run on the calling thread, in configuration order, because they use the
+  /// CAD API.
+  /// </remarks>
+  ref class PluginLoader sealed
+  {
+  public:
+    /// <summary>
+    /// Creates a loader for the plugins in a directory.
+    /// </summary>
+    /// <param name="pluginDirectory">The directory the assemblies are loaded from.</param>
+    /// <param name="config">The plugins to load.</param>
+    PluginLoader(System::String^ pluginDirectory, PluginConfig^ config);
+
+    /// <summary>
+    /// Loads every plugin and calls its entry point with the native factory.
+    /// </summary>
+    /// <param name="nativeFactory">The ControllerFactory passed to plugin_x64_init.</param>
+    /// <returns>true if every plugin started; otherwise, false.</returns>
+    bool Run(System::IntPtr nativeFactory);
+
+  private:
+    ref class Binding;
+
+    System::String^ m_directory;
+    PluginConfig^ m_config;
+
+    void StartPreJit();
+    static void PreJit(System::Object^ state);
+    static int Prepare(System::Reflection::MethodBase^ method);
+    void Report(array<Binding^>^ bindings, double totalMilliseconds);
+  };
+}
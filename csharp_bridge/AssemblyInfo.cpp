@@ -18,3 +18,6 @@ using namespace System::Security::Permissions;
 [assembly:AssemblyVersionAttribute(L"1.0.*")];
 
 [assembly:ComVisible(false)];
+
+// Lets the managed benchmark suite call Detail::ConversionHooks.
+[assembly:InternalsVisibleTo(L"ManagedBenchmarks")];
@@ -0,0 +1,132 @@
+#include "AttributeController.h"
+#include "ElementIdSet.h"
+#include "../diagnostics/BridgeCounters.h"
+#include "../diagnostics/TraceScope.h"
+#include "../interop/AttributeInterop.h"
+#include "../native/StringTable.h"
+
+#include <ICwAPI3DAttributeController.h>
+#include <ICwAPI3DControllerFactory.h>
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+CwAPI3D::Net::Bridge::AttributeController::AttributeController(Interfaces::ICwAPI3DControllerFactory* nativePtr)
+{
+  Detail::TraceScope trace(Native::Trace::Point::AttributeController_Create);
+  m_attributeController = nativePtr->getAttributeController();
+}
+
+// Pins the IDs and one block for all requested columns, reads them in a single native call, then marshals each
+// distinct value once. The string table lives only for the call, so the controller owns no native memory.
+CwAPI3D::Net::Bridge::ElementAttributes^ CwAPI3D::Net::Bridge::AttributeController::Fetch(array<int>^ ids, AttributeColumns columns)
+{
+  if ((columns & AttributeColumns::All) == AttributeColumns::None || (columns & ~AttributeColumns::All) != AttributeColumns::None)
+    throw gcnew ArgumentException("Expected one or more attribute columns.", "columns");
+
+  const int count = ids->Length;
+  auto offsets = gcnew array<int>(Interop::AttributeColumnCount);
+  int columnCount = 0;
+  for (uint32_t c = 0; c < Interop::AttributeColumnCount; ++c)
+  {
+    const auto flag = static_cast<AttributeColumns>(1 << c);
+    offsets[c] = (columns & flag) != AttributeColumns::None ? count * columnCount++ : -1;
+  }
+
+  auto indices = gcnew array<int>(count * columnCount);
+  if (count == 0)
+    return gcnew ElementAttributes(ids, columns, indices, offsets, gcnew array<String^>(0));
+
+  Native::StringTable strings;
+  {
+    pin_ptr<int> pinnedIds = &ids[0];
+    pin_ptr<int> pinnedIndices = &indices[0];
+    int* const columnBlock = pinnedIndices;
+
+    Interop::AttributeRequest request{};
+    request.ids = pinnedIds;
+    request.count = static_cast<uint32_t>(count);
+    for (uint32_t c = 0; c < Interop::AttributeColumnCount; ++c)
+      request.columns[c] = offsets[c] < 0 ? nullptr : columnBlock + offsets[c];
+
+    BridgeCounters::Add(Detail::Counter::IdsToNative, count);
+    Detail::NativeTraceScope native;
+    const bool valid = Interop::FetchAttributes(m_attributeController, request, strings);
+    native.leave();
+    if (!valid)
+      throw gcnew ArgumentException("Element ID cannot be negative.", "elementIDs");
+  }
+
+  auto values = gcnew array<String^>(static_cast<int>(strings.size()));
+  for (int i = 0; i < values->Length; ++i)
+  {
+    const auto text = strings.at(static_cast<uint32_t>(i));
+    values[i] = text.empty() ? String::Empty
+      : gcnew String(text.data(), 0, static_cast<int>(text.size()));
+  }
+  return gcnew ElementAttributes(ids, columns, indices, offsets, values);
+}
+
+System::String^ CwAPI3D::Net::Bridge::AttributeController::FetchOne(int elementID, AttributeColumns column)
+{
+  auto ids = gcnew array<int>(1);
+  ids[0] = elementID;
+  return Fetch(ids, column)->GetValue(column, 0);
+}
+
+CwAPI3D::Net::Bridge::ElementAttributes^ CwAPI3D::Net::Bridge::AttributeController::GetAttributes(List<int>^ elementIDs, AttributeColumns columns)
+{
+  Detail::TraceScope trace(Native::Trace::Point::AttributeController_GetAttributes_List);
+  if (elementIDs == nullptr)
+    throw gcnew ArgumentNullException("elementIDs");
+
+  return Fetch(elementIDs->ToArray(), columns);
+}
+
+CwAPI3D::Net::Bridge::ElementAttributes^ CwAPI3D::Net::Bridge::AttributeController::GetAttributes(array<int>^ elementIDs, AttributeColumns columns)
+{
+  Detail::TraceScope trace(Native::Trace::Point::AttributeController_GetAttributes_Array);
+  if (elementIDs == nullptr)
+    throw gcnew ArgumentNullException("elementIDs");
+
+  return Fetch(static_cast<array<int>^>(elementIDs->Clone()), columns);
+}
+
+CwAPI3D::Net::Bridge::ElementAttributes^ CwAPI3D::Net::Bridge::AttributeController::GetAttributes(ElementIdSet^ elementIDs, AttributeColumns columns)
+{
+  Detail::TraceScope trace(Native::Trace::Point::AttributeController_GetAttributes_IdSet);
+  if (elementIDs == nullptr)
+    throw gcnew ArgumentNullException("elementIDs");
+
+  return Fetch(elementIDs->ToArray(), columns);
+}
+
+System::String^ CwAPI3D::Net::Bridge::AttributeController::GetName(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::AttributeController_GetName);
+  return FetchOne(elementID, AttributeColumns::Name);
+}
+
+System::String^ CwAPI3D::Net::Bridge::AttributeController::GetGroup(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::AttributeController_GetGroup);
+  return FetchOne(elementID, AttributeColumns::Group);
+}
+
+System::String^ CwAPI3D::Net::Bridge::AttributeController::GetSubgroup(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::AttributeController_GetSubgroup);
+  return FetchOne(elementID, AttributeColumns::Subgroup);
+}
+
+System::String^ CwAPI3D::Net::Bridge::AttributeController::GetComment(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::AttributeController_GetComment);
+  return FetchOne(elementID, AttributeColumns::Comment);
+}
+
+System::String^ CwAPI3D::Net::Bridge::AttributeController::GetMaterial(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::AttributeController_GetMaterial);
+  return FetchOne(elementID, AttributeColumns::Material);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "ElementAttributes.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DControllerFactory;
+    class ICwAPI3DAttributeController;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class ElementIdSet;
+
+  /// <summary>
+  /// Reads element attributes: name, group, subgroup, comment and material.
+  /// </summary>
+  /// <remarks>
+  /// GetAttributes reads any combination of attributes of many elements in one native call and returns them as
+  /// columns. Equal values are marshalled once, so reading the material of 300,000 elements that use 50 materials
+  /// creates 50 strings instead of 300,000. Prefer it over calling GetName and the like in a loop.
+  /// </remarks>
+  public ref class AttributeController
+  {
+  private:
+    Interfaces::ICwAPI3DAttributeController* m_attributeController;
+
+    ElementAttributes^ Fetch(array<int>^ ids, AttributeColumns columns);
+    System::String^ FetchOne(int elementID, AttributeColumns column);
+
+  public:
+    explicit AttributeController(Interfaces::ICwAPI3DControllerFactory* nativePtr);
+
+    /// <summary>
+    /// Reads attributes of many elements in one native call.
+    /// </summary>
+    /// <param name="elementIDs">The elements, one row each, in order; IDs may repeat.</param>
+    /// <param name="columns">The attributes to read.</param>
+    /// <returns>One row per element ID and one column per attribute read.</returns>
+    /// <exception cref="System::ArgumentNullException">Thrown when elementIDs is null.</exception>
+    /// <exception cref="System::ArgumentException">Thrown when columns is None or has unknown flags, or an element ID
+    /// is negative.</exception>
+    ElementAttributes^ GetAttributes(System::Collections::Generic::List<int>^ elementIDs, AttributeColumns columns);
+
+    /// <inheritdoc cref="GetAttributes(System::Collections::Generic::List{int}, AttributeColumns)"/>
+    ElementAttributes^ GetAttributes(array<int>^ elementIDs, AttributeColumns columns);
+
+    /// <summary>
+    /// Reads attributes of every element in a set, in ascending ID order, in one native call.
+    /// </summary>
+    /// <param name="elementIDs">The elements.</param>
+    /// <param name="columns">The attributes to read.</param>
+    /// <returns>One row per element, in ascending ID order.</returns>
+    /// <exception cref="System::ArgumentNullException">Thrown when elementIDs is null.</exception>
+    /// <exception cref="System::ArgumentException">Thrown when columns is None or has unknown flags.</exception>
+    ElementAttributes^ GetAttributes(ElementIdSet^ elementIDs, AttributeColumns columns);
+
+    System::String^ GetName(int elementID);
+    System::String^ GetGroup(int elementID);
+    System::String^ GetSubgroup(int elementID);
+    System::String^ GetComment(int elementID);
+    System::String^ GetMaterial(int elementID);
+  };
+}
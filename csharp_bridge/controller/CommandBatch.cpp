@@ -0,0 +1,226 @@
+#include "CommandBatch.h"
+#include "ElementIdList.h"
+#include "ElementIdListPool.h"
+#include "ElementQueryCache.h"
+#include "../diagnostics/BridgeCounters.h"
+#include "../geometry/CoreConversions.h"
+#include "../interop/CommandBatchInterop.h"
+#include "../native/CommandQueue.h"
+
+#include <cstring>
+
+namespace CwAPI3D::Net::Bridge
+{
+  CommandBatch::CommandBatch(Interfaces::ICwAPI3DElementController* elementController, ElementIdListPool^ listPool,
+    ElementQueryCache^ queryCache)
+  {
+    if (!elementController)
+      throw gcnew System::ArgumentNullException("elementController");
+    if (listPool == nullptr)
+      throw gcnew System::ArgumentNullException("listPool");
+    if (queryCache == nullptr)
+      throw gcnew System::ArgumentNullException("queryCache");
+
+    m_elementController = elementController;
+    m_listPool = listPool;
+    m_queryCache = queryCache;
+    m_queue = new Native::CommandQueue();
+    m_copies = new Native::CopyResults();
+    m_copies->offsets.push_back(0u);
+    m_recorded = 0;
+    m_nativeCalls = 0;
+  }
+
+  CommandBatch::~CommandBatch()
+  {
+    this->!CommandBatch();
+  }
+
+  CommandBatch::!CommandBatch()
+  {
+    delete m_queue;
+    m_queue = nullptr;
+    delete m_copies;
+    m_copies = nullptr;
+  }
+
+  void CommandBatch::ThrowIfDisposed()
+  {
+    if (!m_queue)
+      throw gcnew System::ObjectDisposedException("CommandBatch");
+  }
+
+  int CommandBatch::Count::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_queue->size());
+  }
+
+  void CommandBatch::Record(Native::CommandKind kind, List<int>^ elementIDs, Vector3D^ vec)
+  {
+    ThrowIfDisposed();
+    if (elementIDs == nullptr)
+      throw gcnew System::ArgumentNullException("elementIDs");
+
+    const int count = elementIDs->Count;
+    if (m_idScratch == nullptr || m_idScratch->Length < count)
+      m_idScratch = gcnew array<int>(count);
+    elementIDs->CopyTo(m_idScratch);
+    Record(kind, count, vec);
+  }
+
+  void CommandBatch::Record(Native::CommandKind kind, ElementIdList^ elementIDs, Vector3D^ vec)
+  {
+    ThrowIfDisposed();
+    if (elementIDs == nullptr)
+      throw gcnew System::ArgumentNullException("elementIDs");
+
+    array<int>^ buffer = m_idScratch;
+    const int count = elementIDs->CopyTo(buffer);
+    m_idScratch = buffer;
+    Record(kind, count, vec);
+  }
+
+  void CommandBatch::Record(Native::CommandKind kind, int count, Vector3D^ vec)
+  {
+    const Core::Vec3d vector = vec != nullptr ? Detail::ToCore(vec) : Core::Vec3d{};
+    bool recorded = false;
+    if (count == 0)
+    {
+      recorded = m_queue->record(kind, nullptr, 0u, vector);
+    }
+    else
+    {
+      pin_ptr<int> source = &m_idScratch[0];
+      recorded = m_queue->record(kind, source, static_cast<uint32_t>(count), vector);
+    }
+    if (!recorded)
+      throw gcnew System::ArgumentException("Element ID cannot be negative.", "elementIDs");
+
+    BridgeCounters::Add(Detail::Counter::IdsToNative, count);
+    if (vec != nullptr)
+      BridgeCounters::Add(Detail::Counter::VectorsToNative, 1);
+    ++m_recorded;
+  }
+
+  void CommandBatch::MoveElement(List<int>^ elementIDs, Vector3D^ vec)
+  {
+    if (vec == nullptr)
+      throw gcnew System::ArgumentNullException("vec");
+
+    Record(Native::CommandKind::Move, elementIDs, vec);
+  }
+
+  void CommandBatch::MoveElement(ElementIdList^ elementIDs, Vector3D^ vec)
+  {
+    if (vec == nullptr)
+      throw gcnew System::ArgumentNullException("vec");
+
+    Record(Native::CommandKind::Move, elementIDs, vec);
+  }
+
+  int CommandBatch::CopyElements(List<int>^ elementIDs, Vector3D^ vec)
+  {
+    if (vec == nullptr)
+      throw gcnew System::ArgumentNullException("vec");
+
+    Record(Native::CommandKind::Copy, elementIDs, vec);
+    return static_cast<int>(m_queue->copyCount()) - 1;
+  }
+
+  int CommandBatch::CopyElements(ElementIdList^ elementIDs, Vector3D^ vec)
+  {
+    if (vec == nullptr)
+      throw gcnew System::ArgumentNullException("vec");
+
+    Record(Native::CommandKind::Copy, elementIDs, vec);
+    return static_cast<int>(m_queue->copyCount()) - 1;
+  }
+
+  void CommandBatch::DeleteElements(List<int>^ elementIDs)
+  {
+    Record(Native::CommandKind::Delete, elementIDs, nullptr);
+  }
+
+  void CommandBatch::DeleteElements(ElementIdList^ elementIDs)
+  {
+    Record(Native::CommandKind::Delete, elementIDs, nullptr);
+  }
+
+  void CommandBatch::JoinElements(List<int>^ elementIDs)
+  {
+    Record(Native::CommandKind::Join, elementIDs, nullptr);
+  }
+
+  void CommandBatch::JoinElements(ElementIdList^ elementIDs)
+  {
+    Record(Native::CommandKind::Join, elementIDs, nullptr);
+  }
+
+  void CommandBatch::JoinTopLevelElements(List<int>^ elementIDs)
+  {
+    Record(Native::CommandKind::JoinTopLevel, elementIDs, nullptr);
+  }
+
+  void CommandBatch::JoinTopLevelElements(ElementIdList^ elementIDs)
+  {
+    Record(Native::CommandKind::JoinTopLevel, elementIDs, nullptr);
+  }
+
+  int CommandBatch::Flush()
+  {
+    ThrowIfDisposed();
+    m_queue->coalesce();
+
+    // Moves and joins leave the query results as they are; copies and deletes change which elements exist.
+    for (const Native::Command& command : m_queue->commands())
+    {
+      if (command.kind == Native::CommandKind::Copy || command.kind == Native::CommandKind::Delete)
+      {
+        m_queryCache->Invalidate(ElementQueries::Any);
+        break;
+      }
+    }
+
+    // One pooled native list is refilled for every command; the queue is emptied even if the controller throws,
+    // so a failed flush is not replayed by the next one.
+    const auto scratch = m_listPool->RentNative();
+    uint32_t calls = 0;
+    try
+    {
+      calls = Interop::FlushCommands(m_elementController, scratch, *m_queue, *m_copies);
+    }
+    finally
+    {
+      m_listPool->ReturnNative(scratch);
+      m_queue->clear();
+    }
+
+    m_nativeCalls += calls;
+    return static_cast<int>(calls);
+  }
+
+  List<int>^ CommandBatch::GetCopiedElements(int copy)
+  {
+    ThrowIfDisposed();
+    if (copy < 0 || static_cast<size_t>(copy) + 1 >= m_copies->offsets.size())
+      throw gcnew System::ArgumentOutOfRangeException("copy", "The last flushed batch does not contain this copy.");
+
+    const uint32_t begin = m_copies->offsets[copy];
+    const uint32_t count = m_copies->offsets[copy + 1] - begin;
+    auto ids = gcnew array<int>(static_cast<int>(count));
+    BridgeCounters::Add(Detail::Counter::IdsToManaged, count);
+    if (count != 0)
+    {
+      pin_ptr<int> destination = &ids[0];
+      std::memcpy(destination, m_copies->ids.data() + begin, count * sizeof(int));
+    }
+    return gcnew List<int>(ids);
+  }
+
+  void CommandBatch::Clear()
+  {
+    ThrowIfDisposed();
+    m_queue->clear();
+  }
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstdint>
+
+using namespace System::Collections::Generic;
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DElementController;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace Native
+  {
+    enum class CommandKind : std::uint8_t;
+    class CommandQueue;
+    struct CopyResults;
+  }
+
+  ref class Vector3D;
+  ref class ElementIdList;
+  ref class ElementIdListPool;
+  ref class ElementQueryCache;
+
+  /// <summary>
+  /// Records move, copy, delete and join operations and sends them to the element controller on Flush.
+  /// Before flushing, the recorded operations are coalesced: consecutive moves of the same elements become one
+  /// move, moves of elements deleted later in the batch are dropped, consecutive deletes are merged and
+  /// overlapping joins recorded back to back are joined as one set. Each remaining operation is one native call.
+  /// </summary>
+  /// <remarks>
+  /// Copies are never merged. Because the IDs of copied elements are only known after Flush, CopyElements returns
+  /// the index of the copy within the batch; pass it to GetCopiedElements after flushing.
+  /// </remarks>
+  public ref class CommandBatch
+  {
+  private:
+    Interfaces::ICwAPI3DElementController* m_elementController;
+    ElementIdListPool^ m_listPool;
+    ElementQueryCache^ m_queryCache;
+    Native::CommandQueue* m_queue;
+    Native::CopyResults* m_copies;
+    array<int>^ m_idScratch;
+    long long m_recorded;
+    long long m_nativeCalls;
+
+    void ThrowIfDisposed();
+    void Record(Native::CommandKind kind, List<int>^ elementIDs, Vector3D^ vec);
+    void Record(Native::CommandKind kind, ElementIdList^ elementIDs, Vector3D^ vec);
+    void Record(Native::CommandKind kind, int count, Vector3D^ vec);
+
+  public:
+    /// <summary>
+    /// Gets the number of operations recorded since the last Flush or Clear.
+    /// </summary>
+    property int Count
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the total number of operations recorded by this batch.
+    /// </summary>
+    property long long RecordedCount
+    {
+      long long get() { return m_recorded; }
+    }
+
+    /// <summary>
+    /// Gets the total number of element controller calls made by Flush.
+    /// Compare with RecordedCount to see how much coalescing saved.
+    /// </summary>
+    property long long NativeCallCount
+    {
+      long long get() { return m_nativeCalls; }
+    }
+
+    /// <summary>
+    /// Records a move of the elements by the vector.
+    /// </summary>
+    /// <exception cref="System::ArgumentException">Thrown when any element ID is negative.</exception>
+    void MoveElement(List<int>^ elementIDs, Vector3D^ vec);
+    void MoveElement(ElementIdList^ elementIDs, Vector3D^ vec);
+
+    /// <summary>
+    /// Records a copy of the elements, offset by the vector.
+    /// </summary>
+    /// <returns>The index of the copy within this batch, for GetCopiedElements.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when any element ID is negative.</exception>
+    int CopyElements(List<int>^ elementIDs, Vector3D^ vec);
+    int CopyElements(ElementIdList^ elementIDs, Vector3D^ vec);
+
+    /// <summary>
+    /// Records a deletion of the elements.
+    /// </summary>
+    /// <exception cref="System::ArgumentException">Thrown when any element ID is negative.</exception>
+    void DeleteElements(List<int>^ elementIDs);
+    void DeleteElements(ElementIdList^ elementIDs);
+
+    /// <summary>
+    /// Records a join of the elements.
+    /// </summary>
+    /// <exception cref="System::ArgumentException">Thrown when any element ID is negative.</exception>
+    void JoinElements(List<int>^ elementIDs);
+    void JoinElements(ElementIdList^ elementIDs);
+
+    /// <summary>
+    /// Records a top-level join of the elements.
+    /// </summary>
+    /// <exception cref="System::ArgumentException">Thrown when any element ID is negative.</exception>
+    void JoinTopLevelElements(List<int>^ elementIDs);
+    void JoinTopLevelElements(ElementIdList^ elementIDs);
+
+    /// <summary>
+    /// Coalesces the recorded operations and sends them to the element controller in a single native call
+    /// from managed code. The batch is empty afterwards, also when the controller throws.
+    /// Flushing copies or deletes drops the element controller's cached query results.
+    /// </summary>
+    /// <returns>The number of element controller calls made.</returns>
+    int Flush();
+
+    /// <summary>
+    /// Gets the IDs created by a copy of the last flushed batch.
+    /// </summary>
+    /// <param name="copy">The value CopyElements returned.</param>
+    /// <returns>The new element IDs, one per copied element.</returns>
+    /// <exception cref="System::ArgumentOutOfRangeException">Thrown when the last Flush did not include this copy.</exception>
+    List<int>^ GetCopiedElements(int copy);
+
+    /// <summary>
+    /// Discards the recorded operations without sending them.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Releases the native queue.
+    /// </summary>
+    ~CommandBatch();
+
+    /// <summary>
+    /// Finalizer. Releases the native queue if the batch was not disposed.
+    /// </summary>
+    !CommandBatch();
+
+  internal:
+    CommandBatch(Interfaces::ICwAPI3DElementController* elementController, ElementIdListPool^ listPool, ElementQueryCache^ queryCache);
+  };
+}
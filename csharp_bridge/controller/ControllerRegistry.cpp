@@ -0,0 +1,84 @@
+#include "ControllerRegistry.h"
+
+#include <msclr/lock.h>
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+namespace CwAPI3D::Net::Bridge
+{
+  ControllerRegistry::Entry::Entry(Func<Object^>^ factory)
+  {
+    m_factory = factory;
+    m_sync = gcnew Object();
+    m_created = false;
+    m_creations = 0;
+  }
+
+  Object^ ControllerRegistry::Entry::Instance::get()
+  {
+    if (Volatile::Read(m_created))
+      return m_instance;
+
+    // Unlike Lazy<T> with ExecutionAndPublication, a failed creation is not cached: the exception reaches this
+    // caller and the next one runs the factory again. Only successful creations are counted.
+    msclr::lock guard(m_sync);
+    if (!m_created)
+    {
+      m_instance = m_factory();
+      Interlocked::Increment(m_creations);
+      Volatile::Write(m_created, true);
+    }
+    return m_instance;
+  }
+
+  ControllerRegistry::ControllerRegistry()
+  {
+    m_entries = gcnew Dictionary<Type^, Entry^>();
+  }
+
+  void ControllerRegistry::Register(Type^ controllerType, Func<Object^>^ factory)
+  {
+    if (controllerType == nullptr)
+      throw gcnew ArgumentNullException("controllerType");
+    if (factory == nullptr)
+      throw gcnew ArgumentNullException("factory");
+    if (m_entries->ContainsKey(controllerType))
+      throw gcnew InvalidOperationException(String::Format("Controller {0} is already registered.", controllerType->Name));
+
+    m_entries->Add(controllerType, gcnew Entry(factory));
+  }
+
+  ControllerRegistry::Entry^ ControllerRegistry::Find(Type^ controllerType)
+  {
+    if (controllerType == nullptr)
+      throw gcnew ArgumentNullException("controllerType");
+
+    Entry^ entry;
+    if (!m_entries->TryGetValue(controllerType, entry))
+      throw gcnew ArgumentException(String::Format("Controller {0} is not registered.", controllerType->Name), "controllerType");
+
+    return entry;
+  }
+
+  int ControllerRegistry::GetCreationCount(Type^ controllerType)
+  {
+    return Find(controllerType)->Creations;
+  }
+
+  bool ControllerRegistry::IsCreated(Type^ controllerType)
+  {
+    return Find(controllerType)->IsCreated;
+  }
+
+  int ControllerRegistry::TotalCreations::get()
+  {
+    int total = 0;
+    for each (Entry^ entry in m_entries->Values)
+    {
+      total += entry->Creations;
+    }
+    return total;
+  }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  /// <summary>
+  /// Lazily creates and caches one managed wrapper per native controller.
+  /// Each registered controller is created at most once, on first use, even when several threads ask for it at the same time.
+  /// </summary>
+  public ref class ControllerRegistry
+  {
+  private:
+    ref class Entry
+    {
+    private:
+      System::Func<System::Object^>^ m_factory;
+      System::Object^ m_sync;
+      System::Object^ m_instance;
+      bool m_created;
+      int m_creations;
+
+    public:
+      explicit Entry(System::Func<System::Object^>^ factory);
+
+      /// Creates the wrapper on first use. A factory that throws leaves the entry uncreated, so the next call
+      /// retries rather than rethrowing the first failure.
+      property System::Object^ Instance
+      {
+        System::Object^ get();
+      }
+
+      property bool IsCreated
+      {
+        bool get() { return System::Threading::Volatile::Read(m_created); }
+      }
+
+      property int Creations
+      {
+        int get() { return m_creations; }
+      }
+    };
+
+    // Only written while the owning factory registers its controllers, so concurrent lookups need no lock.
+    System::Collections::Generic::Dictionary<System::Type^, Entry^>^ m_entries;
+
+    Entry^ Find(System::Type^ controllerType);
+
+  public:
+    ControllerRegistry();
+
+    /// <summary>
+    /// Gets the number of times the wrapper for the given controller type has been created.
+    /// </summary>
+    /// <param name="controllerType">The managed controller type.</param>
+    /// <returns>0 before the first successful creation, 1 afterwards.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when the type is not registered.</exception>
+    int GetCreationCount(System::Type^ controllerType);
+
+    /// <summary>
+    /// Determines whether the wrapper for the given controller type has already been created.
+    /// </summary>
+    /// <param name="controllerType">The managed controller type.</param>
+    /// <returns>true if the controller has been created; otherwise, false.</returns>
+    bool IsCreated(System::Type^ controllerType);
+
+    /// <summary>
+    /// Gets the total number of wrappers created through this registry.
+    /// </summary>
+    property int TotalCreations
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the managed types of all registered controllers.
+    /// </summary>
+    property System::Collections::Generic::IEnumerable<System::Type^>^ RegisteredTypes
+    {
+      System::Collections::Generic::IEnumerable<System::Type^>^ get() { return m_entries->Keys; }
+    }
+
+  internal:
+    void Register(System::Type^ controllerType, System::Func<System::Object^>^ factory);
+
+    template <typename TController>
+    TController^ Get()
+    {
+      return safe_cast<TController^>(Find(TController::typeid)->Instance);
+    }
+  };
+}
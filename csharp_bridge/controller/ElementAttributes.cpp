@@ -0,0 +1,103 @@
+#include "ElementAttributes.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace CwAPI3D::Net::Bridge
+{
+  ElementAttributes::ElementAttributes(array<int>^ ids, AttributeColumns columns, array<int>^ indices,
+    array<int>^ offsets, array<String^>^ strings)
+  {
+    m_ids = ids;
+    m_columns = columns;
+    m_indices = indices;
+    m_offsets = offsets;
+    m_strings = strings;
+  }
+
+  int ElementAttributes::ColumnIndex(AttributeColumns column)
+  {
+    switch (column)
+    {
+    case AttributeColumns::Name: return 0;
+    case AttributeColumns::Group: return 1;
+    case AttributeColumns::Subgroup: return 2;
+    case AttributeColumns::Comment: return 3;
+    case AttributeColumns::Material: return 4;
+    default: return -1;
+    }
+  }
+
+  int ElementAttributes::OffsetOf(AttributeColumns column)
+  {
+    const int index = ColumnIndex(column);
+    if (index < 0 || m_offsets[index] < 0)
+      throw gcnew ArgumentException("Expected a single column that was read.", "column");
+    return m_offsets[index];
+  }
+
+  array<int>^ ElementAttributes::GetColumn(AttributeColumns column)
+  {
+    const int offset = OffsetOf(column);
+    auto result = gcnew array<int>(m_ids->Length);
+    Array::Copy(m_indices, offset, result, 0, m_ids->Length);
+    return result;
+  }
+
+  String^ ElementAttributes::GetValue(AttributeColumns column, int row)
+  {
+    const int offset = OffsetOf(column);
+    if (row < 0 || row >= m_ids->Length)
+      throw gcnew ArgumentOutOfRangeException("row");
+
+    return m_strings[m_indices[offset + row]];
+  }
+
+  int ElementAttributes::IndexOf(String^ value)
+  {
+    if (value == nullptr)
+      throw gcnew ArgumentNullException("value");
+
+    for (int i = 0; i < m_strings->Length; ++i)
+    {
+      if (String::Equals(m_strings[i], value, StringComparison::Ordinal))
+        return i;
+    }
+    return -1;
+  }
+
+  List<int>^ ElementAttributes::FindElements(AttributeColumns column, String^ value)
+  {
+    const int offset = OffsetOf(column);
+    const int wanted = IndexOf(value);
+    auto result = gcnew List<int>();
+    if (wanted < 0)
+      return result;
+
+    for (int row = 0; row < m_ids->Length; ++row)
+    {
+      if (m_indices[offset + row] == wanted)
+        result->Add(m_ids[row]);
+    }
+    return result;
+  }
+
+  List<int>^ ElementAttributes::FindElements(AttributeColumns column, Predicate<String^>^ match)
+  {
+    const int offset = OffsetOf(column);
+    if (match == nullptr)
+      throw gcnew ArgumentNullException("match");
+
+    auto matches = gcnew array<bool>(m_strings->Length);
+    for (int i = 0; i < m_strings->Length; ++i)
+      matches[i] = match(m_strings[i]);
+
+    auto result = gcnew List<int>();
+    for (int row = 0; row < m_ids->Length; ++row)
+    {
+      if (matches[m_indices[offset + row]])
+        result->Add(m_ids[row]);
+    }
+    return result;
+  }
+}
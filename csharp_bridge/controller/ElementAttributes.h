@@ -0,0 +1,124 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  /// <summary>
+  /// The attribute columns AttributeController.GetAttributes reads; combine them to read several in one call.
+  /// </summary>
+  [System::Flags]
+  public enum class AttributeColumns
+  {
+    None = 0,
+    Name = 1,
+    Group = 2,
+    Subgroup = 4,
+    Comment = 8,
+    Material = 16,
+    All = Name | Group | Subgroup | Comment | Material
+  };
+
+  /// <summary>
+  /// Attributes of many elements, one row per element and one column per attribute read.
+  /// </summary>
+  /// <remarks>
+  /// Each distinct value is stored once, in Strings; a column holds per row the index of the row's value in Strings.
+  /// Filtering compares a value against the distinct strings, not against every row, so FindElements over 300,000
+  /// elements with 50 materials makes 50 string comparisons.
+  /// </remarks>
+  public ref class ElementAttributes sealed
+  {
+  private:
+    array<int>^ m_ids;
+    array<System::String^>^ m_strings;
+    /// Every column read, back to back in AttributeColumns order; m_offsets[c] is where column c starts, or -1.
+    array<int>^ m_indices;
+    array<int>^ m_offsets;
+    AttributeColumns m_columns;
+
+    /// The index of a single column flag in AttributeColumns order, or -1.
+    static int ColumnIndex(AttributeColumns column);
+    int OffsetOf(AttributeColumns column);
+
+  internal:
+    ElementAttributes(array<int>^ ids, AttributeColumns columns, array<int>^ indices, array<int>^ offsets,
+      array<System::String^>^ strings);
+
+  public:
+    /// <summary>
+    /// Gets the number of rows.
+    /// </summary>
+    property int Count
+    {
+      int get() { return m_ids->Length; }
+    }
+
+    /// <summary>
+    /// Gets the element ID of every row. The array belongs to this object; do not modify it.
+    /// </summary>
+    property array<int>^ ElementIds
+    {
+      array<int>^ get() { return m_ids; }
+    }
+
+    /// <summary>
+    /// Gets the columns that were read.
+    /// </summary>
+    property AttributeColumns Columns
+    {
+      AttributeColumns get() { return m_columns; }
+    }
+
+    /// <summary>
+    /// Gets the distinct values of all columns read, each marshalled once. The array belongs to this object; do not
+    /// modify it.
+    /// </summary>
+    property array<System::String^>^ Strings
+    {
+      array<System::String^>^ get() { return m_strings; }
+    }
+
+    /// <summary>
+    /// Copies a column: for every row, the index of its value in Strings.
+    /// </summary>
+    /// <param name="column">A single column that was read.</param>
+    /// <returns>A new array with one index per row.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when column is not a single column that was read.</exception>
+    array<int>^ GetColumn(AttributeColumns column);
+
+    /// <summary>
+    /// Gets the value of one column in one row.
+    /// </summary>
+    /// <param name="column">A single column that was read.</param>
+    /// <param name="row">The row, from 0 to Count - 1.</param>
+    /// <returns>The value; empty when the element has none.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when column is not a single column that was read.</exception>
+    /// <exception cref="System::ArgumentOutOfRangeException">Thrown when row is out of range.</exception>
+    System::String^ GetValue(AttributeColumns column, int row);
+
+    /// <summary>
+    /// Finds a value among the distinct values.
+    /// </summary>
+    /// <param name="value">The value, compared ordinally.</param>
+    /// <returns>The index of the value in Strings, or -1 if no element has it.</returns>
+    int IndexOf(System::String^ value);
+
+    /// <summary>
+    /// Finds the elements whose column has the given value.
+    /// </summary>
+    /// <param name="column">A single column that was read.</param>
+    /// <param name="value">The value, compared ordinally.</param>
+    /// <returns>The element IDs of the matching rows, in row order.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when column is not a single column that was read.</exception>
+    System::Collections::Generic::List<int>^ FindElements(AttributeColumns column, System::String^ value);
+
+    /// <summary>
+    /// Finds the elements whose column has a value that matches a predicate. The predicate runs once per distinct
+    /// value, not once per element.
+    /// </summary>
+    /// <param name="column">A single column that was read.</param>
+    /// <param name="match">The predicate.</param>
+    /// <returns>The element IDs of the matching rows, in row order.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when column is not a single column that was read.</exception>
+    System::Collections::Generic::List<int>^ FindElements(AttributeColumns column, System::Predicate<System::String^>^ match);
+  };
+}
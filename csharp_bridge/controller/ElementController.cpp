@@ -1,158 +1,1048 @@
 #include "ElementController.h"
+#include "CommandBatch.h"
+#include "ElementFilter.h"
+#include "ElementIdEnumerable.h"
+#include "ElementIdList.h"
+#include "ElementIdSet.h"
+#include "ElementQueryCache.h"
+#include "ElementIdListPool.h"
+#include "../diagnostics/BridgeCounters.h"
+#include "../diagnostics/TraceScope.h"
 #include "../geometry/Point3D.h"
+#include "../geometry/PointBuffer.h"
 #include "../geometry/Vector3D.h"
+#include "../geometry/Vector3DValue.h"
+#include "../interop/BeamCreationInterop.h"
+#include "../interop/ElementFilterInterop.h"
+#include "../interop/ElementIdListInterop.h"
+#include "../interop/ElementIdSetInterop.h"
+#include "../native/ElementFilter.h"
+#include "../native/IdSet.h"
+#include "../native/SoaBuffer.h"
+#include "../threading/CadThreadExecutor.h"
 
 #include <ICwAPI3DControllerFactory.h>
 #include <ICwAPI3DElementController.h>
 #include <ICwAPI3DElementIDList.h>
+#include <msclr/gcroot.h>
+#include <memory>
 #include <stdexcept>
 
+namespace
+{
+  // Hands a native list rented by ConvertToNativeList back to its pool when the call returns or throws.
+  class PooledListLease
+  {
+    msclr::gcroot<CwAPI3D::Net::Bridge::ElementIdListPool^> m_pool;
+    CwAPI3D::Interfaces::ICwAPI3DElementIDList* m_nativeList;
+
+  public:
+    PooledListLease(CwAPI3D::Net::Bridge::ElementIdListPool^ pool, CwAPI3D::Interfaces::ICwAPI3DElementIDList* nativeList)
+      : m_pool(pool), m_nativeList(nativeList) {}
+
+    PooledListLease(const PooledListLease&) = delete;
+    PooledListLease& operator=(const PooledListLease&) = delete;
+
+    ~PooledListLease() { m_pool->ReturnNative(m_nativeList); }
+
+    CwAPI3D::Interfaces::ICwAPI3DElementIDList* get() const { return m_nativeList; }
+  };
+
+  void ThrowIfLengthMismatch(int expected, int actual, System::String^ paramName)
+  {
+    if (actual != expected)
+      throw gcnew System::ArgumentException("All beam inputs must have the same length.", paramName);
+  }
+
+  // Async calls run later on the CAD thread, so they work on copies of the caller's inputs.
+  List<int>^ SnapshotIds(List<int>^ elementIDs)
+  {
+    if (elementIDs == nullptr)
+      throw gcnew System::ArgumentNullException("elementIDs");
+    return gcnew List<int>(elementIDs);
+  }
+
+  CwAPI3D::Net::Bridge::Vector3D^ SnapshotVector(CwAPI3D::Net::Bridge::Vector3D^ vec)
+  {
+    if (vec == nullptr)
+      throw gcnew System::ArgumentNullException("vec");
+    return gcnew CwAPI3D::Net::Bridge::Vector3D(vec);
+  }
+
+  CwAPI3D::Net::Bridge::Interop::BeamPoints SoaPoints(CwAPI3D::Net::Bridge::PointBuffer^ points)
+  {
+    const auto storage = points->Storage;
+    return {storage->x(), storage->y(), storage->z(), 1u};
+  }
+}
+
 
 List<int>^ CwAPI3D::Net::Bridge::ElementController::ConvertToManagedList(CwAPI3D::Interfaces::ICwAPI3DElementIDList* nativeList)
 {
-  auto managedList = gcnew List<int>();
-  if (!nativeList) return managedList;
+  const uint32_t count = Interop::ElementIdCount(nativeList);
+  auto managedList = gcnew List<int>(static_cast<int>(count));
+  BridgeCounters::Add(Detail::Counter::IdsToManaged, count);
 
-  const size_t count = nativeList->count();
-  for (size_t i = 0; i < count; ++i)
+  // .NET Framework cannot fill a List's backing array directly, so the IDs go through a stack chunk instead of a
+  // temporary managed array; the List is sized once and never grows.
+  constexpr uint32_t ChunkSize = 1024;
+  int32_t chunk[ChunkSize];
+  for (uint32_t first = 0; first < count;)
   {
-    managedList->Add(static_cast<int>(nativeList->at(static_cast<uint32_t>(i))));
+    const uint32_t copied = Interop::CopyElementIdRange(nativeList, first, chunk, ChunkSize);
+    if (copied == 0) break;
+    for (uint32_t i = 0; i < copied; ++i) managedList->Add(chunk[i]);
+    first += copied;
   }
   return managedList;
 }
 
+array<int>^ CwAPI3D::Net::Bridge::ElementController::ConvertToManagedArray(CwAPI3D::Interfaces::ICwAPI3DElementIDList* nativeList)
+{
+  const uint32_t count = Interop::ElementIdCount(nativeList);
+  auto managedArray = gcnew array<int>(static_cast<int>(count));
+  BridgeCounters::Add(Detail::Counter::IdsToManaged, count);
+  if (count == 0) return managedArray;
+
+  pin_ptr<int> destination = &managedArray[0];
+  Interop::CopyElementIds(nativeList, destination, count);
+  return managedArray;
+}
+
+int CwAPI3D::Net::Bridge::ElementController::CopyToManagedBuffer(CwAPI3D::Interfaces::ICwAPI3DElementIDList* nativeList, array<int>^% buffer)
+{
+  const uint32_t count = Interop::ElementIdCount(nativeList);
+  if (buffer == nullptr || static_cast<uint32_t>(buffer->Length) < count)
+  {
+    buffer = gcnew array<int>(static_cast<int>(count));
+  }
+  BridgeCounters::Add(Detail::Counter::IdsToManaged, count);
+  if (count == 0) return 0;
+
+  pin_ptr<int> destination = &buffer[0];
+  return static_cast<int>(Interop::CopyElementIds(nativeList, destination, count));
+}
+
 CwAPI3D::Interfaces::ICwAPI3DElementIDList* CwAPI3D::Net::Bridge::ElementController::ConvertToNativeList(List<int>^ ids)
 {
-  const auto nativeList = m_controllerFactory->createEmptyElementIDList();
-  for each (int id in ids)
+  const int count = ids->Count;
+  if (m_idScratch == nullptr || m_idScratch->Length < count)
   {
-    if (id < 0)
-    {
-      throw std::invalid_argument("Element ID cannot be negative.");
-    }
-    nativeList->append(static_cast<elementID>(id));
+    m_idScratch = gcnew array<int>(count);
   }
 
+  const auto nativeList = m_listPool->RentNative();
+  BridgeCounters::Add(Detail::Counter::NativeIdLists, 1);
+  BridgeCounters::Add(Detail::Counter::IdsToNative, count);
+  if (count == 0) return nativeList;
+
+  ids->CopyTo(m_idScratch);
+  pin_ptr<int> source = &m_idScratch[0];
+  if (!Interop::AppendElementIds(nativeList, source, static_cast<uint32_t>(count)))
+  {
+    m_listPool->ReturnNative(nativeList);
+    throw std::invalid_argument("Element ID cannot be negative.");
+  }
 
   return nativeList;
 }
 
-CwAPI3D::Net::Bridge::ElementController::ElementController(Interfaces::ICwAPI3DControllerFactory* nativePtr)
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::ConvertToIdSet(CwAPI3D::Interfaces::ICwAPI3DElementIDList* nativeList)
 {
+  auto set = std::make_unique<Native::IdSet>();
+  BridgeCounters::Add(Detail::Counter::IdsToManaged, Interop::CollectElementIds(nativeList, *set));
+  return gcnew ElementIdSet(set.release());
+}
+
+CwAPI3D::Interfaces::ICwAPI3DElementIDList* CwAPI3D::Net::Bridge::ElementController::ConvertToNativeList(ElementIdSet^ ids)
+{
+  if (ids == nullptr)
+    throw gcnew System::ArgumentNullException("elementIDs");
+
+  const auto set = ids->Storage;
+  const auto nativeList = m_listPool->RentNative();
+  BridgeCounters::Add(Detail::Counter::NativeIdLists, 1);
+  BridgeCounters::Add(Detail::Counter::IdsToNative, static_cast<long long>(set->size()));
+  Interop::AppendElementIds(nativeList, *set);
+  System::GC::KeepAlive(ids);
+  return nativeList;
+}
+
+CwAPI3D::Net::Bridge::ElementController::ElementController(Interfaces::ICwAPI3DControllerFactory* nativePtr, CadThreadExecutor^ executor)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_Create);
+  if (executor == nullptr)
+    throw gcnew System::ArgumentNullException("executor");
+
   m_controllerFactory = nativePtr;
+  m_executor = executor;
   m_elementController = m_controllerFactory->getElementController();
+  m_listPool = gcnew ElementIdListPool(m_controllerFactory);
+  m_queryCache = gcnew ElementQueryCache();
+}
+
+// The callers marshal the list after this returns, so the native span ends here.
+CwAPI3D::Interfaces::ICwAPI3DElementIDList* CwAPI3D::Net::Bridge::ElementController::RunQuery(ElementQueries query)
+{
+  Detail::NativeTraceScope native;
+  CwAPI3D::Interfaces::ICwAPI3DElementIDList* result;
+  switch (query)
+  {
+  case ElementQueries::AllIdentifiable: result = m_elementController->getAllIdentifiableElementIDs(); break;
+  case ElementQueries::Visible: result = m_elementController->getVisibleIdentifiableElementIDs(); break;
+  case ElementQueries::Invisible: result = m_elementController->getInvisibleIdentifiableElementIDs(); break;
+  case ElementQueries::Active: result = m_elementController->getActiveIdentifiableElementIDs(); break;
+  case ElementQueries::InactiveAll: result = m_elementController->getInactiveAllIdentifiableElementIDs(); break;
+  case ElementQueries::InactiveVisible: result = m_elementController->getInactiveVisibleIdentifiableElementIDs(); break;
+  default: throw gcnew System::ArgumentException("Expected a single query.", "query");
+  }
+  native.leave();
+  return result;
+}
+
+// The cached array is never handed out: every caller copies it into its own list, buffer or set.
+array<int>^ CwAPI3D::Net::Bridge::ElementController::QueryIds(ElementQueries query)
+{
+  array<int>^ ids;
+  if (m_queryCache->TryGet(query, ids))
+    return ids;
+
+  ids = ConvertToManagedArray(RunQuery(query));
+  m_queryCache->Store(query, ids);
+  return ids;
+}
+
+int CwAPI3D::Net::Bridge::ElementController::QueryIdsInto(ElementQueries query, array<int>^% buffer)
+{
+  if (!m_queryCache->Enabled)
+    return CopyToManagedBuffer(RunQuery(query), buffer);
+
+  const auto ids = QueryIds(query);
+  if (buffer == nullptr || buffer->Length < ids->Length)
+  {
+    buffer = gcnew array<int>(ids->Length);
+  }
+  System::Array::Copy(ids, buffer, ids->Length);
+  return ids->Length;
+}
+
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::QueryIdSet(ElementQueries query)
+{
+  if (!m_queryCache->Enabled)
+    return ConvertToIdSet(RunQuery(query));
+
+  return ElementIdSet::FromArray(QueryIds(query));
+}
+
+IEnumerator<int>^ CwAPI3D::Net::Bridge::ElementController::OpenQuery(ElementQueries query, int pageSize)
+{
+  array<int>^ cached;
+  if (m_queryCache->TryGet(query, cached))
+    return gcnew ElementIdEnumerator(cached);
+
+  return gcnew ElementIdEnumerator(RunQuery(query), pageSize);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::InvalidateQueries()
+{
+  m_queryCache->Invalidate(ElementQueries::Any);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::NotifyModelChanged()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_NotifyModelChanged);
+  m_queryCache->Invalidate(ElementQueries::Any);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::NotifyModelChanged(ElementQueries changed)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_NotifyModelChanged_Queries);
+  m_queryCache->Invalidate(changed);
+}
+
+CwAPI3D::Net::Bridge::ElementIdList^ CwAPI3D::Net::Bridge::ElementController::CreateElementIdList()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateElementIdList);
+  return m_listPool->Rent();
+}
+
+CwAPI3D::Net::Bridge::CommandBatch^ CwAPI3D::Net::Bridge::ElementController::CreateCommandBatch()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateCommandBatch);
+  return gcnew CommandBatch(m_elementController, m_listPool, m_queryCache);
 }
 
 List<int>^ CwAPI3D::Net::Bridge::ElementController::GetAllIdentifiableElementIDs()
 {
-  return ConvertToManagedList(m_elementController->getAllIdentifiableElementIDs());
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetAllIdentifiableElementIDs);
+  return gcnew List<int>(QueryIds(ElementQueries::AllIdentifiable));
 }
 
 List<int>^ CwAPI3D::Net::Bridge::ElementController::GetVisibleIdentifiableElementIDs()
 {
-  return ConvertToManagedList(m_elementController->getVisibleIdentifiableElementIDs());
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetVisibleIdentifiableElementIDs);
+  return gcnew List<int>(QueryIds(ElementQueries::Visible));
 }
 
 List<int>^ CwAPI3D::Net::Bridge::ElementController::GetInvisibleIdentifiableElementIDs()
 {
-  return ConvertToManagedList(m_elementController->getInvisibleIdentifiableElementIDs());
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInvisibleIdentifiableElementIDs);
+  return gcnew List<int>(QueryIds(ElementQueries::Invisible));
 }
 
 List<int>^ CwAPI3D::Net::Bridge::ElementController::GetActiveIdentifiableElementIDs()
 {
-  return ConvertToManagedList(m_elementController->getActiveIdentifiableElementIDs());
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetActiveIdentifiableElementIDs);
+  return gcnew List<int>(QueryIds(ElementQueries::Active));
 }
 
 List<int>^ CwAPI3D::Net::Bridge::ElementController::GetInactiveAllIdentifiableElementIDs()
 {
-  return ConvertToManagedList(m_elementController->getInactiveAllIdentifiableElementIDs());
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInactiveAllIdentifiableElementIDs);
+  return gcnew List<int>(QueryIds(ElementQueries::InactiveAll));
 }
 
 List<int>^ CwAPI3D::Net::Bridge::ElementController::GetInactiveVisibleIdentifiableElementIDs()
 {
-  return ConvertToManagedList(m_elementController->getInactiveVisibleIdentifiableElementIDs());
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInactiveVisibleIdentifiableElementIDs);
+  return gcnew List<int>(QueryIds(ElementQueries::InactiveVisible));
+}
+
+int CwAPI3D::Net::Bridge::ElementController::GetAllIdentifiableElementIDsInto(array<int>^% buffer)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetAllIdentifiableElementIDsInto);
+  return QueryIdsInto(ElementQueries::AllIdentifiable, buffer);
+}
+
+int CwAPI3D::Net::Bridge::ElementController::GetVisibleIdentifiableElementIDsInto(array<int>^% buffer)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetVisibleIdentifiableElementIDsInto);
+  return QueryIdsInto(ElementQueries::Visible, buffer);
+}
+
+int CwAPI3D::Net::Bridge::ElementController::GetInvisibleIdentifiableElementIDsInto(array<int>^% buffer)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInvisibleIdentifiableElementIDsInto);
+  return QueryIdsInto(ElementQueries::Invisible, buffer);
+}
+
+int CwAPI3D::Net::Bridge::ElementController::GetActiveIdentifiableElementIDsInto(array<int>^% buffer)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetActiveIdentifiableElementIDsInto);
+  return QueryIdsInto(ElementQueries::Active, buffer);
 }
 
+int CwAPI3D::Net::Bridge::ElementController::GetInactiveAllIdentifiableElementIDsInto(array<int>^% buffer)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInactiveAllIdentifiableElementIDsInto);
+  return QueryIdsInto(ElementQueries::InactiveAll, buffer);
+}
+
+int CwAPI3D::Net::Bridge::ElementController::GetInactiveVisibleIdentifiableElementIDsInto(array<int>^% buffer)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInactiveVisibleIdentifiableElementIDsInto);
+  return QueryIdsInto(ElementQueries::InactiveVisible, buffer);
+}
+
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::GetAllIdentifiableElementIDSet()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetAllIdentifiableElementIDSet);
+  return QueryIdSet(ElementQueries::AllIdentifiable);
+}
+
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::GetVisibleIdentifiableElementIDSet()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetVisibleIdentifiableElementIDSet);
+  return QueryIdSet(ElementQueries::Visible);
+}
+
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::GetInvisibleIdentifiableElementIDSet()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInvisibleIdentifiableElementIDSet);
+  return QueryIdSet(ElementQueries::Invisible);
+}
+
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::GetActiveIdentifiableElementIDSet()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetActiveIdentifiableElementIDSet);
+  return QueryIdSet(ElementQueries::Active);
+}
+
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::GetInactiveAllIdentifiableElementIDSet()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInactiveAllIdentifiableElementIDSet);
+  return QueryIdSet(ElementQueries::InactiveAll);
+}
+
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::GetInactiveVisibleIdentifiableElementIDSet()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInactiveVisibleIdentifiableElementIDSet);
+  return QueryIdSet(ElementQueries::InactiveVisible);
+}
+
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::RunFilter(ElementFilter^ filter)
+{
+  if (filter == nullptr)
+    throw gcnew System::ArgumentNullException("filter");
+
+  const auto nativeFilter = filter->Storage;
+  auto set = std::make_unique<Native::IdSet>();
+  {
+    Detail::NativeTraceScope native;
+    const auto attributeController = nativeFilter->fieldMask() != 0 ? m_controllerFactory->getAttributeController() : nullptr;
+    Interop::FilterElements(m_elementController, attributeController, *nativeFilter, *set);
+    native.leave();
+  }
+  System::GC::KeepAlive(filter);
+  BridgeCounters::Add(Detail::Counter::IdsToManaged, static_cast<long long>(set->size()));
+  return gcnew ElementIdSet(set.release());
+}
+
+List<int>^ CwAPI3D::Net::Bridge::ElementController::FilterElementIDs(ElementFilter^ filter)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_FilterElementIDs);
+  ElementIdSet^ matches = RunFilter(filter);
+  try
+  {
+    return gcnew List<int>(matches->ToArray());
+  }
+  finally
+  {
+    delete matches;
+  }
+}
+
+CwAPI3D::Net::Bridge::ElementIdSet^ CwAPI3D::Net::Bridge::ElementController::FilterElementIDSet(ElementFilter^ filter)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_FilterElementIDSet);
+  return RunFilter(filter);
+}
+
+IEnumerable<int>^ CwAPI3D::Net::Bridge::ElementController::EnumerateAllIdentifiableElementIDs()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_EnumerateAllIdentifiableElementIDs);
+  return gcnew ElementIdEnumerable(this, ElementQueries::AllIdentifiable, EnumerationPageSize);
+}
+
+IEnumerable<int>^ CwAPI3D::Net::Bridge::ElementController::EnumerateVisibleIdentifiableElementIDs()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_EnumerateVisibleIdentifiableElementIDs);
+  return gcnew ElementIdEnumerable(this, ElementQueries::Visible, EnumerationPageSize);
+}
+
+IEnumerable<int>^ CwAPI3D::Net::Bridge::ElementController::EnumerateInvisibleIdentifiableElementIDs()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_EnumerateInvisibleIdentifiableElementIDs);
+  return gcnew ElementIdEnumerable(this, ElementQueries::Invisible, EnumerationPageSize);
+}
+
+IEnumerable<int>^ CwAPI3D::Net::Bridge::ElementController::EnumerateActiveIdentifiableElementIDs()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_EnumerateActiveIdentifiableElementIDs);
+  return gcnew ElementIdEnumerable(this, ElementQueries::Active, EnumerationPageSize);
+}
+
+IEnumerable<int>^ CwAPI3D::Net::Bridge::ElementController::EnumerateInactiveAllIdentifiableElementIDs()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_EnumerateInactiveAllIdentifiableElementIDs);
+  return gcnew ElementIdEnumerable(this, ElementQueries::InactiveAll, EnumerationPageSize);
+}
+
+IEnumerable<int>^ CwAPI3D::Net::Bridge::ElementController::EnumerateInactiveVisibleIdentifiableElementIDs()
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_EnumerateInactiveVisibleIdentifiableElementIDs);
+  return gcnew ElementIdEnumerable(this, ElementQueries::InactiveVisible, EnumerationPageSize);
+}
+
+IEnumerable<int>^ CwAPI3D::Net::Bridge::ElementController::EnumerateElementIDs(ElementQueries query, int pageSize)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_EnumerateElementIDs);
+  return gcnew ElementIdEnumerable(this, query, pageSize);
+}
 
 void CwAPI3D::Net::Bridge::ElementController::DeleteElements(List<int>^ elementIDs)
 {
-  m_elementController->deleteElements(this->ConvertToNativeList(elementIDs));
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_DeleteElements_List);
+  InvalidateQueries();
+  PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+  Detail::NativeTraceScope native;
+  m_elementController->deleteElements(ids.get());
+}
+
+void CwAPI3D::Net::Bridge::ElementController::DeleteElements(ElementIdList^ elementIDs)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_DeleteElements_IdList);
+  InvalidateQueries();
+  Detail::NativeTraceScope native;
+  m_elementController->deleteElements(elementIDs->Native);
+  System::GC::KeepAlive(elementIDs);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::DeleteElements(ElementIdSet^ elementIDs)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_DeleteElements_IdSet);
+  InvalidateQueries();
+  PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+  Detail::NativeTraceScope native;
+  m_elementController->deleteElements(ids.get());
 }
 
 void CwAPI3D::Net::Bridge::ElementController::JoinElements(List<int>^ elementIDs)
 {
-  m_elementController->joinElements(this->ConvertToNativeList(elementIDs));
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_JoinElements_List);
+  PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+  Detail::NativeTraceScope native;
+  m_elementController->joinElements(ids.get());
+}
+
+void CwAPI3D::Net::Bridge::ElementController::JoinElements(ElementIdList^ elementIDs)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_JoinElements_IdList);
+  Detail::NativeTraceScope native;
+  m_elementController->joinElements(elementIDs->Native);
+  System::GC::KeepAlive(elementIDs);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::JoinElements(ElementIdSet^ elementIDs)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_JoinElements_IdSet);
+  PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+  Detail::NativeTraceScope native;
+  m_elementController->joinElements(ids.get());
 }
 
 void CwAPI3D::Net::Bridge::ElementController::JoinTopLevelElements(List<int>^ elementIDs)
 {
-  m_elementController->joinTopLevelElements(this->ConvertToNativeList(elementIDs));
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_JoinTopLevelElements_List);
+  PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+  Detail::NativeTraceScope native;
+  m_elementController->joinTopLevelElements(ids.get());
+}
+
+void CwAPI3D::Net::Bridge::ElementController::JoinTopLevelElements(ElementIdList^ elementIDs)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_JoinTopLevelElements_IdList);
+  Detail::NativeTraceScope native;
+  m_elementController->joinTopLevelElements(elementIDs->Native);
+  System::GC::KeepAlive(elementIDs);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::JoinTopLevelElements(ElementIdSet^ elementIDs)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_JoinTopLevelElements_IdSet);
+  PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+  Detail::NativeTraceScope native;
+  m_elementController->joinTopLevelElements(ids.get());
 }
 
 int CwAPI3D::Net::Bridge::ElementController::CreateRectangularBeamPoints(double width, double height, Vector3D^ p1, Vector3D^ p2, Vector3D^ p3)
 {
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateRectangularBeamPoints);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
     return static_cast<int>(m_elementController->createRectangularBeamPoints(
         width, height, p1->ToNative(), p2->ToNative(), p3->ToNative()));
 }
 
 int CwAPI3D::Net::Bridge::ElementController::CreateCircularBeamPoints(double diameter, Vector3D^ p1, Vector3D^ p2, Vector3D^ p3)
 {
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateCircularBeamPoints);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
     return static_cast<int>(m_elementController->createCircularBeamPoints(
         diameter, p1->ToNative(), p2->ToNative(), p3->ToNative()));
 }
 
 int CwAPI3D::Net::Bridge::ElementController::CreateSquareBeamPoints(double width, Vector3D^ p1, Vector3D^ p2, Vector3D^ p3)
 {
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateSquareBeamPoints);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
     return static_cast<int>(m_elementController->createSquareBeamPoints(
         width, p1->ToNative(), p2->ToNative(), p3->ToNative()));
 }
 
+array<int>^ CwAPI3D::Net::Bridge::ElementController::CreateBeams(Interop::BeamProfile profile, array<double>^ widths, array<double>^ heights,
+  array<Vector3DValue>^ p1, array<Vector3DValue>^ p2, array<Vector3DValue>^ p3)
+{
+  if (widths == nullptr) throw gcnew System::ArgumentNullException(profile == Interop::BeamProfile::Circular ? "diameters" : "widths");
+  if (p1 == nullptr) throw gcnew System::ArgumentNullException("p1");
+  if (p2 == nullptr) throw gcnew System::ArgumentNullException("p2");
+  if (p3 == nullptr) throw gcnew System::ArgumentNullException("p3");
+
+  const int count = widths->Length;
+  if (heights != nullptr) ThrowIfLengthMismatch(count, heights->Length, "heights");
+  ThrowIfLengthMismatch(count, p1->Length, "p1");
+  ThrowIfLengthMismatch(count, p2->Length, "p2");
+  ThrowIfLengthMismatch(count, p3->Length, "p3");
+
+  auto ids = gcnew array<int>(count);
+  if (count == 0) return ids;
+
+  // Vector3DValue is three packed doubles, so the pinned arrays are read in place with stride 3.
+  pin_ptr<double> pinnedWidths = &widths[0];
+  pin_ptr<double> pinnedHeights = nullptr;
+  if (heights != nullptr) pinnedHeights = &heights[0];
+  pin_ptr<double> pinnedP1 = &p1[0].X;
+  pin_ptr<double> pinnedP2 = &p2[0].X;
+  pin_ptr<double> pinnedP3 = &p3[0].X;
+  pin_ptr<int> pinnedIds = &ids[0];
+  const double* points1 = pinnedP1;
+  const double* points2 = pinnedP2;
+  const double* points3 = pinnedP3;
+
+  Interop::BeamBatch batch{};
+  batch.profile = profile;
+  batch.widths = pinnedWidths;
+  batch.heights = pinnedHeights;
+  batch.p1 = {points1, points1 + 1, points1 + 2, 3u};
+  batch.p2 = {points2, points2 + 1, points2 + 2, 3u};
+  batch.p3 = {points3, points3 + 1, points3 + 2, 3u};
+  batch.count = static_cast<uint32_t>(count);
+  BridgeCounters::Add(Detail::Counter::VectorsToNative, 3ll * count);
+  BridgeCounters::Add(Detail::Counter::IdsToManaged, count);
+  InvalidateQueries();
+  Detail::NativeTraceScope native;
+  Interop::CreateBeams(m_elementController, batch, pinnedIds);
+  return ids;
+}
+
+array<int>^ CwAPI3D::Net::Bridge::ElementController::CreateBeams(Interop::BeamProfile profile, array<double>^ widths, array<double>^ heights,
+  PointBuffer^ p1, PointBuffer^ p2, PointBuffer^ p3)
+{
+  if (widths == nullptr) throw gcnew System::ArgumentNullException(profile == Interop::BeamProfile::Circular ? "diameters" : "widths");
+  if (p1 == nullptr) throw gcnew System::ArgumentNullException("p1");
+  if (p2 == nullptr) throw gcnew System::ArgumentNullException("p2");
+  if (p3 == nullptr) throw gcnew System::ArgumentNullException("p3");
+
+  const int count = widths->Length;
+  if (heights != nullptr) ThrowIfLengthMismatch(count, heights->Length, "heights");
+  ThrowIfLengthMismatch(count, p1->Count, "p1");
+  ThrowIfLengthMismatch(count, p2->Count, "p2");
+  ThrowIfLengthMismatch(count, p3->Count, "p3");
+
+  auto ids = gcnew array<int>(count);
+  if (count == 0) return ids;
+
+  // PointBuffer coordinates live in native memory already; only the managed arrays need pinning. The buffers are
+  // kept alive past the native call instead, so their finalizers cannot free the coordinates mid-loop.
+  pin_ptr<double> pinnedWidths = &widths[0];
+  pin_ptr<double> pinnedHeights = nullptr;
+  if (heights != nullptr) pinnedHeights = &heights[0];
+  pin_ptr<int> pinnedIds = &ids[0];
+
+  Interop::BeamBatch batch{};
+  batch.profile = profile;
+  batch.widths = pinnedWidths;
+  batch.heights = pinnedHeights;
+  batch.p1 = SoaPoints(p1);
+  batch.p2 = SoaPoints(p2);
+  batch.p3 = SoaPoints(p3);
+  batch.count = static_cast<uint32_t>(count);
+  BridgeCounters::Add(Detail::Counter::VectorsToNative, 3ll * count);
+  BridgeCounters::Add(Detail::Counter::IdsToManaged, count);
+  InvalidateQueries();
+  Detail::NativeTraceScope native;
+  Interop::CreateBeams(m_elementController, batch, pinnedIds);
+  System::GC::KeepAlive(p1);
+  System::GC::KeepAlive(p2);
+  System::GC::KeepAlive(p3);
+  return ids;
+}
+
+array<int>^ CwAPI3D::Net::Bridge::ElementController::CreateRectangularBeams(array<double>^ widths, array<double>^ heights,
+  array<Vector3DValue>^ p1, array<Vector3DValue>^ p2, array<Vector3DValue>^ p3)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateRectangularBeams_Values);
+  if (heights == nullptr) throw gcnew System::ArgumentNullException("heights");
+  return CreateBeams(Interop::BeamProfile::Rectangular, widths, heights, p1, p2, p3);
+}
+
+array<int>^ CwAPI3D::Net::Bridge::ElementController::CreateRectangularBeams(array<double>^ widths, array<double>^ heights,
+  PointBuffer^ p1, PointBuffer^ p2, PointBuffer^ p3)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateRectangularBeams_Buffer);
+  if (heights == nullptr) throw gcnew System::ArgumentNullException("heights");
+  return CreateBeams(Interop::BeamProfile::Rectangular, widths, heights, p1, p2, p3);
+}
+
+array<int>^ CwAPI3D::Net::Bridge::ElementController::CreateCircularBeams(array<double>^ diameters,
+  array<Vector3DValue>^ p1, array<Vector3DValue>^ p2, array<Vector3DValue>^ p3)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateCircularBeams_Values);
+  return CreateBeams(Interop::BeamProfile::Circular, diameters, nullptr, p1, p2, p3);
+}
+
+array<int>^ CwAPI3D::Net::Bridge::ElementController::CreateCircularBeams(array<double>^ diameters,
+  PointBuffer^ p1, PointBuffer^ p2, PointBuffer^ p3)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateCircularBeams_Buffer);
+  return CreateBeams(Interop::BeamProfile::Circular, diameters, nullptr, p1, p2, p3);
+}
+
+array<int>^ CwAPI3D::Net::Bridge::ElementController::CreateSquareBeams(array<double>^ widths,
+  array<Vector3DValue>^ p1, array<Vector3DValue>^ p2, array<Vector3DValue>^ p3)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateSquareBeams_Values);
+  return CreateBeams(Interop::BeamProfile::Square, widths, nullptr, p1, p2, p3);
+}
+
+array<int>^ CwAPI3D::Net::Bridge::ElementController::CreateSquareBeams(array<double>^ widths,
+  PointBuffer^ p1, PointBuffer^ p2, PointBuffer^ p3)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_CreateSquareBeams_Buffer);
+  return CreateBeams(Interop::BeamProfile::Square, widths, nullptr, p1, p2, p3);
+}
+
 List<int>^ CwAPI3D::Net::Bridge::ElementController::SolderElements(List<int>^ elementIDs)
 {
-    return ConvertToManagedList(m_elementController->solderElements(this->ConvertToNativeList(elementIDs)));
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_SolderElements_List);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    const auto soldered = m_elementController->solderElements(ids.get());
+    native.leave();
+    return ConvertToManagedList(soldered);
+}
+
+List<int>^ CwAPI3D::Net::Bridge::ElementController::SolderElements(ElementIdList^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_SolderElements_IdList);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
+    const auto soldered = m_elementController->solderElements(elementIDs->Native);
+    System::GC::KeepAlive(elementIDs);
+    native.leave();
+    return ConvertToManagedList(soldered);
+}
+
+List<int>^ CwAPI3D::Net::Bridge::ElementController::SolderElements(ElementIdSet^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_SolderElements_IdSet);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    const auto soldered = m_elementController->solderElements(ids.get());
+    native.leave();
+    return ConvertToManagedList(soldered);
 }
 
 void CwAPI3D::Net::Bridge::ElementController::ConvertBeamToPanel(List<int>^ elementIDs)
 {
-    m_elementController->convertBeamToPanel(this->ConvertToNativeList(elementIDs));
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_ConvertBeamToPanel_List);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    m_elementController->convertBeamToPanel(ids.get());
+}
+
+void CwAPI3D::Net::Bridge::ElementController::ConvertBeamToPanel(ElementIdList^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_ConvertBeamToPanel_IdList);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
+    m_elementController->convertBeamToPanel(elementIDs->Native);
+    System::GC::KeepAlive(elementIDs);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::ConvertBeamToPanel(ElementIdSet^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_ConvertBeamToPanel_IdSet);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    m_elementController->convertBeamToPanel(ids.get());
 }
 
 void CwAPI3D::Net::Bridge::ElementController::ConvertPanelToBeam(List<int>^ elementIDs)
 {
-    m_elementController->convertPanelToBeam(this->ConvertToNativeList(elementIDs));
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_ConvertPanelToBeam_List);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    m_elementController->convertPanelToBeam(ids.get());
+}
+
+void CwAPI3D::Net::Bridge::ElementController::ConvertPanelToBeam(ElementIdList^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_ConvertPanelToBeam_IdList);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
+    m_elementController->convertPanelToBeam(elementIDs->Native);
+    System::GC::KeepAlive(elementIDs);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::ConvertPanelToBeam(ElementIdSet^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_ConvertPanelToBeam_IdSet);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    m_elementController->convertPanelToBeam(ids.get());
 }
 
 void CwAPI3D::Net::Bridge::ElementController::SplitElements(List<int>^ elementIDs)
 {
-    m_elementController->splitElements(this->ConvertToNativeList(elementIDs));
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_SplitElements_List);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    m_elementController->splitElements(ids.get());
+}
+
+void CwAPI3D::Net::Bridge::ElementController::SplitElements(ElementIdList^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_SplitElements_IdList);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
+    m_elementController->splitElements(elementIDs->Native);
+    System::GC::KeepAlive(elementIDs);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::SplitElements(ElementIdSet^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_SplitElements_IdSet);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    m_elementController->splitElements(ids.get());
 }
 
 void CwAPI3D::Net::Bridge::ElementController::MoveElement(List<int>^ elementIDs, Vector3D^ vec)
 {
-    m_elementController->moveElement(this->ConvertToNativeList(elementIDs), vec->ToNative());
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_MoveElement_List);
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    m_elementController->moveElement(ids.get(), vec->ToNative());
+}
+
+void CwAPI3D::Net::Bridge::ElementController::MoveElement(ElementIdList^ elementIDs, Vector3D^ vec)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_MoveElement_IdList);
+    Detail::NativeTraceScope native;
+    m_elementController->moveElement(elementIDs->Native, vec->ToNative());
+    System::GC::KeepAlive(elementIDs);
+}
+
+void CwAPI3D::Net::Bridge::ElementController::MoveElement(ElementIdSet^ elementIDs, Vector3D^ vec)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_MoveElement_IdSet);
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    m_elementController->moveElement(ids.get(), vec->ToNative());
 }
 
 List<int>^ CwAPI3D::Net::Bridge::ElementController::CopyElements(List<int>^ elementIDs, Vector3D^ vec)
 {
-    return ConvertToManagedList(m_elementController->copyElements(this->ConvertToNativeList(elementIDs), vec->ToNative()));
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_CopyElements_List);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    const auto copies = m_elementController->copyElements(ids.get(), vec->ToNative());
+    native.leave();
+    return ConvertToManagedList(copies);
+}
+
+List<int>^ CwAPI3D::Net::Bridge::ElementController::CopyElements(ElementIdList^ elementIDs, Vector3D^ vec)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_CopyElements_IdList);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
+    const auto copies = m_elementController->copyElements(elementIDs->Native, vec->ToNative());
+    System::GC::KeepAlive(elementIDs);
+    native.leave();
+    return ConvertToManagedList(copies);
+}
+
+List<int>^ CwAPI3D::Net::Bridge::ElementController::CopyElements(ElementIdSet^ elementIDs, Vector3D^ vec)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_CopyElements_IdSet);
+    InvalidateQueries();
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    const auto copies = m_elementController->copyElements(ids.get(), vec->ToNative());
+    native.leave();
+    return ConvertToManagedList(copies);
 }
 
 void CwAPI3D::Net::Bridge::ElementController::MakeUndo()
 {
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_MakeUndo);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
     m_elementController->makeUndo();
 }
 
 void CwAPI3D::Net::Bridge::ElementController::MakeRedo()
 {
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_MakeRedo);
+    InvalidateQueries();
+    Detail::NativeTraceScope native;
     m_elementController->makeRedo();
 }
 
 bool CwAPI3D::Net::Bridge::ElementController::UnjoinElements(List<int>^ elementIDs)
 {
-    return m_elementController->unjoinElements(this->ConvertToNativeList(elementIDs));
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_UnjoinElements_List);
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    return m_elementController->unjoinElements(ids.get());
+}
+
+bool CwAPI3D::Net::Bridge::ElementController::UnjoinElements(ElementIdList^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_UnjoinElements_IdList);
+    Detail::NativeTraceScope native;
+    const bool result = m_elementController->unjoinElements(elementIDs->Native);
+    System::GC::KeepAlive(elementIDs);
+    return result;
+}
+
+bool CwAPI3D::Net::Bridge::ElementController::UnjoinElements(ElementIdSet^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_UnjoinElements_IdSet);
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    return m_elementController->unjoinElements(ids.get());
 }
 
 bool CwAPI3D::Net::Bridge::ElementController::UnjoinTopLevelElements(List<int>^ elementIDs)
 {
-    return m_elementController->unjoinTopLevelElements(this->ConvertToNativeList(elementIDs));
-}
\ No newline at end of file
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_UnjoinTopLevelElements_List);
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    return m_elementController->unjoinTopLevelElements(ids.get());
+}
+
+bool CwAPI3D::Net::Bridge::ElementController::UnjoinTopLevelElements(ElementIdList^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_UnjoinTopLevelElements_IdList);
+    Detail::NativeTraceScope native;
+    const bool result = m_elementController->unjoinTopLevelElements(elementIDs->Native);
+    System::GC::KeepAlive(elementIDs);
+    return result;
+}
+
+bool CwAPI3D::Net::Bridge::ElementController::UnjoinTopLevelElements(ElementIdSet^ elementIDs)
+{
+    Detail::TraceScope trace(Native::Trace::Point::ElementController_UnjoinTopLevelElements_IdSet);
+    PooledListLease ids(m_listPool, ConvertToNativeList(elementIDs));
+    Detail::NativeTraceScope native;
+    return m_elementController->unjoinTopLevelElements(ids.get());
+}
+
+Task<List<int>^>^ CwAPI3D::Net::Bridge::ElementController::GetAllIdentifiableElementIDsAsync(CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetAllIdentifiableElementIDsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^>(this, &ElementController::GetAllIdentifiableElementIDs), cancellationToken);
+}
+
+Task<List<int>^>^ CwAPI3D::Net::Bridge::ElementController::GetVisibleIdentifiableElementIDsAsync(CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetVisibleIdentifiableElementIDsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^>(this, &ElementController::GetVisibleIdentifiableElementIDs), cancellationToken);
+}
+
+Task<List<int>^>^ CwAPI3D::Net::Bridge::ElementController::GetInvisibleIdentifiableElementIDsAsync(CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInvisibleIdentifiableElementIDsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^>(this, &ElementController::GetInvisibleIdentifiableElementIDs), cancellationToken);
+}
+
+Task<List<int>^>^ CwAPI3D::Net::Bridge::ElementController::GetActiveIdentifiableElementIDsAsync(CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetActiveIdentifiableElementIDsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^>(this, &ElementController::GetActiveIdentifiableElementIDs), cancellationToken);
+}
+
+Task<List<int>^>^ CwAPI3D::Net::Bridge::ElementController::GetInactiveAllIdentifiableElementIDsAsync(CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInactiveAllIdentifiableElementIDsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^>(this, &ElementController::GetInactiveAllIdentifiableElementIDs), cancellationToken);
+}
+
+Task<List<int>^>^ CwAPI3D::Net::Bridge::ElementController::GetInactiveVisibleIdentifiableElementIDsAsync(CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_GetInactiveVisibleIdentifiableElementIDsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^>(this, &ElementController::GetInactiveVisibleIdentifiableElementIDs), cancellationToken);
+}
+
+Task^ CwAPI3D::Net::Bridge::ElementController::DeleteElementsAsync(List<int>^ elementIDs, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_DeleteElementsAsync);
+  return m_executor->InvokeAsync(gcnew System::Action<List<int>^>(this, &ElementController::DeleteElements), SnapshotIds(elementIDs), cancellationToken);
+}
+
+Task^ CwAPI3D::Net::Bridge::ElementController::JoinElementsAsync(List<int>^ elementIDs, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_JoinElementsAsync);
+  return m_executor->InvokeAsync(gcnew System::Action<List<int>^>(this, &ElementController::JoinElements), SnapshotIds(elementIDs), cancellationToken);
+}
+
+Task^ CwAPI3D::Net::Bridge::ElementController::JoinTopLevelElementsAsync(List<int>^ elementIDs, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_JoinTopLevelElementsAsync);
+  return m_executor->InvokeAsync(gcnew System::Action<List<int>^>(this, &ElementController::JoinTopLevelElements), SnapshotIds(elementIDs), cancellationToken);
+}
+
+Task<bool>^ CwAPI3D::Net::Bridge::ElementController::UnjoinElementsAsync(List<int>^ elementIDs, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_UnjoinElementsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^, bool>(this, &ElementController::UnjoinElements), SnapshotIds(elementIDs), cancellationToken);
+}
+
+Task<bool>^ CwAPI3D::Net::Bridge::ElementController::UnjoinTopLevelElementsAsync(List<int>^ elementIDs, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_UnjoinTopLevelElementsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^, bool>(this, &ElementController::UnjoinTopLevelElements), SnapshotIds(elementIDs), cancellationToken);
+}
+
+Task<List<int>^>^ CwAPI3D::Net::Bridge::ElementController::SolderElementsAsync(List<int>^ elementIDs, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_SolderElementsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^, List<int>^>(this, &ElementController::SolderElements), SnapshotIds(elementIDs), cancellationToken);
+}
+
+Task^ CwAPI3D::Net::Bridge::ElementController::ConvertBeamToPanelAsync(List<int>^ elementIDs, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_ConvertBeamToPanelAsync);
+  return m_executor->InvokeAsync(gcnew System::Action<List<int>^>(this, &ElementController::ConvertBeamToPanel), SnapshotIds(elementIDs), cancellationToken);
+}
+
+Task^ CwAPI3D::Net::Bridge::ElementController::ConvertPanelToBeamAsync(List<int>^ elementIDs, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_ConvertPanelToBeamAsync);
+  return m_executor->InvokeAsync(gcnew System::Action<List<int>^>(this, &ElementController::ConvertPanelToBeam), SnapshotIds(elementIDs), cancellationToken);
+}
+
+Task^ CwAPI3D::Net::Bridge::ElementController::SplitElementsAsync(List<int>^ elementIDs, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_SplitElementsAsync);
+  return m_executor->InvokeAsync(gcnew System::Action<List<int>^>(this, &ElementController::SplitElements), SnapshotIds(elementIDs), cancellationToken);
+}
+
+Task^ CwAPI3D::Net::Bridge::ElementController::MoveElementAsync(List<int>^ elementIDs, Vector3D^ vec, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_MoveElementAsync);
+  return m_executor->InvokeAsync(gcnew System::Action<List<int>^, Vector3D^>(this, &ElementController::MoveElement),
+    SnapshotIds(elementIDs), SnapshotVector(vec), cancellationToken);
+}
+
+Task<List<int>^>^ CwAPI3D::Net::Bridge::ElementController::CopyElementsAsync(List<int>^ elementIDs, Vector3D^ vec, CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_CopyElementsAsync);
+  return m_executor->InvokeAsync(gcnew System::Func<List<int>^, Vector3D^, List<int>^>(this, &ElementController::CopyElements),
+    SnapshotIds(elementIDs), SnapshotVector(vec), cancellationToken);
+}
+
+Task^ CwAPI3D::Net::Bridge::ElementController::MakeUndoAsync(CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_MakeUndoAsync);
+  return m_executor->InvokeAsync(gcnew System::Action(this, &ElementController::MakeUndo), cancellationToken);
+}
+
+Task^ CwAPI3D::Net::Bridge::ElementController::MakeRedoAsync(CancellationToken cancellationToken)
+{
+  Detail::TraceScope trace(Native::Trace::Point::ElementController_MakeRedoAsync);
+  return m_executor->InvokeAsync(gcnew System::Action(this, &ElementController::MakeRedo), cancellationToken);
+}
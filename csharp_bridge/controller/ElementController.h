@@ -1,7 +1,12 @@
 #pragma once
 
+#include "ElementQueryCache.h"
+#include "../interop/BeamCreationInterop.h"
+
 //using namespace System;
 using namespace System::Collections::Generic;
+using namespace System::Threading;
+using namespace System::Threading::Tasks;
 
 namespace CwAPI3D
 {
@@ -16,18 +21,72 @@ namespace CwAPI3D
 namespace CwAPI3D::Net::Bridge
 {
     ref class Vector3D;
+    value struct Vector3DValue;
+    ref class PointBuffer;
+    ref class ElementIdList;
+    ref class ElementIdSet;
+    ref class ElementFilter;
+    ref class ElementIdListPool;
+    ref class CommandBatch;
+    ref class CadThreadExecutor;
 
     public ref class ElementController
     {
         Interfaces::ICwAPI3DControllerFactory* m_controllerFactory;
         Interfaces::ICwAPI3DElementController* m_elementController;
+        ElementIdListPool^ m_listPool;
+        CadThreadExecutor^ m_executor;
+        ElementQueryCache^ m_queryCache;
+        array<int>^ m_idScratch;
 
         //TODO: move into separate utility class (wrapper)
         static List<int>^ ConvertToManagedList(Interfaces::ICwAPI3DElementIDList* nativeList);
+        static array<int>^ ConvertToManagedArray(Interfaces::ICwAPI3DElementIDList* nativeList);
+        static int CopyToManagedBuffer(Interfaces::ICwAPI3DElementIDList* nativeList, array<int>^% buffer);
         Interfaces::ICwAPI3DElementIDList* ConvertToNativeList(List<int>^ ids);
+        static ElementIdSet^ ConvertToIdSet(Interfaces::ICwAPI3DElementIDList* nativeList);
+        Interfaces::ICwAPI3DElementIDList* ConvertToNativeList(ElementIdSet^ ids);
+        Interfaces::ICwAPI3DElementIDList* RunQuery(ElementQueries query);
+        array<int>^ QueryIds(ElementQueries query);
+        int QueryIdsInto(ElementQueries query, array<int>^% buffer);
+        ElementIdSet^ QueryIdSet(ElementQueries query);
+        ElementIdSet^ RunFilter(ElementFilter^ filter);
+        void InvalidateQueries();
+        array<int>^ CreateBeams(Interop::BeamProfile profile, array<double>^ widths, array<double>^ heights, array<Vector3DValue>^ p1, array<Vector3DValue>^ p2, array<Vector3DValue>^ p3);
+        array<int>^ CreateBeams(Interop::BeamProfile profile, array<double>^ widths, array<double>^ heights, PointBuffer^ p1, PointBuffer^ p2, PointBuffer^ p3);
 
     public:
-        explicit ElementController(Interfaces::ICwAPI3DControllerFactory* nativePtr);
+        ElementController(Interfaces::ICwAPI3DControllerFactory* nativePtr, CadThreadExecutor^ executor);
+
+        // Executor that runs the Async variants below on the CAD thread.
+        property CadThreadExecutor^ Executor
+        {
+            CadThreadExecutor^ get() { return m_executor; }
+        }
+
+        // Opt-in cache of the ID queries below. Calls that add, remove or replace elements drop the cached results;
+        // changes made outside the bridge must be reported with NotifyModelChanged.
+        property ElementQueryCache^ QueryCache
+        {
+            ElementQueryCache^ get() { return m_queryCache; }
+        }
+
+        // Host-change notification: drops the cached query results after the model changed outside the bridge,
+        // e.g. from a CAD event handler. The overload drops only the affected queries (e.g. Visibility).
+        void NotifyModelChanged();
+        void NotifyModelChanged(ElementQueries changed);
+
+        // Pool backing the native ID lists of the mutating calls below.
+        property ElementIdListPool^ ListPool
+        {
+            ElementIdListPool^ get() { return m_listPool; }
+        }
+
+        // Rents an empty pooled list; dispose it to hand the native list back to the pool.
+        ElementIdList^ CreateElementIdList();
+
+        // Records moves, copies, deletes and joins and sends them coalesced on Flush, in fewer native calls.
+        CommandBatch^ CreateCommandBatch();
 
         List<int>^ GetAllIdentifiableElementIDs();
         List<int>^ GetVisibleIdentifiableElementIDs();
@@ -35,29 +94,125 @@ namespace CwAPI3D::Net::Bridge
         List<int>^ GetActiveIdentifiableElementIDs();
         List<int>^ GetInactiveAllIdentifiableElementIDs();
         List<int>^ GetInactiveVisibleIdentifiableElementIDs();
+
+        // Bulk variants: copy the IDs into a caller-owned buffer and return the number written.
+        // The buffer is only reallocated when it is null or too small, so polling with the same
+        // buffer does not allocate once it has grown to the model size.
+        int GetAllIdentifiableElementIDsInto(array<int>^% buffer);
+        int GetVisibleIdentifiableElementIDsInto(array<int>^% buffer);
+        int GetInvisibleIdentifiableElementIDsInto(array<int>^% buffer);
+        int GetActiveIdentifiableElementIDsInto(array<int>^% buffer);
+        int GetInactiveAllIdentifiableElementIDsInto(array<int>^% buffer);
+        int GetInactiveVisibleIdentifiableElementIDsInto(array<int>^% buffer);
+
+        // Set variants: return the IDs as a compressed native set, so queries can be combined
+        // (e.g. visible & active) and passed to the mutating calls without building managed lists.
+        ElementIdSet^ GetAllIdentifiableElementIDSet();
+        ElementIdSet^ GetVisibleIdentifiableElementIDSet();
+        ElementIdSet^ GetInvisibleIdentifiableElementIDSet();
+        ElementIdSet^ GetActiveIdentifiableElementIDSet();
+        ElementIdSet^ GetInactiveAllIdentifiableElementIDSet();
+        ElementIdSet^ GetInactiveVisibleIdentifiableElementIDSet();
+
+        // Filter variants: evaluate a compiled ElementFilter natively over the model and return only the matching
+        // IDs, in ascending order. Each query the filter tests runs once per call on the CAD core (the QueryCache
+        // is not consulted), and attributes are read only for elements that pass the query tests.
+        List<int>^ FilterElementIDs(ElementFilter^ filter);
+        ElementIdSet^ FilterElementIDSet(ElementFilter^ filter);
+
+        // Lazy variants: every enumeration runs the query and copies the IDs out in pages of EnumerationPageSize
+        // into one reused buffer, so managed memory stays at one page and breaking out early skips the rest.
+        // Enumerate on the CAD thread.
+        literal int EnumerationPageSize = 4096;
+        IEnumerable<int>^ EnumerateAllIdentifiableElementIDs();
+        IEnumerable<int>^ EnumerateVisibleIdentifiableElementIDs();
+        IEnumerable<int>^ EnumerateInvisibleIdentifiableElementIDs();
+        IEnumerable<int>^ EnumerateActiveIdentifiableElementIDs();
+        IEnumerable<int>^ EnumerateInactiveAllIdentifiableElementIDs();
+        IEnumerable<int>^ EnumerateInactiveVisibleIdentifiableElementIDs();
+        IEnumerable<int>^ EnumerateElementIDs(ElementQueries query, int pageSize);
+
         void DeleteElements(List<int>^ elementIDs);
         void JoinElements(List<int>^ elementIDs);
         void JoinTopLevelElements(List<int>^ elementIDs);
+        void DeleteElements(ElementIdList^ elementIDs);
+        void JoinElements(ElementIdList^ elementIDs);
+        void JoinTopLevelElements(ElementIdList^ elementIDs);
+        void DeleteElements(ElementIdSet^ elementIDs);
+        void JoinElements(ElementIdSet^ elementIDs);
+        void JoinTopLevelElements(ElementIdSet^ elementIDs);
 
 
         int CreateRectangularBeamPoints(double width, double height, Vector3D^ p1, Vector3D^ p2, Vector3D^ p3);
         int CreateCircularBeamPoints(double diameter, Vector3D^ p1, Vector3D^ p2, Vector3D^ p3);
         int CreateSquareBeamPoints(double width, Vector3D^ p1, Vector3D^ p2, Vector3D^ p3);
 
+        // Batch variants: create one beam per entry in a single native call and return the new IDs in order.
+        // Entry i uses widths[i] (diameters[i]), heights[i] and p1[i], p2[i], p3[i]; all inputs must have the same length.
+        array<int>^ CreateRectangularBeams(array<double>^ widths, array<double>^ heights, array<Vector3DValue>^ p1, array<Vector3DValue>^ p2, array<Vector3DValue>^ p3);
+        array<int>^ CreateRectangularBeams(array<double>^ widths, array<double>^ heights, PointBuffer^ p1, PointBuffer^ p2, PointBuffer^ p3);
+        array<int>^ CreateCircularBeams(array<double>^ diameters, array<Vector3DValue>^ p1, array<Vector3DValue>^ p2, array<Vector3DValue>^ p3);
+        array<int>^ CreateCircularBeams(array<double>^ diameters, PointBuffer^ p1, PointBuffer^ p2, PointBuffer^ p3);
+        array<int>^ CreateSquareBeams(array<double>^ widths, array<Vector3DValue>^ p1, array<Vector3DValue>^ p2, array<Vector3DValue>^ p3);
+        array<int>^ CreateSquareBeams(array<double>^ widths, PointBuffer^ p1, PointBuffer^ p2, PointBuffer^ p3);
+
         List<int>^ SolderElements(List<int>^ elementIDs);
         void ConvertBeamToPanel(List<int>^ elementIDs);
         void ConvertPanelToBeam(List<int>^ elementIDs);
         void SplitElements(List<int>^ elementIDs);
+        List<int>^ SolderElements(ElementIdList^ elementIDs);
+        void ConvertBeamToPanel(ElementIdList^ elementIDs);
+        void ConvertPanelToBeam(ElementIdList^ elementIDs);
+        void SplitElements(ElementIdList^ elementIDs);
+        List<int>^ SolderElements(ElementIdSet^ elementIDs);
+        void ConvertBeamToPanel(ElementIdSet^ elementIDs);
+        void ConvertPanelToBeam(ElementIdSet^ elementIDs);
+        void SplitElements(ElementIdSet^ elementIDs);
 
 
         void MoveElement(List<int>^ elementIDs, Vector3D^ vec);
         List<int>^ CopyElements(List<int>^ elementIDs, Vector3D^ vec);
+        void MoveElement(ElementIdList^ elementIDs, Vector3D^ vec);
+        List<int>^ CopyElements(ElementIdList^ elementIDs, Vector3D^ vec);
+        void MoveElement(ElementIdSet^ elementIDs, Vector3D^ vec);
+        List<int>^ CopyElements(ElementIdSet^ elementIDs, Vector3D^ vec);
 
         void MakeUndo();
         void MakeRedo();
         
         bool UnjoinElements(List<int>^ elementIDs);
         bool UnjoinTopLevelElements(List<int>^ elementIDs);
-        
+        bool UnjoinElements(ElementIdList^ elementIDs);
+        bool UnjoinTopLevelElements(ElementIdList^ elementIDs);
+        bool UnjoinElements(ElementIdSet^ elementIDs);
+        bool UnjoinTopLevelElements(ElementIdSet^ elementIDs);
+
+        // Async variants: safe to call from any thread. The call is queued on Executor and runs on the CAD thread;
+        // called on the CAD thread itself, it runs inline. Input lists and vectors are copied when the call is queued.
+        // Cancelling the token skips the call if it has not started yet.
+        Task<List<int>^>^ GetAllIdentifiableElementIDsAsync([System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task<List<int>^>^ GetVisibleIdentifiableElementIDsAsync([System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task<List<int>^>^ GetInvisibleIdentifiableElementIDsAsync([System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task<List<int>^>^ GetActiveIdentifiableElementIDsAsync([System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task<List<int>^>^ GetInactiveAllIdentifiableElementIDsAsync([System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task<List<int>^>^ GetInactiveVisibleIdentifiableElementIDsAsync([System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+
+        Task^ DeleteElementsAsync(List<int>^ elementIDs, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task^ JoinElementsAsync(List<int>^ elementIDs, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task^ JoinTopLevelElementsAsync(List<int>^ elementIDs, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task<bool>^ UnjoinElementsAsync(List<int>^ elementIDs, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task<bool>^ UnjoinTopLevelElementsAsync(List<int>^ elementIDs, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task<List<int>^>^ SolderElementsAsync(List<int>^ elementIDs, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task^ ConvertBeamToPanelAsync(List<int>^ elementIDs, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task^ ConvertPanelToBeamAsync(List<int>^ elementIDs, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task^ SplitElementsAsync(List<int>^ elementIDs, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task^ MoveElementAsync(List<int>^ elementIDs, Vector3D^ vec, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task<List<int>^>^ CopyElementsAsync(List<int>^ elementIDs, Vector3D^ vec, [System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task^ MakeUndoAsync([System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+        Task^ MakeRedoAsync([System::Runtime::InteropServices::Optional] CancellationToken cancellationToken);
+
+    internal:
+        // Runs the query (or takes the cached result) for one enumeration of an EnumerateXxx result.
+        IEnumerator<int>^ OpenQuery(ElementQueries query, int pageSize);
     };
 }
\ No newline at end of file
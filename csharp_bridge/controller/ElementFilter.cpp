@@ -0,0 +1,66 @@
+#include "ElementFilter.h"
+#include "../native/ElementFilter.h"
+
+#include <msclr/marshal_cppstd.h>
+#include <memory>
+#include <string>
+
+namespace CwAPI3D::Net::Bridge
+{
+  ElementFilter::ElementFilter(System::String^ expression, Native::ElementFilter* filter)
+  {
+    m_expression = expression;
+    m_filter = filter;
+  }
+
+  ElementFilter^ ElementFilter::Parse(System::String^ expression)
+  {
+    if (expression == nullptr)
+      throw gcnew System::ArgumentNullException("expression");
+
+    // Attribute values are compared in the CAD core's narrow encoding, so the expression is converted to it too.
+    const std::string text = msclr::interop::marshal_as<std::string>(expression);
+    auto filter = std::make_unique<Native::ElementFilter>();
+    Native::ElementFilter::ParseError error{};
+    if (!filter->parse(text, error))
+    {
+      throw gcnew System::ArgumentException(System::String::Format("{0} (at position {1})",
+        gcnew System::String(error.message), static_cast<long long>(error.position)), "expression");
+    }
+    return gcnew ElementFilter(expression, filter.release());
+  }
+
+  ElementFilter::~ElementFilter()
+  {
+    this->!ElementFilter();
+  }
+
+  ElementFilter::!ElementFilter()
+  {
+    delete m_filter;
+    m_filter = nullptr;
+  }
+
+  void ElementFilter::ThrowIfDisposed()
+  {
+    if (!m_filter)
+      throw gcnew System::ObjectDisposedException("ElementFilter");
+  }
+
+  bool ElementFilter::ReadsAttributes::get()
+  {
+    ThrowIfDisposed();
+    return m_filter->fieldMask() != 0;
+  }
+
+  Native::ElementFilter* ElementFilter::Storage::get()
+  {
+    ThrowIfDisposed();
+    return m_filter;
+  }
+
+  System::String^ ElementFilter::ToString()
+  {
+    return m_expression;
+  }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace Native
+  {
+    class ElementFilter;
+  }
+
+  /// <summary>
+  /// A filter expression over the elements of the model, compiled once into a native predicate tree and evaluated
+  /// by ElementController.FilterElementIDs where the element data lives.
+  /// </summary>
+  /// <remarks>
+  /// <para>
+  /// An expression combines element queries and attribute comparisons with AND, OR, NOT and parentheses, e.g.
+  /// <c>visible AND active AND name == 'Rafter'</c>. The queries are <c>all</c>, <c>visible</c>, <c>invisible</c>,
+  /// <c>active</c>, <c>inactive</c> and <c>inactivevisible</c>; the attributes are <c>name</c>, <c>group</c>,
+  /// <c>subgroup</c>, <c>comment</c> and <c>material</c>, compared with <c>==</c>, <c>!=</c>, <c>contains</c> or
+  /// <c>startswith</c> against a string in single or double quotes (a doubled quote escapes it). Keywords are
+  /// case-insensitive; string comparisons are ordinal.
+  /// </para>
+  /// <para>
+  /// Reuse a filter across calls; dispose it to release the native memory early.
+  /// </para>
+  /// </remarks>
+  public ref class ElementFilter sealed
+  {
+  private:
+    Native::ElementFilter* m_filter;
+    System::String^ m_expression;
+
+    ElementFilter(System::String^ expression, Native::ElementFilter* filter);
+
+    void ThrowIfDisposed();
+
+  public:
+    /// <summary>
+    /// Compiles a filter expression.
+    /// </summary>
+    /// <param name="expression">The expression.</param>
+    /// <returns>The compiled filter.</returns>
+    /// <exception cref="System::ArgumentNullException">Thrown when expression is null.</exception>
+    /// <exception cref="System::ArgumentException">Thrown when expression is not valid; the message gives the
+    /// position of the error.</exception>
+    static ElementFilter^ Parse(System::String^ expression);
+
+    ~ElementFilter();
+    !ElementFilter();
+
+    /// <summary>
+    /// Gets the expression the filter was compiled from.
+    /// </summary>
+    property System::String^ Expression
+    {
+      System::String^ get() { return m_expression; }
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether the filter compares attributes. Filters without attributes are evaluated
+    /// with set algebra over the query results; filters with attributes read them only for elements that pass the
+    /// query tests.
+    /// </summary>
+    property bool ReadsAttributes
+    {
+      bool get();
+    }
+
+    System::String^ ToString() override;
+
+  internal:
+    /// The parsed predicate tree. Callers that hand it to native code must GC::KeepAlive the filter after the call.
+    property Native::ElementFilter* Storage
+    {
+      Native::ElementFilter* get();
+    }
+  };
+}
@@ -0,0 +1,116 @@
+#include "ElementIdEnumerable.h"
+#include "ElementController.h"
+#include "../diagnostics/BridgeCounters.h"
+#include "../interop/ElementIdListInterop.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  ElementIdEnumerator::ElementIdEnumerator(Interfaces::ICwAPI3DElementIDList* nativeList, int pageSize)
+  {
+    if (pageSize <= 0)
+      throw gcnew System::ArgumentOutOfRangeException("pageSize", "Page size must be positive.");
+
+    m_nativeList = nativeList;
+    m_nextPage = 0;
+    // A list shorter than a page needs no more buffer than its length.
+    const uint32_t count = Interop::ElementIdCount(nativeList);
+    m_page = gcnew array<int>(count < static_cast<uint32_t>(pageSize) ? static_cast<int>(count) : pageSize);
+    m_pageLength = 0;
+    m_position = -1;
+  }
+
+  ElementIdEnumerator::ElementIdEnumerator(array<int>^ ids)
+  {
+    if (ids == nullptr)
+      throw gcnew System::ArgumentNullException("ids");
+
+    m_nativeList = nullptr;
+    m_nextPage = 0;
+    m_page = ids;
+    m_pageLength = ids->Length;
+    m_position = -1;
+  }
+
+  ElementIdEnumerator::~ElementIdEnumerator()
+  {
+    m_nativeList = nullptr;
+    m_page = nullptr;
+    m_pageLength = 0;
+    m_position = 0;
+  }
+
+  bool ElementIdEnumerator::MoveNext()
+  {
+    if (m_position + 1 < m_pageLength)
+    {
+      ++m_position;
+      return true;
+    }
+
+    uint32_t copied = 0;
+    if (m_nativeList && m_page->Length != 0)
+    {
+      pin_ptr<int> destination = &m_page[0];
+      copied = Interop::CopyElementIdRange(m_nativeList, m_nextPage, destination, static_cast<uint32_t>(m_page->Length));
+    }
+    if (copied == 0)
+    {
+      m_position = m_pageLength;
+      return false;
+    }
+
+    BridgeCounters::Add(Detail::Counter::IdsToManaged, copied);
+    m_nextPage += copied;
+    m_pageLength = static_cast<int>(copied);
+    m_position = 0;
+    return true;
+  }
+
+  void ElementIdEnumerator::Reset()
+  {
+    if (m_page == nullptr)
+      throw gcnew System::ObjectDisposedException("ElementIdEnumerator");
+
+    if (m_nativeList)
+    {
+      m_nextPage = 0;
+      m_pageLength = 0;
+    }
+    m_position = -1;
+  }
+
+  int ElementIdEnumerator::Current::get()
+  {
+    if (m_position < 0 || m_position >= m_pageLength)
+      throw gcnew System::InvalidOperationException("The enumerator is not positioned on an element.");
+
+    return m_page[m_position];
+  }
+
+  System::Object^ ElementIdEnumerator::CurrentObject::get()
+  {
+    return Current;
+  }
+
+  ElementIdEnumerable::ElementIdEnumerable(ElementController^ controller, ElementQueries query, int pageSize)
+  {
+    if (controller == nullptr)
+      throw gcnew System::ArgumentNullException("controller");
+    if (pageSize <= 0)
+      throw gcnew System::ArgumentOutOfRangeException("pageSize", "Page size must be positive.");
+
+    m_controller = controller;
+    m_query = query;
+    m_pageSize = pageSize;
+  }
+
+  IEnumerator<int>^ ElementIdEnumerable::GetEnumerator()
+  {
+    return m_controller->OpenQuery(m_query, m_pageSize);
+  }
+
+  System::Collections::IEnumerator^ ElementIdEnumerable::GetEnumeratorObject()
+  {
+    return GetEnumerator();
+  }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "ElementQueryCache.h"
+
+#include <cstdint>
+
+using namespace System::Collections::Generic;
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DElementIDList;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class ElementController;
+
+  /// <summary>
+  /// Walks a native ID list page by page. Each page of up to pageSize IDs is copied into the same managed buffer in
+  /// one native call, so managed memory stays at one page however long the list is, and stopping early skips the
+  /// copies of the remaining pages.
+  /// </summary>
+  ref class ElementIdEnumerator sealed : IEnumerator<int>
+  {
+  private:
+    Interfaces::ICwAPI3DElementIDList* m_nativeList;
+    uint32_t m_nextPage;
+    array<int>^ m_page;
+    int m_pageLength;
+    int m_position;
+
+  public:
+    /// <summary>
+    /// Enumerates a native list in pages of pageSize IDs.
+    /// </summary>
+    ElementIdEnumerator(Interfaces::ICwAPI3DElementIDList* nativeList, int pageSize);
+
+    /// <summary>
+    /// Enumerates an array of IDs that is already in managed memory, e.g. a cached query result.
+    /// </summary>
+    ElementIdEnumerator(array<int>^ ids);
+
+    virtual bool MoveNext();
+    virtual void Reset();
+
+    property int Current
+    {
+      virtual int get();
+    }
+
+    property System::Object^ CurrentObject
+    {
+      virtual System::Object^ get() = System::Collections::IEnumerator::Current::get;
+    }
+
+    ~ElementIdEnumerator();
+  };
+
+  /// <summary>
+  /// The result of an ElementController query, run anew each time it is enumerated and read lazily through an
+  /// ElementIdEnumerator. A cached result (see ElementController::QueryCache) is enumerated in place instead.
+  /// </summary>
+  ref class ElementIdEnumerable sealed : IEnumerable<int>
+  {
+  private:
+    ElementController^ m_controller;
+    ElementQueries m_query;
+    int m_pageSize;
+
+  public:
+    ElementIdEnumerable(ElementController^ controller, ElementQueries query, int pageSize);
+
+    virtual IEnumerator<int>^ GetEnumerator();
+    virtual System::Collections::IEnumerator^ GetEnumeratorObject() = System::Collections::IEnumerable::GetEnumerator;
+  };
+}
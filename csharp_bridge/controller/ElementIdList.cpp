@@ -0,0 +1,130 @@
+#include "ElementIdList.h"
+#include "ElementIdListPool.h"
+#include "../diagnostics/BridgeCounters.h"
+#include "../interop/ElementIdListInterop.h"
+
+#include <ICwAPI3DElementIDList.h>
+
+namespace CwAPI3D::Net::Bridge
+{
+  ElementIdList::ElementIdList(Interfaces::ICwAPI3DElementIDList* nativeList, ElementIdListPool^ pool)
+  {
+    if (!nativeList)
+      throw gcnew System::ArgumentNullException("nativeList");
+
+    m_nativeList = nativeList;
+    m_pool = pool;
+  }
+
+  ElementIdList::~ElementIdList()
+  {
+    if (!m_nativeList)
+      return;
+
+    auto nativeList = m_nativeList;
+    m_nativeList = nullptr;
+
+    if (m_pool != nullptr)
+      m_pool->ReturnNative(nativeList);
+    else
+      nativeList->destroy();
+  }
+
+  ElementIdList::!ElementIdList()
+  {
+    // Finalizers run on the GC's thread, where the CAD API must not be called, and the pool may already have been
+    // finalized. The list is queued instead and destroyed by the next pool call on the CAD thread.
+    if (m_nativeList)
+    {
+      ElementIdListPool::Abandon(m_nativeList);
+      m_nativeList = nullptr;
+    }
+  }
+
+  void ElementIdList::ThrowIfDisposed()
+  {
+    if (!m_nativeList)
+      throw gcnew System::ObjectDisposedException("ElementIdList");
+  }
+
+  Interfaces::ICwAPI3DElementIDList* ElementIdList::Native::get()
+  {
+    ThrowIfDisposed();
+    return m_nativeList;
+  }
+
+  int ElementIdList::Count::get()
+  {
+    ThrowIfDisposed();
+    const uint32_t count = Interop::ElementIdCount(m_nativeList);
+    System::GC::KeepAlive(this);
+    return static_cast<int>(count);
+  }
+
+  void ElementIdList::Add(int id)
+  {
+    ThrowIfDisposed();
+    if (id < 0)
+      throw gcnew System::ArgumentOutOfRangeException("id", "Element ID cannot be negative.");
+
+    m_nativeList->append(static_cast<elementID>(id));
+    System::GC::KeepAlive(this);
+    BridgeCounters::Add(Detail::Counter::IdsToNative, 1);
+  }
+
+  void ElementIdList::AddRange(array<int>^ ids)
+  {
+    if (ids == nullptr)
+      throw gcnew System::ArgumentNullException("ids");
+
+    AddRange(ids, ids->Length);
+  }
+
+  void ElementIdList::AddRange(array<int>^ ids, int count)
+  {
+    ThrowIfDisposed();
+    if (ids == nullptr)
+      throw gcnew System::ArgumentNullException("ids");
+    if (count < 0 || count > ids->Length)
+      throw gcnew System::ArgumentOutOfRangeException("count");
+    if (count == 0)
+      return;
+
+    pin_ptr<int> source = &ids[0];
+    const bool appended = Interop::AppendElementIds(m_nativeList, source, static_cast<uint32_t>(count));
+    System::GC::KeepAlive(this);
+    if (!appended)
+      throw gcnew System::ArgumentException("Element ID cannot be negative.", "ids");
+    BridgeCounters::Add(Detail::Counter::IdsToNative, count);
+  }
+
+  void ElementIdList::Clear()
+  {
+    ThrowIfDisposed();
+    m_nativeList->clear();
+    System::GC::KeepAlive(this);
+  }
+
+  array<int>^ ElementIdList::ToArray()
+  {
+    array<int>^ result = nullptr;
+    CopyTo(result);
+    return result;
+  }
+
+  int ElementIdList::CopyTo(array<int>^% buffer)
+  {
+    ThrowIfDisposed();
+    const uint32_t count = Interop::ElementIdCount(m_nativeList);
+    if (buffer == nullptr || static_cast<uint32_t>(buffer->Length) < count)
+      buffer = gcnew array<int>(static_cast<int>(count));
+    BridgeCounters::Add(Detail::Counter::IdsToManaged, count);
+    if (count == 0)
+      return 0;
+
+    pin_ptr<int> destination = &buffer[0];
+    const uint32_t copied = Interop::CopyElementIds(m_nativeList, destination, count);
+    System::GC::KeepAlive(this);
+    return static_cast<int>(copied);
+  }
+}
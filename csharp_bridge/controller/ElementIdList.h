@@ -0,0 +1,105 @@
+#pragma once
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DElementIDList;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class ElementIdListPool;
+
+  /// <summary>
+  /// A managed handle that owns a native ICwAPI3DElementIDList.
+  /// Dispose the handle (or use a using block) to release the native list deterministically;
+  /// pooled lists go back to their pool, all others are destroyed.
+  /// </summary>
+  public ref class ElementIdList
+  {
+  private:
+    Interfaces::ICwAPI3DElementIDList* m_nativeList;
+    ElementIdListPool^ m_pool;
+
+    void ThrowIfDisposed();
+
+  public:
+    /// <summary>
+    /// Gets the number of IDs in the list.
+    /// </summary>
+    property int Count
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether the native list has been released.
+    /// </summary>
+    property bool IsDisposed
+    {
+      bool get() { return m_nativeList == nullptr; }
+    }
+
+    /// <summary>
+    /// Appends a single element ID.
+    /// </summary>
+    /// <param name="id">The element ID.</param>
+    /// <exception cref="System::ArgumentOutOfRangeException">Thrown when id is negative.</exception>
+    void Add(int id);
+
+    /// <summary>
+    /// Appends all IDs of the array in a single native call.
+    /// </summary>
+    /// <param name="ids">The element IDs.</param>
+    /// <exception cref="System::ArgumentException">Thrown when any id is negative.</exception>
+    void AddRange(array<int>^ ids);
+
+    /// <summary>
+    /// Appends the first count IDs of the array in a single native call.
+    /// </summary>
+    /// <param name="ids">The element IDs.</param>
+    /// <param name="count">The number of IDs to append.</param>
+    /// <exception cref="System::ArgumentException">Thrown when any id is negative.</exception>
+    void AddRange(array<int>^ ids, int count);
+
+    /// <summary>
+    /// Removes all IDs while keeping the native list alive.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Copies the IDs into a new array.
+    /// </summary>
+    /// <returns>An array containing the IDs.</returns>
+    array<int>^ ToArray();
+
+    /// <summary>
+    /// Copies the IDs into a caller-owned buffer, growing it only when it is too small.
+    /// </summary>
+    /// <param name="buffer">The destination buffer.</param>
+    /// <returns>The number of IDs written.</returns>
+    int CopyTo(array<int>^% buffer);
+
+    /// <summary>
+    /// Releases the native list.
+    /// </summary>
+    ~ElementIdList();
+
+    /// <summary>
+    /// Finalizer. Queues the native list for destruction on the CAD thread if the handle was not disposed.
+    /// </summary>
+    !ElementIdList();
+
+  internal:
+    ElementIdList(Interfaces::ICwAPI3DElementIDList* nativeList, ElementIdListPool^ pool);
+
+    /// The native list. Callers that pass it to the CAD API must GC::KeepAlive the handle after the call, or the
+    /// finalizer may queue the list for destruction while the call still reads it.
+    property Interfaces::ICwAPI3DElementIDList* Native
+    {
+      Interfaces::ICwAPI3DElementIDList* get();
+    }
+  };
+}
@@ -0,0 +1,155 @@
+#include "ElementIdListPool.h"
+#include "ElementIdList.h"
+#include "../native/ListPool.h"
+
+#include <ICwAPI3DControllerFactory.h>
+#include <ICwAPI3DElementIDList.h>
+#include <msclr/lock.h>
+
+using namespace System;
+
+namespace CwAPI3D::Net::Bridge
+{
+  using NativeListPool = Native::ListPool<Interfaces::ICwAPI3DElementIDList>;
+
+  ElementIdListPool::ElementIdListPool(Interfaces::ICwAPI3DControllerFactory* controllerFactory)
+  {
+    if (!controllerFactory)
+      throw gcnew ArgumentNullException("controllerFactory");
+
+    m_controllerFactory = controllerFactory;
+    m_lists = new NativeListPool(DefaultMaxRetained);
+    m_sync = gcnew Object();
+  }
+
+  ElementIdListPool::~ElementIdListPool()
+  {
+    msclr::lock guard(m_sync);
+    if (!m_lists)
+      return;
+
+    while (auto nativeList = m_lists->takeIdle())
+      nativeList->destroy();
+    delete m_lists;
+    m_lists = nullptr;
+    DestroyAbandoned();
+  }
+
+  ElementIdListPool::!ElementIdListPool()
+  {
+    // Runs on the finalizer thread, so the idle lists are queued for another pool rather than destroyed here.
+    if (!m_lists)
+      return;
+
+    while (auto nativeList = m_lists->takeIdle())
+      s_abandoned->Enqueue(IntPtr(nativeList));
+    delete m_lists;
+    m_lists = nullptr;
+  }
+
+  void ElementIdListPool::ThrowIfDisposed()
+  {
+    if (!m_lists)
+      throw gcnew ObjectDisposedException("ElementIdListPool");
+  }
+
+  void ElementIdListPool::Abandon(Interfaces::ICwAPI3DElementIDList* nativeList)
+  {
+    if (!nativeList)
+      return;
+
+    s_abandoned->Enqueue(IntPtr(nativeList));
+    Threading::Interlocked::Increment(s_abandonedCount);
+  }
+
+  void ElementIdListPool::DestroyAbandoned()
+  {
+    IntPtr nativeList;
+    while (s_abandoned->TryDequeue(nativeList))
+      static_cast<Interfaces::ICwAPI3DElementIDList*>(nativeList.ToPointer())->destroy();
+  }
+
+  long long ElementIdListPool::AbandonedCount::get()
+  {
+    return Threading::Interlocked::Read(s_abandonedCount);
+  }
+
+  int ElementIdListPool::PendingAbandoned::get()
+  {
+    return s_abandoned->Count;
+  }
+
+  int ElementIdListPool::MaxRetained::get()
+  {
+    msclr::lock guard(m_sync);
+    ThrowIfDisposed();
+    return static_cast<int>(m_lists->maxRetained());
+  }
+
+  void ElementIdListPool::MaxRetained::set(int value)
+  {
+    if (value < 0)
+      throw gcnew ArgumentOutOfRangeException("value", "MaxRetained cannot be negative.");
+
+    msclr::lock guard(m_sync);
+    ThrowIfDisposed();
+    m_lists->setMaxRetained(static_cast<size_t>(value));
+    while (auto nativeList = m_lists->takeExcess())
+      nativeList->destroy();
+  }
+
+  int ElementIdListPool::Available::get()
+  {
+    msclr::lock guard(m_sync);
+    return m_lists ? static_cast<int>(m_lists->idle()) : 0;
+  }
+
+  long long ElementIdListPool::CreatedCount::get()
+  {
+    msclr::lock guard(m_sync);
+    ThrowIfDisposed();
+    return m_lists->created();
+  }
+
+  long long ElementIdListPool::RentedCount::get()
+  {
+    msclr::lock guard(m_sync);
+    ThrowIfDisposed();
+    return m_lists->rented();
+  }
+
+  ElementIdList^ ElementIdListPool::Rent()
+  {
+    return gcnew ElementIdList(RentNative(), this);
+  }
+
+  Interfaces::ICwAPI3DElementIDList* ElementIdListPool::RentNative()
+  {
+    if (!s_abandoned->IsEmpty)
+      DestroyAbandoned();
+
+    {
+      msclr::lock guard(m_sync);
+      ThrowIfDisposed();
+      if (auto nativeList = m_lists->rent())
+        return nativeList;
+    }
+    return m_controllerFactory->createEmptyElementIDList();
+  }
+
+  void ElementIdListPool::ReturnNative(Interfaces::ICwAPI3DElementIDList* nativeList)
+  {
+    if (!nativeList)
+      return;
+
+    // Clearing keeps the list's storage, so the next caller appends without reallocating.
+    nativeList->clear();
+
+    {
+      msclr::lock guard(m_sync);
+      if (m_lists && m_lists->keep(nativeList))
+        return;
+    }
+    nativeList->destroy();
+  }
+}
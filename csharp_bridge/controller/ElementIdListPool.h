@@ -0,0 +1,132 @@
+#pragma once
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DControllerFactory;
+    class ICwAPI3DElementIDList;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace Native
+  {
+    template <class List>
+    class ListPool;
+  }
+
+  ref class ElementIdList;
+
+  /// <summary>
+  /// Recycles native element ID lists so that repeated bridge calls do not allocate a new
+  /// ICwAPI3DElementIDList each time. Returned lists are cleared and kept for the next caller.
+  /// </summary>
+  public ref class ElementIdListPool
+  {
+  private:
+    Interfaces::ICwAPI3DControllerFactory* m_controllerFactory;
+    Native::ListPool<Interfaces::ICwAPI3DElementIDList>* m_lists;
+    System::Object^ m_sync;
+
+    // Lists whose handles or pools were finalized. Finalizers run on the GC's thread, where the CAD API must not be
+    // called, so they only queue the lists; the next pool call on the CAD thread destroys them.
+    static System::Collections::Concurrent::ConcurrentQueue<System::IntPtr>^ s_abandoned;
+    static long long s_abandonedCount;
+
+    static ElementIdListPool()
+    {
+      s_abandoned = gcnew System::Collections::Concurrent::ConcurrentQueue<System::IntPtr>();
+    }
+
+    void ThrowIfDisposed();
+    static void DestroyAbandoned();
+
+  public:
+    /// <summary>
+    /// The default number of native lists kept alive by a pool.
+    /// </summary>
+    literal int DefaultMaxRetained = 16;
+
+    /// <summary>
+    /// Gets or sets the maximum number of idle native lists kept by the pool.
+    /// Lists returned while the pool is full are destroyed.
+    /// </summary>
+    property int MaxRetained
+    {
+      int get();
+      void set(int value);
+    }
+
+    /// <summary>
+    /// Gets the number of idle native lists currently held by the pool.
+    /// </summary>
+    property int Available
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the total number of native lists this pool has created.
+    /// Stays constant in steady state when every rented list is returned.
+    /// </summary>
+    property long long CreatedCount
+    {
+      long long get();
+    }
+
+    /// <summary>
+    /// Gets the total number of rent operations served by this pool.
+    /// </summary>
+    property long long RentedCount
+    {
+      long long get();
+    }
+
+    /// <summary>
+    /// Gets the total number of ElementIdList handles, across all pools, that were garbage-collected without being
+    /// disposed. Their native lists are destroyed by the next pool call on the CAD thread; a growing count points
+    /// to a missing using block.
+    /// </summary>
+    static property long long AbandonedCount
+    {
+      long long get();
+    }
+
+    /// <summary>
+    /// Gets the number of abandoned native lists still waiting to be destroyed.
+    /// </summary>
+    static property int PendingAbandoned
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Rents an empty list. Disposing the returned list gives it back to this pool.
+    /// </summary>
+    /// <returns>An empty ElementIdList owned by the caller until disposed.</returns>
+    ElementIdList^ Rent();
+
+    /// <summary>
+    /// Destroys every idle native list held by the pool. Lists returned afterwards are destroyed right away, and
+    /// Rent throws ObjectDisposedException.
+    /// </summary>
+    ~ElementIdListPool();
+
+    /// <summary>
+    /// Finalizer. Hands idle native lists to the abandoned queue if the pool was not disposed; they are destroyed on
+    /// the CAD thread by the next call to any other pool.
+    /// </summary>
+    !ElementIdListPool();
+
+  internal:
+    explicit ElementIdListPool(Interfaces::ICwAPI3DControllerFactory* controllerFactory);
+
+    Interfaces::ICwAPI3DElementIDList* RentNative();
+    void ReturnNative(Interfaces::ICwAPI3DElementIDList* nativeList);
+
+    /// Queues a native list for destruction on the CAD thread. Safe to call from a finalizer.
+    static void Abandon(Interfaces::ICwAPI3DElementIDList* nativeList);
+  };
+}
@@ -0,0 +1,227 @@
+#include "ElementIdSet.h"
+#include "../native/IdSet.h"
+
+#include <cstdint>
+
+namespace CwAPI3D::Net::Bridge
+{
+  ElementIdSet::ElementIdSet()
+  {
+    m_set = new Native::IdSet();
+  }
+
+  ElementIdSet::ElementIdSet(Native::IdSet* set)
+  {
+    if (!set)
+      throw gcnew System::ArgumentNullException("set");
+
+    m_set = set;
+  }
+
+  ElementIdSet^ ElementIdSet::FromArray(array<int>^ ids)
+  {
+    auto result = gcnew ElementIdSet();
+    result->AddRange(ids);
+    return result;
+  }
+
+  ElementIdSet::~ElementIdSet()
+  {
+    this->!ElementIdSet();
+  }
+
+  ElementIdSet::!ElementIdSet()
+  {
+    delete m_set;
+    m_set = nullptr;
+  }
+
+  void ElementIdSet::ThrowIfDisposed()
+  {
+    if (!m_set)
+      throw gcnew System::ObjectDisposedException("ElementIdSet");
+  }
+
+  Native::IdSet& ElementIdSet::StorageOf(ElementIdSet^ set, System::String^ paramName)
+  {
+    if (set == nullptr)
+      throw gcnew System::ArgumentNullException(paramName);
+
+    set->ThrowIfDisposed();
+    return *set->m_set;
+  }
+
+  Native::IdSet* ElementIdSet::Storage::get()
+  {
+    ThrowIfDisposed();
+    return m_set;
+  }
+
+  int ElementIdSet::Count::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_set->size());
+  }
+
+  long long ElementIdSet::MemoryBytes::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<long long>(m_set->memoryBytes());
+  }
+
+  bool ElementIdSet::Contains(int id)
+  {
+    ThrowIfDisposed();
+    return id >= 0 && m_set->contains(static_cast<uint32_t>(id));
+  }
+
+  bool ElementIdSet::Add(int id)
+  {
+    ThrowIfDisposed();
+    if (id < 0)
+      throw gcnew System::ArgumentOutOfRangeException("id", "Element ID cannot be negative.");
+
+    return m_set->add(static_cast<uint32_t>(id));
+  }
+
+  void ElementIdSet::AddRange(array<int>^ ids)
+  {
+    ThrowIfDisposed();
+    if (ids == nullptr)
+      throw gcnew System::ArgumentNullException("ids");
+    if (ids->Length == 0)
+      return;
+
+    pin_ptr<int> source = &ids[0];
+    const int* first = source;
+    for (int i = 0; i < ids->Length; ++i)
+    {
+      if (first[i] < 0)
+        throw gcnew System::ArgumentException("Element ID cannot be negative.", "ids");
+    }
+
+    // Non-negative ints have the same bit pattern as the unsigned IDs the native set stores.
+    m_set->addMany(reinterpret_cast<const uint32_t*>(first), static_cast<size_t>(ids->Length));
+    System::GC::KeepAlive(this);
+  }
+
+  bool ElementIdSet::Remove(int id)
+  {
+    ThrowIfDisposed();
+    return id >= 0 && m_set->remove(static_cast<uint32_t>(id));
+  }
+
+  void ElementIdSet::Clear()
+  {
+    ThrowIfDisposed();
+    m_set->clear();
+  }
+
+  void ElementIdSet::UnionWith(ElementIdSet^ other)
+  {
+    ThrowIfDisposed();
+    m_set->unionWith(StorageOf(other, "other"));
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(other);
+  }
+
+  void ElementIdSet::IntersectWith(ElementIdSet^ other)
+  {
+    ThrowIfDisposed();
+    m_set->intersectWith(StorageOf(other, "other"));
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(other);
+  }
+
+  void ElementIdSet::ExceptWith(ElementIdSet^ other)
+  {
+    ThrowIfDisposed();
+    m_set->subtract(StorageOf(other, "other"));
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(other);
+  }
+
+  bool ElementIdSet::SetEquals(ElementIdSet^ other)
+  {
+    ThrowIfDisposed();
+    const bool equal = *m_set == StorageOf(other, "other");
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(other);
+    return equal;
+  }
+
+  ElementIdSet^ ElementIdSet::Clone()
+  {
+    ThrowIfDisposed();
+    auto copy = new Native::IdSet(*m_set);
+    System::GC::KeepAlive(this);
+    return gcnew ElementIdSet(copy);
+  }
+
+  ElementIdSet^ ElementIdSet::Union(ElementIdSet^ a, ElementIdSet^ b)
+  {
+    auto result = new Native::IdSet(Native::IdSet::unionOf(StorageOf(a, "a"), StorageOf(b, "b")));
+    System::GC::KeepAlive(a);
+    System::GC::KeepAlive(b);
+    return gcnew ElementIdSet(result);
+  }
+
+  ElementIdSet^ ElementIdSet::Intersect(ElementIdSet^ a, ElementIdSet^ b)
+  {
+    auto result = new Native::IdSet(Native::IdSet::intersectionOf(StorageOf(a, "a"), StorageOf(b, "b")));
+    System::GC::KeepAlive(a);
+    System::GC::KeepAlive(b);
+    return gcnew ElementIdSet(result);
+  }
+
+  ElementIdSet^ ElementIdSet::Except(ElementIdSet^ a, ElementIdSet^ b)
+  {
+    auto result = new Native::IdSet(Native::IdSet::differenceOf(StorageOf(a, "a"), StorageOf(b, "b")));
+    System::GC::KeepAlive(a);
+    System::GC::KeepAlive(b);
+    return gcnew ElementIdSet(result);
+  }
+
+  ElementIdSet^ ElementIdSet::operator|(ElementIdSet^ a, ElementIdSet^ b)
+  {
+    return Union(a, b);
+  }
+
+  ElementIdSet^ ElementIdSet::operator&(ElementIdSet^ a, ElementIdSet^ b)
+  {
+    return Intersect(a, b);
+  }
+
+  ElementIdSet^ ElementIdSet::operator-(ElementIdSet^ a, ElementIdSet^ b)
+  {
+    return Except(a, b);
+  }
+
+  array<int>^ ElementIdSet::ToArray()
+  {
+    ThrowIfDisposed();
+    auto result = gcnew array<int>(static_cast<int>(m_set->size()));
+    if (result->Length != 0)
+    {
+      pin_ptr<int> destination = &result[0];
+      m_set->copyTo(reinterpret_cast<uint32_t*>(static_cast<int*>(destination)));
+    }
+    System::GC::KeepAlive(this);
+    return result;
+  }
+
+  int ElementIdSet::CopyTo(array<int>^% buffer)
+  {
+    ThrowIfDisposed();
+    const int count = static_cast<int>(m_set->size());
+    if (buffer == nullptr || buffer->Length < count)
+      buffer = gcnew array<int>(count);
+    if (count != 0)
+    {
+      pin_ptr<int> destination = &buffer[0];
+      m_set->copyTo(reinterpret_cast<uint32_t*>(static_cast<int*>(destination)));
+    }
+    System::GC::KeepAlive(this);
+    return count;
+  }
+}
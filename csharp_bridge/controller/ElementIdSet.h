@@ -0,0 +1,185 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace Native
+  {
+    class IdSet;
+  }
+
+  /// <summary>
+  /// A compressed set of element IDs held in native memory.
+  /// IDs are grouped by their upper 16 bits and each group is stored as a sorted array or, once it holds more than
+  /// 4096 IDs, as a bitmap, so a set of 500,000 consecutive IDs takes about 64 KB. Union, intersection and
+  /// difference run natively group by group, with SIMD over bitmap groups, and never create managed lists.
+  /// </summary>
+  /// <remarks>
+  /// Element controller queries can return their result as an ElementIdSet, and mutating methods accept one, so
+  /// set logic over several queries stays native end to end. Dispose the set to release the native memory early.
+  /// </remarks>
+  public ref class ElementIdSet sealed
+  {
+  private:
+    Native::IdSet* m_set;
+
+    void ThrowIfDisposed();
+    static Native::IdSet& StorageOf(ElementIdSet^ set, System::String^ paramName);
+
+  public:
+    /// <summary>
+    /// Initializes a new, empty ElementIdSet.
+    /// </summary>
+    ElementIdSet();
+
+    /// <summary>
+    /// Creates a set holding the given IDs; duplicates are ignored.
+    /// </summary>
+    /// <param name="ids">The element IDs, in any order.</param>
+    /// <returns>A new ElementIdSet.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when any id is negative.</exception>
+    static ElementIdSet^ FromArray(array<int>^ ids);
+
+    /// <summary>
+    /// Releases the native storage.
+    /// </summary>
+    ~ElementIdSet();
+
+    /// <summary>
+    /// Finalizer. Releases the native storage if the set was not disposed.
+    /// </summary>
+    !ElementIdSet();
+
+    /// <summary>
+    /// Gets the number of IDs in the set.
+    /// </summary>
+    property int Count
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the number of bytes of native memory the set uses.
+    /// </summary>
+    property long long MemoryBytes
+    {
+      long long get();
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether the native storage has been released.
+    /// </summary>
+    property bool IsDisposed
+    {
+      bool get() { return m_set == nullptr; }
+    }
+
+    /// <summary>
+    /// Determines whether the set contains the ID.
+    /// </summary>
+    bool Contains(int id);
+
+    /// <summary>
+    /// Adds an ID.
+    /// </summary>
+    /// <returns>true if the ID was added; false if it was already present.</returns>
+    /// <exception cref="System::ArgumentOutOfRangeException">Thrown when id is negative.</exception>
+    bool Add(int id);
+
+    /// <summary>
+    /// Adds all IDs of the array in a single native call.
+    /// </summary>
+    /// <exception cref="System::ArgumentException">Thrown when any id is negative.</exception>
+    void AddRange(array<int>^ ids);
+
+    /// <summary>
+    /// Removes an ID.
+    /// </summary>
+    /// <returns>true if the ID was removed; false if it was not present.</returns>
+    bool Remove(int id);
+
+    /// <summary>
+    /// Removes all IDs.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Adds every ID of the other set to this one.
+    /// </summary>
+    void UnionWith(ElementIdSet^ other);
+
+    /// <summary>
+    /// Keeps only the IDs that are also in the other set.
+    /// </summary>
+    void IntersectWith(ElementIdSet^ other);
+
+    /// <summary>
+    /// Removes every ID that is in the other set.
+    /// </summary>
+    void ExceptWith(ElementIdSet^ other);
+
+    /// <summary>
+    /// Determines whether both sets contain the same IDs.
+    /// </summary>
+    bool SetEquals(ElementIdSet^ other);
+
+    /// <summary>
+    /// Creates an independent copy of the set.
+    /// </summary>
+    ElementIdSet^ Clone();
+
+    /// <summary>
+    /// Returns a new set with the IDs that are in either set.
+    /// </summary>
+    static ElementIdSet^ Union(ElementIdSet^ a, ElementIdSet^ b);
+
+    /// <summary>
+    /// Returns a new set with the IDs that are in both sets.
+    /// </summary>
+    static ElementIdSet^ Intersect(ElementIdSet^ a, ElementIdSet^ b);
+
+    /// <summary>
+    /// Returns a new set with the IDs of a that are not in b.
+    /// </summary>
+    static ElementIdSet^ Except(ElementIdSet^ a, ElementIdSet^ b);
+
+    /// <summary>
+    /// Same as Union.
+    /// </summary>
+    static ElementIdSet^ operator|(ElementIdSet^ a, ElementIdSet^ b);
+
+    /// <summary>
+    /// Same as Intersect.
+    /// </summary>
+    static ElementIdSet^ operator&(ElementIdSet^ a, ElementIdSet^ b);
+
+    /// <summary>
+    /// Same as Except.
+    /// </summary>
+    static ElementIdSet^ operator-(ElementIdSet^ a, ElementIdSet^ b);
+
+    /// <summary>
+    /// Copies the IDs, in ascending order, into a new array.
+    /// </summary>
+    array<int>^ ToArray();
+
+    /// <summary>
+    /// Copies the IDs, in ascending order, into a caller-owned buffer, growing it only when it is too small.
+    /// </summary>
+    /// <param name="buffer">The destination buffer.</param>
+    /// <returns>The number of IDs written.</returns>
+    int CopyTo(array<int>^% buffer);
+
+  internal:
+    /// <summary>
+    /// Takes ownership of a native set.
+    /// </summary>
+    ElementIdSet(Native::IdSet* set);
+
+    /// The native set. Callers that hand it to native code must GC::KeepAlive the set after the call, or the
+    /// finalizer may free it while the native code still runs.
+    property Native::IdSet* Storage
+    {
+      Native::IdSet* get();
+    }
+  };
+}
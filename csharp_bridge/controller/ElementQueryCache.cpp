@@ -0,0 +1,75 @@
+#include "ElementQueryCache.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  ElementQueryCache::ElementQueryCache()
+  {
+    m_results = gcnew array<array<int>^>(QueryCount);
+    m_enabled = false;
+    m_hits = 0;
+    m_misses = 0;
+    m_invalidations = 0;
+  }
+
+  int ElementQueryCache::IndexOf(ElementQueries query)
+  {
+    switch (query)
+    {
+    case ElementQueries::AllIdentifiable: return 0;
+    case ElementQueries::Visible: return 1;
+    case ElementQueries::Invisible: return 2;
+    case ElementQueries::Active: return 3;
+    case ElementQueries::InactiveAll: return 4;
+    case ElementQueries::InactiveVisible: return 5;
+    default: throw gcnew System::ArgumentException("Expected a single query.", "query");
+    }
+  }
+
+  void ElementQueryCache::Enabled::set(bool value)
+  {
+    if (!value)
+      Invalidate(ElementQueries::Any);
+    m_enabled = value;
+  }
+
+  void ElementQueryCache::Invalidate(ElementQueries queries)
+  {
+    for (int i = 0; i < QueryCount; ++i)
+    {
+      if ((static_cast<int>(queries) & (1 << i)) != 0 && m_results[i] != nullptr)
+      {
+        m_results[i] = nullptr;
+        ++m_invalidations;
+      }
+    }
+  }
+
+  void ElementQueryCache::ResetStatistics()
+  {
+    m_hits = 0;
+    m_misses = 0;
+    m_invalidations = 0;
+  }
+
+  bool ElementQueryCache::TryGet(ElementQueries query, array<int>^% ids)
+  {
+    if (!m_enabled)
+      return false;
+
+    ids = m_results[IndexOf(query)];
+    if (ids == nullptr)
+    {
+      ++m_misses;
+      return false;
+    }
+
+    ++m_hits;
+    return true;
+  }
+
+  void ElementQueryCache::Store(ElementQueries query, array<int>^ ids)
+  {
+    if (m_enabled)
+      m_results[IndexOf(query)] = ids;
+  }
+}
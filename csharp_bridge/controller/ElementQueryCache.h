@@ -0,0 +1,113 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  /// <summary>
+  /// The element ID queries of ElementController, as flags for selecting which cached results to drop.
+  /// </summary>
+  [System::Flags]
+  public enum class ElementQueries
+  {
+    None = 0,
+    AllIdentifiable = 1 << 0,
+    Visible = 1 << 1,
+    Invisible = 1 << 2,
+    Active = 1 << 3,
+    InactiveAll = 1 << 4,
+    InactiveVisible = 1 << 5,
+
+    /// <summary>
+    /// The queries whose result depends on element visibility.
+    /// </summary>
+    Visibility = Visible | Invisible | InactiveVisible,
+
+    /// <summary>
+    /// The queries whose result depends on element activation.
+    /// </summary>
+    Activation = Active | InactiveAll | InactiveVisible,
+
+    Any = AllIdentifiable | Visible | Invisible | Active | InactiveAll | InactiveVisible
+  };
+
+  /// <summary>
+  /// Opt-in memo of ElementController's element ID queries.
+  /// While enabled, each query result is kept until a bridge call that adds, removes or replaces elements (delete,
+  /// copy, split, solder, conversions, beam creation, undo/redo, CommandBatch flushes with copies or deletes) drops
+  /// it. Moves and joins keep the cached results. Changes made outside the bridge (by the user or another plugin)
+  /// are not seen; report them with ElementController::NotifyModelChanged.
+  /// </summary>
+  /// <remarks>
+  /// Every call returns its own copy of the cached IDs, so callers may modify the returned lists.
+  /// </remarks>
+  public ref class ElementQueryCache sealed
+  {
+  private:
+    static constexpr int QueryCount = 6;
+
+    array<array<int>^>^ m_results;
+    bool m_enabled;
+    long long m_hits;
+    long long m_misses;
+    long long m_invalidations;
+
+    static int IndexOf(ElementQueries query);
+
+  public:
+    /// <summary>
+    /// Gets or sets a value indicating whether query results are cached. Disabled by default; disabling drops all
+    /// cached results.
+    /// </summary>
+    property bool Enabled
+    {
+      bool get() { return m_enabled; }
+      void set(bool value);
+    }
+
+    /// <summary>
+    /// Gets the number of queries answered from the cache.
+    /// </summary>
+    property long long HitCount
+    {
+      long long get() { return m_hits; }
+    }
+
+    /// <summary>
+    /// Gets the number of queries that went to the CAD core while the cache was enabled.
+    /// </summary>
+    property long long MissCount
+    {
+      long long get() { return m_misses; }
+    }
+
+    /// <summary>
+    /// Gets the number of cached results that have been dropped.
+    /// </summary>
+    property long long InvalidationCount
+    {
+      long long get() { return m_invalidations; }
+    }
+
+    /// <summary>
+    /// Drops the cached results of the given queries.
+    /// </summary>
+    void Invalidate(ElementQueries queries);
+
+    /// <summary>
+    /// Resets HitCount, MissCount and InvalidationCount to zero.
+    /// </summary>
+    void ResetStatistics();
+
+  internal:
+    ElementQueryCache();
+
+    /// <summary>
+    /// Gets the cached result of a single query, counting a hit or (when enabled) a miss.
+    /// </summary>
+    bool TryGet(ElementQueries query, array<int>^% ids);
+
+    /// <summary>
+    /// Caches the result of a single query if the cache is enabled. The array must not be handed out afterwards.
+    /// </summary>
+    void Store(ElementQueries query, array<int>^ ids);
+  };
+}
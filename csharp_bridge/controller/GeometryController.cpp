@@ -0,0 +1,230 @@
+#include "GeometryController.h"
+#include "ElementIdSet.h"
+#include "../diagnostics/BridgeCounters.h"
+#include "../diagnostics/TraceScope.h"
+#include "../geometry/PointBuffer.h"
+#include "../geometry/VectorBuffer.h"
+#include "../interop/GeometryInterop.h"
+#include "../native/SoaBuffer.h"
+
+#include <ICwAPI3DControllerFactory.h>
+#include <ICwAPI3DGeometryController.h>
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+
+  Native::SoaView ViewOf(PointBuffer^ buffer)
+  {
+    return buffer == nullptr ? Native::SoaView{} : buffer->Storage->view();
+  }
+
+  Native::SoaView ViewOf(VectorBuffer^ buffer)
+  {
+    return buffer == nullptr ? Native::SoaView{} : buffer->Storage->view();
+  }
+
+  CwAPI3D::elementID ToNativeId(int id)
+  {
+    if (id < 0)
+      throw gcnew ArgumentException("Element ID cannot be negative.", "elementID");
+    return static_cast<CwAPI3D::elementID>(id);
+  }
+}
+
+CwAPI3D::Net::Bridge::GeometryController::GeometryController(Interfaces::ICwAPI3DControllerFactory* nativePtr)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_Create);
+  m_geometryController = nativePtr->getGeometryController();
+}
+
+// Pins the IDs and the scalar arrays, then reads every requested field in a single native call straight into the
+// snapshot's buffers.
+void CwAPI3D::Net::Bridge::GeometryController::Fill(GeometrySnapshot^ snapshot)
+{
+  const int count = snapshot->Count;
+  if (count == 0)
+    return;
+
+  pin_ptr<int> ids = &snapshot->IdStorage[0];
+  pin_ptr<double> width = nullptr;
+  pin_ptr<double> height = nullptr;
+  pin_ptr<double> length = nullptr;
+  if (snapshot->Width != nullptr) width = &snapshot->Width[0];
+  if (snapshot->Height != nullptr) height = &snapshot->Height[0];
+  if (snapshot->Length != nullptr) length = &snapshot->Length[0];
+
+  Interop::GeometryRequest request{};
+  request.ids = ids;
+  request.count = static_cast<uint32_t>(count);
+  request.vectors[static_cast<uint32_t>(Interop::GeometryVector::P1)] = ViewOf(snapshot->P1);
+  request.vectors[static_cast<uint32_t>(Interop::GeometryVector::P2)] = ViewOf(snapshot->P2);
+  request.vectors[static_cast<uint32_t>(Interop::GeometryVector::P3)] = ViewOf(snapshot->P3);
+  request.vectors[static_cast<uint32_t>(Interop::GeometryVector::XL)] = ViewOf(snapshot->XL);
+  request.vectors[static_cast<uint32_t>(Interop::GeometryVector::YL)] = ViewOf(snapshot->YL);
+  request.vectors[static_cast<uint32_t>(Interop::GeometryVector::ZL)] = ViewOf(snapshot->ZL);
+  request.scalars[static_cast<uint32_t>(Interop::GeometryScalar::Width)] = width;
+  request.scalars[static_cast<uint32_t>(Interop::GeometryScalar::Height)] = height;
+  request.scalars[static_cast<uint32_t>(Interop::GeometryScalar::Length)] = length;
+
+  int vectorFields = 0;
+  const auto vectorBits = snapshot->Fields & (GeometryFields::Points | GeometryFields::Directions);
+  for (int bits = static_cast<int>(vectorBits); bits != 0; bits &= bits - 1)
+    ++vectorFields;
+
+  BridgeCounters::Add(Detail::Counter::IdsToNative, count);
+  BridgeCounters::Add(Detail::Counter::VectorsToManaged, static_cast<long long>(count) * vectorFields);
+  Detail::NativeTraceScope native;
+  const bool valid = Interop::FetchGeometry(m_geometryController, request);
+  native.leave();
+  // The request only holds the buffers' native storage; the snapshot references the buffers, so keeping it alive
+  // keeps their finalizers from freeing that storage while it is written.
+  GC::KeepAlive(snapshot);
+  if (!valid)
+    throw gcnew ArgumentException("Element ID cannot be negative.", "elementIDs");
+}
+
+// The IDs are copied into the snapshot, so later changes to the caller's array do not show in ElementIds.
+void CwAPI3D::Net::Bridge::GeometryController::Read(array<int>^ elementIDs, GeometryFields fields, GeometrySnapshot^% snapshot)
+{
+  if (elementIDs == nullptr)
+    throw gcnew ArgumentNullException("elementIDs");
+  if ((fields & GeometryFields::All) == GeometryFields::None || (fields & ~GeometryFields::All) != GeometryFields::None)
+    throw gcnew ArgumentException("Expected one or more geometry fields.", "fields");
+
+  if (snapshot == nullptr)
+    snapshot = gcnew GeometrySnapshot();
+  snapshot->Prepare(elementIDs->Length, fields);
+  Array::Copy(elementIDs, snapshot->IdStorage, elementIDs->Length);
+  Fill(snapshot);
+}
+
+int CwAPI3D::Net::Bridge::GeometryController::GetSnapshotInto(array<int>^ elementIDs, GeometryFields fields, GeometrySnapshot^% snapshot)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetSnapshotInto);
+  Read(elementIDs, fields, snapshot);
+  return snapshot->Count;
+}
+
+CwAPI3D::Net::Bridge::GeometrySnapshot^ CwAPI3D::Net::Bridge::GeometryController::GetSnapshot(List<int>^ elementIDs, GeometryFields fields)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetSnapshot_List);
+  if (elementIDs == nullptr)
+    throw gcnew ArgumentNullException("elementIDs");
+
+  GeometrySnapshot^ snapshot = nullptr;
+  Read(elementIDs->ToArray(), fields, snapshot);
+  return snapshot;
+}
+
+CwAPI3D::Net::Bridge::GeometrySnapshot^ CwAPI3D::Net::Bridge::GeometryController::GetSnapshot(array<int>^ elementIDs, GeometryFields fields)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetSnapshot_Array);
+  GeometrySnapshot^ snapshot = nullptr;
+  Read(elementIDs, fields, snapshot);
+  return snapshot;
+}
+
+CwAPI3D::Net::Bridge::GeometrySnapshot^ CwAPI3D::Net::Bridge::GeometryController::GetSnapshot(ElementIdSet^ elementIDs, GeometryFields fields)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetSnapshot_IdSet);
+  if (elementIDs == nullptr)
+    throw gcnew ArgumentNullException("elementIDs");
+
+  GeometrySnapshot^ snapshot = nullptr;
+  Read(elementIDs->ToArray(), fields, snapshot);
+  return snapshot;
+}
+
+CwAPI3D::Net::Bridge::Point3DValue CwAPI3D::Net::Bridge::GeometryController::GetP1(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetP1);
+  const auto id = ToNativeId(elementID);
+  Detail::NativeTraceScope native;
+  const auto point = m_geometryController->getP1(id);
+  native.leave();
+  BridgeCounters::Add(Detail::Counter::VectorsToManaged, 1);
+  return Point3DValue::FromNative(point);
+}
+
+CwAPI3D::Net::Bridge::Point3DValue CwAPI3D::Net::Bridge::GeometryController::GetP2(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetP2);
+  const auto id = ToNativeId(elementID);
+  Detail::NativeTraceScope native;
+  const auto point = m_geometryController->getP2(id);
+  native.leave();
+  BridgeCounters::Add(Detail::Counter::VectorsToManaged, 1);
+  return Point3DValue::FromNative(point);
+}
+
+CwAPI3D::Net::Bridge::Point3DValue CwAPI3D::Net::Bridge::GeometryController::GetP3(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetP3);
+  const auto id = ToNativeId(elementID);
+  Detail::NativeTraceScope native;
+  const auto point = m_geometryController->getP3(id);
+  native.leave();
+  BridgeCounters::Add(Detail::Counter::VectorsToManaged, 1);
+  return Point3DValue::FromNative(point);
+}
+
+CwAPI3D::Net::Bridge::Vector3DValue CwAPI3D::Net::Bridge::GeometryController::GetXL(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetXL);
+  const auto id = ToNativeId(elementID);
+  Detail::NativeTraceScope native;
+  const auto direction = m_geometryController->getXL(id);
+  native.leave();
+  BridgeCounters::Add(Detail::Counter::VectorsToManaged, 1);
+  return Vector3DValue::FromNative(direction);
+}
+
+CwAPI3D::Net::Bridge::Vector3DValue CwAPI3D::Net::Bridge::GeometryController::GetYL(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetYL);
+  const auto id = ToNativeId(elementID);
+  Detail::NativeTraceScope native;
+  const auto direction = m_geometryController->getYL(id);
+  native.leave();
+  BridgeCounters::Add(Detail::Counter::VectorsToManaged, 1);
+  return Vector3DValue::FromNative(direction);
+}
+
+CwAPI3D::Net::Bridge::Vector3DValue CwAPI3D::Net::Bridge::GeometryController::GetZL(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetZL);
+  const auto id = ToNativeId(elementID);
+  Detail::NativeTraceScope native;
+  const auto direction = m_geometryController->getZL(id);
+  native.leave();
+  BridgeCounters::Add(Detail::Counter::VectorsToManaged, 1);
+  return Vector3DValue::FromNative(direction);
+}
+
+double CwAPI3D::Net::Bridge::GeometryController::GetWidth(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetWidth);
+  const auto id = ToNativeId(elementID);
+  Detail::NativeTraceScope native;
+  return m_geometryController->getWidth(id);
+}
+
+double CwAPI3D::Net::Bridge::GeometryController::GetHeight(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetHeight);
+  const auto id = ToNativeId(elementID);
+  Detail::NativeTraceScope native;
+  return m_geometryController->getHeight(id);
+}
+
+double CwAPI3D::Net::Bridge::GeometryController::GetLength(int elementID)
+{
+  Detail::TraceScope trace(Native::Trace::Point::GeometryController_GetLength);
+  const auto id = ToNativeId(elementID);
+  Detail::NativeTraceScope native;
+  return m_geometryController->getLength(id);
+}
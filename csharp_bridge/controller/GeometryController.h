@@ -0,0 +1,83 @@
+#pragma once
+
+#include "GeometrySnapshot.h"
+#include "../geometry/Point3DValue.h"
+#include "../geometry/Vector3DValue.h"
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DControllerFactory;
+    class ICwAPI3DGeometryController;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class ElementIdSet;
+
+  /// <summary>
+  /// Reads element geometry: axis points, local directions and dimensions.
+  /// </summary>
+  /// <remarks>
+  /// GetSnapshot reads any combination of fields for many elements in one native call, straight into PointBuffers,
+  /// VectorBuffers and double arrays. Reading a whole model this way replaces up to nine calls per element. Prefer it
+  /// over calling GetP1 and the like in a loop.
+  /// </remarks>
+  public ref class GeometryController
+  {
+  private:
+    Interfaces::ICwAPI3DGeometryController* m_geometryController;
+
+    void Fill(GeometrySnapshot^ snapshot);
+    void Read(array<int>^ elementIDs, GeometryFields fields, GeometrySnapshot^% snapshot);
+
+  public:
+    explicit GeometryController(Interfaces::ICwAPI3DControllerFactory* nativePtr);
+
+    /// <summary>
+    /// Reads geometry of many elements in one native call.
+    /// </summary>
+    /// <param name="elementIDs">The elements, one row each, in order; IDs may repeat.</param>
+    /// <param name="fields">The fields to read.</param>
+    /// <returns>One row per element ID; fields not requested are null.</returns>
+    /// <exception cref="System::ArgumentNullException">Thrown when elementIDs is null.</exception>
+    /// <exception cref="System::ArgumentException">Thrown when fields is None or has unknown flags, or an element ID
+    /// is negative.</exception>
+    GeometrySnapshot^ GetSnapshot(System::Collections::Generic::List<int>^ elementIDs, GeometryFields fields);
+
+    /// <inheritdoc cref="GetSnapshot(System::Collections::Generic::List{int}, GeometryFields)"/>
+    GeometrySnapshot^ GetSnapshot(array<int>^ elementIDs, GeometryFields fields);
+
+    /// <summary>
+    /// Reads geometry of every element in a set, in ascending ID order, in one native call.
+    /// </summary>
+    /// <param name="elementIDs">The elements.</param>
+    /// <param name="fields">The fields to read.</param>
+    /// <returns>One row per element, in ascending ID order.</returns>
+    /// <exception cref="System::ArgumentNullException">Thrown when elementIDs is null.</exception>
+    /// <exception cref="System::ArgumentException">Thrown when fields is None or has unknown flags.</exception>
+    GeometrySnapshot^ GetSnapshot(ElementIdSet^ elementIDs, GeometryFields fields);
+
+    /// <summary>
+    /// Reads geometry of many elements into a caller-owned snapshot. Its buffers are only reallocated when they are
+    /// too small, so polling the same elements does not allocate once the snapshot has grown to the model size.
+    /// </summary>
+    /// <param name="elementIDs">The elements, one row each, in order.</param>
+    /// <param name="fields">The fields to read; buffers of other fields are released.</param>
+    /// <param name="snapshot">The snapshot to refill, or null to create one.</param>
+    /// <returns>The number of rows read.</returns>
+    int GetSnapshotInto(array<int>^ elementIDs, GeometryFields fields, GeometrySnapshot^% snapshot);
+
+    Point3DValue GetP1(int elementID);
+    Point3DValue GetP2(int elementID);
+    Point3DValue GetP3(int elementID);
+    Vector3DValue GetXL(int elementID);
+    Vector3DValue GetYL(int elementID);
+    Vector3DValue GetZL(int elementID);
+    double GetWidth(int elementID);
+    double GetHeight(int elementID);
+    double GetLength(int elementID);
+  };
+}
@@ -0,0 +1,64 @@
+#include "GeometrySnapshot.h"
+#include "../geometry/PointBuffer.h"
+#include "../geometry/VectorBuffer.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace
+  {
+    bool Has(GeometryFields fields, GeometryFields field)
+    {
+      return (fields & field) != GeometryFields::None;
+    }
+
+    template <class Buffer>
+    void PrepareBuffer(Buffer^% buffer, bool requested, int count)
+    {
+      if (!requested)
+      {
+        delete buffer;
+        buffer = nullptr;
+        return;
+      }
+      if (buffer == nullptr)
+        buffer = gcnew Buffer(count);
+      buffer->Resize(count);
+    }
+
+    void PrepareArray(array<double>^% values, bool requested, int count)
+    {
+      if (!requested)
+        values = nullptr;
+      else if (values == nullptr || values->Length < count)
+        values = gcnew array<double>(count);
+    }
+  }
+
+  GeometrySnapshot::GeometrySnapshot()
+  {
+    m_ids = gcnew array<int>(0);
+  }
+
+  GeometrySnapshot::~GeometrySnapshot()
+  {
+    Prepare(0, GeometryFields::None);
+  }
+
+  void GeometrySnapshot::Prepare(int count, GeometryFields fields)
+  {
+    if (m_ids->Length < count)
+      m_ids = gcnew array<int>(count);
+
+    m_count = count;
+    m_fields = fields;
+    PrepareBuffer(m_p1, Has(fields, GeometryFields::P1), count);
+    PrepareBuffer(m_p2, Has(fields, GeometryFields::P2), count);
+    PrepareBuffer(m_p3, Has(fields, GeometryFields::P3), count);
+    PrepareBuffer(m_xl, Has(fields, GeometryFields::XL), count);
+    PrepareBuffer(m_yl, Has(fields, GeometryFields::YL), count);
+    PrepareBuffer(m_zl, Has(fields, GeometryFields::ZL), count);
+    PrepareArray(m_width, Has(fields, GeometryFields::Width), count);
+    PrepareArray(m_height, Has(fields, GeometryFields::Height), count);
+    PrepareArray(m_length, Has(fields, GeometryFields::Length), count);
+  }
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class PointBuffer;
+  ref class VectorBuffer;
+
+  /// <summary>
+  /// The geometry fields GeometryController.GetSnapshot reads; combine them to read only what is needed.
+  /// </summary>
+  [System::Flags]
+  public enum class GeometryFields
+  {
+    None = 0,
+    P1 = 1 << 0,
+    P2 = 1 << 1,
+    P3 = 1 << 2,
+    XL = 1 << 3,
+    YL = 1 << 4,
+    ZL = 1 << 5,
+    Width = 1 << 6,
+    Height = 1 << 7,
+    Length = 1 << 8,
+
+    /// <summary>
+    /// The axis points and the point fixing the cross-section orientation.
+    /// </summary>
+    Points = P1 | P2 | P3,
+
+    /// <summary>
+    /// The local x, y and z directions.
+    /// </summary>
+    Directions = XL | YL | ZL,
+
+    /// <summary>
+    /// Width, height and length.
+    /// </summary>
+    Dimensions = Width | Height | Length,
+
+    All = Points | Directions | Dimensions
+  };
+
+  /// <summary>
+  /// The geometry of many elements, read with one native call and stored field by field: points and directions in
+  /// PointBuffers and VectorBuffers (three aligned coordinate arrays each, ready for their batch operations) and
+  /// dimensions in double arrays. Row i of every field belongs to ElementIds[i].
+  /// </summary>
+  /// <remarks>
+  /// Fields that were not read are null. Pass the snapshot back to GeometryController.GetSnapshotInto to refill it
+  /// without reallocating; dispose it to release the native buffers early.
+  /// </remarks>
+  public ref class GeometrySnapshot sealed
+  {
+  private:
+    array<int>^ m_ids;
+    int m_count;
+    GeometryFields m_fields;
+    PointBuffer^ m_p1;
+    PointBuffer^ m_p2;
+    PointBuffer^ m_p3;
+    VectorBuffer^ m_xl;
+    VectorBuffer^ m_yl;
+    VectorBuffer^ m_zl;
+    array<double>^ m_width;
+    array<double>^ m_height;
+    array<double>^ m_length;
+
+  internal:
+    GeometrySnapshot();
+
+    /// Sizes the ID array and the buffers of the requested fields for `count` rows, reusing what is large enough,
+    /// and drops the buffers of fields no longer requested.
+    void Prepare(int count, GeometryFields fields);
+
+    property array<int>^ IdStorage
+    {
+      array<int>^ get() { return m_ids; }
+    }
+
+  public:
+    ~GeometrySnapshot();
+
+    /// <summary>
+    /// Gets the number of rows.
+    /// </summary>
+    property int Count
+    {
+      int get() { return m_count; }
+    }
+
+    /// <summary>
+    /// Gets the element ID of every row in the first Count entries. The array belongs to this snapshot.
+    /// </summary>
+    property array<int>^ ElementIds
+    {
+      array<int>^ get() { return m_ids; }
+    }
+
+    /// <summary>
+    /// Gets the fields that were read.
+    /// </summary>
+    property GeometryFields Fields
+    {
+      GeometryFields get() { return m_fields; }
+    }
+
+    /// <summary>
+    /// Gets the start points of the element axes, or null when not read.
+    /// </summary>
+    property PointBuffer^ P1
+    {
+      PointBuffer^ get() { return m_p1; }
+    }
+
+    /// <summary>
+    /// Gets the end points of the element axes, or null when not read.
+    /// </summary>
+    property PointBuffer^ P2
+    {
+      PointBuffer^ get() { return m_p2; }
+    }
+
+    /// <summary>
+    /// Gets the points fixing the cross-section orientation, or null when not read.
+    /// </summary>
+    property PointBuffer^ P3
+    {
+      PointBuffer^ get() { return m_p3; }
+    }
+
+    /// <summary>
+    /// Gets the local x directions (along the axis), or null when not read.
+    /// </summary>
+    property VectorBuffer^ XL
+    {
+      VectorBuffer^ get() { return m_xl; }
+    }
+
+    /// <summary>
+    /// Gets the local y directions, or null when not read.
+    /// </summary>
+    property VectorBuffer^ YL
+    {
+      VectorBuffer^ get() { return m_yl; }
+    }
+
+    /// <summary>
+    /// Gets the local z directions, or null when not read.
+    /// </summary>
+    property VectorBuffer^ ZL
+    {
+      VectorBuffer^ get() { return m_zl; }
+    }
+
+    /// <summary>
+    /// Gets the widths in the first Count entries, or null when not read.
+    /// </summary>
+    property array<double>^ Width
+    {
+      array<double>^ get() { return m_width; }
+    }
+
+    /// <summary>
+    /// Gets the heights in the first Count entries, or null when not read.
+    /// </summary>
+    property array<double>^ Height
+    {
+      array<double>^ get() { return m_height; }
+    }
+
+    /// <summary>
+    /// Gets the lengths in the first Count entries, or null when not read.
+    /// </summary>
+    property array<double>^ Length
+    {
+      array<double>^ get() { return m_length; }
+    }
+  };
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+// Header-only, constexpr-capable geometry core shared by the C++/CLI wrappers (Vector3D, Point3D, Plane3D and
+// their value-type variants). It depends only on the C++20 standard library, so it also builds with gcc and
+// clang outside the CLR toolchain; see CMakeLists.txt in the repository root.
+#include "Hash.h"
+#include "Math.h"
+#include "Plane.h"
+#include "Tolerance.h"
+#include "Vec3.h"
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Vec3.h"
+
+#include <cstdint>
+
+// Hashing for points under a tolerance: coordinates are quantized to a grid of cubic cells first, so points that
+// compare equal within a tolerance much smaller than the cell almost always share a cell, and hence a hash.
+namespace CwAPI3D::Net::Bridge::Core
+{
+  /// Integer coordinates of a grid cell.
+  struct CellKey
+  {
+    std::int64_t x;
+    std::int64_t y;
+    std::int64_t z;
+
+    friend constexpr bool operator==(const CellKey&, const CellKey&) = default;
+  };
+
+  /// Index of the cell of size cellSize that contains value, i.e. floor(value / cellSize). Indices clamp to
+  /// +-2^62, leaving room to step to neighbouring cells without overflow, and NaN maps to cell 0.
+  template <class T>
+  constexpr std::int64_t cellIndex(T value, T cellSize)
+  {
+    const T scaled = value / cellSize;
+    if (!(scaled == scaled))
+      return 0;
+    constexpr std::int64_t limit = std::int64_t(1) << 62;
+    if (scaled <= -static_cast<T>(limit))
+      return -limit;
+    if (scaled >= static_cast<T>(limit))
+      return limit;
+
+    const auto truncated = static_cast<std::int64_t>(scaled);
+    return static_cast<T>(truncated) > scaled ? truncated - 1 : truncated;
+  }
+
+  template <class T>
+  constexpr CellKey cellOf(const Vec3<T>& point, T cellSize)
+  {
+    return {cellIndex(point.x, cellSize), cellIndex(point.y, cellSize), cellIndex(point.z, cellSize)};
+  }
+
+  /// Finalizer of splitmix64: every input bit affects every output bit.
+  constexpr std::uint64_t mixHash(std::uint64_t value)
+  {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    value ^= value >> 31;
+    return value;
+  }
+
+  /// Order-dependent hash of a cell, so that cells with permuted coordinates do not collide.
+  constexpr std::uint64_t hashCell(const CellKey& cell)
+  {
+    std::uint64_t hash = mixHash(static_cast<std::uint64_t>(cell.x));
+    hash = mixHash(hash ^ (static_cast<std::uint64_t>(cell.y) + 0x9e3779b97f4a7c15ull));
+    return mixHash(hash ^ (static_cast<std::uint64_t>(cell.z) + 0x632be59bd9b4e019ull));
+  }
+
+  /// Cell size Point3D and Point3DValue quantize to before hashing, 10^4 times their equality epsilon.
+  template <class T>
+  inline constexpr T PointHashCellSize = T(1e-6);
+
+  /// Hash of a point for GetHashCode, folded to 32 bits. Points in the same cell of PointHashCellSize hash alike;
+  /// -0.0 and 0.0 do too.
+  template <class T>
+  constexpr std::int32_t hashPoint(const Vec3<T>& point)
+  {
+    const std::uint64_t hash = hashCell(cellOf(point, PointHashCellSize<T>));
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(hash ^ (hash >> 32)));
+  }
+}
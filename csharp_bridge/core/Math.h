@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+// Scalar helpers usable in constant expressions. At run time they forward to <cmath>, so results match
+// the rest of the bridge bit for bit.
+namespace CwAPI3D::Net::Bridge::Core
+{
+  template <class T>
+  constexpr T abs(T value)
+  {
+    return value < T(0) ? -value : value;
+  }
+
+  template <class T>
+  constexpr T min(T a, T b)
+  {
+    return b < a ? b : a;
+  }
+
+  template <class T>
+  constexpr T max(T a, T b)
+  {
+    return a < b ? b : a;
+  }
+
+  template <class T>
+  constexpr T clamp(T value, T low, T high)
+  {
+    return value < low ? low : (high < value ? high : value);
+  }
+
+  template <class T>
+  constexpr T sqrt(T value)
+  {
+    static_assert(std::is_floating_point_v<T>, "sqrt requires a floating-point type");
+
+    if (!std::is_constant_evaluated())
+      return std::sqrt(value);
+
+    if (value < T(0) || value != value)
+      return std::numeric_limits<T>::quiet_NaN();
+    if (value == T(0) || value == std::numeric_limits<T>::infinity())
+      return value;
+
+    // Newton iteration; stops once the estimate no longer changes (or oscillates between two neighbours).
+    T current = value < T(1) ? T(1) : value;
+    T previous = T(0);
+    for (int i = 0; i < 2048 && current != previous; ++i)
+    {
+      const T next = T(0.5) * (current + value / current);
+      if (next == previous)
+        return min(current, next);
+      previous = current;
+      current = next;
+    }
+    return current;
+  }
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "Math.h"
+#include "Tolerance.h"
+#include "Vec3.h"
+
+#include <optional>
+
+namespace CwAPI3D::Net::Bridge::Core
+{
+  /// An infinite line through point along direction (unit length when produced by Plane::intersect).
+  template <class T>
+  struct Line
+  {
+    Vec3<T> point;
+    Vec3<T> direction;
+  };
+
+  /// A plane n . p + d = 0 with unit normal n, plus the point it was defined through.
+  /// Construction goes through the factories, which return std::nullopt for degenerate input instead of
+  /// throwing, so callers decide how to report errors.
+  template <class T, TolerancePolicy<T> Tolerance = DefaultTolerance<T>>
+  class Plane
+  {
+  public:
+    using Vector = Vec3<T>;
+
+    /// Plane through point with the given normal; nullopt when the normal is within tolerance of zero length.
+    static constexpr std::optional<Plane> fromPointNormal(const Vector& point, const Vector& normal)
+    {
+      const T length = magnitude(normal);
+      if (Tolerance::isZero(length))
+        return std::nullopt;
+      return fromUnitNormal(point, normal / length);
+    }
+
+    /// Plane through three points; nullopt when they are collinear.
+    static constexpr std::optional<Plane> fromPoints(const Vector& p1, const Vector& p2, const Vector& p3)
+    {
+      return fromPointNormal(p1, cross(p2 - p1, p3 - p1));
+    }
+
+    /// Plane a x + b y + c z + d = 0; nullopt when (a, b, c) is within tolerance of zero.
+    static constexpr std::optional<Plane> fromCoefficients(T a, T b, T c, T d)
+    {
+      const Vector normal{a, b, c};
+      if (Tolerance::isZero(magnitude(normal)))
+        return std::nullopt;
+
+      // Pick the point on the axis of the first usable normal component.
+      Vector point;
+      if (!Tolerance::isZero(a))
+        point = {-d / a, T(0), T(0)};
+      else if (!Tolerance::isZero(b))
+        point = {T(0), -d / b, T(0)};
+      else
+        point = {T(0), T(0), -d / c};
+
+      return fromPointNormal(point, normal);
+    }
+
+    /// Plane through point with a normal the caller guarantees to be unit length.
+    static constexpr Plane fromUnitNormal(const Vector& point, const Vector& unitNormal)
+    {
+      return Plane(point, unitNormal, -dot(unitNormal, point));
+    }
+
+    constexpr const Vector& point() const { return m_point; }
+    constexpr const Vector& normal() const { return m_normal; }
+    constexpr T d() const { return m_d; }
+
+    /// Signed distance from p to the plane; positive on the side the normal points to.
+    constexpr T distanceTo(const Vector& p) const
+    {
+      return dot(m_normal, p) + m_d;
+    }
+
+    constexpr bool contains(const Vector& p, T epsilon) const
+    {
+      return abs(distanceTo(p)) < epsilon;
+    }
+
+    constexpr bool contains(const Vector& p) const
+    {
+      return Tolerance::isZero(distanceTo(p));
+    }
+
+    /// Orthogonal projection of p onto the plane.
+    constexpr Vector project(const Vector& p) const
+    {
+      return p - m_normal * distanceTo(p);
+    }
+
+    /// Intersection of the segment start-end with the plane; nullopt when the segment is shorter than
+    /// tolerance, runs parallel to the plane, or does not reach it.
+    constexpr std::optional<Vector> intersectSegment(const Vector& start, const Vector& end) const
+    {
+      const Vector offset = end - start;
+      const T length = magnitude(offset);
+      if (Tolerance::isZero(length))
+        return std::nullopt;
+
+      const Vector direction = offset / length;
+      const T denominator = dot(m_normal, direction);
+      if (Tolerance::isZero(denominator))
+        return std::nullopt;
+
+      const T t = -distanceTo(start) / denominator;
+      if (t < T(0) || t > length)
+        return std::nullopt;
+
+      return start + direction * t;
+    }
+
+    constexpr bool isParallelTo(const Plane& other, T epsilon) const
+    {
+      return magnitude(cross(m_normal, other.m_normal)) < epsilon;
+    }
+
+    constexpr bool isParallelTo(const Plane& other) const
+    {
+      return isParallelTo(other, Tolerance::epsilon);
+    }
+
+    /// Same plane within tolerance: parallel normals and other's point on this plane.
+    constexpr bool approxEquals(const Plane& other) const
+    {
+      return isParallelTo(other) && contains(other.m_point);
+    }
+
+    /// Line shared by both planes; nullopt when they are parallel.
+    constexpr std::optional<Line<T>> intersect(const Plane& other) const
+    {
+      if (isParallelTo(other))
+        return std::nullopt;
+
+      const Vector direction = normalize<T, Tolerance>(cross(m_normal, other.m_normal));
+
+      // Solve the two plane equations with the coordinate along the smallest direction component fixed at zero,
+      // which keeps the 2x2 system best conditioned; fall through to the next axis if it is singular anyway.
+      const T ax = abs(direction.x), ay = abs(direction.y), az = abs(direction.z);
+      int zeroComponent = (ax <= ay && ax <= az) ? 0 : ((ay <= ax && ay <= az) ? 1 : 2);
+
+      const T a1 = m_normal.x, b1 = m_normal.y, c1 = m_normal.z, d1 = m_d;
+      const T a2 = other.m_normal.x, b2 = other.m_normal.y, c2 = other.m_normal.z, d2 = other.m_d;
+      Vector point;
+
+      if (zeroComponent == 0)
+      {
+        const T det = b1 * c2 - b2 * c1;
+        if (Tolerance::isZero(det))
+          zeroComponent = 1;
+        else
+          point = {T(0), (c1 * d2 - c2 * d1) / det, (b2 * d1 - b1 * d2) / det};
+      }
+
+      if (zeroComponent == 1)
+      {
+        const T det = a1 * c2 - a2 * c1;
+        if (Tolerance::isZero(det))
+          zeroComponent = 2;
+        else
+          point = {(c1 * d2 - c2 * d1) / det, T(0), (a2 * d1 - a1 * d2) / det};
+      }
+
+      if (zeroComponent == 2)
+      {
+        const T det = a1 * b2 - a2 * b1;
+        if (Tolerance::isZero(det))
+          return std::nullopt;
+        point = {(b1 * d2 - b2 * d1) / det, (a2 * d1 - a1 * d2) / det, T(0)};
+      }
+
+      return Line<T>{point, direction};
+    }
+
+  private:
+    constexpr Plane(const Vector& point, const Vector& normal, T d)
+      : m_point(point), m_normal(normal), m_d(d)
+    {
+    }
+
+    Vector m_point;
+    Vector m_normal;
+    T m_d;
+  };
+
+  using Planed = Plane<double>;
+}
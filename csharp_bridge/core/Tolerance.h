@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Math.h"
+
+#include <concepts>
+#include <type_traits>
+
+namespace CwAPI3D::Net::Bridge::Core
+{
+  /// Requirements for the tolerance policy template parameter of the core geometry types.
+  template <class Policy, class T>
+  concept TolerancePolicy = requires(T value)
+  {
+    { Policy::epsilon } -> std::convertible_to<T>;
+    { Policy::isZero(value) } -> std::same_as<bool>;
+    { Policy::equal(value, value) } -> std::same_as<bool>;
+  };
+
+  /// Values closer than epsilon are equal. For double, epsilon is the 1e-10 used throughout the bridge.
+  template <class T>
+  struct AbsoluteTolerance
+  {
+    static constexpr T epsilon = std::is_same_v<T, float> ? T(1e-5) : T(1e-10);
+
+    static constexpr bool isZero(T value) { return abs(value) < epsilon; }
+    static constexpr bool equal(T a, T b) { return abs(a - b) < epsilon; }
+  };
+
+  /// Like AbsoluteTolerance, but equality scales epsilon with the larger magnitude once it exceeds 1,
+  /// which suits coordinates far from the origin.
+  template <class T>
+  struct RelativeTolerance
+  {
+    static constexpr T epsilon = AbsoluteTolerance<T>::epsilon;
+
+    static constexpr bool isZero(T value) { return abs(value) < epsilon; }
+    static constexpr bool equal(T a, T b) { return abs(a - b) < epsilon * max(T(1), max(abs(a), abs(b))); }
+  };
+
+  template <class T>
+  using DefaultTolerance = AbsoluteTolerance<T>;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Math.h"
+#include "Tolerance.h"
+
+#include <cmath>
+
+namespace CwAPI3D::Net::Bridge::Core
+{
+  /// A point or vector in 3D space. Plain aggregate, so Vec3<double> has the layout of CwAPI3D::vector3D.
+  template <class T>
+  struct Vec3
+  {
+    T x{};
+    T y{};
+    T z{};
+
+    friend constexpr Vec3 operator+(const Vec3& a, const Vec3& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+    friend constexpr Vec3 operator-(const Vec3& a, const Vec3& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+    friend constexpr Vec3 operator-(const Vec3& v) { return {-v.x, -v.y, -v.z}; }
+    friend constexpr Vec3 operator*(const Vec3& v, T scalar) { return {v.x * scalar, v.y * scalar, v.z * scalar}; }
+    friend constexpr Vec3 operator*(T scalar, const Vec3& v) { return v * scalar; }
+    friend constexpr Vec3 operator/(const Vec3& v, T scalar) { return {v.x / scalar, v.y / scalar, v.z / scalar}; }
+
+    /// Exact comparison; use approxEqual for tolerance-based equality.
+    friend constexpr bool operator==(const Vec3&, const Vec3&) = default;
+  };
+
+  using Vec3d = Vec3<double>;
+  using Vec3f = Vec3<float>;
+
+  template <class T>
+  constexpr T dot(const Vec3<T>& a, const Vec3<T>& b)
+  {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+  }
+
+  template <class T>
+  constexpr Vec3<T> cross(const Vec3<T>& a, const Vec3<T>& b)
+  {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+  }
+
+  template <class T>
+  constexpr T magnitudeSquared(const Vec3<T>& v)
+  {
+    return dot(v, v);
+  }
+
+  template <class T>
+  constexpr T magnitude(const Vec3<T>& v)
+  {
+    return sqrt(magnitudeSquared(v));
+  }
+
+  template <class T>
+  constexpr T distanceSquared(const Vec3<T>& a, const Vec3<T>& b)
+  {
+    return magnitudeSquared(b - a);
+  }
+
+  template <class T>
+  constexpr T distance(const Vec3<T>& a, const Vec3<T>& b)
+  {
+    return sqrt(distanceSquared(a, b));
+  }
+
+  /// Returns v scaled to unit length, or the zero vector when |v| is within tolerance of zero.
+  template <class T, TolerancePolicy<T> Tolerance = DefaultTolerance<T>>
+  constexpr Vec3<T> normalize(const Vec3<T>& v)
+  {
+    const T length = magnitude(v);
+    if (Tolerance::isZero(length))
+      return {};
+    return v / length;
+  }
+
+  /// Component-wise comparison under the tolerance policy.
+  template <class T, TolerancePolicy<T> Tolerance = DefaultTolerance<T>>
+  constexpr bool approxEqual(const Vec3<T>& a, const Vec3<T>& b)
+  {
+    return Tolerance::equal(a.x, b.x) && Tolerance::equal(a.y, b.y) && Tolerance::equal(a.z, b.z);
+  }
+
+  /// Angle between a and b in radians, or 0 when either is within tolerance of zero length.
+  /// Not constexpr: std::acos is not usable in constant expressions before C++26.
+  template <class T, TolerancePolicy<T> Tolerance = DefaultTolerance<T>>
+  T angle(const Vec3<T>& a, const Vec3<T>& b)
+  {
+    const T magnitudeA = magnitude(a);
+    const T magnitudeB = magnitude(b);
+    if (Tolerance::isZero(magnitudeA) || Tolerance::isZero(magnitudeB))
+      return T(0);
+
+    return std::acos(clamp(dot(a, b) / (magnitudeA * magnitudeB), T(-1), T(1)));
+  }
+}
@@ -3,41 +3,93 @@
 
 #include <stdexcept>
 
+#include "controller/AttributeController.h"
+#include "controller/ControllerRegistry.h"
 #include "controller/ElementController.h"
+#include "controller/GeometryController.h"
+#include "diagnostics/TraceScope.h"
+#include "threading/CadThreadExecutor.h"
 
 CwAPI3D::Net::Bridge::CwApi3DFactory::CwApi3DFactory(IntPtr nativeFactoryPtr)
 {
+  Detail::TraceScope trace(Native::Trace::Point::CwApi3DFactory_Create);
   mControllerFactory = static_cast<CwAPI3D::ControllerFactory*>(nativeFactoryPtr.ToPointer());
   if (!mControllerFactory)
   {
     throw std::runtime_error("Failed to initialize CwApi3DFactory: nativeFactoryPtr is null.");
   }
-  mElementController = gcnew ElementController(mControllerFactory);
+  mExecutor = gcnew CadThreadExecutor();
+  mControllers = gcnew ControllerRegistry();
+  mControllers->Register(ElementController::typeid, gcnew Func<Object^>(this, &CwApi3DFactory::CreateElementController));
+  mControllers->Register(AttributeController::typeid, gcnew Func<Object^>(this, &CwApi3DFactory::CreateAttributeController));
+  mControllers->Register(GeometryController::typeid, gcnew Func<Object^>(this, &CwApi3DFactory::CreateGeometryController));
+}
+
+System::Object^ CwAPI3D::Net::Bridge::CwApi3DFactory::CreateElementController()
+{
+  return gcnew ElementController(mControllerFactory, mExecutor);
+}
+
+System::Object^ CwAPI3D::Net::Bridge::CwApi3DFactory::CreateAttributeController()
+{
+  return gcnew AttributeController(mControllerFactory);
+}
+
+System::Object^ CwAPI3D::Net::Bridge::CwApi3DFactory::CreateGeometryController()
+{
+  return gcnew GeometryController(mControllerFactory);
 }
 
 System::String^ CwAPI3D::Net::Bridge::CwApi3DFactory::GetSomething()
 {
+  Detail::TraceScope trace(Native::Trace::Point::CwApi3DFactory_GetSomething);
   if (!mControllerFactory)
   {
     throw std::runtime_error("ControllerFactory is not initialized.");
   }
+  Detail::NativeTraceScope native;
   const auto text = mControllerFactory->getUtilityController()->get3DFilePath()->narrowData();
+  native.leave();
   const auto textToString = gcnew System::String(text);
   return textToString;
 }
 
 IntPtr CwAPI3D::Net::Bridge::CwApi3DFactory::GetNativeFactory()
 {
+  Detail::TraceScope trace(Native::Trace::Point::CwApi3DFactory_GetNativeFactory);
   throw std::runtime_error("GetNativeFactory is not implemented in this example.");
 }
 
 CwAPI3D::Net::Bridge::ElementController^ CwAPI3D::Net::Bridge::CwApi3DFactory::GetElementController()
 {
+  Detail::TraceScope trace(Native::Trace::Point::CwApi3DFactory_GetElementController);
 
   if (!mControllerFactory)
   {
     throw std::runtime_error("ControllerFactory is not initialized.");
   }
-  return gcnew ElementController(mControllerFactory);
+  return mControllers->Get<ElementController>();
+
+}
+
+CwAPI3D::Net::Bridge::AttributeController^ CwAPI3D::Net::Bridge::CwApi3DFactory::GetAttributeController()
+{
+  Detail::TraceScope trace(Native::Trace::Point::CwApi3DFactory_GetAttributeController);
 
+  if (!mControllerFactory)
+  {
+    throw std::runtime_error("ControllerFactory is not initialized.");
+  }
+  return mControllers->Get<AttributeController>();
+}
+
+CwAPI3D::Net::Bridge::GeometryController^ CwAPI3D::Net::Bridge::CwApi3DFactory::GetGeometryController()
+{
+  Detail::TraceScope trace(Native::Trace::Point::CwApi3DFactory_GetGeometryController);
+
+  if (!mControllerFactory)
+  {
+    throw std::runtime_error("ControllerFactory is not initialized.");
+  }
+  return mControllers->Get<GeometryController>();
 }
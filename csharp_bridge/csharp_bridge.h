@@ -12,13 +12,25 @@ using namespace System;
 namespace CwAPI3D::Net::Bridge
 {
   ref class ElementController;
+  ref class AttributeController;
+  ref class GeometryController;
+  ref class ControllerRegistry;
+  ref class CadThreadExecutor;
 
   public ref class CwApi3DFactory
   {
   private:
     CwAPI3D::ControllerFactory* mControllerFactory;
 
-    Bridge::ElementController^ mElementController;
+    Bridge::ControllerRegistry^ mControllers;
+
+    Bridge::CadThreadExecutor^ mExecutor;
+
+    System::Object^ CreateElementController();
+
+    System::Object^ CreateAttributeController();
+
+    System::Object^ CreateGeometryController();
 
   public:
     explicit CwApi3DFactory(IntPtr nativeFactoryPtr);
@@ -29,5 +41,27 @@ namespace CwAPI3D::Net::Bridge
 
     Bridge::ElementController^ GetElementController();
 
+    Bridge::AttributeController^ GetAttributeController();
+
+    Bridge::GeometryController^ GetGeometryController();
+
+    /// <summary>
+    /// Gets the registry caching this factory's controller wrappers, e.g. to inspect creation counts.
+    /// </summary>
+    property Bridge::ControllerRegistry^ Controllers
+    {
+      Bridge::ControllerRegistry^ get() { return mControllers; }
+    }
+
+    /// <summary>
+    /// Gets the executor that runs the controllers' Async calls on the CAD thread.
+    /// It belongs to the thread that created this factory, which must be the CAD thread; drain it there by
+    /// scheduling RunPending on the message loop whenever WorkAvailable is raised.
+    /// </summary>
+    property Bridge::CadThreadExecutor^ Executor
+    {
+      Bridge::CadThreadExecutor^ get() { return mExecutor; }
+    }
+
   };
 }
@@ -0,0 +1,169 @@
+#include "BridgeCounters.h"
+
+#include <msclr/lock.h>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  namespace Trace = Native::Trace;
+
+  long long Copied(MarshallingCounts counts)
+  {
+    return counts.IdsToNative + counts.IdsToManaged + counts.VectorsToNative + counts.VectorsToManaged;
+  }
+
+  /// Orders methods by the IDs and vectors they copied, most first.
+  int CompareCopied(MarshallingCounts a, MarshallingCounts b)
+  {
+    const long long first = Copied(a);
+    const long long second = Copied(b);
+    return first > second ? -1 : (first < second ? 1 : 0);
+  }
+
+  void AppendLine(System::Text::StringBuilder^ report, MarshallingCounts counts)
+  {
+    report->AppendFormat("{0,-60} {1,10} {2,12} {3,12} {4,12} {5,12} {6,12}", counts.Name, counts.NativeIdLists,
+      counts.IdsToNative, counts.IdsToManaged, counts.VectorsToNative, counts.VectorsToManaged, counts.GeometryObjects);
+    report->AppendLine();
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  CounterSnapshot::CounterSnapshot(array<long long>^ counts)
+  {
+    m_counts = counts;
+  }
+
+  MarshallingCounts CounterSnapshot::Entry(int slot)
+  {
+    const int first = slot * BridgeCounters::CounterCount;
+    MarshallingCounts entry;
+    entry.NativeIdLists = m_counts[first + static_cast<int>(Detail::Counter::NativeIdLists)];
+    entry.IdsToNative = m_counts[first + static_cast<int>(Detail::Counter::IdsToNative)];
+    entry.IdsToManaged = m_counts[first + static_cast<int>(Detail::Counter::IdsToManaged)];
+    entry.VectorsToNative = m_counts[first + static_cast<int>(Detail::Counter::VectorsToNative)];
+    entry.VectorsToManaged = m_counts[first + static_cast<int>(Detail::Counter::VectorsToManaged)];
+    entry.GeometryObjects = m_counts[first + static_cast<int>(Detail::Counter::GeometryObjects)];
+    if (slot == 0)
+    {
+      entry.Name = "(outside bridge methods)";
+      entry.ClassName = System::String::Empty;
+    }
+    else
+    {
+      const auto point = static_cast<Trace::Point>(slot - 1);
+      entry.Name = gcnew System::String(Trace::name(point));
+      entry.ClassName = gcnew System::String(Trace::className(point));
+    }
+    return entry;
+  }
+
+  MarshallingCounts CounterSnapshot::Totals::get()
+  {
+    MarshallingCounts totals;
+    totals.Name = "Total";
+    totals.ClassName = System::String::Empty;
+    for (int slot = 0; slot < BridgeCounters::SlotCount; ++slot)
+    {
+      const int first = slot * BridgeCounters::CounterCount;
+      totals.NativeIdLists += m_counts[first + static_cast<int>(Detail::Counter::NativeIdLists)];
+      totals.IdsToNative += m_counts[first + static_cast<int>(Detail::Counter::IdsToNative)];
+      totals.IdsToManaged += m_counts[first + static_cast<int>(Detail::Counter::IdsToManaged)];
+      totals.VectorsToNative += m_counts[first + static_cast<int>(Detail::Counter::VectorsToNative)];
+      totals.VectorsToManaged += m_counts[first + static_cast<int>(Detail::Counter::VectorsToManaged)];
+      totals.GeometryObjects += m_counts[first + static_cast<int>(Detail::Counter::GeometryObjects)];
+    }
+    return totals;
+  }
+
+  array<MarshallingCounts>^ CounterSnapshot::Methods::get()
+  {
+    auto methods = gcnew System::Collections::Generic::List<MarshallingCounts>();
+    // Slot 0, the conversions outside any method, goes last.
+    for (int i = 1; i <= BridgeCounters::SlotCount; ++i)
+    {
+      const int slot = i % BridgeCounters::SlotCount;
+      const int first = slot * BridgeCounters::CounterCount;
+      for (int counter = 0; counter < BridgeCounters::CounterCount; ++counter)
+      {
+        if (m_counts[first + counter] != 0)
+        {
+          methods->Add(Entry(slot));
+          break;
+        }
+      }
+    }
+    return methods->ToArray();
+  }
+
+  CounterSnapshot^ CounterSnapshot::Since(CounterSnapshot^ earlier)
+  {
+    if (earlier == nullptr)
+      throw gcnew System::ArgumentNullException("earlier");
+
+    auto counts = gcnew array<long long>(m_counts->Length);
+    for (int i = 0; i < counts->Length; ++i)
+      counts[i] = m_counts[i] - earlier->m_counts[i];
+    return gcnew CounterSnapshot(counts);
+  }
+
+  System::String^ CounterSnapshot::FormatReport()
+  {
+    auto methods = Methods;
+    System::Array::Sort(methods, gcnew System::Comparison<MarshallingCounts>(&CompareCopied));
+
+    auto report = gcnew System::Text::StringBuilder();
+    report->AppendFormat("{0,-60} {1,10} {2,12} {3,12} {4,12} {5,12} {6,12}", "Method", "ID lists", "IDs in",
+      "IDs out", "vectors in", "vectors out", "geometry");
+    report->AppendLine();
+    for each (MarshallingCounts method in methods)
+      AppendLine(report, method);
+    AppendLine(report, Totals);
+    return report->ToString();
+  }
+
+  // A thread's table outlives the thread, so counts made on pool threads that have since exited are still summed.
+  array<long long>^ BridgeCounters::RegisterThread()
+  {
+    auto counts = gcnew array<long long>(SlotCount * CounterCount);
+    {
+      msclr::lock guard(s_threads);
+      s_threads->Add(counts);
+    }
+    s_counts = counts;
+    return counts;
+  }
+
+  array<long long>^ BridgeCounters::Sum()
+  {
+    auto sum = gcnew array<long long>(SlotCount * CounterCount);
+    msclr::lock guard(s_threads);
+    for each (array<long long>^ counts in s_threads)
+    {
+      for (int i = 0; i < sum->Length; ++i)
+        sum[i] += counts[i];
+    }
+    return sum;
+  }
+
+  CounterSnapshot^ BridgeCounters::TakeSnapshot()
+  {
+    auto counts = Sum();
+    auto baseline = s_baseline;
+    for (int i = 0; i < counts->Length; ++i)
+      counts[i] -= baseline[i];
+    return gcnew CounterSnapshot(counts);
+  }
+
+  void BridgeCounters::Reset()
+  {
+    // Other threads keep counting into their tables, so a reset moves the baseline instead of clearing them.
+    s_baseline = Sum();
+  }
+
+  System::String^ BridgeCounters::FormatReport()
+  {
+    return TakeSnapshot()->FormatReport();
+  }
+}
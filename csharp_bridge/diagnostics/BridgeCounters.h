@@ -0,0 +1,163 @@
+#pragma once
+
+#include "../native/Trace.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace Detail
+  {
+    /// What BridgeCounters counts, in the order of the MarshallingCounts fields.
+    enum class Counter
+    {
+      NativeIdLists,
+      IdsToNative,
+      IdsToManaged,
+      VectorsToNative,
+      VectorsToManaged,
+      GeometryObjects,
+      Count
+    };
+  }
+
+  /// <summary>
+  /// How much data one bridge method, or all of them, moved between managed and native code.
+  /// </summary>
+  public value struct MarshallingCounts
+  {
+    /// <summary>The class and signature of the method, "(outside bridge methods)" or "Total".</summary>
+    System::String^ Name;
+    /// <summary>The class declaring the method; empty for the outside and total entries.</summary>
+    System::String^ ClassName;
+    /// <summary>Native element ID lists filled from a managed list or set for a CAD call.</summary>
+    long long NativeIdLists;
+    /// <summary>Element IDs copied from managed into native lists or batches.</summary>
+    long long IdsToNative;
+    /// <summary>Element IDs copied from native lists into managed lists, arrays or sets.</summary>
+    long long IdsToManaged;
+    /// <summary>Points and vectors converted to the CAD API's vector3D.</summary>
+    long long VectorsToNative;
+    /// <summary>Points and vectors converted from the CAD API's vector3D.</summary>
+    long long VectorsToManaged;
+    /// <summary>Point3D, Vector3D, Plane3D, PointBuffer and VectorBuffer objects allocated.</summary>
+    long long GeometryObjects;
+  };
+
+  /// <summary>
+  /// The marshalling counters at one point in time, counted since the last BridgeCounters.Reset.
+  /// </summary>
+  public ref class CounterSnapshot sealed
+  {
+  private:
+    array<long long>^ m_counts;
+
+    MarshallingCounts Entry(int slot);
+
+  internal:
+    CounterSnapshot(array<long long>^ counts);
+
+  public:
+    /// <summary>
+    /// Gets the counts summed over all methods.
+    /// </summary>
+    property MarshallingCounts Totals
+    {
+      MarshallingCounts get();
+    }
+
+    /// <summary>
+    /// Gets the counts of every method that moved any data, in declaration order, followed by conversions made
+    /// outside any bridge method.
+    /// </summary>
+    property array<MarshallingCounts>^ Methods
+    {
+      array<MarshallingCounts>^ get();
+    }
+
+    /// <summary>
+    /// Computes what was counted between an earlier snapshot and this one, so a plugin can dump the counters
+    /// periodically without resetting them.
+    /// </summary>
+    /// <param name="earlier">A snapshot taken before this one and after the last reset.</param>
+    /// <returns>The difference of the two snapshots.</returns>
+    CounterSnapshot^ Since(CounterSnapshot^ earlier);
+
+    /// <summary>
+    /// Formats the snapshot as a table, one line per method, the method that copied the most IDs and vectors
+    /// first, followed by the totals.
+    /// </summary>
+    /// <returns>The report text.</returns>
+    System::String^ FormatReport();
+  };
+
+  /// <summary>
+  /// Counts the element ID lists, element IDs, points and vectors the bridge converts between managed and native
+  /// code, and the geometry objects it allocates, per bridge method. Counting is always on.
+  /// </summary>
+  /// <remarks>
+  /// Each thread counts into its own table, so counting takes no lock: a conversion costs two thread-static reads
+  /// and an add, per list or array rather than per element. The data moved inside a method is counted for the
+  /// innermost bridge method running on the thread; a geometry object is counted for the method that allocates it.
+  /// </remarks>
+  public ref class BridgeCounters abstract sealed
+  {
+  private:
+    [System::ThreadStatic] static array<long long>^ s_counts;
+    /// The innermost bridge method running on this thread, plus one; 0 outside any bridge method.
+    [System::ThreadStatic] static int s_method;
+    static System::Collections::Generic::List<array<long long>^>^ s_threads;
+    static array<long long>^ s_baseline;
+
+    static BridgeCounters()
+    {
+      s_threads = gcnew System::Collections::Generic::List<array<long long>^>();
+      s_baseline = gcnew array<long long>(SlotCount * CounterCount);
+    }
+
+    static array<long long>^ RegisterThread();
+    static array<long long>^ Sum();
+
+  internal:
+    literal int CounterCount = static_cast<int>(Detail::Counter::Count);
+    /// One slot per bridge method, after the slot for conversions outside any.
+    literal int SlotCount = static_cast<int>(Native::Trace::PointCount) + 1;
+
+    /// Makes `point` the method data is counted for on this thread; returns the method to restore on return.
+    static int EnterMethod(Native::Trace::Point point)
+    {
+      const int caller = s_method;
+      s_method = static_cast<int>(point) + 1;
+      return caller;
+    }
+
+    static void LeaveMethod(int caller)
+    {
+      s_method = caller;
+    }
+
+    static void Add(Detail::Counter counter, long long amount)
+    {
+      array<long long>^ counts = s_counts;
+      if (counts == nullptr)
+        counts = RegisterThread();
+      counts[s_method * CounterCount + static_cast<int>(counter)] += amount;
+    }
+
+  public:
+    /// <summary>
+    /// Takes a snapshot of the counters of all threads. Counts still being added on other threads may be missing.
+    /// </summary>
+    /// <returns>The counts since the last reset.</returns>
+    static CounterSnapshot^ TakeSnapshot();
+
+    /// <summary>
+    /// Starts counting from zero again. Snapshots taken before the reset are not affected.
+    /// </summary>
+    static void Reset();
+
+    /// <summary>
+    /// Formats a new snapshot; see CounterSnapshot.FormatReport.
+    /// </summary>
+    /// <returns>The report text.</returns>
+    static System::String^ FormatReport();
+  };
+}
@@ -0,0 +1,103 @@
+#include "BridgeTrace.h"
+
+#include "../native/Trace.h"
+
+#include <filesystem>
+#include <fstream>
+#include <msclr/marshal_cppstd.h>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  namespace Trace = Native::Trace;
+
+  /// Native summaries are in nanoseconds.
+  LatencySummary ToManaged(const Trace::LatencySummary& summary)
+  {
+    LatencySummary result;
+    result.Count = static_cast<long long>(summary.count);
+    result.Mean = summary.mean / 1000.0;
+    result.P50 = summary.p50 / 1000.0;
+    result.P90 = summary.p90 / 1000.0;
+    result.P99 = summary.p99 / 1000.0;
+    result.P999 = summary.p999 / 1000.0;
+    result.Max = summary.max / 1000.0;
+    return result;
+  }
+
+  /// Orders methods by the time they took overall, most first.
+  int CompareTotalTime(MethodLatency a, MethodLatency b)
+  {
+    const double first = a.Total.Mean * a.Total.Count;
+    const double second = b.Total.Mean * b.Total.Count;
+    return first > second ? -1 : (first < second ? 1 : 0);
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  void BridgeTrace::Enabled::set(bool value)
+  {
+    Trace::setEnabled(value);
+    s_enabled = value;
+  }
+
+  int BridgeTrace::EventCount::get()
+  {
+    return static_cast<int>(Trace::eventCount());
+  }
+
+  void BridgeTrace::Clear()
+  {
+    Trace::clear();
+  }
+
+  array<MethodLatency>^ BridgeTrace::GetStatistics()
+  {
+    const auto statistics = Trace::statistics();
+    auto result = gcnew array<MethodLatency>(static_cast<int>(statistics.size()));
+    for (int i = 0; i < result->Length; ++i)
+    {
+      const Trace::PointStatistics& entry = statistics[i];
+      result[i].Name = gcnew System::String(Trace::name(entry.point));
+      result[i].ClassName = gcnew System::String(Trace::className(entry.point));
+      result[i].Total = ToManaged(entry.total);
+      result[i].Native = ToManaged(entry.native);
+      result[i].Marshalling = ToManaged(entry.marshalling);
+    }
+    return result;
+  }
+
+  System::String^ BridgeTrace::FormatReport()
+  {
+    auto statistics = GetStatistics();
+    System::Array::Sort(statistics, gcnew System::Comparison<MethodLatency>(&CompareTotalTime));
+
+    auto report = gcnew System::Text::StringBuilder();
+    report->AppendLine("Latency in microseconds: total p50 / p99 / max, native and marshalling mean");
+    for each (MethodLatency method in statistics)
+    {
+      report->AppendFormat("{0,-60} {1,9} calls  {2,10:F2} {3,10:F2} {4,12:F2}  native {5,10:F2}  marshalling {6,10:F2}",
+        method.Name, method.Total.Count, method.Total.P50, method.Total.P99, method.Total.Max, method.Native.Mean,
+        method.Marshalling.Mean);
+      report->AppendLine();
+    }
+    return report->ToString();
+  }
+
+  void BridgeTrace::WriteChromeTrace(System::String^ path)
+  {
+    if (path == nullptr)
+      throw gcnew System::ArgumentNullException("path");
+
+    const std::filesystem::path file(msclr::interop::marshal_as<std::wstring>(path));
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    if (!out)
+      throw gcnew System::IO::IOException("Cannot open " + path + " for writing.");
+
+    Trace::writeChromeTrace(out);
+    out.close();
+    if (!out)
+      throw gcnew System::IO::IOException("Cannot write " + path + ".");
+  }
+}
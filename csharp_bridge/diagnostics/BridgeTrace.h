@@ -0,0 +1,104 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  /// <summary>
+  /// Latency percentiles of one traced method, in microseconds. Percentiles are within 1/32 of the exact value.
+  /// </summary>
+  public value struct LatencySummary
+  {
+    /// <summary>The number of calls.</summary>
+    long long Count;
+    /// <summary>The mean latency.</summary>
+    double Mean;
+    /// <summary>The median latency.</summary>
+    double P50;
+    /// <summary>The 90th percentile latency.</summary>
+    double P90;
+    /// <summary>The 99th percentile latency.</summary>
+    double P99;
+    /// <summary>The 99.9th percentile latency.</summary>
+    double P999;
+    /// <summary>The largest latency.</summary>
+    double Max;
+  };
+
+  /// <summary>
+  /// The latencies of one bridge method over all threads, split into the time spent inside the CAD API and the
+  /// rest of the call (argument checks, marshalling, building the result).
+  /// </summary>
+  public value struct MethodLatency
+  {
+    /// <summary>The class and signature of the method, e.g. "ElementController.DeleteElements(List&lt;int&gt;)".</summary>
+    System::String^ Name;
+    /// <summary>The class declaring the method.</summary>
+    System::String^ ClassName;
+    /// <summary>The whole call.</summary>
+    LatencySummary Total;
+    /// <summary>The time inside the CAD API.</summary>
+    LatencySummary Native;
+    /// <summary>The rest of the call.</summary>
+    LatencySummary Marshalling;
+  };
+
+  /// <summary>
+  /// Per-call latency tracing of every ElementController, AttributeController, GeometryController and CwApi3DFactory
+  /// method and the geometry constructors.
+  /// </summary>
+  /// <remarks>
+  /// While Enabled, each call is recorded on its own thread without locking: into a ring of the thread's last
+  /// 65536 calls, which WriteChromeTrace exports, and into latency histograms per method, which GetStatistics
+  /// summarizes. Recording costs a few tens of nanoseconds per call; while disabled, a traced method only tests
+  /// Enabled and tells BridgeCounters which method is running. Statistics and exports may be taken from any
+  /// thread while calls are being recorded.
+  /// </remarks>
+  public ref class BridgeTrace abstract sealed
+  {
+  private:
+    static bool s_enabled;
+
+  public:
+    /// <summary>
+    /// Gets or sets a value indicating whether calls are recorded. Enabling for the first time, or after Clear,
+    /// starts the trace's clock.
+    /// </summary>
+    static property bool Enabled
+    {
+      bool get() { return s_enabled; }
+      void set(bool value);
+    }
+
+    /// <summary>
+    /// Gets the number of calls held for export, over all threads.
+    /// </summary>
+    static property int EventCount
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Drops all recorded calls and statistics and restarts the trace's clock.
+    /// </summary>
+    static void Clear();
+
+    /// <summary>
+    /// Summarizes the latencies of every method called since recording started or was cleared.
+    /// </summary>
+    /// <returns>One entry per method called, in declaration order.</returns>
+    static array<MethodLatency>^ GetStatistics();
+
+    /// <summary>
+    /// Formats GetStatistics as a table, one line per method, the method that took the most time overall first.
+    /// </summary>
+    /// <returns>The report text.</returns>
+    static System::String^ FormatReport();
+
+    /// <summary>
+    /// Writes the recorded calls as Chrome trace event JSON, for chrome://tracing or https://ui.perfetto.dev.
+    /// Each call is one event on its thread's track, with its native and marshalling time in the event's args.
+    /// </summary>
+    /// <param name="path">The file to write; it is overwritten.</param>
+    /// <exception cref="System::IO::IOException">Thrown when the file cannot be written.</exception>
+    static void WriteChromeTrace(System::String^ path);
+  };
+}
@@ -0,0 +1,77 @@
+#include "ConversionHooks.h"
+
+#include <CwAPI3DTypes.h>
+
+namespace
+{
+  CwAPI3D::vector3D Diagonal(int i)
+  {
+    CwAPI3D::vector3D vec;
+    vec.mX = vec.mY = vec.mZ = static_cast<double>(i);
+    return vec;
+  }
+
+  double Sum(const CwAPI3D::vector3D& vec)
+  {
+    return vec.mX + vec.mY + vec.mZ;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge::Detail
+{
+  double ConversionHooks::ToNative(array<Point3D^>^ points)
+  {
+    double sum = 0.0;
+    for (int i = 0; i < points->Length; ++i)
+      sum += Sum(points[i]->ToNative());
+    return sum;
+  }
+
+  double ConversionHooks::ToNative(array<Vector3D^>^ vectors)
+  {
+    double sum = 0.0;
+    for (int i = 0; i < vectors->Length; ++i)
+      sum += Sum(vectors[i]->ToNative());
+    return sum;
+  }
+
+  double ConversionHooks::ToNative(array<Point3DValue>^ points)
+  {
+    double sum = 0.0;
+    for (int i = 0; i < points->Length; ++i)
+      sum += Sum(points[i].ToNative());
+    return sum;
+  }
+
+  double ConversionHooks::ToNative(array<Vector3DValue>^ vectors)
+  {
+    double sum = 0.0;
+    for (int i = 0; i < vectors->Length; ++i)
+      sum += Sum(vectors[i].ToNative());
+    return sum;
+  }
+
+  void ConversionHooks::FromNative(array<Point3D^>^ points)
+  {
+    for (int i = 0; i < points->Length; ++i)
+      points[i] = Point3D::FromNative(Diagonal(i));
+  }
+
+  void ConversionHooks::FromNative(array<Vector3D^>^ vectors)
+  {
+    for (int i = 0; i < vectors->Length; ++i)
+      vectors[i] = Vector3D::FromNative(Diagonal(i));
+  }
+
+  void ConversionHooks::FromNative(array<Point3DValue>^ points)
+  {
+    for (int i = 0; i < points->Length; ++i)
+      points[i] = Point3DValue::FromNative(Diagonal(i));
+  }
+
+  void ConversionHooks::FromNative(array<Vector3DValue>^ vectors)
+  {
+    for (int i = 0; i < vectors->Length; ++i)
+      vectors[i] = Vector3DValue::FromNative(Diagonal(i));
+  }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "../geometry/Point3D.h"
+#include "../geometry/Point3DValue.h"
+#include "../geometry/Vector3D.h"
+#include "../geometry/Vector3DValue.h"
+
+namespace CwAPI3D::Net::Bridge::Detail
+{
+  /// <summary>
+  /// Drives ToNative and FromNative of the geometry types for the managed benchmark suite. Their signatures use
+  /// the CAD API's vector3D, which C# cannot name, so each hook loops over a managed array on this side of the
+  /// boundary. Visible to the ManagedBenchmarks assembly only (see AssemblyInfo.cpp).
+  /// </summary>
+  ref class ConversionHooks abstract sealed
+  {
+  public:
+    /// <summary>Converts every point with ToNative and returns the sum of the coordinates.</summary>
+    static double ToNative(array<Point3D^>^ points);
+    /// <inheritdoc cref="ToNative(array{Point3D})"/>
+    static double ToNative(array<Vector3D^>^ vectors);
+    /// <inheritdoc cref="ToNative(array{Point3D})"/>
+    static double ToNative(array<Point3DValue>^ points);
+    /// <inheritdoc cref="ToNative(array{Point3D})"/>
+    static double ToNative(array<Vector3DValue>^ vectors);
+
+    /// <summary>Fills every slot of the array with FromNative of a native vector3D (i, i, i).</summary>
+    static void FromNative(array<Point3D^>^ points);
+    /// <inheritdoc cref="FromNative(array{Point3D})"/>
+    static void FromNative(array<Vector3D^>^ vectors);
+    /// <inheritdoc cref="FromNative(array{Point3D})"/>
+    static void FromNative(array<Point3DValue>^ points);
+    /// <inheritdoc cref="FromNative(array{Point3D})"/>
+    static void FromNative(array<Vector3DValue>^ vectors);
+  };
+}
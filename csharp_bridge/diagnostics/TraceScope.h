@@ -0,0 +1,62 @@
+#pragma once
+
+#include "BridgeCounters.h"
+#include "BridgeTrace.h"
+#include "../native/Trace.h"
+
+namespace CwAPI3D::Net::Bridge::Detail
+{
+  /// Records one call of a bridge method while BridgeTrace is enabled, and makes it the method BridgeCounters
+  /// counts for until it returns; declare it first thing in the method. While tracing is disabled, it costs a test
+  /// of BridgeTrace::Enabled and the swap of the counted method.
+  class TraceScope
+  {
+    bool m_active;
+    int m_caller;
+
+  public:
+    explicit TraceScope(Native::Trace::Point point)
+      : m_active(BridgeTrace::Enabled), m_caller(BridgeCounters::EnterMethod(point))
+    {
+      if (m_active)
+        Native::Trace::begin(point);
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope()
+    {
+      if (m_active)
+        Native::Trace::end();
+      BridgeCounters::LeaveMethod(m_caller);
+    }
+  };
+
+  /// Counts the time from here to leave(), or else to the end of the innermost traced call on this thread, as spent
+  /// inside the CAD API; everything else in that call counts as marshalling. Going out of scope records nothing:
+  /// the call's end closes the native time on the same timestamp, which saves a clock read per call. Call leave()
+  /// when the method does more work after the CAD call, or when the scope lives in a helper.
+  class NativeTraceScope
+  {
+    bool m_active;
+
+  public:
+    NativeTraceScope() : m_active(BridgeTrace::Enabled)
+    {
+      if (m_active)
+        Native::Trace::enterNative();
+    }
+
+    NativeTraceScope(const NativeTraceScope&) = delete;
+    NativeTraceScope& operator=(const NativeTraceScope&) = delete;
+
+    /// Ends the native time before the call's result is marshalled.
+    void leave()
+    {
+      if (m_active)
+        Native::Trace::leaveNative();
+      m_active = false;
+    }
+  };
+}
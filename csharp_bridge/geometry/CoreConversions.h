@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Plane3D.h"
+#include "Plane3DValue.h"
+#include "Point3D.h"
+#include "Point3DValue.h"
+#include "Vector3D.h"
+#include "Vector3DValue.h"
+
+#include "../core/Geometry.h"
+
+// Conversions between the managed geometry types and the native core they forward their math to.
+// Internal to the bridge; include only from .cpp files.
+namespace CwAPI3D::Net::Bridge::Detail
+{
+  inline Core::Vec3d ToCore(Vector3D^ vector)
+  {
+    return Core::Vec3d{vector->X, vector->Y, vector->Z};
+  }
+
+  inline Core::Vec3d ToCore(Point3D^ point)
+  {
+    return Core::Vec3d{point->X, point->Y, point->Z};
+  }
+
+  inline Core::Vec3d ToCore(Vector3DValue vector)
+  {
+    return Core::Vec3d{vector.X, vector.Y, vector.Z};
+  }
+
+  inline Core::Vec3d ToCore(Point3DValue point)
+  {
+    return Core::Vec3d{point.X, point.Y, point.Z};
+  }
+
+  inline Vector3D^ ToVector3D(const Core::Vec3d& vector)
+  {
+    return gcnew Vector3D(vector.x, vector.y, vector.z);
+  }
+
+  inline Point3D^ ToPoint3D(const Core::Vec3d& point)
+  {
+    return gcnew Point3D(point.x, point.y, point.z);
+  }
+
+  inline Vector3DValue ToVector3DValue(const Core::Vec3d& vector)
+  {
+    return Vector3DValue(vector.x, vector.y, vector.z);
+  }
+
+  inline Point3DValue ToPoint3DValue(const Core::Vec3d& point)
+  {
+    return Point3DValue(point.x, point.y, point.z);
+  }
+
+  inline Core::Planed ToCore(Plane3D^ plane)
+  {
+    // Both managed plane types keep their normal at unit length.
+    return Core::Planed::fromUnitNormal(ToCore(plane->Point), ToCore(plane->Normal));
+  }
+
+  inline Core::Planed ToCore(Plane3DValue plane)
+  {
+    return Core::Planed::fromUnitNormal(ToCore(plane.Point), ToCore(plane.Normal));
+  }
+}
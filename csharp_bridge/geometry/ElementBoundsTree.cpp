@@ -0,0 +1,234 @@
+#include "ElementBoundsTree.h"
+#include "CoreConversions.h"
+#include "Plane3D.h"
+#include "Point3D.h"
+#include "Vector3D.h"
+
+#include "../native/Bvh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+
+  array<int>^ ToArray(const std::vector<std::int32_t>& ids)
+  {
+    auto result = gcnew array<int>(static_cast<int>(ids.size()));
+    if (!ids.empty())
+    {
+      pin_ptr<int> destination = &result[0];
+      std::copy(ids.begin(), ids.end(), static_cast<int*>(destination));
+    }
+    return result;
+  }
+
+  Core::Vec3d UnitDirection(Vector3D^ direction)
+  {
+    if (direction == nullptr)
+      throw gcnew System::ArgumentNullException("direction");
+
+    const Core::Vec3d vector = Detail::ToCore(direction);
+    const double length = Core::magnitude(vector);
+    if (Core::DefaultTolerance<double>::isZero(length))
+      throw gcnew System::ArgumentException("Direction vector cannot be zero length.", "direction");
+    return vector / length;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  using Detail::ToCore;
+
+  ElementBoundsTree::ElementBoundsTree(Native::Bvh* tree)
+  {
+    m_tree = tree;
+  }
+
+  ElementBoundsTree^ ElementBoundsTree::Build(array<int>^ elementIds, array<Point3DValue>^ minimums,
+    array<Point3DValue>^ maximums)
+  {
+    return Build(elementIds, minimums, maximums, true);
+  }
+
+  ElementBoundsTree^ ElementBoundsTree::Build(array<int>^ elementIds, array<Point3DValue>^ minimums,
+    array<Point3DValue>^ maximums, bool parallel)
+  {
+    if (elementIds == nullptr)
+      throw gcnew System::ArgumentNullException("elementIds");
+    if (minimums == nullptr)
+      throw gcnew System::ArgumentNullException("minimums");
+    if (maximums == nullptr)
+      throw gcnew System::ArgumentNullException("maximums");
+    if (minimums->Length != elementIds->Length || maximums->Length != elementIds->Length)
+      throw gcnew System::ArgumentException("elementIds, minimums and maximums must have the same length.");
+
+    const int count = elementIds->Length;
+    std::vector<Native::Aabb> boxes(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i)
+      boxes[i] = Native::Aabb{ToCore(minimums[i]), ToCore(maximums[i])};
+
+    Native::Bvh* tree;
+    if (count == 0)
+      tree = new Native::Bvh();
+    else
+    {
+      pin_ptr<int> ids = &elementIds[0];
+      tree = new Native::Bvh(Native::Bvh::build(ids, boxes.data(), boxes.size(), parallel));
+    }
+    return gcnew ElementBoundsTree(tree);
+  }
+
+  ElementBoundsTree::~ElementBoundsTree()
+  {
+    this->!ElementBoundsTree();
+  }
+
+  ElementBoundsTree::!ElementBoundsTree()
+  {
+    delete m_tree;
+    m_tree = nullptr;
+  }
+
+  void ElementBoundsTree::ThrowIfDisposed()
+  {
+    if (!m_tree)
+      throw gcnew System::ObjectDisposedException("ElementBoundsTree");
+  }
+
+  int ElementBoundsTree::Count::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_tree->size());
+  }
+
+  int ElementBoundsTree::NodeCount::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_tree->nodeCount());
+  }
+
+  int ElementBoundsTree::Depth::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_tree->depth());
+  }
+
+  long long ElementBoundsTree::MemoryBytes::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<long long>(m_tree->memoryBytes());
+  }
+
+  array<int>^ ElementBoundsTree::QueryBox(Point3D^ minimum, Point3D^ maximum)
+  {
+    ThrowIfDisposed();
+    if (minimum == nullptr)
+      throw gcnew System::ArgumentNullException("minimum");
+    if (maximum == nullptr)
+      throw gcnew System::ArgumentNullException("maximum");
+
+    const Core::Vec3d a = ToCore(minimum);
+    const Core::Vec3d b = ToCore(maximum);
+    const Native::Aabb box{{std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)},
+                           {std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)}};
+    std::vector<std::int32_t> ids;
+    m_tree->queryBox(box, ids);
+    System::GC::KeepAlive(this);
+    return ToArray(ids);
+  }
+
+  array<int>^ ElementBoundsTree::QueryHalfSpace(Plane3D^ plane, HalfSpaceSelection selection)
+  {
+    ThrowIfDisposed();
+    if (plane == nullptr)
+      throw gcnew System::ArgumentNullException("plane");
+
+    Native::Bvh::HalfSpaceMode mode;
+    switch (selection)
+    {
+    case HalfSpaceSelection::Overlapping:
+      mode = Native::Bvh::HalfSpaceMode::Overlapping;
+      break;
+    case HalfSpaceSelection::Inside:
+      mode = Native::Bvh::HalfSpaceMode::Inside;
+      break;
+    case HalfSpaceSelection::Straddling:
+      mode = Native::Bvh::HalfSpaceMode::Straddling;
+      break;
+    default:
+      throw gcnew System::ArgumentOutOfRangeException("selection");
+    }
+
+    std::vector<std::int32_t> ids;
+    m_tree->queryHalfSpace(ToCore(plane), mode, ids);
+    System::GC::KeepAlive(this);
+    return ToArray(ids);
+  }
+
+  bool ElementBoundsTree::FindNearest(Point3D^ point, int% elementId, double% distance)
+  {
+    return FindNearest(point, std::numeric_limits<double>::infinity(), elementId, distance);
+  }
+
+  bool ElementBoundsTree::FindNearest(Point3D^ point, double maxDistance, int% elementId, double% distance)
+  {
+    ThrowIfDisposed();
+    if (point == nullptr)
+      throw gcnew System::ArgumentNullException("point");
+
+    std::int32_t id = 0;
+    double found = 0.0;
+    const bool hit = m_tree->nearest(ToCore(point), maxDistance, id, found);
+    System::GC::KeepAlive(this);
+    if (!hit)
+      return false;
+
+    elementId = id;
+    distance = found;
+    return true;
+  }
+
+  bool ElementBoundsTree::RayCast(Point3D^ origin, Vector3D^ direction, int% elementId, double% distance)
+  {
+    return RayCast(origin, direction, std::numeric_limits<double>::infinity(), elementId, distance);
+  }
+
+  bool ElementBoundsTree::RayCast(Point3D^ origin, Vector3D^ direction, double maxDistance, int% elementId,
+    double% distance)
+  {
+    ThrowIfDisposed();
+    if (origin == nullptr)
+      throw gcnew System::ArgumentNullException("origin");
+
+    Native::Bvh::RayHit hit{};
+    const Core::Vec3d unit = UnitDirection(direction);
+    const bool found = m_tree->rayCast(ToCore(origin), unit, maxDistance, hit);
+    System::GC::KeepAlive(this);
+    if (!found)
+      return false;
+
+    elementId = hit.id;
+    distance = hit.distance;
+    return true;
+  }
+
+  array<int>^ ElementBoundsTree::RayCastAll(Point3D^ origin, Vector3D^ direction, double maxDistance)
+  {
+    ThrowIfDisposed();
+    if (origin == nullptr)
+      throw gcnew System::ArgumentNullException("origin");
+
+    std::vector<Native::Bvh::RayHit> hits;
+    m_tree->rayCastAll(ToCore(origin), UnitDirection(direction), maxDistance, hits);
+    System::GC::KeepAlive(this);
+    auto result = gcnew array<int>(static_cast<int>(hits.size()));
+    for (int i = 0; i < result->Length; ++i)
+      result[i] = hits[i].id;
+    return result;
+  }
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Point3DValue.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace Native
+  {
+    class Bvh;
+  }
+
+  ref class Plane3D;
+  ref class Point3D;
+  ref class Vector3D;
+
+  /// <summary>
+  /// Selects the elements a half-space query returns, relative to the side of a plane its normal points to.
+  /// </summary>
+  public enum class HalfSpaceSelection
+  {
+    /// <summary>Elements with any part of their bounds on the normal side of the plane.</summary>
+    Overlapping,
+    /// <summary>Elements whose bounds lie entirely on the normal side of the plane.</summary>
+    Inside,
+    /// <summary>Elements whose bounds the plane passes through.</summary>
+    Straddling
+  };
+
+  /// <summary>
+  /// A bounding-volume hierarchy over element bounding boxes, held in native memory.
+  /// Answers box, nearest-element, ray and half-space queries in logarithmic rather than linear time, so picking
+  /// and clash pre-filters no longer have to test every ID returned by GetAllIdentifiableElementIDs.
+  /// </summary>
+  /// <remarks>
+  /// The tree is a snapshot: build a new one after elements have moved. Queries only read the tree and may run
+  /// on any thread, concurrently. Dispose the tree to release the native memory early.
+  /// </remarks>
+  public ref class ElementBoundsTree sealed
+  {
+  private:
+    Native::Bvh* m_tree;
+
+    ElementBoundsTree(Native::Bvh* tree);
+
+    void ThrowIfDisposed();
+
+  public:
+    /// <summary>
+    /// Builds a tree over the bounding boxes of the given elements, on all cores for large inputs.
+    /// </summary>
+    /// <param name="elementIds">The element IDs.</param>
+    /// <param name="minimums">One corner of each element's bounding box.</param>
+    /// <param name="maximums">The opposite corner of each element's bounding box.</param>
+    /// <returns>A new ElementBoundsTree.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when the arrays differ in length.</exception>
+    static ElementBoundsTree^ Build(array<int>^ elementIds, array<Point3DValue>^ minimums, array<Point3DValue>^ maximums);
+
+    /// <summary>
+    /// Builds a tree over the bounding boxes of the given elements.
+    /// </summary>
+    /// <param name="elementIds">The element IDs.</param>
+    /// <param name="minimums">One corner of each element's bounding box.</param>
+    /// <param name="maximums">The opposite corner of each element's bounding box.</param>
+    /// <param name="parallel">Whether large inputs are built on all cores.</param>
+    /// <returns>A new ElementBoundsTree.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when the arrays differ in length.</exception>
+    static ElementBoundsTree^ Build(array<int>^ elementIds, array<Point3DValue>^ minimums, array<Point3DValue>^ maximums,
+      bool parallel);
+
+    /// <summary>
+    /// Releases the native storage.
+    /// </summary>
+    ~ElementBoundsTree();
+
+    /// <summary>
+    /// Finalizer. Releases the native storage if the tree was not disposed.
+    /// </summary>
+    !ElementBoundsTree();
+
+    /// <summary>
+    /// Gets the number of elements in the tree.
+    /// </summary>
+    property int Count
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the number of tree nodes.
+    /// </summary>
+    property int NodeCount
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the number of nodes on the longest path from the root to a leaf.
+    /// </summary>
+    property int Depth
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the number of bytes of native memory the tree uses.
+    /// </summary>
+    property long long MemoryBytes
+    {
+      long long get();
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether the native storage has been released.
+    /// </summary>
+    property bool IsDisposed
+    {
+      bool get() { return m_tree == nullptr; }
+    }
+
+    /// <summary>
+    /// Finds the elements whose bounds overlap or touch a box.
+    /// </summary>
+    /// <param name="minimum">One corner of the box.</param>
+    /// <param name="maximum">The opposite corner of the box.</param>
+    /// <returns>The IDs of the elements found, in no particular order.</returns>
+    array<int>^ QueryBox(Point3D^ minimum, Point3D^ maximum);
+
+    /// <summary>
+    /// Finds the elements whose bounds lie in the given relation to a plane.
+    /// </summary>
+    /// <param name="plane">The plane; its normal points into the half-space.</param>
+    /// <param name="selection">Which elements to return.</param>
+    /// <returns>The IDs of the elements found, in no particular order.</returns>
+    array<int>^ QueryHalfSpace(Plane3D^ plane, HalfSpaceSelection selection);
+
+    /// <summary>
+    /// Finds the element whose bounds are closest to a point.
+    /// </summary>
+    /// <param name="point">The point to search from.</param>
+    /// <param name="elementId">When this method returns true, the ID of the closest element.</param>
+    /// <param name="distance">When this method returns true, the distance to its bounds; 0 when the point is inside.</param>
+    /// <returns>true if the tree holds any element; otherwise, false.</returns>
+    bool FindNearest(Point3D^ point, int% elementId, double% distance);
+
+    /// <summary>
+    /// Finds the element whose bounds are closest to a point, up to a maximum distance.
+    /// </summary>
+    /// <param name="point">The point to search from.</param>
+    /// <param name="maxDistance">The largest distance to search.</param>
+    /// <param name="elementId">When this method returns true, the ID of the closest element.</param>
+    /// <param name="distance">When this method returns true, the distance to its bounds; 0 when the point is inside.</param>
+    /// <returns>true if an element lies within maxDistance; otherwise, false.</returns>
+    bool FindNearest(Point3D^ point, double maxDistance, int% elementId, double% distance);
+
+    /// <summary>
+    /// Finds the first element whose bounds a ray enters.
+    /// </summary>
+    /// <param name="origin">The start of the ray.</param>
+    /// <param name="direction">The direction of the ray; need not be normalized.</param>
+    /// <param name="elementId">When this method returns true, the ID of the element hit.</param>
+    /// <param name="distance">When this method returns true, the distance from origin to where the ray enters its bounds.</param>
+    /// <returns>true if the ray hits any element; otherwise, false.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when direction has zero length.</exception>
+    bool RayCast(Point3D^ origin, Vector3D^ direction, int% elementId, double% distance);
+
+    /// <summary>
+    /// Finds the first element whose bounds a ray enters, up to a maximum distance.
+    /// </summary>
+    /// <param name="origin">The start of the ray.</param>
+    /// <param name="direction">The direction of the ray; need not be normalized.</param>
+    /// <param name="maxDistance">The length of the ray.</param>
+    /// <param name="elementId">When this method returns true, the ID of the element hit.</param>
+    /// <param name="distance">When this method returns true, the distance from origin to where the ray enters its bounds.</param>
+    /// <returns>true if the ray hits an element within maxDistance; otherwise, false.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when direction has zero length.</exception>
+    bool RayCast(Point3D^ origin, Vector3D^ direction, double maxDistance, int% elementId, double% distance);
+
+    /// <summary>
+    /// Finds every element whose bounds a ray enters, nearest first, e.g. as candidates for exact picking.
+    /// </summary>
+    /// <param name="origin">The start of the ray.</param>
+    /// <param name="direction">The direction of the ray; need not be normalized.</param>
+    /// <param name="maxDistance">The length of the ray.</param>
+    /// <returns>The IDs of the elements hit, ordered by the distance at which the ray enters their bounds.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when direction has zero length.</exception>
+    array<int>^ RayCastAll(Point3D^ origin, Vector3D^ direction, double maxDistance);
+  };
+}
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "PlaneSide.h"
+
 namespace CwAPI3D
 {
   struct vector3D;
@@ -9,6 +11,7 @@ namespace CwAPI3D::Net::Bridge
 {
   ref class Point3D;
   ref class Vector3D;
+  ref class PointBuffer;
 
   /// <summary>
   /// Represents a plane in 3D space defined by a point and a normal vector.
@@ -95,6 +98,13 @@ namespace CwAPI3D::Net::Bridge
     /// <returns>The signed distance from the point to the plane.</returns>
     double DistanceTo(Point3D^ point);
 
+    /// <summary>
+    /// Calculates the signed distance from every point of a buffer to this plane in one native call.
+    /// </summary>
+    /// <param name="points">The points to calculate distances from.</param>
+    /// <param name="distances">Receives one signed distance per point; grown when too small.</param>
+    void DistanceTo(PointBuffer^ points, array<double>^% distances);
+
     /// <summary>
     /// Determines whether a point lies on this plane within the specified epsilon.
     /// </summary>
@@ -110,6 +120,23 @@ namespace CwAPI3D::Net::Bridge
     /// <returns>true if the point lies on the plane; otherwise, false.</returns>
     bool ContainsPoint(Point3D^ point);
 
+    /// <summary>
+    /// Determines the side of this plane every point of a buffer lies on, in one native call.
+    /// </summary>
+    /// <param name="points">The points to classify.</param>
+    /// <param name="epsilon">Points closer to the plane than this are classified as On.</param>
+    /// <param name="sides">Receives one side per point; grown when too small.</param>
+    /// <returns>The number of points on each side.</returns>
+    PlaneSideCounts Classify(PointBuffer^ points, double epsilon, array<PlaneSide>^% sides);
+
+    /// <summary>
+    /// Determines the side of this plane every point of a buffer lies on using default epsilon.
+    /// </summary>
+    /// <param name="points">The points to classify.</param>
+    /// <param name="sides">Receives one side per point; grown when too small.</param>
+    /// <returns>The number of points on each side.</returns>
+    PlaneSideCounts Classify(PointBuffer^ points, array<PlaneSide>^% sides);
+
     /// <summary>
     /// Projects a point onto this plane.
     /// </summary>
@@ -117,6 +144,13 @@ namespace CwAPI3D::Net::Bridge
     /// <returns>The projected point.</returns>
     Point3D^ ProjectPoint(Point3D^ point);
 
+    /// <summary>
+    /// Projects every point of a buffer onto this plane in one native call.
+    /// </summary>
+    /// <param name="points">The points to project.</param>
+    /// <param name="result">Receives the projected points; may be the same buffer as points.</param>
+    void ProjectPoint(PointBuffer^ points, PointBuffer^ result);
+
     /// <summary>
     /// Determines the intersection point of a line with this plane.
     /// </summary>
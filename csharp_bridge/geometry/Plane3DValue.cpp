@@ -0,0 +1,166 @@
+#include "Plane3DValue.h"
+#include "CoreConversions.h"
+#include "Plane3D.h"
+#include "Point3D.h"
+#include "Vector3D.h"
+
+#include <cmath>
+
+namespace CwAPI3D::Net::Bridge
+{
+  Plane3DValue::Plane3DValue(Point3DValue point, Vector3DValue normal)
+  {
+    auto plane = Core::Planed::fromPointNormal(Detail::ToCore(point), Detail::ToCore(normal));
+    if (!plane)
+      throw gcnew System::ArgumentException("Normal vector cannot be zero length.");
+
+    m_Point = point;
+    m_Normal = Detail::ToVector3DValue(plane->normal());
+    m_D = plane->d();
+  }
+
+  Plane3DValue::Plane3DValue(Point3DValue p1, Point3DValue p2, Point3DValue p3)
+  {
+    auto plane = Core::Planed::fromPoints(Detail::ToCore(p1), Detail::ToCore(p2), Detail::ToCore(p3));
+    if (!plane)
+      throw gcnew System::ArgumentException("Points are collinear and do not define a plane.");
+
+    m_Point = p1;
+    m_Normal = Detail::ToVector3DValue(plane->normal());
+    m_D = plane->d();
+  }
+
+  Plane3DValue Plane3DValue::FromCoefficients(double a, double b, double c, double d)
+  {
+    auto plane = Core::Planed::fromCoefficients(a, b, c, d);
+    if (!plane)
+      throw gcnew System::ArgumentException("Normal vector components (A, B, C) cannot all be zero.");
+
+    Plane3DValue result;
+    result.m_Point = Detail::ToPoint3DValue(plane->point());
+    result.m_Normal = Detail::ToVector3DValue(plane->normal());
+    result.m_D = plane->d();
+    return result;
+  }
+
+  double Plane3DValue::DistanceTo(Point3DValue point)
+  {
+    // The normal is unit length, so no division is needed
+    return m_Normal.X * point.X + m_Normal.Y * point.Y + m_Normal.Z * point.Z + m_D;
+  }
+
+  double Plane3DValue::DistanceTo(Point3DValue% point)
+  {
+    return m_Normal.X * point.X + m_Normal.Y * point.Y + m_Normal.Z * point.Z + m_D;
+  }
+
+  bool Plane3DValue::ContainsPoint(Point3DValue point, double epsilon)
+  {
+    return std::fabs(DistanceTo(point)) < epsilon;
+  }
+
+  bool Plane3DValue::ContainsPoint(Point3DValue point)
+  {
+    constexpr double epsilon = 1e-10;
+    return ContainsPoint(point, epsilon);
+  }
+
+  Point3DValue Plane3DValue::ProjectPoint(Point3DValue point)
+  {
+    double distance = DistanceTo(point);
+    return Point3DValue(
+      point.X - distance * m_Normal.X,
+      point.Y - distance * m_Normal.Y,
+      point.Z - distance * m_Normal.Z
+    );
+  }
+
+  void Plane3DValue::ProjectPoint(Point3DValue% point, Point3DValue% result)
+  {
+    double distance = DistanceTo(point);
+    double x = point.X - distance * m_Normal.X;
+    double y = point.Y - distance * m_Normal.Y;
+    double z = point.Z - distance * m_Normal.Z;
+    result.X = x;
+    result.Y = y;
+    result.Z = z;
+  }
+
+  bool Plane3DValue::IntersectLine(Point3DValue lineStart, Point3DValue lineEnd, Point3DValue% intersectionPoint)
+  {
+    Core::Vec3d start = Detail::ToCore(lineStart);
+    Core::Vec3d end = Detail::ToCore(lineEnd);
+    if (Core::DefaultTolerance<double>::isZero(Core::distance(start, end)))
+      throw gcnew System::ArgumentException("Line has zero length.");
+
+    auto hit = Detail::ToCore(*this).intersectSegment(start, end);
+    intersectionPoint = hit ? Detail::ToPoint3DValue(*hit) : Point3DValue();
+    return hit.has_value();
+  }
+
+  bool Plane3DValue::IsParallelTo(Plane3DValue other, double epsilon)
+  {
+    return Detail::ToCore(*this).isParallelTo(Detail::ToCore(other), epsilon);
+  }
+
+  bool Plane3DValue::IsParallelTo(Plane3DValue other)
+  {
+    constexpr double epsilon = 1e-10;
+    return IsParallelTo(other, epsilon);
+  }
+
+  bool Plane3DValue::Equals(Plane3DValue other)
+  {
+    constexpr double epsilon = 1e-10;
+    return IsParallelTo(other, epsilon) && ContainsPoint(other.m_Point, epsilon);
+  }
+
+  bool Plane3DValue::Equals(System::Object^ obj)
+  {
+    if (obj == nullptr || !obj->GetType()->Equals(Plane3DValue::typeid))
+      return false;
+
+    return Equals(safe_cast<Plane3DValue>(obj));
+  }
+
+  int Plane3DValue::GetHashCode()
+  {
+    return m_Normal.GetHashCode() ^ m_D.GetHashCode();
+  }
+
+  System::String^ Plane3DValue::ToString()
+  {
+    return System::String::Format("Plane: {0}x + {1}y + {2}z + {3} = 0",
+      m_Normal.X, m_Normal.Y, m_Normal.Z, m_D);
+  }
+
+  Plane3DValue::operator Plane3DValue(Plane3D^ plane)
+  {
+    if (plane == nullptr)
+      throw gcnew System::ArgumentNullException("plane");
+
+    // Plane3D keeps its normal normalized, so the fields can be copied without re-validating.
+    Plane3DValue result;
+    result.m_Point = Point3DValue(plane->Point->X, plane->Point->Y, plane->Point->Z);
+    result.m_Normal = Vector3DValue(plane->Normal->X, plane->Normal->Y, plane->Normal->Z);
+    result.m_D = plane->D;
+    return result;
+  }
+
+  Plane3DValue::operator Plane3D^(Plane3DValue plane)
+  {
+    return gcnew Plane3D(
+      gcnew Point3D(plane.m_Point.X, plane.m_Point.Y, plane.m_Point.Z),
+      gcnew Vector3D(plane.m_Normal.X, plane.m_Normal.Y, plane.m_Normal.Z));
+  }
+
+  bool Plane3DValue::operator==(Plane3DValue p1, Plane3DValue p2)
+  {
+    return p1.Equals(p2);
+  }
+
+  bool Plane3DValue::operator!=(Plane3DValue p1, Plane3DValue p2)
+  {
+    return !p1.Equals(p2);
+  }
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Point3DValue.h"
+#include "Vector3DValue.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class Plane3D;
+
+  /// <summary>
+  /// Allocation-free counterpart of Plane3D, holding its point and unit normal inline.
+  /// A default-initialized Plane3DValue has a zero normal and is not a valid plane; use one of the constructors.
+  /// </summary>
+  [System::Runtime::InteropServices::StructLayout(System::Runtime::InteropServices::LayoutKind::Sequential)]
+  public value struct Plane3DValue
+  {
+  private:
+    Vector3DValue m_Normal;
+    double m_D; // Distance from origin in the plane equation: Ax + By + Cz + D = 0
+    Point3DValue m_Point;
+
+  public:
+    /// <summary>
+    /// Gets a point on the plane.
+    /// </summary>
+    property Point3DValue Point
+    {
+      Point3DValue get() { return m_Point; }
+    }
+
+    /// <summary>
+    /// Gets the unit normal vector of the plane.
+    /// </summary>
+    property Vector3DValue Normal
+    {
+      Vector3DValue get() { return m_Normal; }
+    }
+
+    /// <summary>
+    /// Gets the D component of the plane equation: Ax + By + Cz + D = 0.
+    /// </summary>
+    property double D
+    {
+      double get() { return m_D; }
+    }
+
+    /// <summary>
+    /// Initializes a new Plane3DValue with the specified point and normal.
+    /// </summary>
+    /// <param name="point">A point on the plane.</param>
+    /// <param name="normal">The normal vector of the plane; it is normalized.</param>
+    /// <exception cref="System::ArgumentException">Thrown when the normal has zero length.</exception>
+    Plane3DValue(Point3DValue point, Vector3DValue normal);
+
+    /// <summary>
+    /// Initializes a new Plane3DValue through three points.
+    /// </summary>
+    /// <param name="p1">First point on the plane.</param>
+    /// <param name="p2">Second point on the plane.</param>
+    /// <param name="p3">Third point on the plane.</param>
+    /// <exception cref="System::ArgumentException">Thrown when the points are collinear.</exception>
+    Plane3DValue(Point3DValue p1, Point3DValue p2, Point3DValue p3);
+
+    /// <summary>
+    /// Creates a plane from the coefficients of the plane equation: Ax + By + Cz + D = 0.
+    /// </summary>
+    /// <param name="a">A coefficient (normal X component).</param>
+    /// <param name="b">B coefficient (normal Y component).</param>
+    /// <param name="c">C coefficient (normal Z component).</param>
+    /// <param name="d">D coefficient.</param>
+    /// <returns>The plane.</returns>
+    static Plane3DValue FromCoefficients(double a, double b, double c, double d);
+
+    /// <summary>
+    /// Calculates the signed distance from a point to this plane.
+    /// </summary>
+    /// <param name="point">The point to calculate distance from.</param>
+    /// <returns>The signed distance from the point to the plane.</returns>
+    double DistanceTo(Point3DValue point);
+
+    /// <summary>
+    /// Calculates the signed distance from a point passed by reference to this plane.
+    /// </summary>
+    /// <param name="point">The point to calculate distance from.</param>
+    /// <returns>The signed distance from the point to the plane.</returns>
+    double DistanceTo(Point3DValue% point);
+
+    /// <summary>
+    /// Determines whether a point lies on this plane within the specified epsilon.
+    /// </summary>
+    /// <param name="point">The point to check.</param>
+    /// <param name="epsilon">The tolerance value.</param>
+    /// <returns>true if the point lies on the plane; otherwise, false.</returns>
+    bool ContainsPoint(Point3DValue point, double epsilon);
+
+    /// <summary>
+    /// Determines whether a point lies on this plane using default epsilon.
+    /// </summary>
+    /// <param name="point">The point to check.</param>
+    /// <returns>true if the point lies on the plane; otherwise, false.</returns>
+    bool ContainsPoint(Point3DValue point);
+
+    /// <summary>
+    /// Projects a point onto this plane.
+    /// </summary>
+    /// <param name="point">The point to project.</param>
+    /// <returns>The projected point.</returns>
+    Point3DValue ProjectPoint(Point3DValue point);
+
+    /// <summary>
+    /// Projects a point passed by reference onto this plane.
+    /// </summary>
+    /// <param name="point">The point to project.</param>
+    /// <param name="result">When this method returns, contains the projected point.</param>
+    void ProjectPoint(Point3DValue% point, [System::Runtime::InteropServices::Out] Point3DValue% result);
+
+    /// <summary>
+    /// Determines the intersection point of a line segment with this plane.
+    /// </summary>
+    /// <param name="lineStart">The start point of the segment.</param>
+    /// <param name="lineEnd">The end point of the segment.</param>
+    /// <param name="intersectionPoint">When this method returns, contains the intersection point if successful.</param>
+    /// <returns>true if the segment intersects the plane; otherwise, false.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when the segment has zero length.</exception>
+    bool IntersectLine(Point3DValue lineStart, Point3DValue lineEnd, [System::Runtime::InteropServices::Out] Point3DValue% intersectionPoint);
+
+    /// <summary>
+    /// Determines whether this plane is parallel to another plane.
+    /// </summary>
+    /// <param name="other">The other plane to check.</param>
+    /// <param name="epsilon">The tolerance value.</param>
+    /// <returns>true if the planes are parallel; otherwise, false.</returns>
+    bool IsParallelTo(Plane3DValue other, double epsilon);
+
+    /// <summary>
+    /// Determines whether this plane is parallel to another plane using default epsilon.
+    /// </summary>
+    /// <param name="other">The other plane to check.</param>
+    /// <returns>true if the planes are parallel; otherwise, false.</returns>
+    bool IsParallelTo(Plane3DValue other);
+
+    /// <summary>
+    /// Determines whether this plane is equal to another plane.
+    /// </summary>
+    /// <param name="other">The plane to compare with.</param>
+    /// <returns>true if the planes are equal; otherwise, false.</returns>
+    bool Equals(Plane3DValue other);
+
+    /// <summary>
+    /// Determines whether this plane is equal to another object.
+    /// </summary>
+    /// <param name="obj">The object to compare with.</param>
+    /// <returns>true if obj is an equal Plane3DValue; otherwise, false.</returns>
+    bool Equals(System::Object^ obj) override;
+
+    /// <summary>
+    /// Returns a hash code for this plane.
+    /// </summary>
+    /// <returns>A hash code for the current Plane3DValue.</returns>
+    int GetHashCode() override;
+
+    /// <summary>
+    /// Returns a string representation of this plane.
+    /// </summary>
+    /// <returns>A string representation of the plane.</returns>
+    System::String^ ToString() override;
+
+    /// <summary>
+    /// Implicit conversion from the reference type Plane3D.
+    /// </summary>
+    static operator Plane3DValue(Plane3D^ plane);
+
+    /// <summary>
+    /// Explicit conversion to the reference type Plane3D. Allocates new objects.
+    /// </summary>
+    explicit static operator Plane3D^(Plane3DValue plane);
+
+    /// <summary>
+    /// Operator overload for equality.
+    /// </summary>
+    static bool operator==(Plane3DValue p1, Plane3DValue p2);
+
+    /// <summary>
+    /// Operator overload for inequality.
+    /// </summary>
+    static bool operator!=(Plane3DValue p1, Plane3DValue p2);
+  };
+}
@@ -0,0 +1,133 @@
+#include "PlaneIntersection.h"
+#include "PointBuffer.h"
+#include "VectorBuffer.h"
+
+#include "../native/SoaBuffer.h"
+#include "../native/SoaKernels.h"
+
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+
+  /// Plane3DValue also stores its reference point, so the coefficients are gathered into compact columns.
+  struct PlaneColumns
+  {
+    explicit PlaneColumns(array<Plane3DValue>^ planes)
+    {
+      const size_t count = static_cast<size_t>(planes->Length);
+      nx.reserve(count);
+      ny.reserve(count);
+      nz.reserve(count);
+      d.reserve(count);
+      for each (Plane3DValue plane in planes)
+      {
+        Vector3DValue normal = plane.Normal;
+        nx.push_back(normal.X);
+        ny.push_back(normal.Y);
+        nz.push_back(normal.Z);
+        d.push_back(plane.D);
+      }
+    }
+
+    Native::Kernels::ConstPlaneView view() const
+    {
+      return { nx.data(), ny.data(), nz.data(), d.data(), nx.size() };
+    }
+
+    std::vector<double> nx;
+    std::vector<double> ny;
+    std::vector<double> nz;
+    std::vector<double> d;
+  };
+
+  constexpr double epsilon = 1e-10;
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  int PlaneIntersection::IntersectPairs(array<Plane3DValue>^ first, array<Plane3DValue>^ second,
+    array<PlaneIntersectionStatus>^% status, PointBuffer^ points, VectorBuffer^ directions)
+  {
+    return IntersectPairs(first, second, status, points, directions, false);
+  }
+
+  int PlaneIntersection::IntersectPairs(array<Plane3DValue>^ first, array<Plane3DValue>^ second,
+    array<PlaneIntersectionStatus>^% status, PointBuffer^ points, VectorBuffer^ directions, bool parallel)
+  {
+    if (first == nullptr)
+      throw gcnew System::ArgumentNullException("first");
+    if (second == nullptr)
+      throw gcnew System::ArgumentNullException("second");
+    if (points == nullptr)
+      throw gcnew System::ArgumentNullException("points");
+    if (directions == nullptr)
+      throw gcnew System::ArgumentNullException("directions");
+
+    const long long total = static_cast<long long>(first->Length) * second->Length;
+    if (total > System::Int32::MaxValue)
+      throw gcnew System::ArgumentException("Too many plane pairs for a single call.", "second");
+
+    const int count = static_cast<int>(total);
+    if (status == nullptr || status->Length < count)
+      status = gcnew array<PlaneIntersectionStatus>(count);
+
+    Native::SoaBuffer* pointTarget = points->Storage;
+    Native::SoaBuffer* directionTarget = directions->Storage;
+    pointTarget->resize(static_cast<size_t>(count));
+    directionTarget->resize(static_cast<size_t>(count));
+    if (count == 0)
+      return 0;
+
+    const PlaneColumns firstPlanes(first);
+    const PlaneColumns secondPlanes(second);
+    // PlaneIntersectionStatus and the native status share their values and their one-byte layout.
+    pin_ptr<PlaneIntersectionStatus> statusOut = &status[0];
+    size_t intersecting = Native::Kernels::intersectPlanePairs(firstPlanes.view(), secondPlanes.view(), epsilon,
+      pointTarget->view(), directionTarget->view(),
+      reinterpret_cast<Native::Kernels::PlaneIntersectionStatus*>(statusOut), parallel);
+    System::GC::KeepAlive(points);
+    System::GC::KeepAlive(directions);
+    return static_cast<int>(intersecting);
+  }
+
+  int PlaneIntersection::IntersectTriples(array<Plane3DValue>^ a, array<Plane3DValue>^ b, array<Plane3DValue>^ c,
+    array<PlaneIntersectionStatus>^% status, PointBuffer^ points)
+  {
+    return IntersectTriples(a, b, c, status, points, false);
+  }
+
+  int PlaneIntersection::IntersectTriples(array<Plane3DValue>^ a, array<Plane3DValue>^ b, array<Plane3DValue>^ c,
+    array<PlaneIntersectionStatus>^% status, PointBuffer^ points, bool parallel)
+  {
+    if (a == nullptr)
+      throw gcnew System::ArgumentNullException("a");
+    if (b == nullptr)
+      throw gcnew System::ArgumentNullException("b");
+    if (c == nullptr)
+      throw gcnew System::ArgumentNullException("c");
+    if (points == nullptr)
+      throw gcnew System::ArgumentNullException("points");
+    if (b->Length != a->Length || c->Length != a->Length)
+      throw gcnew System::ArgumentException("The plane arrays must have the same length.");
+
+    const int count = a->Length;
+    if (status == nullptr || status->Length < count)
+      status = gcnew array<PlaneIntersectionStatus>(count);
+
+    Native::SoaBuffer* target = points->Storage;
+    target->resize(static_cast<size_t>(count));
+    if (count == 0)
+      return 0;
+
+    const PlaneColumns aPlanes(a);
+    const PlaneColumns bPlanes(b);
+    const PlaneColumns cPlanes(c);
+    pin_ptr<PlaneIntersectionStatus> statusOut = &status[0];
+    size_t intersecting = Native::Kernels::intersectPlaneTriples(aPlanes.view(), bPlanes.view(), cPlanes.view(), epsilon,
+      target->view(), reinterpret_cast<Native::Kernels::PlaneIntersectionStatus*>(statusOut), parallel);
+    System::GC::KeepAlive(points);
+    return static_cast<int>(intersecting);
+  }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Plane3DValue.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class PointBuffer;
+  ref class VectorBuffer;
+
+  /// <summary>
+  /// How two or three planes meet, as reported by PlaneIntersection.
+  /// </summary>
+  public enum class PlaneIntersectionStatus : System::Byte
+  {
+    /// <summary>Two planes meet in one line, three planes in one point.</summary>
+    Intersecting = 0,
+    /// <summary>Two planes are parallel and apart.</summary>
+    Parallel = 1,
+    /// <summary>Two planes are the same plane within tolerance.</summary>
+    Coincident = 2,
+    /// <summary>Three planes do not meet in a single point: at least two are parallel, or all share a direction.</summary>
+    Singular = 3
+  };
+
+  /// <summary>
+  /// Intersects whole sets of planes in a single native call: every plane of one set with every plane of another
+  /// into lines, and triples of planes into points.
+  /// The rules for parallel planes match Plane3D::IntersectPlane, but no objects are allocated per pair.
+  /// </summary>
+  public ref class PlaneIntersection abstract sealed
+  {
+  public:
+    /// <summary>
+    /// Intersects every plane of one set with every plane of another.
+    /// Results are grouped by the second plane: the entry for first[i] and second[j] is at index j * first->Length + i.
+    /// </summary>
+    /// <param name="first">The first set of planes.</param>
+    /// <param name="second">The second set of planes.</param>
+    /// <param name="status">Receives first->Length * second->Length statuses; grown when too small.</param>
+    /// <param name="points">Receives for each intersecting pair the point of its line closest to the origin, the origin otherwise.</param>
+    /// <param name="directions">Receives for each intersecting pair the unit line direction, the zero vector otherwise.</param>
+    /// <returns>The number of intersecting pairs.</returns>
+    static int IntersectPairs(array<Plane3DValue>^ first, array<Plane3DValue>^ second,
+      array<PlaneIntersectionStatus>^% status, PointBuffer^ points, VectorBuffer^ directions);
+
+    /// <summary>
+    /// Intersects every plane of one set with every plane of another, optionally splitting large inputs across all cores.
+    /// Results are grouped by the second plane: the entry for first[i] and second[j] is at index j * first->Length + i.
+    /// </summary>
+    /// <param name="first">The first set of planes.</param>
+    /// <param name="second">The second set of planes.</param>
+    /// <param name="status">Receives first->Length * second->Length statuses; grown when too small.</param>
+    /// <param name="points">Receives for each intersecting pair the point of its line closest to the origin, the origin otherwise.</param>
+    /// <param name="directions">Receives for each intersecting pair the unit line direction, the zero vector otherwise.</param>
+    /// <param name="parallel">true to process large inputs on multiple threads.</param>
+    /// <returns>The number of intersecting pairs.</returns>
+    static int IntersectPairs(array<Plane3DValue>^ first, array<Plane3DValue>^ second,
+      array<PlaneIntersectionStatus>^% status, PointBuffer^ points, VectorBuffer^ directions, bool parallel);
+
+    /// <summary>
+    /// Intersects the planes a[i], b[i] and c[i] for every i.
+    /// </summary>
+    /// <param name="a">The first plane of each triple.</param>
+    /// <param name="b">The second plane of each triple; must have the same length as a.</param>
+    /// <param name="c">The third plane of each triple; must have the same length as a.</param>
+    /// <param name="status">Receives one status per triple; grown when too small.</param>
+    /// <param name="points">Receives one point per triple: the common point, or the origin for singular triples.</param>
+    /// <returns>The number of triples that meet in one point.</returns>
+    static int IntersectTriples(array<Plane3DValue>^ a, array<Plane3DValue>^ b, array<Plane3DValue>^ c,
+      array<PlaneIntersectionStatus>^% status, PointBuffer^ points);
+
+    /// <summary>
+    /// Intersects the planes a[i], b[i] and c[i] for every i, optionally splitting large inputs across all cores.
+    /// </summary>
+    /// <param name="a">The first plane of each triple.</param>
+    /// <param name="b">The second plane of each triple; must have the same length as a.</param>
+    /// <param name="c">The third plane of each triple; must have the same length as a.</param>
+    /// <param name="status">Receives one status per triple; grown when too small.</param>
+    /// <param name="points">Receives one point per triple: the common point, or the origin for singular triples.</param>
+    /// <param name="parallel">true to process large inputs on multiple threads.</param>
+    /// <returns>The number of triples that meet in one point.</returns>
+    static int IntersectTriples(array<Plane3DValue>^ a, array<Plane3DValue>^ b, array<Plane3DValue>^ c,
+      array<PlaneIntersectionStatus>^% status, PointBuffer^ points, bool parallel);
+  };
+}
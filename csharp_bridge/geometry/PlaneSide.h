@@ -0,0 +1,30 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  /// <summary>
+  /// The side of a plane a point lies on, relative to the direction its normal points to.
+  /// </summary>
+  public enum class PlaneSide : System::SByte
+  {
+    /// <summary>Behind the plane, further than the tolerance.</summary>
+    Back = -1,
+    /// <summary>On the plane, within the tolerance.</summary>
+    On = 0,
+    /// <summary>In front of the plane, further than the tolerance.</summary>
+    Front = 1
+  };
+
+  /// <summary>
+  /// The number of points found on each side of a plane by Plane3D::Classify.
+  /// </summary>
+  public value struct PlaneSideCounts
+  {
+    /// <summary>The number of points in front of the plane.</summary>
+    int Front;
+    /// <summary>The number of points behind the plane.</summary>
+    int Back;
+    /// <summary>The number of points on the plane.</summary>
+    int On;
+  };
+}
@@ -1,16 +1,24 @@
 #include "Point3D.h"
+#include "CoreConversions.h"
+
+#include "../diagnostics/BridgeCounters.h"
 
 #include <cmath>
 #include <CwAPI3DTypes.h>
 #include <stdexcept>
 
+namespace Core = CwAPI3D::Net::Bridge::Core;
+using CwAPI3D::Net::Bridge::Detail::ToCore;
+
 CwAPI3D::Net::Bridge::Point3D^ CwAPI3D::Net::Bridge::Point3D::FromNative(const CwAPI3D::vector3D& vec)
 {
+  BridgeCounters::Add(Detail::Counter::VectorsToManaged, 1);
   return gcnew Point3D(vec.mX, vec.mY, vec.mZ);
 }
 
 CwAPI3D::vector3D CwAPI3D::Net::Bridge::Point3D::ToNative()
 {
+  BridgeCounters::Add(Detail::Counter::VectorsToNative, 1);
   CwAPI3D::vector3D result;
   result.mX = m_X;
   result.mY = m_Y;
@@ -20,10 +28,7 @@ CwAPI3D::vector3D CwAPI3D::Net::Bridge::Point3D::ToNative()
 
 double CwAPI3D::Net::Bridge::Point3D::DistanceTo(Point3D^ other)
 {
-  double dx = other->X - m_X;
-  double dy = other->Y - m_Y;
-  double dz = other->Z - m_Z;
-  return System::Math::Sqrt(dx * dx + dy * dy + dz * dz);
+  return Core::distance(ToCore(this), ToCore(other));
 }
 
 CwAPI3D::Net::Bridge::Point3D^ CwAPI3D::Net::Bridge::Point3D::Add(Point3D^ other)
@@ -43,8 +48,7 @@ CwAPI3D::Net::Bridge::Point3D^ CwAPI3D::Net::Bridge::Point3D::Multiply(double sc
 
 CwAPI3D::Net::Bridge::Point3D^ CwAPI3D::Net::Bridge::Point3D::Divide(double scalar)
 {
-  constexpr double epsilon = 1e-10;  // Small value for floating-point comparison
-  if (std::abs(scalar) < epsilon)
+  if (Core::DefaultTolerance<double>::isZero(scalar))
     throw gcnew System::DivideByZeroException("Cannot divide by zero.");
 
   return gcnew Point3D(m_X / scalar, m_Y / scalar, m_Z / scalar);
@@ -56,17 +60,12 @@ bool CwAPI3D::Net::Bridge::Point3D::Equals(System::Object^ obj)
     return false;
 
   Point3D^ other = safe_cast<Point3D^>(obj); // https://learn.microsoft.com/en-us/cpp/extensions/safe-cast-cpp-component-extensions?view=msvc-170
-  constexpr double epsilon = 1e-10;
-
-  return std::fabs(m_X - other->X) < epsilon &&
-    std::fabs(m_Y - other->Y) < epsilon &&
-    std::fabs(m_Z - other->Z) < epsilon;
-
+  return Core::approxEqual(ToCore(this), ToCore(other));
 }
 
 int CwAPI3D::Net::Bridge::Point3D::GetHashCode()
 {
-  return m_X.GetHashCode() ^ m_Y.GetHashCode() ^ m_Z.GetHashCode();
+  return Core::hashPoint(ToCore(this));
 }
 
 System::String^ CwAPI3D::Net::Bridge::Point3D::ToString()
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../diagnostics/TraceScope.h"
+
 namespace CwAPI3D
 {
   struct vector3D;
@@ -48,7 +50,11 @@ namespace CwAPI3D::Net::Bridge
     /// <summary>
     /// Initializes a new instance of the Point3D class with coordinates (0, 0, 0).
     /// </summary>
-    Point3D() : m_X(0.0), m_Y(0.0), m_Z(0.0) {}
+    Point3D() : m_X(0.0), m_Y(0.0), m_Z(0.0)
+    {
+      BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+      Detail::TraceScope trace(Native::Trace::Point::Point3D_Create);
+    }
 
     /// <summary>
     /// Initializes a new instance of the Point3D class with the specified coordinates.
@@ -56,13 +62,21 @@ namespace CwAPI3D::Net::Bridge
     /// <param name="x">The X coordinate.</param>
     /// <param name="y">The Y coordinate.</param>
     /// <param name="z">The Z coordinate.</param>
-    Point3D(double x, double y, double z) : m_X(x), m_Y(y), m_Z(z) {}
+    Point3D(double x, double y, double z) : m_X(x), m_Y(y), m_Z(z)
+    {
+      BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+      Detail::TraceScope trace(Native::Trace::Point::Point3D_Create_Coordinates);
+    }
 
     /// <summary>
     /// Copy constructor. Initializes a new instance of the Point3D class with the values from another Point3D.
     /// </summary>
     /// <param name="other">Another Point3D object whose values are copied.</param>
-    Point3D(Point3D^ other) : m_X(other->X), m_Y(other->Y), m_Z(other->Z) {}
+    Point3D(Point3D^ other) : m_X(other->X), m_Y(other->Y), m_Z(other->Z)
+    {
+      BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+      Detail::TraceScope trace(Native::Trace::Point::Point3D_Create_Copy);
+    }
 
     /// <summary>
     /// Creates a Point3D from a native vector3D.
@@ -121,7 +135,9 @@ namespace CwAPI3D::Net::Bridge
     bool Equals(System::Object^ obj) override;
 
     /// <summary>
-    /// Returns a hash code for this point.
+    /// Returns a hash code for this point, computed from its coordinates rounded down to a 1e-6 grid.
+    /// Equal points share a hash code unless they straddle a grid line; to deduplicate points within a
+    /// tolerance, use SpatialPointHash rather than a dictionary keyed by point.
     /// </summary>
     /// <returns>A hash code for the current Point3D.</returns>
     int GetHashCode() override;
@@ -0,0 +1,199 @@
+#include "Point3DValue.h"
+#include "Point3D.h"
+
+#include "../diagnostics/BridgeCounters.h"
+
+#include "../core/Hash.h"
+
+#include <cmath>
+#include <cstring>
+#include <CwAPI3DTypes.h>
+
+namespace CwAPI3D::Net::Bridge
+{
+  Point3DValue Point3DValue::FromNative(const CwAPI3D::vector3D& vec)
+  {
+    return *reinterpret_cast<const Point3DValue*>(&vec);
+  }
+
+  CwAPI3D::vector3D Point3DValue::ToNative()
+  {
+    Point3DValue copy = *this;
+    return *reinterpret_cast<CwAPI3D::vector3D*>(&copy);
+  }
+
+  void Point3DValue::CopyToNative(array<Point3DValue>^ source, CwAPI3D::vector3D* destination)
+  {
+    if (source == nullptr)
+      throw gcnew System::ArgumentNullException("source");
+    if (source->Length == 0)
+      return;
+    if (!destination)
+      throw gcnew System::ArgumentNullException("destination");
+
+    BridgeCounters::Add(Detail::Counter::VectorsToNative, source->Length);
+    pin_ptr<Point3DValue> pinned = &source[0];
+    std::memcpy(destination, pinned, static_cast<size_t>(source->Length) * sizeof(CwAPI3D::vector3D));
+  }
+
+  array<Point3DValue>^ Point3DValue::FromNative(const CwAPI3D::vector3D* source, int count)
+  {
+    if (count < 0)
+      throw gcnew System::ArgumentOutOfRangeException("count");
+
+    auto result = gcnew array<Point3DValue>(count);
+    if (count == 0)
+      return result;
+    if (!source)
+      throw gcnew System::ArgumentNullException("source");
+
+    BridgeCounters::Add(Detail::Counter::VectorsToManaged, count);
+    pin_ptr<Point3DValue> pinned = &result[0];
+    std::memcpy(pinned, source, static_cast<size_t>(count) * sizeof(CwAPI3D::vector3D));
+    return result;
+  }
+
+  double Point3DValue::DistanceTo(Point3DValue other)
+  {
+    return std::sqrt(DistanceSquaredTo(other));
+  }
+
+  double Point3DValue::DistanceSquaredTo(Point3DValue other)
+  {
+    double dx = other.X - X;
+    double dy = other.Y - Y;
+    double dz = other.Z - Z;
+    return dx * dx + dy * dy + dz * dz;
+  }
+
+  Point3DValue Point3DValue::Add(Point3DValue other)
+  {
+    return Point3DValue(X + other.X, Y + other.Y, Z + other.Z);
+  }
+
+  Point3DValue Point3DValue::Subtract(Point3DValue other)
+  {
+    return Point3DValue(X - other.X, Y - other.Y, Z - other.Z);
+  }
+
+  Point3DValue Point3DValue::Multiply(double scalar)
+  {
+    return Point3DValue(X * scalar, Y * scalar, Z * scalar);
+  }
+
+  Point3DValue Point3DValue::Divide(double scalar)
+  {
+    constexpr double epsilon = 1e-10;
+    if (std::fabs(scalar) < epsilon)
+      throw gcnew System::DivideByZeroException("Cannot divide by zero.");
+
+    return Point3DValue(X / scalar, Y / scalar, Z / scalar);
+  }
+
+  Point3DValue Point3DValue::Translate(Vector3DValue offset)
+  {
+    return Point3DValue(X + offset.X, Y + offset.Y, Z + offset.Z);
+  }
+
+  void Point3DValue::TranslateInPlace(Vector3DValue% offset)
+  {
+    X += offset.X;
+    Y += offset.Y;
+    Z += offset.Z;
+  }
+
+  double Point3DValue::Distance(Point3DValue% p1, Point3DValue% p2)
+  {
+    double dx = p2.X - p1.X;
+    double dy = p2.Y - p1.Y;
+    double dz = p2.Z - p1.Z;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+
+  void Point3DValue::Translate(Point3DValue% point, Vector3DValue% offset, Point3DValue% result)
+  {
+    result.X = point.X + offset.X;
+    result.Y = point.Y + offset.Y;
+    result.Z = point.Z + offset.Z;
+  }
+
+  bool Point3DValue::Equals(Point3DValue other)
+  {
+    constexpr double epsilon = 1e-10;
+
+    return std::fabs(X - other.X) < epsilon &&
+      std::fabs(Y - other.Y) < epsilon &&
+      std::fabs(Z - other.Z) < epsilon;
+  }
+
+  bool Point3DValue::Equals(System::Object^ obj)
+  {
+    if (obj == nullptr || !obj->GetType()->Equals(Point3DValue::typeid))
+      return false;
+
+    return Equals(safe_cast<Point3DValue>(obj));
+  }
+
+  int Point3DValue::GetHashCode()
+  {
+    return Core::hashPoint(Core::Vec3d{X, Y, Z});
+  }
+
+  System::String^ Point3DValue::ToString()
+  {
+    return System::String::Format("({0}, {1}, {2})", X, Y, Z);
+  }
+
+  Point3DValue::operator Point3DValue(Point3D^ point)
+  {
+    if (point == nullptr)
+      throw gcnew System::ArgumentNullException("point");
+
+    return Point3DValue(point->X, point->Y, point->Z);
+  }
+
+  Point3DValue::operator Point3D^(Point3DValue point)
+  {
+    return gcnew Point3D(point.X, point.Y, point.Z);
+  }
+
+  Point3DValue Point3DValue::operator+(Point3DValue p1, Point3DValue p2)
+  {
+    return p1.Add(p2);
+  }
+
+  Point3DValue Point3DValue::operator+(Point3DValue p, Vector3DValue v)
+  {
+    return p.Translate(v);
+  }
+
+  Point3DValue Point3DValue::operator-(Point3DValue p1, Point3DValue p2)
+  {
+    return p1.Subtract(p2);
+  }
+
+  Point3DValue Point3DValue::operator*(Point3DValue p, double scalar)
+  {
+    return p.Multiply(scalar);
+  }
+
+  Point3DValue Point3DValue::operator*(double scalar, Point3DValue p)
+  {
+    return p.Multiply(scalar);
+  }
+
+  Point3DValue Point3DValue::operator/(Point3DValue p, double scalar)
+  {
+    return p.Divide(scalar);
+  }
+
+  bool Point3DValue::operator==(Point3DValue p1, Point3DValue p2)
+  {
+    return p1.Equals(p2);
+  }
+
+  bool Point3DValue::operator!=(Point3DValue p1, Point3DValue p2)
+  {
+    return !p1.Equals(p2);
+  }
+}
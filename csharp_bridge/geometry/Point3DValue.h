@@ -0,0 +1,223 @@
+#pragma once
+
+#include "Vector3DValue.h"
+
+namespace CwAPI3D
+{
+  struct vector3D;
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class Point3D;
+
+  /// <summary>
+  /// Allocation-free counterpart of Point3D.
+  /// The layout matches the native CwAPI3D::vector3D (three consecutive doubles), so values and arrays
+  /// can be handed to native code without copying field by field.
+  /// </summary>
+  [System::Runtime::InteropServices::StructLayout(System::Runtime::InteropServices::LayoutKind::Sequential)]
+  public value struct Point3DValue
+  {
+    /// <summary>
+    /// The X coordinate.
+    /// </summary>
+    double X;
+
+    /// <summary>
+    /// The Y coordinate.
+    /// </summary>
+    double Y;
+
+    /// <summary>
+    /// The Z coordinate.
+    /// </summary>
+    double Z;
+
+    /// <summary>
+    /// Initializes a new Point3DValue with the specified coordinates.
+    /// </summary>
+    /// <param name="x">The X coordinate.</param>
+    /// <param name="y">The Y coordinate.</param>
+    /// <param name="z">The Z coordinate.</param>
+    Point3DValue(double x, double y, double z) : X(x), Y(y), Z(z) {}
+
+    /// <summary>
+    /// Reinterprets a native vector3D as a Point3DValue.
+    /// </summary>
+    /// <param name="vec">The native vector3D structure.</param>
+    /// <returns>The point with the same coordinates.</returns>
+    static Point3DValue FromNative(const CwAPI3D::vector3D& vec);
+
+    /// <summary>
+    /// Reinterprets this point as a native vector3D.
+    /// </summary>
+    /// <returns>A native vector3D structure.</returns>
+    CwAPI3D::vector3D ToNative();
+
+    /// <summary>
+    /// Copies an array of points into native memory with a single block copy.
+    /// </summary>
+    /// <param name="source">The points to copy.</param>
+    /// <param name="destination">Native storage for at least source->Length points.</param>
+    static void CopyToNative(array<Point3DValue>^ source, CwAPI3D::vector3D* destination);
+
+    /// <summary>
+    /// Copies native points into a new managed array with a single block copy.
+    /// </summary>
+    /// <param name="source">The native points.</param>
+    /// <param name="count">The number of points to copy.</param>
+    /// <returns>A new array holding the points.</returns>
+    static array<Point3DValue>^ FromNative(const CwAPI3D::vector3D* source, int count);
+
+    /// <summary>
+    /// Calculates the distance between this point and another point.
+    /// </summary>
+    /// <param name="other">The other point.</param>
+    /// <returns>The distance between the two points.</returns>
+    double DistanceTo(Point3DValue other);
+
+    /// <summary>
+    /// Calculates the squared distance between this point and another point, avoiding the square root.
+    /// </summary>
+    /// <param name="other">The other point.</param>
+    /// <returns>The squared distance between the two points.</returns>
+    double DistanceSquaredTo(Point3DValue other);
+
+    /// <summary>
+    /// Adds another point to this point.
+    /// </summary>
+    /// <param name="other">The point to add.</param>
+    /// <returns>The sum.</returns>
+    Point3DValue Add(Point3DValue other);
+
+    /// <summary>
+    /// Subtracts another point from this point.
+    /// </summary>
+    /// <param name="other">The point to subtract.</param>
+    /// <returns>The difference.</returns>
+    Point3DValue Subtract(Point3DValue other);
+
+    /// <summary>
+    /// Multiplies this point by a scalar value.
+    /// </summary>
+    /// <param name="scalar">The scalar value to multiply by.</param>
+    /// <returns>The product.</returns>
+    Point3DValue Multiply(double scalar);
+
+    /// <summary>
+    /// Divides this point by a scalar value.
+    /// </summary>
+    /// <param name="scalar">The scalar value to divide by.</param>
+    /// <returns>The quotient.</returns>
+    /// <exception cref="System::DivideByZeroException">Thrown when scalar is zero.</exception>
+    Point3DValue Divide(double scalar);
+
+    /// <summary>
+    /// Moves this point along a vector.
+    /// </summary>
+    /// <param name="offset">The displacement.</param>
+    /// <returns>The translated point.</returns>
+    Point3DValue Translate(Vector3DValue offset);
+
+    /// <summary>
+    /// Moves this point along a vector in place.
+    /// </summary>
+    /// <param name="offset">The displacement.</param>
+    void TranslateInPlace(Vector3DValue% offset);
+
+    /// <summary>
+    /// Calculates the distance between two points passed by reference.
+    /// </summary>
+    /// <param name="p1">The first point.</param>
+    /// <param name="p2">The second point.</param>
+    /// <returns>The distance between the two points.</returns>
+    static double Distance(Point3DValue% p1, Point3DValue% p2);
+
+    /// <summary>
+    /// Moves a point passed by reference along a vector.
+    /// </summary>
+    /// <param name="point">The point.</param>
+    /// <param name="offset">The displacement.</param>
+    /// <param name="result">When this method returns, contains the translated point.</param>
+    static void Translate(Point3DValue% point, Vector3DValue% offset, [System::Runtime::InteropServices::Out] Point3DValue% result);
+
+    /// <summary>
+    /// Determines whether this point is equal to another point within 1e-10 per coordinate.
+    /// </summary>
+    /// <param name="other">The point to compare with.</param>
+    /// <returns>true if the points are equal; otherwise, false.</returns>
+    bool Equals(Point3DValue other);
+
+    /// <summary>
+    /// Determines whether this point is equal to another object.
+    /// </summary>
+    /// <param name="obj">The object to compare with.</param>
+    /// <returns>true if obj is an equal Point3DValue; otherwise, false.</returns>
+    bool Equals(System::Object^ obj) override;
+
+    /// <summary>
+    /// Returns a hash code for this point, computed from its coordinates rounded down to a 1e-6 grid.
+    /// Equal points share a hash code unless they straddle a grid line; to deduplicate points within a
+    /// tolerance, use SpatialPointHash rather than a dictionary keyed by point.
+    /// </summary>
+    /// <returns>A hash code for the current Point3DValue.</returns>
+    int GetHashCode() override;
+
+    /// <summary>
+    /// Returns a string representation of this point.
+    /// </summary>
+    /// <returns>A string representation of the point.</returns>
+    System::String^ ToString() override;
+
+    /// <summary>
+    /// Implicit conversion from the reference type Point3D.
+    /// </summary>
+    static operator Point3DValue(Point3D^ point);
+
+    /// <summary>
+    /// Explicit conversion to the reference type Point3D. Allocates a new object.
+    /// </summary>
+    explicit static operator Point3D^(Point3DValue point);
+
+    /// <summary>
+    /// Operator overload for addition.
+    /// </summary>
+    static Point3DValue operator+(Point3DValue p1, Point3DValue p2);
+
+    /// <summary>
+    /// Operator overload for translation by a vector.
+    /// </summary>
+    static Point3DValue operator+(Point3DValue p, Vector3DValue v);
+
+    /// <summary>
+    /// Operator overload for subtraction.
+    /// </summary>
+    static Point3DValue operator-(Point3DValue p1, Point3DValue p2);
+
+    /// <summary>
+    /// Operator overload for multiplication by scalar.
+    /// </summary>
+    static Point3DValue operator*(Point3DValue p, double scalar);
+
+    /// <summary>
+    /// Operator overload for multiplication by scalar (scalar first).
+    /// </summary>
+    static Point3DValue operator*(double scalar, Point3DValue p);
+
+    /// <summary>
+    /// Operator overload for division by scalar.
+    /// </summary>
+    static Point3DValue operator/(Point3DValue p, double scalar);
+
+    /// <summary>
+    /// Operator overload for equality.
+    /// </summary>
+    static bool operator==(Point3DValue p1, Point3DValue p2);
+
+    /// <summary>
+    /// Operator overload for inequality.
+    /// </summary>
+    static bool operator!=(Point3DValue p1, Point3DValue p2);
+  };
+}
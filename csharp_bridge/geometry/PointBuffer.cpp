@@ -0,0 +1,256 @@
+#include "PointBuffer.h"
+#include "VectorBuffer.h"
+
+#include "../diagnostics/TraceScope.h"
+
+#include "../native/SoaBuffer.h"
+#include "../native/SoaKernels.h"
+
+#include <cstring>
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace
+  {
+    void EnsureLength(array<double>^% values, int count)
+    {
+      if (values == nullptr || values->Length < count)
+        values = gcnew array<double>(count);
+    }
+  }
+
+  PointBuffer::PointBuffer()
+  {
+    BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+    Detail::TraceScope trace(Native::Trace::Point::PointBuffer_Create);
+    m_buffer = new Native::SoaBuffer();
+  }
+
+  PointBuffer::PointBuffer(int capacity)
+  {
+    BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+    Detail::TraceScope trace(Native::Trace::Point::PointBuffer_Create_Capacity);
+    if (capacity < 0)
+      throw gcnew System::ArgumentOutOfRangeException("capacity");
+
+    m_buffer = new Native::SoaBuffer(static_cast<size_t>(capacity));
+  }
+
+  PointBuffer^ PointBuffer::FromArray(array<Point3DValue>^ points)
+  {
+    if (points == nullptr)
+      throw gcnew System::ArgumentNullException("points");
+
+    auto result = gcnew PointBuffer(points->Length);
+    Native::SoaBuffer* buffer = result->m_buffer;
+    buffer->resize(static_cast<size_t>(points->Length));
+
+    double* x = buffer->x();
+    double* y = buffer->y();
+    double* z = buffer->z();
+    for (int i = 0; i < points->Length; ++i)
+    {
+      x[i] = points[i].X;
+      y[i] = points[i].Y;
+      z[i] = points[i].Z;
+    }
+    return result;
+  }
+
+  PointBuffer::~PointBuffer()
+  {
+    this->!PointBuffer();
+  }
+
+  PointBuffer::!PointBuffer()
+  {
+    delete m_buffer;
+    m_buffer = nullptr;
+  }
+
+  void PointBuffer::ThrowIfDisposed()
+  {
+    if (!m_buffer)
+      throw gcnew System::ObjectDisposedException("PointBuffer");
+  }
+
+  int PointBuffer::Count::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_buffer->size());
+  }
+
+  int PointBuffer::Capacity::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_buffer->capacity());
+  }
+
+  Point3DValue PointBuffer::default::get(int index)
+  {
+    ThrowIfDisposed();
+    if (index < 0 || static_cast<size_t>(index) >= m_buffer->size())
+      throw gcnew System::ArgumentOutOfRangeException("index");
+
+    return Point3DValue(m_buffer->x()[index], m_buffer->y()[index], m_buffer->z()[index]);
+  }
+
+  void PointBuffer::default::set(int index, Point3DValue value)
+  {
+    ThrowIfDisposed();
+    if (index < 0 || static_cast<size_t>(index) >= m_buffer->size())
+      throw gcnew System::ArgumentOutOfRangeException("index");
+
+    m_buffer->x()[index] = value.X;
+    m_buffer->y()[index] = value.Y;
+    m_buffer->z()[index] = value.Z;
+  }
+
+  void PointBuffer::Add(double x, double y, double z)
+  {
+    ThrowIfDisposed();
+    m_buffer->push_back(x, y, z);
+  }
+
+  void PointBuffer::Add(Point3DValue point)
+  {
+    Add(point.X, point.Y, point.Z);
+  }
+
+  void PointBuffer::Clear()
+  {
+    ThrowIfDisposed();
+    m_buffer->clear();
+  }
+
+  void PointBuffer::Reserve(int capacity)
+  {
+    ThrowIfDisposed();
+    if (capacity < 0)
+      throw gcnew System::ArgumentOutOfRangeException("capacity");
+
+    m_buffer->reserve(static_cast<size_t>(capacity));
+  }
+
+  void PointBuffer::Resize(int count)
+  {
+    ThrowIfDisposed();
+    if (count < 0)
+      throw gcnew System::ArgumentOutOfRangeException("count");
+
+    m_buffer->resize(static_cast<size_t>(count));
+  }
+
+  void PointBuffer::CopyFrom(array<double>^ x, array<double>^ y, array<double>^ z)
+  {
+    ThrowIfDisposed();
+    if (x == nullptr)
+      throw gcnew System::ArgumentNullException("x");
+    if (y == nullptr)
+      throw gcnew System::ArgumentNullException("y");
+    if (z == nullptr)
+      throw gcnew System::ArgumentNullException("z");
+    if (x->Length != y->Length || x->Length != z->Length)
+      throw gcnew System::ArgumentException("Coordinate arrays must have the same length.");
+
+    const size_t count = static_cast<size_t>(x->Length);
+    m_buffer->resize(count);
+    if (count == 0)
+      return;
+
+    pin_ptr<double> px = &x[0];
+    pin_ptr<double> py = &y[0];
+    pin_ptr<double> pz = &z[0];
+    std::memcpy(m_buffer->x(), px, count * sizeof(double));
+    std::memcpy(m_buffer->y(), py, count * sizeof(double));
+    std::memcpy(m_buffer->z(), pz, count * sizeof(double));
+    System::GC::KeepAlive(this);
+  }
+
+  int PointBuffer::CopyTo(array<double>^% x, array<double>^% y, array<double>^% z)
+  {
+    ThrowIfDisposed();
+    const int count = static_cast<int>(m_buffer->size());
+    EnsureLength(x, count);
+    EnsureLength(y, count);
+    EnsureLength(z, count);
+    if (count == 0)
+      return 0;
+
+    pin_ptr<double> px = &x[0];
+    pin_ptr<double> py = &y[0];
+    pin_ptr<double> pz = &z[0];
+    std::memcpy(px, m_buffer->x(), static_cast<size_t>(count) * sizeof(double));
+    std::memcpy(py, m_buffer->y(), static_cast<size_t>(count) * sizeof(double));
+    std::memcpy(pz, m_buffer->z(), static_cast<size_t>(count) * sizeof(double));
+    System::GC::KeepAlive(this);
+    return count;
+  }
+
+  array<Point3DValue>^ PointBuffer::ToArray()
+  {
+    ThrowIfDisposed();
+    const int count = static_cast<int>(m_buffer->size());
+    auto result = gcnew array<Point3DValue>(count);
+
+    const double* x = m_buffer->x();
+    const double* y = m_buffer->y();
+    const double* z = m_buffer->z();
+    for (int i = 0; i < count; ++i)
+      result[i] = Point3DValue(x[i], y[i], z[i]);
+    System::GC::KeepAlive(this);
+    return result;
+  }
+
+  void PointBuffer::Translate(Vector3DValue offset, PointBuffer^ result)
+  {
+    ThrowIfDisposed();
+    if (result == nullptr)
+      throw gcnew System::ArgumentNullException("result");
+
+    Native::SoaBuffer* target = result->Storage;
+    target->resize(m_buffer->size());
+    Native::Kernels::translate(m_buffer->view(), offset.X, offset.Y, offset.Z, target->view());
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(result);
+  }
+
+  void PointBuffer::DistanceTo(Point3DValue point, array<double>^% distances)
+  {
+    ThrowIfDisposed();
+    const int count = static_cast<int>(m_buffer->size());
+    EnsureLength(distances, count);
+    if (count == 0)
+      return;
+
+    pin_ptr<double> out = &distances[0];
+    Native::Kernels::distanceToPoint(m_buffer->view(), point.X, point.Y, point.Z, out);
+    System::GC::KeepAlive(this);
+  }
+
+  void PointBuffer::VectorsTo(PointBuffer^ other, VectorBuffer^ result)
+  {
+    ThrowIfDisposed();
+    if (other == nullptr)
+      throw gcnew System::ArgumentNullException("other");
+    if (result == nullptr)
+      throw gcnew System::ArgumentNullException("result");
+
+    Native::SoaBuffer* end = other->Storage;
+    if (end->size() != m_buffer->size())
+      throw gcnew System::ArgumentException("Both buffers must have the same count.", "other");
+
+    Native::SoaBuffer* target = result->Storage;
+    target->resize(m_buffer->size());
+    Native::Kernels::subtract(end->view(), m_buffer->view(), target->view());
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(other);
+    System::GC::KeepAlive(result);
+  }
+
+  Native::SoaBuffer* PointBuffer::Storage::get()
+  {
+    ThrowIfDisposed();
+    return m_buffer;
+  }
+}
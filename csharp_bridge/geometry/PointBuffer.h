@@ -0,0 +1,150 @@
+#pragma once
+
+#include "Point3DValue.h"
+#include "Vector3DValue.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace Native
+  {
+    class SoaBuffer;
+  }
+
+  ref class VectorBuffer;
+
+  /// <summary>
+  /// A resizable collection of points stored as three aligned native arrays (X, Y, Z).
+  /// Batch operations run in native code over the whole buffer using the widest SIMD instruction set available.
+  /// </summary>
+  public ref class PointBuffer
+  {
+  private:
+    Native::SoaBuffer* m_buffer;
+
+    void ThrowIfDisposed();
+
+  public:
+    /// <summary>
+    /// Initializes a new, empty PointBuffer.
+    /// </summary>
+    PointBuffer();
+
+    /// <summary>
+    /// Initializes a new, empty PointBuffer with room for the given number of points.
+    /// </summary>
+    /// <param name="capacity">The number of points to reserve space for.</param>
+    explicit PointBuffer(int capacity);
+
+    /// <summary>
+    /// Creates a buffer holding a copy of the given points.
+    /// </summary>
+    /// <param name="points">The points to copy.</param>
+    /// <returns>A new PointBuffer.</returns>
+    static PointBuffer^ FromArray(array<Point3DValue>^ points);
+
+    /// <summary>
+    /// Releases the native storage.
+    /// </summary>
+    ~PointBuffer();
+
+    /// <summary>
+    /// Finalizer. Releases the native storage if the buffer was not disposed.
+    /// </summary>
+    !PointBuffer();
+
+    /// <summary>
+    /// Gets the number of points in the buffer.
+    /// </summary>
+    property int Count
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the number of points the buffer can hold without reallocating.
+    /// </summary>
+    property int Capacity
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets or sets the point at the specified index.
+    /// </summary>
+    property Point3DValue default[int]
+    {
+      Point3DValue get(int index);
+      void set(int index, Point3DValue value);
+    }
+
+    /// <summary>
+    /// Appends a point.
+    /// </summary>
+    void Add(double x, double y, double z);
+
+    /// <summary>
+    /// Appends a point.
+    /// </summary>
+    void Add(Point3DValue point);
+
+    /// <summary>
+    /// Removes all points while keeping the storage.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Ensures the buffer can hold at least the given number of points.
+    /// </summary>
+    void Reserve(int capacity);
+
+    /// <summary>
+    /// Sets the number of points; new points are at the origin.
+    /// </summary>
+    void Resize(int count);
+
+    /// <summary>
+    /// Replaces the contents with the given coordinate arrays, which must have equal lengths.
+    /// </summary>
+    void CopyFrom(array<double>^ x, array<double>^ y, array<double>^ z);
+
+    /// <summary>
+    /// Copies the coordinates into caller-owned arrays, growing them only when they are too small.
+    /// </summary>
+    /// <returns>The number of points written.</returns>
+    int CopyTo(array<double>^% x, array<double>^% y, array<double>^% z);
+
+    /// <summary>
+    /// Copies the points into a new array.
+    /// </summary>
+    array<Point3DValue>^ ToArray();
+
+    /// <summary>
+    /// Translates every point by the same offset.
+    /// </summary>
+    /// <param name="offset">The displacement.</param>
+    /// <param name="result">Receives the translated points; may be this buffer.</param>
+    void Translate(Vector3DValue offset, PointBuffer^ result);
+
+    /// <summary>
+    /// Calculates the distance from every point to a single point.
+    /// </summary>
+    /// <param name="point">The reference point.</param>
+    /// <param name="distances">Receives one distance per point; grown when too small.</param>
+    void DistanceTo(Point3DValue point, array<double>^% distances);
+
+    /// <summary>
+    /// Calculates the vectors from every point of this buffer to the matching point of another buffer.
+    /// </summary>
+    /// <param name="other">The end points; must have the same count.</param>
+    /// <param name="result">Receives other[i] - this[i].</param>
+    void VectorsTo(PointBuffer^ other, VectorBuffer^ result);
+
+  internal:
+    /// The native storage. Callers that hand it to native code must GC::KeepAlive the buffer after the call, or the
+    /// finalizer may free it while the native code still runs.
+    property Native::SoaBuffer* Storage
+    {
+      Native::SoaBuffer* get();
+    }
+  };
+}
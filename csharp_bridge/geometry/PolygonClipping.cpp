@@ -0,0 +1,74 @@
+#include "PolygonClipping.h"
+#include "PointBuffer.h"
+
+#include "../native/PolygonClipping.h"
+#include "../native/SoaBuffer.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace CwAPI3D::Net::Bridge
+{
+  int PolygonClipping::Clip(PointBuffer^ vertices, array<int>^ offsets, Plane3DValue plane, PointBuffer^ result,
+    array<int>^% resultOffsets)
+  {
+    return Clip(vertices, offsets, gcnew array<Plane3DValue>{ plane }, result, resultOffsets);
+  }
+
+  int PolygonClipping::Clip(PointBuffer^ vertices, array<int>^ offsets, array<Plane3DValue>^ planes, PointBuffer^ result,
+    array<int>^% resultOffsets)
+  {
+    constexpr double epsilon = 1e-10;
+    return Clip(vertices, offsets, planes, epsilon, result, resultOffsets);
+  }
+
+  int PolygonClipping::Clip(PointBuffer^ vertices, array<int>^ offsets, array<Plane3DValue>^ planes, double epsilon,
+    PointBuffer^ result, array<int>^% resultOffsets)
+  {
+    if (vertices == nullptr)
+      throw gcnew System::ArgumentNullException("vertices");
+    if (offsets == nullptr)
+      throw gcnew System::ArgumentNullException("offsets");
+    if (planes == nullptr)
+      throw gcnew System::ArgumentNullException("planes");
+    if (result == nullptr)
+      throw gcnew System::ArgumentNullException("result");
+    if (result == vertices)
+      throw gcnew System::ArgumentException("The result buffer must not be the input buffer.", "result");
+    if (offsets->Length == 0)
+      throw gcnew System::ArgumentException("Offsets must end with the total vertex count.", "offsets");
+    if (epsilon < 0.0)
+      throw gcnew System::ArgumentOutOfRangeException("epsilon", "Epsilon must not be negative.");
+
+    Native::SoaBuffer* source = vertices->Storage;
+    const long long vertexCount = static_cast<long long>(source->size());
+    int previous = 0;
+    for (int k = 0; k < offsets->Length; ++k)
+    {
+      const int offset = offsets[k];
+      if (offset < previous || offset > vertexCount)
+        throw gcnew System::ArgumentException("Offsets must be ascending and within the vertex count.", "offsets");
+      previous = offset;
+    }
+
+    if (resultOffsets == nullptr || resultOffsets->Length < offsets->Length)
+      resultOffsets = gcnew array<int>(offsets->Length);
+
+    // Plane3DValue also stores its reference point, so the coefficients are gathered into a compact array.
+    std::vector<Native::Kernels::PlaneCoefficients> coefficients;
+    coefficients.reserve(static_cast<size_t>(planes->Length));
+    for each (Plane3DValue plane in planes)
+    {
+      Vector3DValue normal = plane.Normal;
+      coefficients.push_back({ normal.X, normal.Y, normal.Z, plane.D });
+    }
+
+    pin_ptr<int> polygonOffsets = &offsets[0];
+    pin_ptr<int> clippedOffsets = &resultOffsets[0];
+    size_t kept = Native::Kernels::clipPolygons(source->view(), polygonOffsets, static_cast<size_t>(offsets->Length - 1),
+      coefficients.data(), coefficients.size(), epsilon, *result->Storage, clippedOffsets);
+    System::GC::KeepAlive(vertices);
+    System::GC::KeepAlive(result);
+    return static_cast<int>(kept);
+  }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Plane3DValue.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class PointBuffer;
+
+  /// <summary>
+  /// Clips whole sets of planar polygons against planes in a single native call (Sutherland-Hodgman).
+  /// Polygons are stored flat: polygon k is the vertices offsets[k] to offsets[k + 1] - 1 of one PointBuffer, so
+  /// thousands of panel outlines are clipped without allocating an object per vertex.
+  /// </summary>
+  /// <remarks>
+  /// Each polygon keeps the part on the front side of every plane, the side its normal points to; to keep the back
+  /// side, flip the plane. Clipping against several planes keeps the part inside the convex region they bound.
+  /// The result has one polygon per input polygon, in the same order; polygons clipped away are empty.
+  /// </remarks>
+  public ref class PolygonClipping abstract sealed
+  {
+  public:
+    /// <summary>
+    /// Clips every polygon against one plane.
+    /// </summary>
+    /// <param name="vertices">The vertices of all polygons.</param>
+    /// <param name="offsets">The index of each polygon's first vertex, followed by the total vertex count.</param>
+    /// <param name="plane">The plane to clip against.</param>
+    /// <param name="result">Receives the vertices of the clipped polygons.</param>
+    /// <param name="resultOffsets">Receives offsets->Length offsets into result; grown when too small.</param>
+    /// <returns>The number of polygons that are not empty after clipping.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when the offsets are not ascending or exceed the vertex count.</exception>
+    static int Clip(PointBuffer^ vertices, array<int>^ offsets, Plane3DValue plane, PointBuffer^ result,
+      array<int>^% resultOffsets);
+
+    /// <summary>
+    /// Clips every polygon against a convex set of planes.
+    /// </summary>
+    /// <param name="vertices">The vertices of all polygons.</param>
+    /// <param name="offsets">The index of each polygon's first vertex, followed by the total vertex count.</param>
+    /// <param name="planes">The planes to clip against.</param>
+    /// <param name="result">Receives the vertices of the clipped polygons.</param>
+    /// <param name="resultOffsets">Receives offsets->Length offsets into result; grown when too small.</param>
+    /// <returns>The number of polygons that are not empty after clipping.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when the offsets are not ascending or exceed the vertex count.</exception>
+    static int Clip(PointBuffer^ vertices, array<int>^ offsets, array<Plane3DValue>^ planes, PointBuffer^ result,
+      array<int>^% resultOffsets);
+
+    /// <summary>
+    /// Clips every polygon against a convex set of planes with the specified tolerance.
+    /// </summary>
+    /// <param name="vertices">The vertices of all polygons.</param>
+    /// <param name="offsets">The index of each polygon's first vertex, followed by the total vertex count.</param>
+    /// <param name="planes">The planes to clip against.</param>
+    /// <param name="epsilon">Vertices closer to a plane than this count as on it and are kept unchanged.</param>
+    /// <param name="result">Receives the vertices of the clipped polygons.</param>
+    /// <param name="resultOffsets">Receives offsets->Length offsets into result; grown when too small.</param>
+    /// <returns>The number of polygons that are not empty after clipping.</returns>
+    /// <exception cref="System::ArgumentException">Thrown when the offsets are not ascending or exceed the vertex count.</exception>
+    static int Clip(PointBuffer^ vertices, array<int>^ offsets, array<Plane3DValue>^ planes, double epsilon,
+      PointBuffer^ result, array<int>^% resultOffsets);
+  };
+}
@@ -0,0 +1,70 @@
+#include "SegmentPlaneIntersection.h"
+#include "PointBuffer.h"
+
+#include "../native/SoaBuffer.h"
+#include "../native/SoaKernels.h"
+
+#include <vector>
+
+namespace CwAPI3D::Net::Bridge
+{
+  int SegmentPlaneIntersection::Intersect(PointBuffer^ starts, PointBuffer^ ends, Plane3DValue plane, array<bool>^% hits, PointBuffer^ points)
+  {
+    return Intersect(starts, ends, plane, hits, points, false);
+  }
+
+  int SegmentPlaneIntersection::Intersect(PointBuffer^ starts, PointBuffer^ ends, Plane3DValue plane, array<bool>^% hits, PointBuffer^ points, bool parallel)
+  {
+    return Intersect(starts, ends, gcnew array<Plane3DValue>{ plane }, hits, points, parallel);
+  }
+
+  int SegmentPlaneIntersection::Intersect(PointBuffer^ starts, PointBuffer^ ends, array<Plane3DValue>^ planes, array<bool>^% hits, PointBuffer^ points, bool parallel)
+  {
+    if (starts == nullptr)
+      throw gcnew System::ArgumentNullException("starts");
+    if (ends == nullptr)
+      throw gcnew System::ArgumentNullException("ends");
+    if (planes == nullptr)
+      throw gcnew System::ArgumentNullException("planes");
+    if (points == nullptr)
+      throw gcnew System::ArgumentNullException("points");
+    if (points == starts || points == ends)
+      throw gcnew System::ArgumentException("The result buffer must not be one of the input buffers.", "points");
+
+    Native::SoaBuffer* startBuffer = starts->Storage;
+    Native::SoaBuffer* endBuffer = ends->Storage;
+    if (startBuffer->size() != endBuffer->size())
+      throw gcnew System::ArgumentException("Start and end buffers must have the same count.", "ends");
+
+    const long long total = static_cast<long long>(startBuffer->size()) * planes->Length;
+    if (total > System::Int32::MaxValue)
+      throw gcnew System::ArgumentException("Too many segment-plane pairs for a single call.", "planes");
+
+    const int count = static_cast<int>(total);
+    if (hits == nullptr || hits->Length < count)
+      hits = gcnew array<bool>(count);
+
+    Native::SoaBuffer* target = points->Storage;
+    target->resize(static_cast<size_t>(count));
+    if (count == 0)
+      return 0;
+
+    // Plane3DValue also stores its reference point, so the coefficients are gathered into a compact array.
+    std::vector<Native::Kernels::PlaneCoefficients> coefficients;
+    coefficients.reserve(static_cast<size_t>(planes->Length));
+    for each (Plane3DValue plane in planes)
+    {
+      Vector3DValue normal = plane.Normal;
+      coefficients.push_back({ normal.X, normal.Y, normal.Z, plane.D });
+    }
+
+    constexpr double epsilon = 1e-10;
+    pin_ptr<bool> hitFlags = &hits[0];
+    size_t hitCount = Native::Kernels::intersectSegmentsPlanes(startBuffer->view(), endBuffer->view(),
+      coefficients.data(), coefficients.size(), epsilon, hitFlags, target->view(), parallel);
+    System::GC::KeepAlive(starts);
+    System::GC::KeepAlive(ends);
+    System::GC::KeepAlive(points);
+    return static_cast<int>(hitCount);
+  }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Plane3DValue.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class PointBuffer;
+
+  /// <summary>
+  /// Intersects whole sets of line segments with planes in a single native call.
+  /// Segment i runs from starts[i] to ends[i]. The rules match Plane3D::IntersectLine, except that a zero-length
+  /// segment is reported as a miss instead of throwing.
+  /// </summary>
+  public ref class SegmentPlaneIntersection abstract sealed
+  {
+  public:
+    /// <summary>
+    /// Intersects every segment with one plane.
+    /// </summary>
+    /// <param name="starts">The segment start points.</param>
+    /// <param name="ends">The segment end points; must have the same count as starts.</param>
+    /// <param name="plane">The plane to intersect with.</param>
+    /// <param name="hits">Receives one flag per segment; grown when too small.</param>
+    /// <param name="points">Receives one point per segment: the intersection on a hit, the origin otherwise.</param>
+    /// <returns>The number of segments that hit the plane.</returns>
+    static int Intersect(PointBuffer^ starts, PointBuffer^ ends, Plane3DValue plane, array<bool>^% hits, PointBuffer^ points);
+
+    /// <summary>
+    /// Intersects every segment with one plane, optionally splitting large inputs across all cores.
+    /// </summary>
+    /// <param name="starts">The segment start points.</param>
+    /// <param name="ends">The segment end points; must have the same count as starts.</param>
+    /// <param name="plane">The plane to intersect with.</param>
+    /// <param name="hits">Receives one flag per segment; grown when too small.</param>
+    /// <param name="points">Receives one point per segment: the intersection on a hit, the origin otherwise.</param>
+    /// <param name="parallel">true to process large inputs on multiple threads.</param>
+    /// <returns>The number of segments that hit the plane.</returns>
+    static int Intersect(PointBuffer^ starts, PointBuffer^ ends, Plane3DValue plane, array<bool>^% hits, PointBuffer^ points, bool parallel);
+
+    /// <summary>
+    /// Intersects every segment with each of several planes.
+    /// Results are grouped by plane: the entry for plane k and segment i is at index k * starts->Count + i.
+    /// </summary>
+    /// <param name="starts">The segment start points.</param>
+    /// <param name="ends">The segment end points; must have the same count as starts.</param>
+    /// <param name="planes">The planes to intersect with.</param>
+    /// <param name="hits">Receives planes->Length * starts->Count flags; grown when too small.</param>
+    /// <param name="points">Receives planes->Length * starts->Count points.</param>
+    /// <param name="parallel">true to process large inputs on multiple threads.</param>
+    /// <returns>The total number of hits over all planes.</returns>
+    static int Intersect(PointBuffer^ starts, PointBuffer^ ends, array<Plane3DValue>^ planes, array<bool>^% hits, PointBuffer^ points, bool parallel);
+  };
+}
@@ -0,0 +1,178 @@
+#include "SpatialPointHash.h"
+#include "CoreConversions.h"
+#include "PointBuffer.h"
+
+#include "../native/SoaBuffer.h"
+#include "../native/SpatialHash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+
+  void CheckTolerance(double tolerance)
+  {
+    if (!(tolerance > 0.0) || !std::isfinite(tolerance))
+      throw gcnew System::ArgumentOutOfRangeException("tolerance", "Tolerance must be positive and finite.");
+  }
+
+  int WeldInto(Native::SpatialHash& hash, PointBuffer^ points, array<int>^% indices)
+  {
+    if (points == nullptr)
+      throw gcnew System::ArgumentNullException("points");
+
+    Native::SoaBuffer* source = points->Storage;
+    const int count = static_cast<int>(source->size());
+    if (indices == nullptr || indices->Length < count)
+      indices = gcnew array<int>(count);
+    if (count == 0)
+      return 0;
+
+    pin_ptr<int> out = &indices[0];
+    const size_t unique = hash.weld(source->view(), out);
+    System::GC::KeepAlive(points);
+    return static_cast<int>(unique);
+  }
+
+  void CopyPoints(const Native::SpatialHash& hash, PointBuffer^ result)
+  {
+    if (result == nullptr)
+      throw gcnew System::ArgumentNullException("result");
+
+    const Native::ConstSoaView points = hash.points();
+    Native::SoaBuffer* target = result->Storage;
+    target->resize(points.count);
+    std::copy(points.x, points.x + points.count, target->x());
+    std::copy(points.y, points.y + points.count, target->y());
+    std::copy(points.z, points.z + points.count, target->z());
+    System::GC::KeepAlive(result);
+  }
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  using Detail::ToCore;
+
+  SpatialPointHash::SpatialPointHash(double tolerance)
+  {
+    CheckTolerance(tolerance);
+    m_hash = new Native::SpatialHash(tolerance);
+  }
+
+  int SpatialPointHash::Weld(PointBuffer^ points, double tolerance, array<int>^% indices, PointBuffer^ unique)
+  {
+    CheckTolerance(tolerance);
+    if (unique == nullptr)
+      throw gcnew System::ArgumentNullException("unique");
+    if (unique == points)
+      throw gcnew System::ArgumentException("The result buffer must not be the input buffer.", "unique");
+
+    Native::SpatialHash hash(tolerance);
+    const int count = WeldInto(hash, points, indices);
+    CopyPoints(hash, unique);
+    return count;
+  }
+
+  SpatialPointHash::~SpatialPointHash()
+  {
+    this->!SpatialPointHash();
+  }
+
+  SpatialPointHash::!SpatialPointHash()
+  {
+    delete m_hash;
+    m_hash = nullptr;
+  }
+
+  void SpatialPointHash::ThrowIfDisposed()
+  {
+    if (!m_hash)
+      throw gcnew System::ObjectDisposedException("SpatialPointHash");
+  }
+
+  double SpatialPointHash::Tolerance::get()
+  {
+    ThrowIfDisposed();
+    return m_hash->tolerance();
+  }
+
+  int SpatialPointHash::Count::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_hash->size());
+  }
+
+  long long SpatialPointHash::MemoryBytes::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<long long>(m_hash->memoryBytes());
+  }
+
+  Point3DValue SpatialPointHash::GetPoint(int index)
+  {
+    ThrowIfDisposed();
+    if (index < 0 || index >= static_cast<int>(m_hash->size()))
+      throw gcnew System::ArgumentOutOfRangeException("index");
+
+    const Native::ConstSoaView points = m_hash->points();
+    Point3DValue point(points.x[index], points.y[index], points.z[index]);
+    System::GC::KeepAlive(this);
+    return point;
+  }
+
+  void SpatialPointHash::CopyPointsTo(PointBuffer^ result)
+  {
+    ThrowIfDisposed();
+    CopyPoints(*m_hash, result);
+    System::GC::KeepAlive(this);
+  }
+
+  void SpatialPointHash::Add(PointBuffer^ points)
+  {
+    ThrowIfDisposed();
+    if (points == nullptr)
+      throw gcnew System::ArgumentNullException("points");
+
+    m_hash->insert(points->Storage->view());
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(points);
+  }
+
+  int SpatialPointHash::Weld(PointBuffer^ points, array<int>^% indices)
+  {
+    ThrowIfDisposed();
+    const int count = WeldInto(*m_hash, points, indices);
+    System::GC::KeepAlive(this);
+    return count;
+  }
+
+  int SpatialPointHash::Find(Point3DValue point)
+  {
+    ThrowIfDisposed();
+    const int index = m_hash->find(ToCore(point));
+    System::GC::KeepAlive(this);
+    return index;
+  }
+
+  array<int>^ SpatialPointHash::QueryRadius(Point3DValue center, double radius)
+  {
+    ThrowIfDisposed();
+    if (!(radius >= 0.0))
+      throw gcnew System::ArgumentOutOfRangeException("radius", "Radius must not be negative.");
+
+    std::vector<std::int32_t> ids;
+    m_hash->queryRadius(ToCore(center), radius, ids);
+    System::GC::KeepAlive(this);
+    auto result = gcnew array<int>(static_cast<int>(ids.size()));
+    if (!ids.empty())
+    {
+      pin_ptr<int> destination = &result[0];
+      std::copy(ids.begin(), ids.end(), static_cast<int*>(destination));
+    }
+    return result;
+  }
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Point3DValue.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace Native
+  {
+    class SpatialHash;
+  }
+
+  ref class PointBuffer;
+
+  /// <summary>
+  /// A hash grid over points, held in native memory, that finds points within a tolerance in constant time.
+  /// Use it to weld coincident points, e.g. to snap beam endpoints that meet, instead of a dictionary keyed by
+  /// Point3D: a hash code cannot be consistent with an equality that has a tolerance.
+  /// </summary>
+  /// <remarks>
+  /// Each stored point has an index, in the order the points were stored. Lookups only read the grid and may run
+  /// on any thread, concurrently; Add and Weld must not run concurrently with anything else. Dispose the grid to
+  /// release the native memory early.
+  /// </remarks>
+  public ref class SpatialPointHash sealed
+  {
+  private:
+    Native::SpatialHash* m_hash;
+
+    void ThrowIfDisposed();
+
+  public:
+    /// <summary>
+    /// Initializes a new, empty SpatialPointHash.
+    /// </summary>
+    /// <param name="tolerance">Points at most this far apart are the same point.</param>
+    /// <exception cref="System::ArgumentOutOfRangeException">Thrown when tolerance is not positive and finite.</exception>
+    explicit SpatialPointHash(double tolerance);
+
+    /// <summary>
+    /// Welds a buffer of points in one native call, without keeping the grid.
+    /// </summary>
+    /// <param name="points">The points to weld.</param>
+    /// <param name="tolerance">Points at most this far apart are welded.</param>
+    /// <param name="indices">Receives for each point the index of its welded point in unique; grown when too small.</param>
+    /// <param name="unique">Receives the welded points.</param>
+    /// <returns>The number of welded points.</returns>
+    /// <exception cref="System::ArgumentOutOfRangeException">Thrown when tolerance is not positive and finite.</exception>
+    static int Weld(PointBuffer^ points, double tolerance, array<int>^% indices, PointBuffer^ unique);
+
+    /// <summary>
+    /// Releases the native storage.
+    /// </summary>
+    ~SpatialPointHash();
+
+    /// <summary>
+    /// Finalizer. Releases the native storage if the grid was not disposed.
+    /// </summary>
+    !SpatialPointHash();
+
+    /// <summary>
+    /// Gets the distance within which points are the same point.
+    /// </summary>
+    property double Tolerance
+    {
+      double get();
+    }
+
+    /// <summary>
+    /// Gets the number of stored points.
+    /// </summary>
+    property int Count
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the number of bytes of native memory the grid uses.
+    /// </summary>
+    property long long MemoryBytes
+    {
+      long long get();
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether the native storage has been released.
+    /// </summary>
+    property bool IsDisposed
+    {
+      bool get() { return m_hash == nullptr; }
+    }
+
+    /// <summary>
+    /// Gets the stored point with the specified index.
+    /// </summary>
+    /// <param name="index">The index of the point.</param>
+    /// <returns>The point.</returns>
+    Point3DValue GetPoint(int index);
+
+    /// <summary>
+    /// Copies all stored points, in index order, into a buffer.
+    /// </summary>
+    /// <param name="result">Receives the points.</param>
+    void CopyPointsTo(PointBuffer^ result);
+
+    /// <summary>
+    /// Stores every point of a buffer, including points within the tolerance of ones already stored.
+    /// </summary>
+    /// <param name="points">The points to store.</param>
+    void Add(PointBuffer^ points);
+
+    /// <summary>
+    /// Maps every point of a buffer to the nearest stored point within the tolerance, storing the point when
+    /// there is none. Points are processed in order, so a chain of points each within the tolerance of the
+    /// next may map to more than one stored point.
+    /// </summary>
+    /// <param name="points">The points to weld.</param>
+    /// <param name="indices">Receives the index of the stored point for each point; grown when too small.</param>
+    /// <returns>The number of points this call stored.</returns>
+    int Weld(PointBuffer^ points, array<int>^% indices);
+
+    /// <summary>
+    /// Finds the stored point nearest to a point, within the tolerance.
+    /// </summary>
+    /// <param name="point">The point to look up.</param>
+    /// <returns>The index of the stored point, or -1 when none lies within the tolerance.</returns>
+    int Find(Point3DValue point);
+
+    /// <summary>
+    /// Finds all stored points within a radius of a point.
+    /// </summary>
+    /// <param name="center">The point to search around.</param>
+    /// <param name="radius">The largest distance to search.</param>
+    /// <returns>The indices of the points found, in no particular order.</returns>
+    array<int>^ QueryRadius(Point3DValue center, double radius);
+  };
+}
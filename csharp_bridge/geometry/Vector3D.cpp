@@ -1,10 +1,17 @@
 ﻿#include "Vector3D.h"
+#include "CoreConversions.h"
 #include "Point3D.h"
 
+#include "../diagnostics/BridgeCounters.h"
+
 #include <cmath>
 #include <CwAPI3DTypes.h>
 #include <stdexcept>
 
+namespace Core = CwAPI3D::Net::Bridge::Core;
+using CwAPI3D::Net::Bridge::Detail::ToCore;
+using CwAPI3D::Net::Bridge::Detail::ToVector3D;
+
 CwAPI3D::Net::Bridge::Vector3D^ CwAPI3D::Net::Bridge::Vector3D::FromPoints(Point3D^ from, Point3D^ to)
 {
   return gcnew Vector3D(
@@ -16,11 +23,13 @@ CwAPI3D::Net::Bridge::Vector3D^ CwAPI3D::Net::Bridge::Vector3D::FromPoints(Point
 
 CwAPI3D::Net::Bridge::Vector3D^ CwAPI3D::Net::Bridge::Vector3D::FromNative(const CwAPI3D::vector3D& vec)
 {
+  BridgeCounters::Add(Detail::Counter::VectorsToManaged, 1);
   return gcnew Vector3D(vec.mX, vec.mY, vec.mZ);
 }
 
 CwAPI3D::vector3D CwAPI3D::Net::Bridge::Vector3D::ToNative()
 {
+  BridgeCounters::Add(Detail::Counter::VectorsToNative, 1);
   CwAPI3D::vector3D result;
   result.mX = m_X;
   result.mY = m_Y;
@@ -50,8 +59,7 @@ CwAPI3D::Net::Bridge::Vector3D^ CwAPI3D::Net::Bridge::Vector3D::Multiply(double
 
 CwAPI3D::Net::Bridge::Vector3D^ CwAPI3D::Net::Bridge::Vector3D::Divide(double scalar)
 {
-  constexpr double epsilon = 1e-10;  // Small value for floating-point comparison
-  if (std::fabs(scalar) < epsilon)
+  if (Core::DefaultTolerance<double>::isZero(scalar))
     throw gcnew System::DivideByZeroException("Cannot divide by near-zero value.");
 
   return gcnew Vector3D(m_X / scalar, m_Y / scalar, m_Z / scalar);
@@ -59,51 +67,27 @@ CwAPI3D::Net::Bridge::Vector3D^ CwAPI3D::Net::Bridge::Vector3D::Divide(double sc
 
 double CwAPI3D::Net::Bridge::Vector3D::DotProduct(Vector3D^ other)
 {
-  return m_X * other->X + m_Y * other->Y + m_Z * other->Z;
+  return Core::dot(ToCore(this), ToCore(other));
 }
 
 CwAPI3D::Net::Bridge::Vector3D^ CwAPI3D::Net::Bridge::Vector3D::CrossProduct(Vector3D^ other)
 {
-  return gcnew Vector3D(
-    m_Y * other->Z - m_Z * other->Y,
-    m_Z * other->X - m_X * other->Z,
-    m_X * other->Y - m_Y * other->X
-  );
+  return ToVector3D(Core::cross(ToCore(this), ToCore(other)));
 }
 
 double CwAPI3D::Net::Bridge::Vector3D::Magnitude()
 {
-  return System::Math::Sqrt(m_X * m_X + m_Y * m_Y + m_Z * m_Z);
+  return Core::magnitude(ToCore(this));
 }
 
 CwAPI3D::Net::Bridge::Vector3D^ CwAPI3D::Net::Bridge::Vector3D::Normalize()
 {
-  double magnitude = Magnitude();
-  constexpr double epsilon = 1e-10;
-
-  if (std::fabs(magnitude) < epsilon)
-    return gcnew Vector3D(0.0, 0.0, 0.0);
-
-  return Divide(magnitude);
+  return ToVector3D(Core::normalize(ToCore(this)));
 }
 
 double CwAPI3D::Net::Bridge::Vector3D::AngleTo(Vector3D^ other)
 {
-  double magnitude1 = Magnitude();
-  double magnitude2 = other->Magnitude();
-  constexpr double epsilon = 1e-10;
-
-  if (std::fabs(magnitude1) < epsilon || std::fabs(magnitude2) < epsilon)
-    return 0.0;
-
-  double dotProduct = DotProduct(other);
-  double cosAngle = dotProduct / (magnitude1 * magnitude2);
-
-  // Clamp cosAngle to the valid range for acos
-  if (cosAngle > 1.0) cosAngle = 1.0;
-  if (cosAngle < -1.0) cosAngle = -1.0;
-
-  return System::Math::Acos(cosAngle);
+  return Core::angle(ToCore(this), ToCore(other));
 }
 
 CwAPI3D::Net::Bridge::Vector3D^ CwAPI3D::Net::Bridge::Vector3D::Negate()
@@ -116,12 +100,7 @@ bool CwAPI3D::Net::Bridge::Vector3D::Equals(System::Object^ obj)
   if (obj == nullptr || !obj->GetType()->Equals(Vector3D::typeid))
     return false;
 
-  Vector3D^ other = safe_cast<Vector3D^>(obj);
-  constexpr double epsilon = 1e-10;
-
-  return std::fabs(m_X - other->X) < epsilon &&
-    std::fabs(m_Y - other->Y) < epsilon &&
-    std::fabs(m_Z - other->Z) < epsilon;
+  return Core::approxEqual(ToCore(this), ToCore(safe_cast<Vector3D^>(obj)));
 }
 
 int CwAPI3D::Net::Bridge::Vector3D::GetHashCode()
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "../diagnostics/TraceScope.h"
+
 namespace CwAPI3D
 {
   struct vector3D;
@@ -51,7 +53,11 @@ namespace CwAPI3D::Net::Bridge
     /// <summary>
     /// Initializes a new instance of the Vector3D class with components (0, 0, 0).
     /// </summary>
-    Vector3D() : m_X(0.0), m_Y(0.0), m_Z(0.0) {}
+    Vector3D() : m_X(0.0), m_Y(0.0), m_Z(0.0)
+    {
+      BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+      Detail::TraceScope trace(Native::Trace::Point::Vector3D_Create);
+    }
 
     /// <summary>
     /// Initializes a new instance of the Vector3D class with the specified components.
@@ -59,13 +65,21 @@ namespace CwAPI3D::Net::Bridge
     /// <param name="x">The X component.</param>
     /// <param name="y">The Y component.</param>
     /// <param name="z">The Z component.</param>
-    Vector3D(double x, double y, double z) : m_X(x), m_Y(y), m_Z(z) {}
+    Vector3D(double x, double y, double z) : m_X(x), m_Y(y), m_Z(z)
+    {
+      BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+      Detail::TraceScope trace(Native::Trace::Point::Vector3D_Create_Coordinates);
+    }
 
     /// <summary>
     /// Copy constructor. Initializes a new instance of the Vector3D class with the values from another Vector3D.
     /// </summary>
     /// <param name="other">Another Vector3D object whose values are copied.</param>
-    Vector3D(Vector3D^ other) : m_X(other->X), m_Y(other->Y), m_Z(other->Z) {}
+    Vector3D(Vector3D^ other) : m_X(other->X), m_Y(other->Y), m_Z(other->Z)
+    {
+      BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+      Detail::TraceScope trace(Native::Trace::Point::Vector3D_Create_Copy);
+    }
 
     /// <summary>
     /// Creates a Vector3D from two points, representing the direction from the first point to the second.
@@ -0,0 +1,296 @@
+#include "Vector3DValue.h"
+#include "CoreConversions.h"
+#include "Point3DValue.h"
+#include "Vector3D.h"
+
+#include "../diagnostics/BridgeCounters.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <CwAPI3DTypes.h>
+
+// ToNative/FromNative reinterpret the value as a native vector3D, which is only valid while both are three packed doubles.
+static_assert(sizeof(CwAPI3D::vector3D) == 3 * sizeof(double), "vector3D must consist of exactly three doubles");
+static_assert(offsetof(CwAPI3D::vector3D, mX) == 0, "unexpected vector3D layout");
+static_assert(offsetof(CwAPI3D::vector3D, mY) == sizeof(double), "unexpected vector3D layout");
+static_assert(offsetof(CwAPI3D::vector3D, mZ) == 2 * sizeof(double), "unexpected vector3D layout");
+
+namespace CwAPI3D::Net::Bridge
+{
+  Vector3DValue Vector3DValue::FromPoints(Point3DValue from, Point3DValue to)
+  {
+    return Vector3DValue(to.X - from.X, to.Y - from.Y, to.Z - from.Z);
+  }
+
+  Vector3DValue Vector3DValue::FromNative(const CwAPI3D::vector3D& vec)
+  {
+    return *reinterpret_cast<const Vector3DValue*>(&vec);
+  }
+
+  CwAPI3D::vector3D Vector3DValue::ToNative()
+  {
+    Vector3DValue copy = *this;
+    return *reinterpret_cast<CwAPI3D::vector3D*>(&copy);
+  }
+
+  void Vector3DValue::CopyToNative(array<Vector3DValue>^ source, CwAPI3D::vector3D* destination)
+  {
+    if (source == nullptr)
+      throw gcnew System::ArgumentNullException("source");
+    if (source->Length == 0)
+      return;
+    if (!destination)
+      throw gcnew System::ArgumentNullException("destination");
+
+    BridgeCounters::Add(Detail::Counter::VectorsToNative, source->Length);
+    pin_ptr<Vector3DValue> pinned = &source[0];
+    std::memcpy(destination, pinned, static_cast<size_t>(source->Length) * sizeof(CwAPI3D::vector3D));
+  }
+
+  array<Vector3DValue>^ Vector3DValue::FromNative(const CwAPI3D::vector3D* source, int count)
+  {
+    if (count < 0)
+      throw gcnew System::ArgumentOutOfRangeException("count");
+
+    auto result = gcnew array<Vector3DValue>(count);
+    if (count == 0)
+      return result;
+    if (!source)
+      throw gcnew System::ArgumentNullException("source");
+
+    BridgeCounters::Add(Detail::Counter::VectorsToManaged, count);
+    pin_ptr<Vector3DValue> pinned = &result[0];
+    std::memcpy(pinned, source, static_cast<size_t>(count) * sizeof(CwAPI3D::vector3D));
+    return result;
+  }
+
+  Point3DValue Vector3DValue::ToPoint3D()
+  {
+    return Point3DValue(X, Y, Z);
+  }
+
+  Vector3DValue Vector3DValue::Add(Vector3DValue other)
+  {
+    return Vector3DValue(X + other.X, Y + other.Y, Z + other.Z);
+  }
+
+  Vector3DValue Vector3DValue::Subtract(Vector3DValue other)
+  {
+    return Vector3DValue(X - other.X, Y - other.Y, Z - other.Z);
+  }
+
+  Vector3DValue Vector3DValue::Multiply(double scalar)
+  {
+    return Vector3DValue(X * scalar, Y * scalar, Z * scalar);
+  }
+
+  Vector3DValue Vector3DValue::Divide(double scalar)
+  {
+    constexpr double epsilon = 1e-10;
+    if (std::fabs(scalar) < epsilon)
+      throw gcnew System::DivideByZeroException("Cannot divide by near-zero value.");
+
+    return Vector3DValue(X / scalar, Y / scalar, Z / scalar);
+  }
+
+  double Vector3DValue::DotProduct(Vector3DValue other)
+  {
+    return X * other.X + Y * other.Y + Z * other.Z;
+  }
+
+  Vector3DValue Vector3DValue::CrossProduct(Vector3DValue other)
+  {
+    return Detail::ToVector3DValue(Core::cross(Detail::ToCore(*this), Detail::ToCore(other)));
+  }
+
+  double Vector3DValue::Magnitude()
+  {
+    return Core::magnitude(Detail::ToCore(*this));
+  }
+
+  double Vector3DValue::MagnitudeSquared()
+  {
+    return Core::magnitudeSquared(Detail::ToCore(*this));
+  }
+
+  Vector3DValue Vector3DValue::Normalize()
+  {
+    Vector3DValue result = *this;
+    result.NormalizeInPlace();
+    return result;
+  }
+
+  double Vector3DValue::AngleTo(Vector3DValue other)
+  {
+    return Core::angle(Detail::ToCore(*this), Detail::ToCore(other));
+  }
+
+  Vector3DValue Vector3DValue::Negate()
+  {
+    return Vector3DValue(-X, -Y, -Z);
+  }
+
+  void Vector3DValue::AddInPlace(Vector3DValue% other)
+  {
+    X += other.X;
+    Y += other.Y;
+    Z += other.Z;
+  }
+
+  void Vector3DValue::SubtractInPlace(Vector3DValue% other)
+  {
+    X -= other.X;
+    Y -= other.Y;
+    Z -= other.Z;
+  }
+
+  void Vector3DValue::MultiplyInPlace(double scalar)
+  {
+    X *= scalar;
+    Y *= scalar;
+    Z *= scalar;
+  }
+
+  void Vector3DValue::NormalizeInPlace()
+  {
+    constexpr double epsilon = 1e-10;
+    double magnitude = Magnitude();
+
+    if (magnitude < epsilon)
+    {
+      X = 0.0;
+      Y = 0.0;
+      Z = 0.0;
+      return;
+    }
+
+    double inverse = 1.0 / magnitude;
+    X *= inverse;
+    Y *= inverse;
+    Z *= inverse;
+  }
+
+  void Vector3DValue::Add(Vector3DValue% left, Vector3DValue% right, Vector3DValue% result)
+  {
+    result.X = left.X + right.X;
+    result.Y = left.Y + right.Y;
+    result.Z = left.Z + right.Z;
+  }
+
+  void Vector3DValue::Subtract(Vector3DValue% left, Vector3DValue% right, Vector3DValue% result)
+  {
+    result.X = left.X - right.X;
+    result.Y = left.Y - right.Y;
+    result.Z = left.Z - right.Z;
+  }
+
+  void Vector3DValue::Multiply(Vector3DValue% vec, double scalar, Vector3DValue% result)
+  {
+    result.X = vec.X * scalar;
+    result.Y = vec.Y * scalar;
+    result.Z = vec.Z * scalar;
+  }
+
+  double Vector3DValue::DotProduct(Vector3DValue% left, Vector3DValue% right)
+  {
+    return left.X * right.X + left.Y * right.Y + left.Z * right.Z;
+  }
+
+  void Vector3DValue::CrossProduct(Vector3DValue% left, Vector3DValue% right, Vector3DValue% result)
+  {
+    // Read all inputs first so that result may alias left or right.
+    double x = left.Y * right.Z - left.Z * right.Y;
+    double y = left.Z * right.X - left.X * right.Z;
+    double z = left.X * right.Y - left.Y * right.X;
+    result.X = x;
+    result.Y = y;
+    result.Z = z;
+  }
+
+  void Vector3DValue::Normalize(Vector3DValue% vec, Vector3DValue% result)
+  {
+    result = vec;
+    result.NormalizeInPlace();
+  }
+
+  bool Vector3DValue::Equals(Vector3DValue other)
+  {
+    constexpr double epsilon = 1e-10;
+
+    return std::fabs(X - other.X) < epsilon &&
+      std::fabs(Y - other.Y) < epsilon &&
+      std::fabs(Z - other.Z) < epsilon;
+  }
+
+  bool Vector3DValue::Equals(System::Object^ obj)
+  {
+    if (obj == nullptr || !obj->GetType()->Equals(Vector3DValue::typeid))
+      return false;
+
+    return Equals(safe_cast<Vector3DValue>(obj));
+  }
+
+  int Vector3DValue::GetHashCode()
+  {
+    return X.GetHashCode() ^ Y.GetHashCode() ^ Z.GetHashCode();
+  }
+
+  System::String^ Vector3DValue::ToString()
+  {
+    return System::String::Format("({0}, {1}, {2})", X, Y, Z);
+  }
+
+  Vector3DValue::operator Vector3DValue(Vector3D^ vec)
+  {
+    if (vec == nullptr)
+      throw gcnew System::ArgumentNullException("vec");
+
+    return Vector3DValue(vec->X, vec->Y, vec->Z);
+  }
+
+  Vector3DValue::operator Vector3D^(Vector3DValue vec)
+  {
+    return gcnew Vector3D(vec.X, vec.Y, vec.Z);
+  }
+
+  Vector3DValue Vector3DValue::operator+(Vector3DValue v1, Vector3DValue v2)
+  {
+    return v1.Add(v2);
+  }
+
+  Vector3DValue Vector3DValue::operator-(Vector3DValue v1, Vector3DValue v2)
+  {
+    return v1.Subtract(v2);
+  }
+
+  Vector3DValue Vector3DValue::operator-(Vector3DValue v)
+  {
+    return v.Negate();
+  }
+
+  Vector3DValue Vector3DValue::operator*(Vector3DValue v, double scalar)
+  {
+    return v.Multiply(scalar);
+  }
+
+  Vector3DValue Vector3DValue::operator*(double scalar, Vector3DValue v)
+  {
+    return v.Multiply(scalar);
+  }
+
+  Vector3DValue Vector3DValue::operator/(Vector3DValue v, double scalar)
+  {
+    return v.Divide(scalar);
+  }
+
+  bool Vector3DValue::operator==(Vector3DValue v1, Vector3DValue v2)
+  {
+    return v1.Equals(v2);
+  }
+
+  bool Vector3DValue::operator!=(Vector3DValue v1, Vector3DValue v2)
+  {
+    return !v1.Equals(v2);
+  }
+}
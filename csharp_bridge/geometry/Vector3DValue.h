@@ -0,0 +1,306 @@
+#pragma once
+
+namespace CwAPI3D
+{
+  struct vector3D;
+}
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class Vector3D;
+  value struct Point3DValue;
+
+  /// <summary>
+  /// Allocation-free counterpart of Vector3D.
+  /// The layout matches the native CwAPI3D::vector3D (three consecutive doubles), so values and arrays
+  /// can be handed to native code without copying field by field.
+  /// </summary>
+  [System::Runtime::InteropServices::StructLayout(System::Runtime::InteropServices::LayoutKind::Sequential)]
+  public value struct Vector3DValue
+  {
+    /// <summary>
+    /// The X component of the vector.
+    /// </summary>
+    double X;
+
+    /// <summary>
+    /// The Y component of the vector.
+    /// </summary>
+    double Y;
+
+    /// <summary>
+    /// The Z component of the vector.
+    /// </summary>
+    double Z;
+
+    /// <summary>
+    /// Initializes a new Vector3DValue with the specified components.
+    /// </summary>
+    /// <param name="x">The X component.</param>
+    /// <param name="y">The Y component.</param>
+    /// <param name="z">The Z component.</param>
+    Vector3DValue(double x, double y, double z) : X(x), Y(y), Z(z) {}
+
+    /// <summary>
+    /// Creates the vector pointing from one point to another.
+    /// </summary>
+    /// <param name="from">The starting point.</param>
+    /// <param name="to">The ending point.</param>
+    /// <returns>The vector from the first point to the second.</returns>
+    static Vector3DValue FromPoints(Point3DValue from, Point3DValue to);
+
+    /// <summary>
+    /// Reinterprets a native vector3D as a Vector3DValue.
+    /// </summary>
+    /// <param name="vec">The native vector3D structure.</param>
+    /// <returns>The vector with the same components.</returns>
+    static Vector3DValue FromNative(const CwAPI3D::vector3D& vec);
+
+    /// <summary>
+    /// Reinterprets this vector as a native vector3D.
+    /// </summary>
+    /// <returns>A native vector3D structure.</returns>
+    CwAPI3D::vector3D ToNative();
+
+    /// <summary>
+    /// Copies an array of vectors into native memory with a single block copy.
+    /// </summary>
+    /// <param name="source">The vectors to copy.</param>
+    /// <param name="destination">Native storage for at least source->Length vectors.</param>
+    static void CopyToNative(array<Vector3DValue>^ source, CwAPI3D::vector3D* destination);
+
+    /// <summary>
+    /// Copies native vectors into a new managed array with a single block copy.
+    /// </summary>
+    /// <param name="source">The native vectors.</param>
+    /// <param name="count">The number of vectors to copy.</param>
+    /// <returns>A new array holding the vectors.</returns>
+    static array<Vector3DValue>^ FromNative(const CwAPI3D::vector3D* source, int count);
+
+    /// <summary>
+    /// Converts this vector to a point with the same coordinates.
+    /// </summary>
+    /// <returns>A Point3DValue with the same coordinate values.</returns>
+    Point3DValue ToPoint3D();
+
+    /// <summary>
+    /// Adds another vector to this vector.
+    /// </summary>
+    /// <param name="other">The vector to add.</param>
+    /// <returns>The sum.</returns>
+    Vector3DValue Add(Vector3DValue other);
+
+    /// <summary>
+    /// Subtracts another vector from this vector.
+    /// </summary>
+    /// <param name="other">The vector to subtract.</param>
+    /// <returns>The difference.</returns>
+    Vector3DValue Subtract(Vector3DValue other);
+
+    /// <summary>
+    /// Multiplies this vector by a scalar value.
+    /// </summary>
+    /// <param name="scalar">The scalar value to multiply by.</param>
+    /// <returns>The product.</returns>
+    Vector3DValue Multiply(double scalar);
+
+    /// <summary>
+    /// Divides this vector by a scalar value.
+    /// </summary>
+    /// <param name="scalar">The scalar value to divide by.</param>
+    /// <returns>The quotient.</returns>
+    /// <exception cref="System::DivideByZeroException">Thrown when scalar is zero.</exception>
+    Vector3DValue Divide(double scalar);
+
+    /// <summary>
+    /// Calculates the dot product of this vector and another vector.
+    /// </summary>
+    /// <param name="other">The other vector.</param>
+    /// <returns>The dot product.</returns>
+    double DotProduct(Vector3DValue other);
+
+    /// <summary>
+    /// Calculates the cross product of this vector and another vector.
+    /// </summary>
+    /// <param name="other">The other vector.</param>
+    /// <returns>The cross product.</returns>
+    Vector3DValue CrossProduct(Vector3DValue other);
+
+    /// <summary>
+    /// Calculates the magnitude (length) of this vector.
+    /// </summary>
+    /// <returns>The magnitude of the vector.</returns>
+    double Magnitude();
+
+    /// <summary>
+    /// Calculates the squared magnitude of this vector, avoiding the square root.
+    /// </summary>
+    /// <returns>The squared magnitude of the vector.</returns>
+    double MagnitudeSquared();
+
+    /// <summary>
+    /// Returns a normalized version of this vector (with magnitude 1), or the zero vector if this vector has no length.
+    /// </summary>
+    /// <returns>The normalized vector.</returns>
+    Vector3DValue Normalize();
+
+    /// <summary>
+    /// Calculates the angle between this vector and another vector in radians.
+    /// </summary>
+    /// <param name="other">The other vector.</param>
+    /// <returns>The angle in radians.</returns>
+    double AngleTo(Vector3DValue other);
+
+    /// <summary>
+    /// Creates the opposite direction vector.
+    /// </summary>
+    /// <returns>The vector pointing in the opposite direction.</returns>
+    Vector3DValue Negate();
+
+    /// <summary>
+    /// Adds another vector to this vector in place.
+    /// </summary>
+    /// <param name="other">The vector to add.</param>
+    void AddInPlace(Vector3DValue% other);
+
+    /// <summary>
+    /// Subtracts another vector from this vector in place.
+    /// </summary>
+    /// <param name="other">The vector to subtract.</param>
+    void SubtractInPlace(Vector3DValue% other);
+
+    /// <summary>
+    /// Multiplies this vector by a scalar value in place.
+    /// </summary>
+    /// <param name="scalar">The scalar value to multiply by.</param>
+    void MultiplyInPlace(double scalar);
+
+    /// <summary>
+    /// Normalizes this vector in place. A zero-length vector is left as the zero vector.
+    /// </summary>
+    void NormalizeInPlace();
+
+    /// <summary>
+    /// Adds two vectors passed by reference.
+    /// </summary>
+    /// <param name="left">The first vector.</param>
+    /// <param name="right">The second vector.</param>
+    /// <param name="result">When this method returns, contains the sum.</param>
+    static void Add(Vector3DValue% left, Vector3DValue% right, [System::Runtime::InteropServices::Out] Vector3DValue% result);
+
+    /// <summary>
+    /// Subtracts two vectors passed by reference.
+    /// </summary>
+    /// <param name="left">The vector to subtract from.</param>
+    /// <param name="right">The vector to subtract.</param>
+    /// <param name="result">When this method returns, contains the difference.</param>
+    static void Subtract(Vector3DValue% left, Vector3DValue% right, [System::Runtime::InteropServices::Out] Vector3DValue% result);
+
+    /// <summary>
+    /// Multiplies a vector passed by reference by a scalar value.
+    /// </summary>
+    /// <param name="vec">The vector.</param>
+    /// <param name="scalar">The scalar value to multiply by.</param>
+    /// <param name="result">When this method returns, contains the product.</param>
+    static void Multiply(Vector3DValue% vec, double scalar, [System::Runtime::InteropServices::Out] Vector3DValue% result);
+
+    /// <summary>
+    /// Calculates the dot product of two vectors passed by reference.
+    /// </summary>
+    /// <param name="left">The first vector.</param>
+    /// <param name="right">The second vector.</param>
+    /// <returns>The dot product.</returns>
+    static double DotProduct(Vector3DValue% left, Vector3DValue% right);
+
+    /// <summary>
+    /// Calculates the cross product of two vectors passed by reference.
+    /// </summary>
+    /// <param name="left">The first vector.</param>
+    /// <param name="right">The second vector.</param>
+    /// <param name="result">When this method returns, contains the cross product.</param>
+    static void CrossProduct(Vector3DValue% left, Vector3DValue% right, [System::Runtime::InteropServices::Out] Vector3DValue% result);
+
+    /// <summary>
+    /// Normalizes a vector passed by reference.
+    /// </summary>
+    /// <param name="vec">The vector to normalize.</param>
+    /// <param name="result">When this method returns, contains the normalized vector.</param>
+    static void Normalize(Vector3DValue% vec, [System::Runtime::InteropServices::Out] Vector3DValue% result);
+
+    /// <summary>
+    /// Determines whether this vector is equal to another vector within 1e-10 per component.
+    /// </summary>
+    /// <param name="other">The vector to compare with.</param>
+    /// <returns>true if the vectors are equal; otherwise, false.</returns>
+    bool Equals(Vector3DValue other);
+
+    /// <summary>
+    /// Determines whether this vector is equal to another object.
+    /// </summary>
+    /// <param name="obj">The object to compare with.</param>
+    /// <returns>true if obj is an equal Vector3DValue; otherwise, false.</returns>
+    bool Equals(System::Object^ obj) override;
+
+    /// <summary>
+    /// Returns a hash code for this vector.
+    /// </summary>
+    /// <returns>A hash code for the current Vector3DValue.</returns>
+    int GetHashCode() override;
+
+    /// <summary>
+    /// Returns a string representation of this vector.
+    /// </summary>
+    /// <returns>A string representation of the vector.</returns>
+    System::String^ ToString() override;
+
+    /// <summary>
+    /// Implicit conversion from the reference type Vector3D.
+    /// </summary>
+    static operator Vector3DValue(Vector3D^ vec);
+
+    /// <summary>
+    /// Explicit conversion to the reference type Vector3D. Allocates a new object.
+    /// </summary>
+    explicit static operator Vector3D^(Vector3DValue vec);
+
+    /// <summary>
+    /// Operator overload for addition.
+    /// </summary>
+    static Vector3DValue operator+(Vector3DValue v1, Vector3DValue v2);
+
+    /// <summary>
+    /// Operator overload for subtraction.
+    /// </summary>
+    static Vector3DValue operator-(Vector3DValue v1, Vector3DValue v2);
+
+    /// <summary>
+    /// Operator overload for negation.
+    /// </summary>
+    static Vector3DValue operator-(Vector3DValue v);
+
+    /// <summary>
+    /// Operator overload for multiplication by scalar.
+    /// </summary>
+    static Vector3DValue operator*(Vector3DValue v, double scalar);
+
+    /// <summary>
+    /// Operator overload for multiplication by scalar (scalar first).
+    /// </summary>
+    static Vector3DValue operator*(double scalar, Vector3DValue v);
+
+    /// <summary>
+    /// Operator overload for division by scalar.
+    /// </summary>
+    static Vector3DValue operator/(Vector3DValue v, double scalar);
+
+    /// <summary>
+    /// Operator overload for equality.
+    /// </summary>
+    static bool operator==(Vector3DValue v1, Vector3DValue v2);
+
+    /// <summary>
+    /// Operator overload for inequality.
+    /// </summary>
+    static bool operator!=(Vector3DValue v1, Vector3DValue v2);
+  };
+}
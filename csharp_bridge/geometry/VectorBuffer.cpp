@@ -0,0 +1,302 @@
+#include "VectorBuffer.h"
+
+#include "../diagnostics/TraceScope.h"
+
+#include "../native/SoaBuffer.h"
+#include "../native/SoaKernels.h"
+
+#include <cstring>
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace
+  {
+    void EnsureLength(array<double>^% values, int count)
+    {
+      if (values == nullptr || values->Length < count)
+        values = gcnew array<double>(count);
+    }
+  }
+
+  VectorBuffer::VectorBuffer()
+  {
+    BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+    Detail::TraceScope trace(Native::Trace::Point::VectorBuffer_Create);
+    m_buffer = new Native::SoaBuffer();
+  }
+
+  VectorBuffer::VectorBuffer(int capacity)
+  {
+    BridgeCounters::Add(Detail::Counter::GeometryObjects, 1);
+    Detail::TraceScope trace(Native::Trace::Point::VectorBuffer_Create_Capacity);
+    if (capacity < 0)
+      throw gcnew System::ArgumentOutOfRangeException("capacity");
+
+    m_buffer = new Native::SoaBuffer(static_cast<size_t>(capacity));
+  }
+
+  VectorBuffer^ VectorBuffer::FromArray(array<Vector3DValue>^ vectors)
+  {
+    if (vectors == nullptr)
+      throw gcnew System::ArgumentNullException("vectors");
+
+    auto result = gcnew VectorBuffer(vectors->Length);
+    Native::SoaBuffer* buffer = result->m_buffer;
+    buffer->resize(static_cast<size_t>(vectors->Length));
+
+    double* x = buffer->x();
+    double* y = buffer->y();
+    double* z = buffer->z();
+    for (int i = 0; i < vectors->Length; ++i)
+    {
+      x[i] = vectors[i].X;
+      y[i] = vectors[i].Y;
+      z[i] = vectors[i].Z;
+    }
+    return result;
+  }
+
+  VectorBuffer::~VectorBuffer()
+  {
+    this->!VectorBuffer();
+  }
+
+  VectorBuffer::!VectorBuffer()
+  {
+    delete m_buffer;
+    m_buffer = nullptr;
+  }
+
+  void VectorBuffer::ThrowIfDisposed()
+  {
+    if (!m_buffer)
+      throw gcnew System::ObjectDisposedException("VectorBuffer");
+  }
+
+  int VectorBuffer::Count::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_buffer->size());
+  }
+
+  int VectorBuffer::Capacity::get()
+  {
+    ThrowIfDisposed();
+    return static_cast<int>(m_buffer->capacity());
+  }
+
+  Vector3DValue VectorBuffer::default::get(int index)
+  {
+    ThrowIfDisposed();
+    if (index < 0 || static_cast<size_t>(index) >= m_buffer->size())
+      throw gcnew System::ArgumentOutOfRangeException("index");
+
+    return Vector3DValue(m_buffer->x()[index], m_buffer->y()[index], m_buffer->z()[index]);
+  }
+
+  void VectorBuffer::default::set(int index, Vector3DValue value)
+  {
+    ThrowIfDisposed();
+    if (index < 0 || static_cast<size_t>(index) >= m_buffer->size())
+      throw gcnew System::ArgumentOutOfRangeException("index");
+
+    m_buffer->x()[index] = value.X;
+    m_buffer->y()[index] = value.Y;
+    m_buffer->z()[index] = value.Z;
+  }
+
+  void VectorBuffer::Add(double x, double y, double z)
+  {
+    ThrowIfDisposed();
+    m_buffer->push_back(x, y, z);
+  }
+
+  void VectorBuffer::Add(Vector3DValue vector)
+  {
+    Add(vector.X, vector.Y, vector.Z);
+  }
+
+  void VectorBuffer::Clear()
+  {
+    ThrowIfDisposed();
+    m_buffer->clear();
+  }
+
+  void VectorBuffer::Reserve(int capacity)
+  {
+    ThrowIfDisposed();
+    if (capacity < 0)
+      throw gcnew System::ArgumentOutOfRangeException("capacity");
+
+    m_buffer->reserve(static_cast<size_t>(capacity));
+  }
+
+  void VectorBuffer::Resize(int count)
+  {
+    ThrowIfDisposed();
+    if (count < 0)
+      throw gcnew System::ArgumentOutOfRangeException("count");
+
+    m_buffer->resize(static_cast<size_t>(count));
+  }
+
+  void VectorBuffer::CopyFrom(array<double>^ x, array<double>^ y, array<double>^ z)
+  {
+    ThrowIfDisposed();
+    if (x == nullptr)
+      throw gcnew System::ArgumentNullException("x");
+    if (y == nullptr)
+      throw gcnew System::ArgumentNullException("y");
+    if (z == nullptr)
+      throw gcnew System::ArgumentNullException("z");
+    if (x->Length != y->Length || x->Length != z->Length)
+      throw gcnew System::ArgumentException("Coordinate arrays must have the same length.");
+
+    const size_t count = static_cast<size_t>(x->Length);
+    m_buffer->resize(count);
+    if (count == 0)
+      return;
+
+    pin_ptr<double> px = &x[0];
+    pin_ptr<double> py = &y[0];
+    pin_ptr<double> pz = &z[0];
+    std::memcpy(m_buffer->x(), px, count * sizeof(double));
+    std::memcpy(m_buffer->y(), py, count * sizeof(double));
+    std::memcpy(m_buffer->z(), pz, count * sizeof(double));
+    System::GC::KeepAlive(this);
+  }
+
+  int VectorBuffer::CopyTo(array<double>^% x, array<double>^% y, array<double>^% z)
+  {
+    ThrowIfDisposed();
+    const int count = static_cast<int>(m_buffer->size());
+    EnsureLength(x, count);
+    EnsureLength(y, count);
+    EnsureLength(z, count);
+    if (count == 0)
+      return 0;
+
+    pin_ptr<double> px = &x[0];
+    pin_ptr<double> py = &y[0];
+    pin_ptr<double> pz = &z[0];
+    std::memcpy(px, m_buffer->x(), static_cast<size_t>(count) * sizeof(double));
+    std::memcpy(py, m_buffer->y(), static_cast<size_t>(count) * sizeof(double));
+    std::memcpy(pz, m_buffer->z(), static_cast<size_t>(count) * sizeof(double));
+    System::GC::KeepAlive(this);
+    return count;
+  }
+
+  array<Vector3DValue>^ VectorBuffer::ToArray()
+  {
+    ThrowIfDisposed();
+    const int count = static_cast<int>(m_buffer->size());
+    auto result = gcnew array<Vector3DValue>(count);
+
+    const double* x = m_buffer->x();
+    const double* y = m_buffer->y();
+    const double* z = m_buffer->z();
+    for (int i = 0; i < count; ++i)
+      result[i] = Vector3DValue(x[i], y[i], z[i]);
+    System::GC::KeepAlive(this);
+    return result;
+  }
+
+  void VectorBuffer::ThrowIfMismatched(VectorBuffer^ other)
+  {
+    if (other == nullptr)
+      throw gcnew System::ArgumentNullException("other");
+    if (other->Storage->size() != m_buffer->size())
+      throw gcnew System::ArgumentException("Both buffers must have the same count.", "other");
+  }
+
+  Native::SoaView VectorBuffer::PrepareResult(VectorBuffer^ result)
+  {
+    if (result == nullptr)
+      throw gcnew System::ArgumentNullException("result");
+
+    Native::SoaBuffer* target = result->Storage;
+    target->resize(m_buffer->size());
+    return target->view();
+  }
+
+  void VectorBuffer::Add(VectorBuffer^ other, VectorBuffer^ result)
+  {
+    ThrowIfDisposed();
+    ThrowIfMismatched(other);
+    Native::Kernels::add(m_buffer->view(), other->Storage->view(), PrepareResult(result));
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(other);
+    System::GC::KeepAlive(result);
+  }
+
+  void VectorBuffer::Subtract(VectorBuffer^ other, VectorBuffer^ result)
+  {
+    ThrowIfDisposed();
+    ThrowIfMismatched(other);
+    Native::Kernels::subtract(m_buffer->view(), other->Storage->view(), PrepareResult(result));
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(other);
+    System::GC::KeepAlive(result);
+  }
+
+  void VectorBuffer::Multiply(double scalar, VectorBuffer^ result)
+  {
+    ThrowIfDisposed();
+    Native::Kernels::scale(m_buffer->view(), scalar, PrepareResult(result));
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(result);
+  }
+
+  void VectorBuffer::DotProduct(VectorBuffer^ other, array<double>^% results)
+  {
+    ThrowIfDisposed();
+    ThrowIfMismatched(other);
+    const int count = static_cast<int>(m_buffer->size());
+    EnsureLength(results, count);
+    if (count == 0)
+      return;
+
+    pin_ptr<double> out = &results[0];
+    Native::Kernels::dot(m_buffer->view(), other->Storage->view(), out);
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(other);
+  }
+
+  void VectorBuffer::CrossProduct(VectorBuffer^ other, VectorBuffer^ result)
+  {
+    ThrowIfDisposed();
+    ThrowIfMismatched(other);
+    Native::Kernels::cross(m_buffer->view(), other->Storage->view(), PrepareResult(result));
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(other);
+    System::GC::KeepAlive(result);
+  }
+
+  void VectorBuffer::Magnitude(array<double>^% magnitudes)
+  {
+    ThrowIfDisposed();
+    const int count = static_cast<int>(m_buffer->size());
+    EnsureLength(magnitudes, count);
+    if (count == 0)
+      return;
+
+    pin_ptr<double> out = &magnitudes[0];
+    Native::Kernels::magnitude(m_buffer->view(), out);
+    System::GC::KeepAlive(this);
+  }
+
+  void VectorBuffer::Normalize(VectorBuffer^ result)
+  {
+    ThrowIfDisposed();
+    constexpr double epsilon = 1e-10;
+    Native::Kernels::normalize(m_buffer->view(), epsilon, PrepareResult(result));
+    System::GC::KeepAlive(this);
+    System::GC::KeepAlive(result);
+  }
+
+  Native::SoaBuffer* VectorBuffer::Storage::get()
+  {
+    ThrowIfDisposed();
+    return m_buffer;
+  }
+}
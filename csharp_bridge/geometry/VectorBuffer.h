@@ -0,0 +1,177 @@
+#pragma once
+
+#include "Vector3DValue.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  namespace Native
+  {
+    class SoaBuffer;
+    struct SoaView;
+  }
+
+  /// <summary>
+  /// A resizable collection of vectors stored as three aligned native arrays (X, Y, Z).
+  /// Batch operations run in native code over the whole buffer using the widest SIMD instruction set available.
+  /// </summary>
+  public ref class VectorBuffer
+  {
+  private:
+    Native::SoaBuffer* m_buffer;
+
+    void ThrowIfDisposed();
+    void ThrowIfMismatched(VectorBuffer^ other);
+    Native::SoaView PrepareResult(VectorBuffer^ result);
+
+  public:
+    /// <summary>
+    /// Initializes a new, empty VectorBuffer.
+    /// </summary>
+    VectorBuffer();
+
+    /// <summary>
+    /// Initializes a new, empty VectorBuffer with room for the given number of vectors.
+    /// </summary>
+    /// <param name="capacity">The number of vectors to reserve space for.</param>
+    explicit VectorBuffer(int capacity);
+
+    /// <summary>
+    /// Creates a buffer holding a copy of the given vectors.
+    /// </summary>
+    /// <param name="vectors">The vectors to copy.</param>
+    /// <returns>A new VectorBuffer.</returns>
+    static VectorBuffer^ FromArray(array<Vector3DValue>^ vectors);
+
+    /// <summary>
+    /// Releases the native storage.
+    /// </summary>
+    ~VectorBuffer();
+
+    /// <summary>
+    /// Finalizer. Releases the native storage if the buffer was not disposed.
+    /// </summary>
+    !VectorBuffer();
+
+    /// <summary>
+    /// Gets the number of vectors in the buffer.
+    /// </summary>
+    property int Count
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the number of vectors the buffer can hold without reallocating.
+    /// </summary>
+    property int Capacity
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets or sets the vector at the specified index.
+    /// </summary>
+    property Vector3DValue default[int]
+    {
+      Vector3DValue get(int index);
+      void set(int index, Vector3DValue value);
+    }
+
+    /// <summary>
+    /// Appends a vector.
+    /// </summary>
+    void Add(double x, double y, double z);
+
+    /// <summary>
+    /// Appends a vector.
+    /// </summary>
+    void Add(Vector3DValue vector);
+
+    /// <summary>
+    /// Removes all vectors while keeping the storage.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Ensures the buffer can hold at least the given number of vectors.
+    /// </summary>
+    void Reserve(int capacity);
+
+    /// <summary>
+    /// Sets the number of vectors; new vectors are zero.
+    /// </summary>
+    void Resize(int count);
+
+    /// <summary>
+    /// Replaces the contents with the given coordinate arrays, which must have equal lengths.
+    /// </summary>
+    void CopyFrom(array<double>^ x, array<double>^ y, array<double>^ z);
+
+    /// <summary>
+    /// Copies the coordinates into caller-owned arrays, growing them only when they are too small.
+    /// </summary>
+    /// <returns>The number of vectors written.</returns>
+    int CopyTo(array<double>^% x, array<double>^% y, array<double>^% z);
+
+    /// <summary>
+    /// Copies the vectors into a new array.
+    /// </summary>
+    array<Vector3DValue>^ ToArray();
+
+    /// <summary>
+    /// Adds the matching vectors of another buffer.
+    /// </summary>
+    /// <param name="other">The vectors to add; must have the same count.</param>
+    /// <param name="result">Receives this[i] + other[i]; may be this buffer.</param>
+    void Add(VectorBuffer^ other, VectorBuffer^ result);
+
+    /// <summary>
+    /// Subtracts the matching vectors of another buffer.
+    /// </summary>
+    /// <param name="other">The vectors to subtract; must have the same count.</param>
+    /// <param name="result">Receives this[i] - other[i]; may be this buffer.</param>
+    void Subtract(VectorBuffer^ other, VectorBuffer^ result);
+
+    /// <summary>
+    /// Multiplies every vector by a scalar value.
+    /// </summary>
+    /// <param name="scalar">The scalar value to multiply by.</param>
+    /// <param name="result">Receives the scaled vectors; may be this buffer.</param>
+    void Multiply(double scalar, VectorBuffer^ result);
+
+    /// <summary>
+    /// Calculates the dot product of every vector with the matching vector of another buffer.
+    /// </summary>
+    /// <param name="other">The other vectors; must have the same count.</param>
+    /// <param name="results">Receives one dot product per vector; grown when too small.</param>
+    void DotProduct(VectorBuffer^ other, array<double>^% results);
+
+    /// <summary>
+    /// Calculates the cross product of every vector with the matching vector of another buffer.
+    /// </summary>
+    /// <param name="other">The other vectors; must have the same count.</param>
+    /// <param name="result">Receives this[i] x other[i]; may be this buffer.</param>
+    void CrossProduct(VectorBuffer^ other, VectorBuffer^ result);
+
+    /// <summary>
+    /// Calculates the magnitude of every vector.
+    /// </summary>
+    /// <param name="magnitudes">Receives one magnitude per vector; grown when too small.</param>
+    void Magnitude(array<double>^% magnitudes);
+
+    /// <summary>
+    /// Normalizes every vector. Vectors shorter than 1e-10 become the zero vector instead of throwing,
+    /// so a single degenerate entry does not abort the whole batch.
+    /// </summary>
+    /// <param name="result">Receives the unit vectors; may be this buffer.</param>
+    void Normalize(VectorBuffer^ result);
+
+  internal:
+    /// The native storage. Callers that hand it to native code must GC::KeepAlive the buffer after the call, or the
+    /// finalizer may free it while the native code still runs.
+    property Native::SoaBuffer* Storage
+    {
+      Native::SoaBuffer* get();
+    }
+  };
+}
@@ -0,0 +1,10 @@
+#include "AttributeInterop.h"
+#include "AttributeInteropImpl.h"
+
+#include <ICwAPI3DAttributeController.h>
+
+bool CwAPI3D::Net::Bridge::Interop::FetchAttributes(Interfaces::ICwAPI3DAttributeController* controller,
+  const AttributeRequest& request, Native::StringTable& strings)
+{
+  return Detail::fetchAttributes<elementID>(controller, request, strings);
+}
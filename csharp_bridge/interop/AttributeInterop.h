@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DAttributeController;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge::Native
+{
+  class StringTable;
+}
+
+// Native helper for reading attributes of many elements with one managed->native transition. Like
+// ElementIdListInterop, it is compiled without /clr; the per-element controller calls and string copies run in a
+// tight native loop, and each distinct value is interned so it crosses the managed boundary once.
+namespace CwAPI3D::Net::Bridge::Interop
+{
+  enum class AttributeColumn : uint8_t
+  {
+    Name,
+    Group,
+    Subgroup,
+    Comment,
+    Material,
+    Count
+  };
+
+  inline constexpr uint32_t AttributeColumnCount = static_cast<uint32_t>(AttributeColumn::Count);
+
+  /// The attributes to read for `count` elements. columns[c] receives, for every element, the index in the string
+  /// table of its value of column c; a null entry skips the column.
+  struct AttributeRequest
+  {
+    const int32_t* ids;
+    uint32_t count;
+    int32_t* columns[AttributeColumnCount];
+  };
+
+  /// Reads the requested columns and interns their values into `strings`. Nothing is read and false is returned
+  /// if any of the IDs is negative.
+  bool FetchAttributes(Interfaces::ICwAPI3DAttributeController* controller, const AttributeRequest& request,
+    Native::StringTable& strings);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "AttributeInterop.h"
+#include "../native/StringTable.h"
+
+#include <cstdint>
+#include <string_view>
+
+// Loop body of Interop::FetchAttributes, templated on the controller and element ID types so it runs against the
+// SDK's ICwAPI3DAttributeController (AttributeInterop.cpp) and the in-process mock controller (mock/).
+// Native only: include from translation units compiled without /clr.
+namespace CwAPI3D::Net::Bridge::Interop::Detail
+{
+  /// The value of one attribute column as the controller returns it; null when the controller has none.
+  template <class ElementId, class Controller>
+  const char* attributeText(Controller* controller, AttributeColumn column, ElementId id)
+  {
+    auto* text = [&] {
+      switch (column)
+      {
+      case AttributeColumn::Name: return controller->getName(id);
+      case AttributeColumn::Group: return controller->getGroup(id);
+      case AttributeColumn::Subgroup: return controller->getSubgroup(id);
+      case AttributeColumn::Comment: return controller->getComment(id);
+      default: return controller->getElementMaterialName(id);
+      }
+    }();
+    return text ? text->narrowData() : nullptr;
+  }
+
+  template <class ElementId, class Controller>
+  bool fetchAttributes(Controller* controller, const AttributeRequest& request, Native::StringTable& strings)
+  {
+    if (!controller) return false;
+    if (request.count == 0) return true;
+    if (!request.ids) return false;
+
+    for (uint32_t i = 0; i < request.count; ++i)
+    {
+      if (request.ids[i] < 0) return false;
+    }
+
+    for (uint32_t c = 0; c < AttributeColumnCount; ++c)
+    {
+      int32_t* indices = request.columns[c];
+      if (!indices) continue;
+
+      // Neighbouring elements often share a value, e.g. the beams of one wall, so the previous value is checked
+      // before the table is probed.
+      std::string_view previous;
+      int32_t previousIndex = -1;
+      for (uint32_t i = 0; i < request.count; ++i)
+      {
+        const char* text = attributeText<ElementId>(controller, static_cast<AttributeColumn>(c),
+          static_cast<ElementId>(request.ids[i]));
+        const std::string_view value = text ? std::string_view(text) : std::string_view();
+        if (previousIndex < 0 || value != previous)
+        {
+          previousIndex = static_cast<int32_t>(strings.intern(value));
+          previous = strings.at(static_cast<uint32_t>(previousIndex));
+        }
+        indices[i] = previousIndex;
+      }
+    }
+    return true;
+  }
+}
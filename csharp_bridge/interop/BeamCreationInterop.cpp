@@ -0,0 +1,15 @@
+#include "BeamCreationInterop.h"
+#include "BeamCreationInteropImpl.h"
+
+#include <ICwAPI3DElementController.h>
+
+uint32_t CwAPI3D::Net::Bridge::Interop::CreateBeams(Interfaces::ICwAPI3DElementController* controller, const BeamBatch& batch, int32_t* ids)
+{
+  return Detail::createBeams(controller, batch, ids, [](double x, double y, double z) {
+    CwAPI3D::vector3D result;
+    result.mX = x;
+    result.mY = y;
+    result.mZ = z;
+    return result;
+  });
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DElementController;
+  }
+}
+
+// Native helper for creating many beams with one managed->native transition. Like ElementIdListInterop, it is
+// compiled without /clr; the per-beam controller calls run in a tight native loop.
+namespace CwAPI3D::Net::Bridge::Interop
+{
+  enum class BeamProfile : uint8_t
+  {
+    Rectangular,
+    Circular,
+    Square
+  };
+
+  /// Point i is (x[i * stride], y[i * stride], z[i * stride]). Stride 3 reads packed vector3D arrays
+  /// (array<Vector3DValue>), stride 1 reads the separate coordinate arrays of a PointBuffer.
+  struct BeamPoints
+  {
+    const double* x;
+    const double* y;
+    const double* z;
+    uint32_t stride;
+  };
+
+  /// Parameters of `count` beams. `widths` holds the width (rectangular, square) or diameter (circular) per beam;
+  /// `heights` is only read for rectangular beams.
+  struct BeamBatch
+  {
+    BeamProfile profile;
+    const double* widths;
+    const double* heights;
+    BeamPoints p1;
+    BeamPoints p2;
+    BeamPoints p3;
+    uint32_t count;
+  };
+
+  /// Creates the beams in order and writes their IDs to `ids`, which must hold `batch.count` entries.
+  /// Returns the number of beams created.
+  uint32_t CreateBeams(Interfaces::ICwAPI3DElementController* controller, const BeamBatch& batch, int32_t* ids);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "BeamCreationInterop.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Loop body of Interop::CreateBeams, templated on the controller and vector types so it runs against the SDK's
+// ICwAPI3DElementController (BeamCreationInterop.cpp) and the in-process mock controller (mock/).
+// Native only: include from translation units compiled without /clr.
+namespace CwAPI3D::Net::Bridge::Interop::Detail
+{
+  /// `makeVector(x, y, z)` builds the controller's vector type.
+  template <class Controller, class MakeVector>
+  uint32_t createBeams(Controller* controller, const BeamBatch& batch, int32_t* ids, MakeVector makeVector)
+  {
+    if (!controller || !ids || !batch.widths) return 0u;
+    if (batch.profile == BeamProfile::Rectangular && !batch.heights) return 0u;
+
+    const auto point = [&makeVector](const BeamPoints& points, uint32_t i) {
+      const std::size_t offset = static_cast<std::size_t>(i) * points.stride;
+      return makeVector(points.x[offset], points.y[offset], points.z[offset]);
+    };
+
+    for (uint32_t i = 0; i < batch.count; ++i)
+    {
+      const auto p1 = point(batch.p1, i);
+      const auto p2 = point(batch.p2, i);
+      const auto p3 = point(batch.p3, i);
+      switch (batch.profile)
+      {
+      case BeamProfile::Rectangular:
+        ids[i] = static_cast<int32_t>(controller->createRectangularBeamPoints(batch.widths[i], batch.heights[i], p1, p2, p3));
+        break;
+      case BeamProfile::Circular:
+        ids[i] = static_cast<int32_t>(controller->createCircularBeamPoints(batch.widths[i], p1, p2, p3));
+        break;
+      case BeamProfile::Square:
+        ids[i] = static_cast<int32_t>(controller->createSquareBeamPoints(batch.widths[i], p1, p2, p3));
+        break;
+      }
+    }
+    return batch.count;
+  }
+}
@@ -0,0 +1,18 @@
+#include "CommandBatchInterop.h"
+#include "CommandBatchInteropImpl.h"
+
+#include <ICwAPI3DElementController.h>
+#include <ICwAPI3DElementIDList.h>
+
+uint32_t CwAPI3D::Net::Bridge::Interop::FlushCommands(Interfaces::ICwAPI3DElementController* controller,
+  Interfaces::ICwAPI3DElementIDList* scratch, const Native::CommandQueue& queue, Native::CopyResults& copies)
+{
+  return Detail::flushCommands<Interfaces::ICwAPI3DElementController, Interfaces::ICwAPI3DElementIDList, elementID>(
+    controller, scratch, queue, copies, [](double x, double y, double z) {
+      CwAPI3D::vector3D result;
+      result.mX = x;
+      result.mY = y;
+      result.mZ = z;
+      return result;
+    });
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DElementController;
+    class ICwAPI3DElementIDList;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge::Native
+{
+  class CommandQueue;
+  struct CopyResults;
+}
+
+// Native helper that flushes a coalesced CommandBatch with one managed->native transition. Like
+// ElementIdListInterop, it is compiled without /clr.
+namespace CwAPI3D::Net::Bridge::Interop
+{
+  /// Issues the queued commands in order, refilling `scratch` with each command's IDs, and writes the new IDs of
+  /// every copy to `copies`. Returns the number of element controller calls made.
+  uint32_t FlushCommands(Interfaces::ICwAPI3DElementController* controller, Interfaces::ICwAPI3DElementIDList* scratch,
+    const Native::CommandQueue& queue, Native::CopyResults& copies);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CommandBatchInterop.h"
+#include "ElementIdListInteropImpl.h"
+#include "../native/CommandQueue.h"
+
+#include <cstdint>
+
+// Loop body of Interop::FlushCommands, templated on the controller, list and vector types so it runs against the
+// SDK's ICwAPI3DElementController (CommandBatchInterop.cpp) and the in-process mock controller (mock/).
+// Native only: include from translation units compiled without /clr.
+namespace CwAPI3D::Net::Bridge::Interop::Detail
+{
+  /// `makeVector(x, y, z)` builds the controller's vector type.
+  template <class Controller, class List, class ElementId, class MakeVector>
+  uint32_t flushCommands(Controller* controller, List* scratch, const Native::CommandQueue& queue, Native::CopyResults& copies,
+    MakeVector makeVector)
+  {
+    copies.ids.clear();
+    copies.offsets.assign(1, 0u);
+    if (!controller || !scratch) return 0u;
+
+    uint32_t calls = 0;
+    for (const Native::Command& command : queue.commands())
+    {
+      if (command.kind == Native::CommandKind::Copy && command.count == 0)
+      {
+        copies.offsets.push_back(static_cast<uint32_t>(copies.ids.size()));
+        continue;
+      }
+
+      scratch->clear();
+      appendElementIds<List, ElementId>(scratch, queue.ids(command), command.count);
+      switch (command.kind)
+      {
+      case Native::CommandKind::Move:
+        controller->moveElement(scratch, makeVector(command.vector.x, command.vector.y, command.vector.z));
+        break;
+      case Native::CommandKind::Copy:
+      {
+        auto* created = controller->copyElements(scratch, makeVector(command.vector.x, command.vector.y, command.vector.z));
+        const uint32_t offset = static_cast<uint32_t>(copies.ids.size());
+        copies.ids.resize(offset + elementIdCount(created));
+        copyElementIds(created, copies.ids.data() + offset, static_cast<uint32_t>(copies.ids.size()) - offset);
+        copies.offsets.push_back(static_cast<uint32_t>(copies.ids.size()));
+        break;
+      }
+      case Native::CommandKind::Delete:
+        controller->deleteElements(scratch);
+        break;
+      case Native::CommandKind::Join:
+        controller->joinElements(scratch);
+        break;
+      case Native::CommandKind::JoinTopLevel:
+        controller->joinTopLevelElements(scratch);
+        break;
+      }
+      ++calls;
+    }
+    scratch->clear();
+    return calls;
+  }
+}
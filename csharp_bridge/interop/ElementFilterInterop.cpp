@@ -0,0 +1,12 @@
+#include "ElementFilterInterop.h"
+#include "ElementFilterInteropImpl.h"
+
+#include <ICwAPI3DAttributeController.h>
+#include <ICwAPI3DElementController.h>
+#include <ICwAPI3DElementIDList.h>
+
+uint32_t CwAPI3D::Net::Bridge::Interop::FilterElements(Interfaces::ICwAPI3DElementController* elements,
+  Interfaces::ICwAPI3DAttributeController* attributes, const Native::ElementFilter& filter, Native::IdSet& result)
+{
+  return Detail::filterElements<elementID>(elements, attributes, filter, result);
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DElementController;
+    class ICwAPI3DAttributeController;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge::Native
+{
+  class ElementFilter;
+  class IdSet;
+}
+
+// Native helper that evaluates an ElementFilter where the element data lives. The queries and attribute reads run
+// in a native loop compiled without /clr, and only the matching IDs are handed back, as an IdSet.
+namespace CwAPI3D::Net::Bridge::Interop
+{
+  /// Replaces `result` with the identifiable elements that match `filter`. Every query the filter tests runs once;
+  /// a filter without attributes is then evaluated with set algebra, otherwise element by element over the
+  /// intersection of its required queries, reading each attribute at most once per element and only when the
+  /// cheaper tests have not decided. Returns the number of elements evaluated one by one.
+  uint32_t FilterElements(Interfaces::ICwAPI3DElementController* elements,
+    Interfaces::ICwAPI3DAttributeController* attributes, const Native::ElementFilter& filter, Native::IdSet& result);
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "AttributeInteropImpl.h"
+#include "ElementIdSetInteropImpl.h"
+#include "../native/ElementFilter.h"
+#include "../native/IdSet.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Loop body of Interop::FilterElements, templated on the controller and element ID types so it runs against the
+// SDK's controllers (ElementFilterInterop.cpp) and the in-process mock controllers (mock/).
+// Native only: include from translation units compiled without /clr.
+namespace CwAPI3D::Net::Bridge::Interop::Detail
+{
+  static_assert(static_cast<uint32_t>(AttributeColumn::Material) ==
+    static_cast<uint32_t>(Native::ElementFilter::Field::Material), "filter fields follow the attribute columns");
+  static_assert(Native::ElementFilter::FieldCount == AttributeColumnCount);
+
+  template <class Elements>
+  auto* runElementQuery(Elements* elements, Native::ElementFilter::Query query)
+  {
+    using Query = Native::ElementFilter::Query;
+    switch (query)
+    {
+    case Query::AllIdentifiable: return elements->getAllIdentifiableElementIDs();
+    case Query::Visible: return elements->getVisibleIdentifiableElementIDs();
+    case Query::Invisible: return elements->getInvisibleIdentifiableElementIDs();
+    case Query::Active: return elements->getActiveIdentifiableElementIDs();
+    case Query::InactiveAll: return elements->getInactiveAllIdentifiableElementIDs();
+    default: return elements->getInactiveVisibleIdentifiableElementIDs();
+    }
+  }
+
+  template <class ElementId, class Elements, class Attributes>
+  uint32_t filterElements(Elements* elements, Attributes* attributes, const Native::ElementFilter& filter,
+    Native::IdSet& result)
+  {
+    using Filter = Native::ElementFilter;
+    result.clear();
+    if (!elements || filter.empty()) return 0u;
+
+    const uint32_t required = filter.requiredQueries();
+    uint32_t needed = filter.queryMask();
+    if (filter.fieldMask() != 0 && required == 0)
+      needed |= 1u << static_cast<uint32_t>(Filter::Query::AllIdentifiable);
+
+    // The SDK reuses query result lists, so each one is copied into a set before the next query runs.
+    std::array<Native::IdSet, Filter::QueryCount> sets;
+    for (uint32_t q = 0; q < Filter::QueryCount; ++q)
+    {
+      if (needed & (1u << q))
+        collectElementIds(runElementQuery(elements, static_cast<Filter::Query>(q)), sets[q]);
+    }
+    auto setOf = [&](Filter::Query query) -> const Native::IdSet& { return sets[static_cast<uint32_t>(query)]; };
+
+    if (filter.fieldMask() == 0)
+    {
+      result = filter.evaluateSets<Native::IdSet>(setOf);
+      return 0u;
+    }
+
+    // Only elements in every required query can match, so the loop visits their intersection.
+    Native::IdSet narrowed;
+    const Native::IdSet* candidates = nullptr;
+    for (uint32_t q = 0; q < Filter::QueryCount; ++q)
+    {
+      if (!(required & (1u << q))) continue;
+      if (!candidates)
+      {
+        candidates = &sets[q];
+        continue;
+      }
+      narrowed = Native::IdSet::intersectionOf(*candidates, sets[q]);
+      candidates = &narrowed;
+    }
+    if (!candidates) candidates = &setOf(Filter::Query::AllIdentifiable);
+
+    // The text of the controller's last call stays valid only until the next one, so each field is copied once
+    // per element into storage that is reused from element to element.
+    std::array<std::string, Filter::FieldCount> values;
+    uint32_t loaded = 0;
+    uint32_t current = 0;
+    auto inQuery = [&](Filter::Query query) { return setOf(query).contains(current); };
+    auto fieldText = [&](Filter::Field field) -> std::string_view {
+      const auto f = static_cast<uint32_t>(field);
+      if (!(loaded & (1u << f)))
+      {
+        const char* text = attributes
+          ? attributeText<ElementId>(attributes, static_cast<AttributeColumn>(f), static_cast<ElementId>(current))
+          : nullptr;
+        values[f].assign(text ? text : "");
+        loaded |= 1u << f;
+      }
+      return values[f];
+    };
+
+    std::vector<uint32_t> matches;
+    candidates->forEach([&](uint32_t id) {
+      current = id;
+      loaded = 0;
+      if (filter.matches(inQuery, fieldText)) matches.push_back(id);
+    });
+    result.addMany(matches.data(), matches.size());
+    return static_cast<uint32_t>(candidates->size());
+  }
+}
@@ -0,0 +1,24 @@
+#include "ElementIdListInterop.h"
+#include "ElementIdListInteropImpl.h"
+
+#include <ICwAPI3DElementIDList.h>
+
+uint32_t CwAPI3D::Net::Bridge::Interop::ElementIdCount(Interfaces::ICwAPI3DElementIDList* nativeList)
+{
+  return Detail::elementIdCount(nativeList);
+}
+
+uint32_t CwAPI3D::Net::Bridge::Interop::CopyElementIds(Interfaces::ICwAPI3DElementIDList* nativeList, int32_t* destination, uint32_t capacity)
+{
+  return Detail::copyElementIds(nativeList, destination, capacity);
+}
+
+uint32_t CwAPI3D::Net::Bridge::Interop::CopyElementIdRange(Interfaces::ICwAPI3DElementIDList* nativeList, uint32_t first, int32_t* destination, uint32_t capacity)
+{
+  return Detail::copyElementIdRange(nativeList, first, destination, capacity);
+}
+
+bool CwAPI3D::Net::Bridge::Interop::AppendElementIds(Interfaces::ICwAPI3DElementIDList* nativeList, const int32_t* source, uint32_t count)
+{
+  return Detail::appendElementIds<Interfaces::ICwAPI3DElementIDList, elementID>(nativeList, source, count);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DElementIDList;
+  }
+}
+
+// Native helpers for moving element IDs across the managed boundary.
+// These functions are compiled without /clr, so a call from managed code costs a single
+// transition no matter how many IDs are copied; the per-element virtual calls into
+// ICwAPI3DElementIDList stay on the native side.
+namespace CwAPI3D::Net::Bridge::Interop
+{
+  /// Returns the number of IDs in the list, or 0 for a null list.
+  uint32_t ElementIdCount(Interfaces::ICwAPI3DElementIDList* nativeList);
+
+  /// Copies up to `capacity` IDs from the list into `destination` and returns the number copied.
+  uint32_t CopyElementIds(Interfaces::ICwAPI3DElementIDList* nativeList, int32_t* destination, uint32_t capacity);
+
+  /// Copies up to `capacity` IDs, starting at index `first`, from the list into `destination` and returns the
+  /// number copied (0 once `first` is past the end).
+  uint32_t CopyElementIdRange(Interfaces::ICwAPI3DElementIDList* nativeList, uint32_t first, int32_t* destination, uint32_t capacity);
+
+  /// Appends `count` IDs from `source` to the list. Nothing is appended and false is returned
+  /// if any of the IDs is negative.
+  bool AppendElementIds(Interfaces::ICwAPI3DElementIDList* nativeList, const int32_t* source, uint32_t count);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+// Loop bodies of the ElementIdListInterop helpers, templated on the list type so the same code runs against
+// the SDK's ICwAPI3DElementIDList (ElementIdListInterop.cpp) and the in-process mock list (mock/).
+// Native only: include from translation units compiled without /clr.
+namespace CwAPI3D::Net::Bridge::Interop::Detail
+{
+  template <class List>
+  uint32_t elementIdCount(List* nativeList)
+  {
+    return nativeList ? static_cast<uint32_t>(nativeList->count()) : 0u;
+  }
+
+  template <class List>
+  uint32_t copyElementIdRange(List* nativeList, uint32_t first, int32_t* destination, uint32_t capacity)
+  {
+    if (!nativeList || !destination) return 0u;
+
+    const uint32_t count = static_cast<uint32_t>(nativeList->count());
+    if (first >= count) return 0u;
+
+    const uint32_t toCopy = count - first < capacity ? count - first : capacity;
+    for (uint32_t i = 0; i < toCopy; ++i)
+    {
+      destination[i] = static_cast<int32_t>(nativeList->at(first + i));
+    }
+    return toCopy;
+  }
+
+  template <class List>
+  uint32_t copyElementIds(List* nativeList, int32_t* destination, uint32_t capacity)
+  {
+    return copyElementIdRange(nativeList, 0u, destination, capacity);
+  }
+
+  template <class List, class ElementId>
+  bool appendElementIds(List* nativeList, const int32_t* source, uint32_t count)
+  {
+    if (!nativeList) return false;
+    if (count == 0) return true;
+    if (!source) return false;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      if (source[i] < 0) return false;
+    }
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      nativeList->append(static_cast<ElementId>(source[i]));
+    }
+    return true;
+  }
+}
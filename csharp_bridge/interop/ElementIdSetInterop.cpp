@@ -0,0 +1,14 @@
+#include "ElementIdSetInterop.h"
+#include "ElementIdSetInteropImpl.h"
+
+#include <ICwAPI3DElementIDList.h>
+
+uint32_t CwAPI3D::Net::Bridge::Interop::CollectElementIds(Interfaces::ICwAPI3DElementIDList* nativeList, Native::IdSet& set)
+{
+  return Detail::collectElementIds(nativeList, set);
+}
+
+bool CwAPI3D::Net::Bridge::Interop::AppendElementIds(Interfaces::ICwAPI3DElementIDList* nativeList, const Native::IdSet& set)
+{
+  return Detail::appendElementIds<Interfaces::ICwAPI3DElementIDList, elementID>(nativeList, set);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DElementIDList;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge::Native
+{
+  class IdSet;
+}
+
+// Native helpers that move element IDs between an SDK list and an ElementIdSet without managed arrays in between.
+namespace CwAPI3D::Net::Bridge::Interop
+{
+  /// Adds every ID in the list to `set` and returns the number of IDs read, or 0 for a null list.
+  uint32_t CollectElementIds(Interfaces::ICwAPI3DElementIDList* nativeList, Native::IdSet& set);
+
+  /// Appends the IDs of `set` to the list in ascending order. Returns false for a null list.
+  bool AppendElementIds(Interfaces::ICwAPI3DElementIDList* nativeList, const Native::IdSet& set);
+}
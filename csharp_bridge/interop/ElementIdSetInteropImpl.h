@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../native/IdSet.h"
+
+#include <cstdint>
+#include <vector>
+
+// Loop bodies of the ElementIdSetInterop helpers, templated on the list type so the same code runs against the
+// SDK's ICwAPI3DElementIDList (ElementIdSetInterop.cpp) and the in-process mock list (mock/).
+// Native only: include from translation units compiled without /clr.
+namespace CwAPI3D::Net::Bridge::Interop::Detail
+{
+  template <class List>
+  uint32_t collectElementIds(List* nativeList, Native::IdSet& set)
+  {
+    if (!nativeList) return 0u;
+
+    // Gathered first so the set sorts the IDs once instead of inserting them one by one.
+    const uint32_t count = static_cast<uint32_t>(nativeList->count());
+    std::vector<uint32_t> ids(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      ids[i] = static_cast<uint32_t>(nativeList->at(i));
+    }
+    set.addMany(ids.data(), ids.size());
+    return count;
+  }
+
+  template <class List, class ElementId>
+  bool appendElementIds(List* nativeList, const Native::IdSet& set)
+  {
+    if (!nativeList) return false;
+
+    set.forEach([&](uint32_t id) { nativeList->append(static_cast<ElementId>(id)); });
+    return true;
+  }
+}
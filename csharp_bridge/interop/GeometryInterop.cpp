@@ -0,0 +1,15 @@
+#include "GeometryInterop.h"
+#include "GeometryInteropImpl.h"
+
+#include <ICwAPI3DGeometryController.h>
+
+bool CwAPI3D::Net::Bridge::Interop::FetchGeometry(Interfaces::ICwAPI3DGeometryController* controller,
+  const GeometryRequest& request)
+{
+  return Detail::fetchGeometry<elementID>(controller, request,
+    [](const vector3D& vector, double& x, double& y, double& z) {
+      x = vector.mX;
+      y = vector.mY;
+      z = vector.mZ;
+    });
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../native/SoaBuffer.h"
+
+#include <cstdint>
+
+namespace CwAPI3D
+{
+  namespace Interfaces
+  {
+    class ICwAPI3DGeometryController;
+  }
+}
+
+// Native helper for reading the geometry of many elements with one managed->native transition. Like
+// ElementIdListInterop, it is compiled without /clr; the per-element controller calls run in a tight native loop
+// that splits each returned vector3D straight into the coordinate arrays of a PointBuffer or VectorBuffer.
+namespace CwAPI3D::Net::Bridge::Interop
+{
+  enum class GeometryVector : uint8_t
+  {
+    P1,
+    P2,
+    P3,
+    XL,
+    YL,
+    ZL,
+    Count
+  };
+
+  enum class GeometryScalar : uint8_t
+  {
+    Width,
+    Height,
+    Length,
+    Count
+  };
+
+  inline constexpr uint32_t GeometryVectorCount = static_cast<uint32_t>(GeometryVector::Count);
+  inline constexpr uint32_t GeometryScalarCount = static_cast<uint32_t>(GeometryScalar::Count);
+
+  /// The geometry to read for `count` elements. vectors[v] receives the points or directions of field v and must
+  /// hold `count` entries; a null x skips the field. scalars[s] likewise receives one value per element, or is null.
+  struct GeometryRequest
+  {
+    const int32_t* ids;
+    uint32_t count;
+    Native::SoaView vectors[GeometryVectorCount];
+    double* scalars[GeometryScalarCount];
+  };
+
+  /// Reads the requested fields. Nothing is read and false is returned if any of the IDs is negative.
+  bool FetchGeometry(Interfaces::ICwAPI3DGeometryController* controller, const GeometryRequest& request);
+}
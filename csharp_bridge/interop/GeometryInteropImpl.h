@@ -0,0 +1,80 @@
+#pragma once
+
+#include "GeometryInterop.h"
+
+#include <cstdint>
+
+// Loop body of Interop::FetchGeometry, templated on the controller and element ID types so it runs against the
+// SDK's ICwAPI3DGeometryController (GeometryInterop.cpp) and the in-process mock controller (mock/).
+// Native only: include from translation units compiled without /clr.
+namespace CwAPI3D::Net::Bridge::Interop::Detail
+{
+  inline constexpr uint32_t GeometryBlockSize = 256;
+
+  template <class ElementId, class Controller>
+  auto geometryVector(Controller* controller, GeometryVector field, ElementId id)
+  {
+    switch (field)
+    {
+    case GeometryVector::P1: return controller->getP1(id);
+    case GeometryVector::P2: return controller->getP2(id);
+    case GeometryVector::P3: return controller->getP3(id);
+    case GeometryVector::XL: return controller->getXL(id);
+    case GeometryVector::YL: return controller->getYL(id);
+    default: return controller->getZL(id);
+    }
+  }
+
+  template <class ElementId, class Controller>
+  double geometryScalar(Controller* controller, GeometryScalar field, ElementId id)
+  {
+    switch (field)
+    {
+    case GeometryScalar::Width: return controller->getWidth(id);
+    case GeometryScalar::Height: return controller->getHeight(id);
+    default: return controller->getLength(id);
+    }
+  }
+
+  /// `split(vector, x, y, z)` writes the coordinates of the controller's vector type.
+  template <class ElementId, class Controller, class Split>
+  bool fetchGeometry(Controller* controller, const GeometryRequest& request, Split split)
+  {
+    if (!controller) return false;
+    if (request.count == 0) return true;
+    if (!request.ids) return false;
+
+    for (uint32_t i = 0; i < request.count; ++i)
+    {
+      if (request.ids[i] < 0) return false;
+    }
+
+    // Field by field within blocks of elements: each pass streams into only one set of coordinate arrays (the
+    // separately allocated arrays of all fields would otherwise compete for the same cache sets), while the
+    // controller's lookups of a block's elements stay in cache from one pass to the next.
+    for (uint32_t begin = 0; begin < request.count; begin += GeometryBlockSize)
+    {
+      const uint32_t end = request.count - begin < GeometryBlockSize ? request.count : begin + GeometryBlockSize;
+      for (uint32_t v = 0; v < GeometryVectorCount; ++v)
+      {
+        const Native::SoaView out = request.vectors[v];
+        if (!out.x) continue;
+
+        for (uint32_t i = begin; i < end; ++i)
+        {
+          const auto id = static_cast<ElementId>(request.ids[i]);
+          split(geometryVector(controller, static_cast<GeometryVector>(v), id), out.x[i], out.y[i], out.z[i]);
+        }
+      }
+      for (uint32_t s = 0; s < GeometryScalarCount; ++s)
+      {
+        double* out = request.scalars[s];
+        if (!out) continue;
+
+        for (uint32_t i = begin; i < end; ++i)
+          out[i] = geometryScalar(controller, static_cast<GeometryScalar>(s), static_cast<ElementId>(request.ids[i]));
+      }
+    }
+    return true;
+  }
+}
@@ -0,0 +1,322 @@
+#include "ElementStore.h"
+
+#include <core/Hash.h>
+
+#include <cmath>
+#include <random>
+#include <utility>
+
+const CwAPI3D::Net::Bridge::Mock::Element* CwAPI3D::Net::Bridge::Mock::ElementStore::find(ElementId id) const
+{
+  const auto it = m_index.find(id);
+  return it == m_index.end() ? nullptr : &m_elements[it->second];
+}
+
+CwAPI3D::Net::Bridge::Mock::Element* CwAPI3D::Net::Bridge::Mock::ElementStore::findMutable(ElementId id)
+{
+  const auto it = m_index.find(id);
+  return it == m_index.end() ? nullptr : &m_elements[it->second];
+}
+
+CwAPI3D::Net::Bridge::Mock::ElementId CwAPI3D::Net::Bridge::Mock::ElementStore::insert(Element element)
+{
+  const ElementId id = element.id;
+  m_index.emplace(id, m_elements.size());
+  m_elements.push_back(std::move(element));
+  return id;
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::erase(ElementId id)
+{
+  const auto it = m_index.find(id);
+  if (it == m_index.end())
+    return;
+
+  const std::size_t index = it->second;
+  const std::size_t last = m_elements.size() - 1;
+  if (index != last)
+  {
+    m_elements[index] = std::move(m_elements[last]);
+    m_index[m_elements[index].id] = index;
+  }
+  m_elements.pop_back();
+  m_index.erase(id);
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::populate(std::size_t count, const PopulateOptions& options)
+{
+  m_elements.reserve(m_elements.size() + count);
+  m_index.reserve(m_elements.size() + count);
+
+  std::mt19937 random(options.seed);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  const auto side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const Core::Vec3d origin{static_cast<double>(i % (side ? side : 1)) * options.spacing,
+                             static_cast<double>(i / (side ? side : 1)) * options.spacing, 0.0};
+
+    Element element;
+    element.id = m_nextId++;
+    element.type = unit(random) < options.panelRatio ? ElementType::Panel : ElementType::Beam;
+    element.p1 = origin;
+    element.p2 = origin + Core::Vec3d{options.spacing * 0.8, 0.0, 0.0};
+    element.p3 = origin + Core::Vec3d{0.0, 0.0, 1.0};
+    if (element.type == ElementType::Panel)
+    {
+      element.width = options.spacing * 0.6;
+      element.height = 20.0;
+    }
+    else
+    {
+      element.width = 100.0;
+      element.height = 200.0;
+    }
+    element.visible = unit(random) < options.visibleRatio;
+    element.active = unit(random) < options.activeRatio;
+    element.group = static_cast<std::uint32_t>(i * (options.groups ? options.groups : 1) / count);
+    element.subgroup = static_cast<std::uint16_t>(i % 4);
+    // Hashed rather than drawn from `random`, so the rest of the model is the same as without attributes.
+    element.material = static_cast<std::uint16_t>(Core::mixHash(i ^ options.seed) % (options.materials ? options.materials : 1));
+    insert(std::move(element));
+  }
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::reset()
+{
+  m_elements.clear();
+  m_index.clear();
+  m_pending = {};
+  m_undo.clear();
+  m_redo.clear();
+}
+
+CwAPI3D::Net::Bridge::Mock::ElementId CwAPI3D::Net::Bridge::Mock::ElementStore::add(Element element)
+{
+  element.id = m_nextId++;
+  const ElementId id = insert(std::move(element));
+  recordCreated(id);
+  commit();
+  return id;
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::translate(const std::vector<ElementId>& ids, const Core::Vec3d& offset)
+{
+  for (const ElementId id : ids)
+  {
+    if (Element* element = findMutable(id))
+    {
+      recordBefore(*element);
+      element->p1 = element->p1 + offset;
+      element->p2 = element->p2 + offset;
+      element->p3 = element->p3 + offset;
+    }
+  }
+  commit();
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::copy(const std::vector<ElementId>& ids, const Core::Vec3d& offset,
+                                                    std::vector<ElementId>& created)
+{
+  for (const ElementId id : ids)
+  {
+    const Element* source = find(id);
+    if (!source)
+      continue;
+
+    // Copied by value first: inserting may reallocate the storage `source` points into.
+    Element copy = *source;
+    copy.id = m_nextId++;
+    copy.p1 = copy.p1 + offset;
+    copy.p2 = copy.p2 + offset;
+    copy.p3 = copy.p3 + offset;
+    copy.joinGroup = 0;
+    copy.topLevelJoinGroup = 0;
+    created.push_back(insert(std::move(copy)));
+    recordCreated(created.back());
+  }
+  commit();
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::remove(const std::vector<ElementId>& ids)
+{
+  for (const ElementId id : ids)
+  {
+    if (const Element* element = find(id))
+    {
+      recordBefore(*element);
+      erase(id);
+    }
+  }
+  commit();
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::join(const std::vector<ElementId>& ids, bool topLevel)
+{
+  const std::uint32_t group = m_nextJoinGroup++;
+  for (const ElementId id : ids)
+  {
+    if (Element* element = findMutable(id))
+    {
+      recordBefore(*element);
+      (topLevel ? element->topLevelJoinGroup : element->joinGroup) = group;
+    }
+  }
+  commit();
+}
+
+bool CwAPI3D::Net::Bridge::Mock::ElementStore::unjoin(const std::vector<ElementId>& ids, bool topLevel)
+{
+  bool unjoined = false;
+  for (const ElementId id : ids)
+  {
+    Element* element = findMutable(id);
+    if (!element)
+      continue;
+
+    std::uint32_t& group = topLevel ? element->topLevelJoinGroup : element->joinGroup;
+    if (group != 0)
+    {
+      recordBefore(*element);
+      group = 0;
+      unjoined = true;
+    }
+  }
+  commit();
+  return unjoined;
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::setType(const std::vector<ElementId>& ids, ElementType type)
+{
+  for (const ElementId id : ids)
+  {
+    Element* element = findMutable(id);
+    if (element && element->type != type)
+    {
+      recordBefore(*element);
+      element->type = type;
+    }
+  }
+  commit();
+}
+
+CwAPI3D::Net::Bridge::Mock::ElementId CwAPI3D::Net::Bridge::Mock::ElementStore::solder(const std::vector<ElementId>& ids)
+{
+  std::vector<Element> parts;
+  for (const ElementId id : ids)
+  {
+    if (const Element* element = find(id))
+      parts.push_back(*element);
+  }
+  if (parts.size() < 2)
+    return 0;
+
+  Element soldered = parts.front();
+  soldered.id = m_nextId++;
+  soldered.p2 = parts.back().p2;
+  soldered.joinGroup = 0;
+  soldered.topLevelJoinGroup = 0;
+
+  for (const Element& part : parts)
+  {
+    recordBefore(part);
+    erase(part.id);
+  }
+  const ElementId id = insert(std::move(soldered));
+  recordCreated(id);
+  commit();
+  return id;
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::split(const std::vector<ElementId>& ids, std::vector<ElementId>& created)
+{
+  for (const ElementId id : ids)
+  {
+    Element* element = findMutable(id);
+    if (!element)
+      continue;
+
+    recordBefore(*element);
+    const Core::Vec3d middle = (element->p1 + element->p2) * 0.5;
+    Element second = *element;
+    second.id = m_nextId++;
+    second.p1 = middle;
+    second.p3 = element->p3 + (middle - element->p1);
+    element->p2 = middle;
+
+    created.push_back(insert(std::move(second)));
+    recordCreated(created.back());
+  }
+  commit();
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::commit()
+{
+  if (m_pending.restore.empty() && m_pending.remove.empty())
+    return;
+
+  m_undo.push_back(std::move(m_pending));
+  m_pending = {};
+  if (m_undo.size() > m_undoLimit)
+    m_undo.erase(m_undo.begin());
+  m_redo.clear();
+}
+
+CwAPI3D::Net::Bridge::Mock::ElementStore::Step CwAPI3D::Net::Bridge::Mock::ElementStore::apply(const Step& step)
+{
+  Step inverse;
+  for (const ElementId id : step.remove)
+  {
+    if (const Element* element = find(id))
+    {
+      inverse.restore.push_back(*element);
+      erase(id);
+    }
+  }
+  // Newest state first, so when an element was recorded more than once the oldest state is written last and wins.
+  for (auto it = step.restore.rbegin(); it != step.restore.rend(); ++it)
+  {
+    if (Element* element = findMutable(it->id))
+    {
+      inverse.restore.push_back(*element);
+      *element = *it;
+    }
+    else
+    {
+      inverse.remove.push_back(insert(*it));
+    }
+  }
+  return inverse;
+}
+
+void CwAPI3D::Net::Bridge::Mock::ElementStore::setUndoLimit(std::size_t limit)
+{
+  m_undoLimit = limit;
+  if (m_undo.size() > limit)
+    m_undo.erase(m_undo.begin(), m_undo.begin() + static_cast<std::ptrdiff_t>(m_undo.size() - limit));
+  if (limit == 0)
+    m_redo.clear();
+}
+
+bool CwAPI3D::Net::Bridge::Mock::ElementStore::undo()
+{
+  if (m_undo.empty())
+    return false;
+
+  Step step = std::move(m_undo.back());
+  m_undo.pop_back();
+  m_redo.push_back(apply(step));
+  return true;
+}
+
+bool CwAPI3D::Net::Bridge::Mock::ElementStore::redo()
+{
+  if (m_redo.empty())
+    return false;
+
+  Step step = std::move(m_redo.back());
+  m_redo.pop_back();
+  m_undo.push_back(apply(step));
+  return true;
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "MockElementIdList.h"
+
+#include <core/Vec3.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace CwAPI3D::Net::Bridge::Mock
+{
+  enum class ElementType : std::uint8_t
+  {
+    Beam,
+    Panel
+  };
+
+  enum class Profile : std::uint8_t
+  {
+    Rectangular,
+    Circular,
+    Square
+  };
+
+  /// One element of the mock model: an axis from p1 to p2, with p3 fixing the orientation of the cross section.
+  struct Element
+  {
+    ElementId id = 0;
+    ElementType type = ElementType::Beam;
+    Profile profile = Profile::Rectangular;
+    Core::Vec3d p1;
+    Core::Vec3d p2;
+    Core::Vec3d p3;
+    double width = 0.0;
+    double height = 0.0;
+    bool visible = true;
+    bool active = false;
+    /// Join group shared by elements joined together; 0 when not joined.
+    std::uint32_t joinGroup = 0;
+    /// Join group for top-level joins; 0 when not joined.
+    std::uint32_t topLevelJoinGroup = 0;
+    /// Attributes, as indices MockAttributeController turns into its strings.
+    std::uint32_t group = 0;
+    std::uint16_t subgroup = 0;
+    std::uint16_t material = 0;
+  };
+
+  /// Parameters for ElementStore::populate.
+  struct PopulateOptions
+  {
+    /// Fraction of generated elements that are panels; the rest are beams.
+    double panelRatio = 0.25;
+    /// Fraction of generated elements that are visible.
+    double visibleRatio = 0.9;
+    /// Fraction of generated elements that are active (selected).
+    double activeRatio = 0.01;
+    /// Grid spacing between generated elements.
+    double spacing = 1000.0;
+    /// Number of distinct groups, each a contiguous run of generated elements, like the members of one wall.
+    std::uint32_t groups = 1000;
+    /// Number of distinct materials, assigned at random.
+    std::uint16_t materials = 50;
+    std::uint32_t seed = 1;
+  };
+
+  /// In-memory element model with undo/redo. Lookups by ID are O(1); removal swaps the last element into the
+  /// freed slot, so enumeration order is not creation order once elements have been deleted.
+  /// Not thread-safe, like the CAD host it stands in for.
+  class ElementStore
+  {
+  public:
+    /// Number of mutating operations kept for undo.
+    static constexpr std::size_t DefaultUndoLimit = 64;
+
+    ElementStore() = default;
+
+    std::size_t size() const { return m_elements.size(); }
+    bool contains(ElementId id) const { return m_index.find(id) != m_index.end(); }
+
+    /// Returns the element with the given ID, or nullptr.
+    const Element* find(ElementId id) const;
+
+    /// All elements, in storage order.
+    const std::vector<Element>& elements() const { return m_elements; }
+
+    /// Appends `count` synthetic beams and panels laid out on a grid. Not recorded for undo.
+    void populate(std::size_t count, const PopulateOptions& options = {});
+
+    /// Removes all elements and clears the undo history.
+    void reset();
+
+    /// Appends the IDs of all elements matching the predicate to `out`.
+    template <class Predicate>
+    void collect(Predicate predicate, std::vector<ElementId>& out) const
+    {
+      for (const Element& element : m_elements)
+      {
+        if (predicate(element))
+          out.push_back(element.id);
+      }
+    }
+
+    // Mutating operations. Each records one undo step; unknown IDs are ignored.
+
+    /// Adds the element, assigns and returns its new ID.
+    ElementId add(Element element);
+    void translate(const std::vector<ElementId>& ids, const Core::Vec3d& offset);
+    /// Copies the elements, moved by `offset`, and appends the IDs of the copies to `created`.
+    void copy(const std::vector<ElementId>& ids, const Core::Vec3d& offset, std::vector<ElementId>& created);
+    void remove(const std::vector<ElementId>& ids);
+    void join(const std::vector<ElementId>& ids, bool topLevel);
+    /// Returns true if any of the elements was joined.
+    bool unjoin(const std::vector<ElementId>& ids, bool topLevel);
+    void setType(const std::vector<ElementId>& ids, ElementType type);
+    /// Replaces the elements by one element spanning from the first element's start to the last element's end.
+    /// Returns the new ID, or 0 if fewer than two of the IDs exist.
+    ElementId solder(const std::vector<ElementId>& ids);
+    /// Splits every element at the middle of its axis; the original keeps the first half.
+    void split(const std::vector<ElementId>& ids, std::vector<ElementId>& created);
+
+    /// Sets the number of operations kept for undo. 0 turns recording off, which load tests at millions of
+    /// elements want: every recorded step keeps a copy of each element it touched.
+    void setUndoLimit(std::size_t limit);
+    std::size_t undoLimit() const { return m_undoLimit; }
+
+    bool undo();
+    bool redo();
+    std::size_t undoDepth() const { return m_undo.size(); }
+    std::size_t redoDepth() const { return m_redo.size(); }
+
+  private:
+    /// Applying a step restores `restore` and removes `remove`; the inverse step is returned.
+    struct Step
+    {
+      std::vector<Element> restore;
+      std::vector<ElementId> remove;
+    };
+
+    Element* findMutable(ElementId id);
+    ElementId insert(Element element);
+    void erase(ElementId id);
+    Step apply(const Step& step);
+
+    /// Saves the current state of an element about to change, so undo can bring it back.
+    void recordBefore(const Element& element)
+    {
+      if (m_undoLimit != 0)
+        m_pending.restore.push_back(element);
+    }
+    void recordCreated(ElementId id)
+    {
+      if (m_undoLimit != 0)
+        m_pending.remove.push_back(id);
+    }
+    void commit();
+
+    std::vector<Element> m_elements;
+    std::unordered_map<ElementId, std::size_t> m_index;
+    ElementId m_nextId = 1;
+    std::uint32_t m_nextJoinGroup = 1;
+    std::size_t m_undoLimit = DefaultUndoLimit;
+
+    Step m_pending;
+    std::vector<Step> m_undo;
+    std::vector<Step> m_redo;
+  };
+}
@@ -0,0 +1,44 @@
+#include "MockAttributeController.h"
+
+CwAPI3D::Net::Bridge::Mock::MockString* CwAPI3D::Net::Bridge::Mock::MockAttributeController::numbered(const Element* element, const char* prefix, unsigned long number)
+{
+  std::string& text = m_result.text();
+  text.clear();
+  if (element)
+  {
+    text += prefix;
+    text += std::to_string(number);
+  }
+  return &m_result;
+}
+
+CwAPI3D::Net::Bridge::Mock::MockString* CwAPI3D::Net::Bridge::Mock::MockAttributeController::getName(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  m_result.text() = !element ? "" : (element->type == ElementType::Panel ? "Panel" : "Beam");
+  return &m_result;
+}
+
+CwAPI3D::Net::Bridge::Mock::MockString* CwAPI3D::Net::Bridge::Mock::MockAttributeController::getGroup(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return numbered(element, "Wall ", element ? element->group : 0ul);
+}
+
+CwAPI3D::Net::Bridge::Mock::MockString* CwAPI3D::Net::Bridge::Mock::MockAttributeController::getSubgroup(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return numbered(element, "Layer ", element ? element->subgroup : 0ul);
+}
+
+CwAPI3D::Net::Bridge::Mock::MockString* CwAPI3D::Net::Bridge::Mock::MockAttributeController::getComment(ElementId)
+{
+  m_result.text().clear();
+  return &m_result;
+}
+
+CwAPI3D::Net::Bridge::Mock::MockString* CwAPI3D::Net::Bridge::Mock::MockAttributeController::getElementMaterialName(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return numbered(element, "Material ", element ? element->material : 0ul);
+}
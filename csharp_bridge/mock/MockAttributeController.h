@@ -0,0 +1,46 @@
+#pragma once
+
+#include "ElementStore.h"
+
+#include <string>
+
+namespace CwAPI3D::Net::Bridge::Mock
+{
+  /// Mirrors the ICwAPI3DString members used by the bridge.
+  class MockString
+  {
+  public:
+    const char* narrowData() const { return m_text.c_str(); }
+
+    std::string& text() { return m_text; }
+
+  private:
+    std::string m_text;
+  };
+
+  /// Mirrors the ICwAPI3DAttributeController members used by the bridge, on top of an ElementStore. The name is the
+  /// element type, the group and subgroup "Wall <n>" and "Layer <n>", the material "Material <n>", and the comment
+  /// is empty. Like the SDK, each call builds the string anew; it stays valid until the next call. Unknown IDs have
+  /// empty attributes.
+  class MockAttributeController
+  {
+  public:
+    explicit MockAttributeController(ElementStore& store) : m_store(store) {}
+
+    MockAttributeController(const MockAttributeController&) = delete;
+    MockAttributeController& operator=(const MockAttributeController&) = delete;
+
+    MockString* getName(ElementId id);
+    MockString* getGroup(ElementId id);
+    MockString* getSubgroup(ElementId id);
+    MockString* getComment(ElementId id);
+    MockString* getElementMaterialName(ElementId id);
+
+  private:
+    /// Sets the result to `prefix` followed by `number`, or empty for an unknown element.
+    MockString* numbered(const Element* element, const char* prefix, unsigned long number);
+
+    ElementStore& m_store;
+    MockString m_result;
+  };
+}
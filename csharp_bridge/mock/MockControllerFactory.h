@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ElementStore.h"
+#include "MockAttributeController.h"
+#include "MockElementController.h"
+#include "MockElementIdList.h"
+#include "MockGeometryController.h"
+
+#include <cstddef>
+
+namespace CwAPI3D::Net::Bridge::Mock
+{
+  /// Mirrors the ICwAPI3DControllerFactory members used by the bridge. Owns the element store and the
+  /// controller, so a factory is a complete headless model:
+  ///
+  ///   Mock::MockControllerFactory factory;
+  ///   factory.store().populate(1'000'000);
+  ///   auto* ids = factory.getElementController()->getVisibleIdentifiableElementIDs();
+  class MockControllerFactory
+  {
+  public:
+    MockControllerFactory() : m_elementController(m_store), m_attributeController(m_store), m_geometryController(m_store) {}
+
+    /// Creates a factory whose store already holds `elementCount` synthetic elements.
+    explicit MockControllerFactory(std::size_t elementCount, const PopulateOptions& options = {})
+      : MockControllerFactory()
+    {
+      m_store.populate(elementCount, options);
+    }
+
+    MockControllerFactory(const MockControllerFactory&) = delete;
+    MockControllerFactory& operator=(const MockControllerFactory&) = delete;
+
+    MockElementController* getElementController() { return &m_elementController; }
+    MockAttributeController* getAttributeController() { return &m_attributeController; }
+    MockGeometryController* getGeometryController() { return &m_geometryController; }
+
+    /// Returns a new empty list; release it with destroy().
+    MockElementIdList* createEmptyElementIDList() { return new MockElementIdList(); }
+
+    ElementStore& store() { return m_store; }
+
+  private:
+    ElementStore m_store;
+    MockElementController m_elementController;
+    MockAttributeController m_attributeController;
+    MockGeometryController m_geometryController;
+  };
+}
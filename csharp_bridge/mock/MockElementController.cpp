@@ -0,0 +1,165 @@
+#include "MockElementController.h"
+
+#include <utility>
+#include <vector>
+
+namespace
+{
+  using CwAPI3D::Net::Bridge::Mock::ElementId;
+  using CwAPI3D::Net::Bridge::Mock::MockElementIdList;
+
+  const std::vector<ElementId>& idsOf(MockElementIdList* list)
+  {
+    static const std::vector<ElementId> empty;
+    return list ? list->ids() : empty;
+  }
+}
+
+CwAPI3D::Net::Bridge::Mock::MockElementIdList* CwAPI3D::Net::Bridge::Mock::MockElementController::beginResult()
+{
+  m_result.clear();
+  return &m_result;
+}
+
+CwAPI3D::Net::Bridge::Mock::MockElementIdList* CwAPI3D::Net::Bridge::Mock::MockElementController::getAllIdentifiableElementIDs()
+{
+  MockElementIdList* result = beginResult();
+  result->reserve(m_store.size());
+  for (const Element& element : m_store.elements())
+    result->append(element.id);
+  return result;
+}
+
+CwAPI3D::Net::Bridge::Mock::MockElementIdList* CwAPI3D::Net::Bridge::Mock::MockElementController::getVisibleIdentifiableElementIDs()
+{
+  return query([](const Element& element) { return element.visible; });
+}
+
+CwAPI3D::Net::Bridge::Mock::MockElementIdList* CwAPI3D::Net::Bridge::Mock::MockElementController::getInvisibleIdentifiableElementIDs()
+{
+  return query([](const Element& element) { return !element.visible; });
+}
+
+CwAPI3D::Net::Bridge::Mock::MockElementIdList* CwAPI3D::Net::Bridge::Mock::MockElementController::getActiveIdentifiableElementIDs()
+{
+  return query([](const Element& element) { return element.active; });
+}
+
+CwAPI3D::Net::Bridge::Mock::MockElementIdList* CwAPI3D::Net::Bridge::Mock::MockElementController::getInactiveAllIdentifiableElementIDs()
+{
+  return query([](const Element& element) { return !element.active; });
+}
+
+CwAPI3D::Net::Bridge::Mock::MockElementIdList* CwAPI3D::Net::Bridge::Mock::MockElementController::getInactiveVisibleIdentifiableElementIDs()
+{
+  return query([](const Element& element) { return !element.active && element.visible; });
+}
+
+void CwAPI3D::Net::Bridge::Mock::MockElementController::deleteElements(MockElementIdList* elementIDs)
+{
+  m_store.remove(idsOf(elementIDs));
+}
+
+void CwAPI3D::Net::Bridge::Mock::MockElementController::joinElements(MockElementIdList* elementIDs)
+{
+  m_store.join(idsOf(elementIDs), false);
+}
+
+void CwAPI3D::Net::Bridge::Mock::MockElementController::joinTopLevelElements(MockElementIdList* elementIDs)
+{
+  m_store.join(idsOf(elementIDs), true);
+}
+
+bool CwAPI3D::Net::Bridge::Mock::MockElementController::unjoinElements(MockElementIdList* elementIDs)
+{
+  return m_store.unjoin(idsOf(elementIDs), false);
+}
+
+bool CwAPI3D::Net::Bridge::Mock::MockElementController::unjoinTopLevelElements(MockElementIdList* elementIDs)
+{
+  return m_store.unjoin(idsOf(elementIDs), true);
+}
+
+CwAPI3D::Net::Bridge::Mock::ElementId CwAPI3D::Net::Bridge::Mock::MockElementController::createBeam(
+  Profile profile, double width, double height, Core::Vec3d p1, Core::Vec3d p2, Core::Vec3d p3)
+{
+  Element element;
+  element.type = ElementType::Beam;
+  element.profile = profile;
+  element.width = width;
+  element.height = height;
+  element.p1 = p1;
+  element.p2 = p2;
+  element.p3 = p3;
+  return m_store.add(element);
+}
+
+CwAPI3D::Net::Bridge::Mock::ElementId CwAPI3D::Net::Bridge::Mock::MockElementController::createRectangularBeamPoints(
+  double width, double height, Core::Vec3d p1, Core::Vec3d p2, Core::Vec3d p3)
+{
+  return createBeam(Profile::Rectangular, width, height, p1, p2, p3);
+}
+
+CwAPI3D::Net::Bridge::Mock::ElementId CwAPI3D::Net::Bridge::Mock::MockElementController::createCircularBeamPoints(
+  double diameter, Core::Vec3d p1, Core::Vec3d p2, Core::Vec3d p3)
+{
+  return createBeam(Profile::Circular, diameter, diameter, p1, p2, p3);
+}
+
+CwAPI3D::Net::Bridge::Mock::ElementId CwAPI3D::Net::Bridge::Mock::MockElementController::createSquareBeamPoints(
+  double width, Core::Vec3d p1, Core::Vec3d p2, Core::Vec3d p3)
+{
+  return createBeam(Profile::Square, width, width, p1, p2, p3);
+}
+
+CwAPI3D::Net::Bridge::Mock::MockElementIdList* CwAPI3D::Net::Bridge::Mock::MockElementController::solderElements(MockElementIdList* elementIDs)
+{
+  const ElementId soldered = m_store.solder(idsOf(elementIDs));
+  MockElementIdList* result = beginResult();
+  if (soldered != 0)
+    result->append(soldered);
+  return result;
+}
+
+void CwAPI3D::Net::Bridge::Mock::MockElementController::convertBeamToPanel(MockElementIdList* elementIDs)
+{
+  m_store.setType(idsOf(elementIDs), ElementType::Panel);
+}
+
+void CwAPI3D::Net::Bridge::Mock::MockElementController::convertPanelToBeam(MockElementIdList* elementIDs)
+{
+  m_store.setType(idsOf(elementIDs), ElementType::Beam);
+}
+
+void CwAPI3D::Net::Bridge::Mock::MockElementController::splitElements(MockElementIdList* elementIDs)
+{
+  std::vector<ElementId> created;
+  m_store.split(idsOf(elementIDs), created);
+}
+
+void CwAPI3D::Net::Bridge::Mock::MockElementController::moveElement(MockElementIdList* elementIDs, Core::Vec3d vector)
+{
+  m_store.translate(idsOf(elementIDs), vector);
+}
+
+CwAPI3D::Net::Bridge::Mock::MockElementIdList* CwAPI3D::Net::Bridge::Mock::MockElementController::copyElements(
+  MockElementIdList* elementIDs, Core::Vec3d vector)
+{
+  // The source may be the result list itself (e.g. copying what a query returned), so the new IDs are collected
+  // separately and only then moved into the result.
+  std::vector<ElementId> created;
+  m_store.copy(idsOf(elementIDs), vector, created);
+  MockElementIdList* result = beginResult();
+  result->ids() = std::move(created);
+  return result;
+}
+
+void CwAPI3D::Net::Bridge::Mock::MockElementController::makeUndo()
+{
+  m_store.undo();
+}
+
+void CwAPI3D::Net::Bridge::Mock::MockElementController::makeRedo()
+{
+  m_store.redo();
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "ElementStore.h"
+#include "MockElementIdList.h"
+
+#include <core/Vec3.h>
+
+namespace CwAPI3D::Net::Bridge::Mock
+{
+  /// Mirrors the ICwAPI3DElementController members used by ElementController, on top of an ElementStore.
+  /// Points and vectors are Core::Vec3d, which has the layout of CwAPI3D::vector3D.
+  /// Lists returned by the queries are owned by the controller and stay valid until the next call that returns
+  /// a list; like the SDK's, they are never destroyed by the caller.
+  class MockElementController
+  {
+  public:
+    explicit MockElementController(ElementStore& store) : m_store(store) {}
+
+    MockElementController(const MockElementController&) = delete;
+    MockElementController& operator=(const MockElementController&) = delete;
+
+    MockElementIdList* getAllIdentifiableElementIDs();
+    MockElementIdList* getVisibleIdentifiableElementIDs();
+    MockElementIdList* getInvisibleIdentifiableElementIDs();
+    MockElementIdList* getActiveIdentifiableElementIDs();
+    MockElementIdList* getInactiveAllIdentifiableElementIDs();
+    MockElementIdList* getInactiveVisibleIdentifiableElementIDs();
+
+    void deleteElements(MockElementIdList* elementIDs);
+    void joinElements(MockElementIdList* elementIDs);
+    void joinTopLevelElements(MockElementIdList* elementIDs);
+    bool unjoinElements(MockElementIdList* elementIDs);
+    bool unjoinTopLevelElements(MockElementIdList* elementIDs);
+
+    ElementId createRectangularBeamPoints(double width, double height, Core::Vec3d p1, Core::Vec3d p2, Core::Vec3d p3);
+    ElementId createCircularBeamPoints(double diameter, Core::Vec3d p1, Core::Vec3d p2, Core::Vec3d p3);
+    ElementId createSquareBeamPoints(double width, Core::Vec3d p1, Core::Vec3d p2, Core::Vec3d p3);
+
+    MockElementIdList* solderElements(MockElementIdList* elementIDs);
+    void convertBeamToPanel(MockElementIdList* elementIDs);
+    void convertPanelToBeam(MockElementIdList* elementIDs);
+    void splitElements(MockElementIdList* elementIDs);
+
+    void moveElement(MockElementIdList* elementIDs, Core::Vec3d vector);
+    MockElementIdList* copyElements(MockElementIdList* elementIDs, Core::Vec3d vector);
+
+    void makeUndo();
+    void makeRedo();
+
+    ElementStore& store() { return m_store; }
+
+  private:
+    /// Clears and returns the result list; its storage is reused from call to call.
+    MockElementIdList* beginResult();
+
+    template <class Predicate>
+    MockElementIdList* query(Predicate predicate)
+    {
+      MockElementIdList* result = beginResult();
+      m_store.collect(predicate, result->ids());
+      return result;
+    }
+
+    ElementId createBeam(Profile profile, double width, double height, Core::Vec3d p1, Core::Vec3d p2, Core::Vec3d p3);
+
+    ElementStore& m_store;
+    MockElementIdList m_result;
+  };
+}
@@ -0,0 +1,6 @@
+#include "MockElementIdList.h"
+
+void CwAPI3D::Net::Bridge::Mock::MockElementIdList::destroy()
+{
+  delete this;
+}
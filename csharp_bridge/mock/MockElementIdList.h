@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// In-process stand-in for the CwAPI3D SDK, used to load-test the bridge without a running CAD host.
+// The mock classes mirror the members of ICwAPI3DElementIDList, ICwAPI3DElementController and
+// ICwAPI3DControllerFactory that the bridge calls (same names and argument order), so code templated on the
+// list or controller type - such as Interop::Detail - runs unchanged against either.
+namespace CwAPI3D::Net::Bridge::Mock
+{
+  /// Same representation as the SDK's elementID.
+  using ElementId = std::uint64_t;
+
+  /// Element ID list backed by a contiguous vector.
+  class MockElementIdList
+  {
+  public:
+    MockElementIdList() { s_live.fetch_add(1, std::memory_order_relaxed); }
+    explicit MockElementIdList(std::vector<ElementId> ids) : m_ids(std::move(ids))
+    {
+      s_live.fetch_add(1, std::memory_order_relaxed);
+    }
+    ~MockElementIdList() { s_live.fetch_sub(1, std::memory_order_relaxed); }
+
+    MockElementIdList(const MockElementIdList&) = delete;
+    MockElementIdList& operator=(const MockElementIdList&) = delete;
+
+    /// Deletes a list created by MockControllerFactory::createEmptyElementIDList, as the SDK's destroy() does.
+    void destroy();
+
+    std::uint64_t count() const { return m_ids.size(); }
+    ElementId at(std::uint64_t index) const { return m_ids[index]; }
+    void append(ElementId id) { m_ids.push_back(id); }
+    void clear() { m_ids.clear(); }
+
+    void reserve(std::size_t capacity) { m_ids.reserve(capacity); }
+    const ElementId* data() const { return m_ids.data(); }
+    const std::vector<ElementId>& ids() const { return m_ids; }
+    std::vector<ElementId>& ids() { return m_ids; }
+
+    /// Number of lists currently alive, so soak runs can check that pooled lists are not leaked.
+    static std::int64_t liveCount() { return s_live.load(std::memory_order_relaxed); }
+
+  private:
+    inline static std::atomic<std::int64_t> s_live{0};
+
+    std::vector<ElementId> m_ids;
+  };
+}
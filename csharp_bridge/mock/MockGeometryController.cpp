@@ -0,0 +1,73 @@
+#include "MockGeometryController.h"
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+
+  Core::Vec3d localX(const Mock::Element& element)
+  {
+    return Core::normalize(element.p2 - element.p1);
+  }
+
+  /// The part of p1 -> p3 perpendicular to the axis.
+  Core::Vec3d localZ(const Mock::Element& element)
+  {
+    const Core::Vec3d x = localX(element);
+    const Core::Vec3d toP3 = element.p3 - element.p1;
+    return Core::normalize(toP3 - x * Core::dot(toP3, x));
+  }
+}
+
+CwAPI3D::Net::Bridge::Core::Vec3d CwAPI3D::Net::Bridge::Mock::MockGeometryController::getP1(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return element ? element->p1 : Core::Vec3d{};
+}
+
+CwAPI3D::Net::Bridge::Core::Vec3d CwAPI3D::Net::Bridge::Mock::MockGeometryController::getP2(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return element ? element->p2 : Core::Vec3d{};
+}
+
+CwAPI3D::Net::Bridge::Core::Vec3d CwAPI3D::Net::Bridge::Mock::MockGeometryController::getP3(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return element ? element->p3 : Core::Vec3d{};
+}
+
+CwAPI3D::Net::Bridge::Core::Vec3d CwAPI3D::Net::Bridge::Mock::MockGeometryController::getXL(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return element ? localX(*element) : Core::Vec3d{};
+}
+
+CwAPI3D::Net::Bridge::Core::Vec3d CwAPI3D::Net::Bridge::Mock::MockGeometryController::getYL(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return element ? Core::cross(localZ(*element), localX(*element)) : Core::Vec3d{};
+}
+
+CwAPI3D::Net::Bridge::Core::Vec3d CwAPI3D::Net::Bridge::Mock::MockGeometryController::getZL(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return element ? localZ(*element) : Core::Vec3d{};
+}
+
+double CwAPI3D::Net::Bridge::Mock::MockGeometryController::getWidth(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return element ? element->width : 0.0;
+}
+
+double CwAPI3D::Net::Bridge::Mock::MockGeometryController::getHeight(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return element ? element->height : 0.0;
+}
+
+double CwAPI3D::Net::Bridge::Mock::MockGeometryController::getLength(ElementId id)
+{
+  const Element* element = m_store.find(id);
+  return element ? Core::distance(element->p1, element->p2) : 0.0;
+}
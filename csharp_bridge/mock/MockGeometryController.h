@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ElementStore.h"
+
+#include <core/Vec3.h>
+
+namespace CwAPI3D::Net::Bridge::Mock
+{
+  /// Mirrors the ICwAPI3DGeometryController members used by the bridge, on top of an ElementStore. Points and
+  /// vectors are Core::Vec3d, which has the layout of CwAPI3D::vector3D. The local x axis runs from p1 to p2, the
+  /// local z axis towards p3 and the local y axis completes the right-handed frame. Unknown IDs return zeros.
+  class MockGeometryController
+  {
+  public:
+    explicit MockGeometryController(ElementStore& store) : m_store(store) {}
+
+    MockGeometryController(const MockGeometryController&) = delete;
+    MockGeometryController& operator=(const MockGeometryController&) = delete;
+
+    Core::Vec3d getP1(ElementId id);
+    Core::Vec3d getP2(ElementId id);
+    Core::Vec3d getP3(ElementId id);
+    Core::Vec3d getXL(ElementId id);
+    Core::Vec3d getYL(ElementId id);
+    Core::Vec3d getZL(ElementId id);
+    double getWidth(ElementId id);
+    double getHeight(ElementId id);
+    double getLength(ElementId id);
+
+  private:
+    ElementStore& m_store;
+  };
+}
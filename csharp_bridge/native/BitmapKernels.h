@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Word-wise kernels over bitmaps, used by IdSet for its dense containers. They share the instruction set
+// selection of the SoA kernels (see activeSimdLevel in SoaKernels.h). Output may alias either input.
+namespace CwAPI3D::Net::Bridge::Native::Kernels
+{
+  /// out[i] = a[i] & b[i]; returns the number of set bits in out.
+  std::size_t bitmapAnd(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t words);
+
+  /// out[i] = a[i] | b[i]; returns the number of set bits in out.
+  std::size_t bitmapOr(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t words);
+
+  /// out[i] = a[i] & ~b[i]; returns the number of set bits in out.
+  std::size_t bitmapAndNot(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t words);
+
+  /// Returns the number of set bits in the words.
+  std::size_t bitmapCount(const std::uint64_t* bits, std::size_t words);
+}
@@ -0,0 +1,704 @@
+#include "Bvh.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+namespace
+{
+  using CwAPI3D::Net::Bridge::Core::Vec3d;
+  using CwAPI3D::Net::Bridge::Native::Aabb;
+
+  constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+  /// Nodes with at least this many boxes are measured and binned on all cores during a parallel build.
+  constexpr std::size_t ParallelBinningThreshold = 64 * 1024;
+  /// A parallel build hands subtrees of at most count / (threads * this) boxes, but no fewer than
+  /// MinSubtreeSize, to the worker threads.
+  constexpr std::size_t SubtreesPerThread = 4;
+  constexpr std::size_t MinSubtreeSize = 4096;
+
+  /// Cost of visiting one inner node, relative to testing one box, in the SAH estimate. Leaf boxes are tested
+  /// back to back without a stack push, so an inner node costs about two box tests.
+  constexpr double TraversalCost = 2.0;
+
+  double component(const Vec3d& v, int axis)
+  {
+    return axis == 0 ? v.x : axis == 1 ? v.y : v.z;
+  }
+
+  Aabb emptyBox()
+  {
+    return Aabb{{Infinity, Infinity, Infinity}, {-Infinity, -Infinity, -Infinity}};
+  }
+
+  void grow(Aabb& box, const Aabb& other)
+  {
+    box.min = {std::min(box.min.x, other.min.x), std::min(box.min.y, other.min.y), std::min(box.min.z, other.min.z)};
+    box.max = {std::max(box.max.x, other.max.x), std::max(box.max.y, other.max.y), std::max(box.max.z, other.max.z)};
+  }
+
+  void grow(Aabb& box, const Vec3d& point)
+  {
+    grow(box, Aabb{point, point});
+  }
+
+  /// Half the surface area; the SAH only compares areas, so the factor 2 is dropped.
+  double halfArea(const Aabb& box)
+  {
+    const Vec3d extent = box.max - box.min;
+    if (extent.x < 0.0)
+      return 0.0;
+    return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+  }
+
+  bool overlaps(const Aabb& a, const Aabb& b)
+  {
+    return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y &&
+           a.min.z <= b.max.z && b.min.z <= a.max.z;
+  }
+
+  double distanceSquared(const Aabb& box, const Vec3d& point)
+  {
+    const double dx = std::max({box.min.x - point.x, 0.0, point.x - box.max.x});
+    const double dy = std::max({box.min.y - point.y, 0.0, point.y - box.max.y});
+    const double dz = std::max({box.min.z - point.z, 0.0, point.z - box.max.z});
+    return dx * dx + dy * dy + dz * dz;
+  }
+
+  /// Range of n . p + d over the corners of the box.
+  std::pair<double, double> planeRange(const Aabb& box, const Vec3d& normal, double d)
+  {
+    const Vec3d center = (box.min + box.max) * 0.5;
+    const Vec3d extent = (box.max - box.min) * 0.5;
+    const double distance = CwAPI3D::Net::Bridge::Core::dot(normal, center) + d;
+    const double radius = std::abs(normal.x) * extent.x + std::abs(normal.y) * extent.y + std::abs(normal.z) * extent.z;
+    return {distance - radius, distance + radius};
+  }
+
+  /// A ray prepared for slab tests. Axes the ray runs parallel to are tested by containment instead of by
+  /// division, so rays along an axis and origins on a box face need no special care by the caller.
+  struct Ray
+  {
+    std::array<double, 3> origin;
+    std::array<double, 3> inverse;
+    std::array<bool, 3> parallel;
+
+    Ray(const Vec3d& from, const Vec3d& direction)
+    {
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        const double d = component(direction, axis);
+        origin[axis] = component(from, axis);
+        parallel[axis] = d == 0.0;
+        inverse[axis] = parallel[axis] ? 0.0 : 1.0 / d;
+      }
+    }
+
+    /// Sets `entry` to where the ray enters the box (0 when it starts inside) if that is at most maxDistance.
+    bool enters(const Aabb& box, double maxDistance, double& entry) const
+    {
+      double near = 0.0;
+      double far = maxDistance;
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        const double low = component(box.min, axis);
+        const double high = component(box.max, axis);
+        if (parallel[axis])
+        {
+          if (origin[axis] < low || origin[axis] > high)
+            return false;
+          continue;
+        }
+        double t1 = (low - origin[axis]) * inverse[axis];
+        double t2 = (high - origin[axis]) * inverse[axis];
+        if (t1 > t2)
+          std::swap(t1, t2);
+        near = std::max(near, t1);
+        far = std::min(far, t2);
+        if (near > far)
+          return false;
+      }
+      entry = near;
+      return true;
+    }
+  };
+
+  /// Depth-first traversal stack. Pushing both children of every visited node never holds more than
+  /// depth + 1 entries, which fits the inline storage for any reasonably balanced tree.
+  template <class Entry>
+  class TraversalStack
+  {
+  public:
+    explicit TraversalStack(std::size_t depth)
+    {
+      if (depth + 1 > m_local.size())
+        m_heap.resize(depth + 1);
+      m_data = m_heap.empty() ? m_local.data() : m_heap.data();
+    }
+
+    void push(const Entry& entry) { m_data[m_size++] = entry; }
+    bool empty() const { return m_size == 0; }
+    Entry pop() { return m_data[--m_size]; }
+
+  private:
+    std::array<Entry, 64> m_local;
+    std::vector<Entry> m_heap;
+    Entry* m_data;
+    std::size_t m_size = 0;
+  };
+
+  /// A box during the build. The partitioning moves the boxes themselves rather than indices to them, so every
+  /// pass over a node reads memory in order.
+  struct Primitive
+  {
+    Aabb box;
+    Vec3d centroid;
+    std::uint32_t index;
+  };
+
+  struct NodeDistance
+  {
+    std::uint32_t node;
+    double distance;
+  };
+}
+
+namespace CwAPI3D::Net::Bridge::Native
+{
+  /// Binned SAH builder that reorders the primitives into leaf order. Subtrees handed out by a parallel build are
+  /// built into their own node vectors by separate Builder instances over disjoint ranges of the same primitives.
+  class Bvh::Builder
+  {
+  public:
+    Builder(Primitive* primitives, bool parallel) : m_primitives(primitives), m_parallel(parallel)
+    {
+    }
+
+    /// A subtree over [begin, end) that the parallel build defers to a worker thread.
+    struct Subtree
+    {
+      std::uint32_t node;
+      std::uint32_t begin;
+      std::uint32_t end;
+      std::size_t level;
+      std::vector<Node> nodes;
+      std::size_t depth = 0;
+    };
+
+    /// Builds node `index` of `nodes` over [begin, end) at the given level (root = 1). With a deferral limit,
+    /// ranges of at most that many boxes are appended to `deferred` instead of being built.
+    void buildNode(std::vector<Node>& nodes, std::uint32_t index, std::uint32_t begin, std::uint32_t end,
+      std::size_t level, std::size_t deferLimit, std::vector<Subtree>* deferred)
+    {
+      const std::size_t count = end - begin;
+      if (deferred && count <= deferLimit)
+      {
+        deferred->push_back(Subtree{index, begin, end, level, {}, 0});
+        return;
+      }
+
+      const Extent extent = measure(begin, end);
+      nodes[index].bounds = extent.bounds;
+
+      const std::uint32_t mid = split(extent, begin, end);
+      if (mid == end)
+      {
+        nodes[index].first = begin;
+        nodes[index].count = static_cast<std::uint32_t>(count);
+        m_depth = std::max(m_depth, level);
+        return;
+      }
+
+      const auto left = static_cast<std::uint32_t>(nodes.size());
+      nodes.resize(nodes.size() + 2);
+      nodes[index].first = left;
+      nodes[index].count = 0;
+      buildNode(nodes, left, begin, mid, level + 1, deferLimit, deferred);
+      buildNode(nodes, left + 1, mid, end, level + 1, deferLimit, deferred);
+    }
+
+    std::size_t depth() const { return m_depth; }
+
+  private:
+    struct Extent
+    {
+      Aabb bounds;
+      Aabb centroids;
+    };
+
+    struct Bin
+    {
+      Aabb bounds;
+      std::uint32_t count;
+    };
+
+    /// Bins along one axis; only the first `count` are used.
+    struct Bins
+    {
+      std::array<Bin, BinCount> bins;
+      std::size_t count;
+      int axis;
+      double low;
+      double scale;
+
+      std::size_t binOf(const Core::Vec3d& centroid) const
+      {
+        const auto bin = static_cast<std::size_t>((component(centroid, axis) - low) * scale);
+        return std::min(bin, count - 1);
+      }
+    };
+
+    bool parallelOver(std::size_t count) const { return m_parallel && count >= ParallelBinningThreshold; }
+
+    /// Calls body(first, last) over [begin, end), split across cores for large ranges of a parallel build.
+    template <class Body>
+    void forRange(std::uint32_t begin, std::uint32_t end, Body&& body) const
+    {
+      const std::size_t count = end - begin;
+      if (!parallelOver(count))
+      {
+        body(begin, end);
+        return;
+      }
+      parallelFor(count, ParallelBinningThreshold / 4, [&](std::size_t first, std::size_t last) {
+        body(begin + static_cast<std::uint32_t>(first), begin + static_cast<std::uint32_t>(last));
+      });
+    }
+
+    Extent measure(std::uint32_t begin, std::uint32_t end) const
+    {
+      Extent extent{emptyBox(), emptyBox()};
+      std::mutex lock;
+      forRange(begin, end, [&](std::uint32_t first, std::uint32_t last) {
+        Extent partial{emptyBox(), emptyBox()};
+        for (std::uint32_t i = first; i < last; ++i)
+        {
+          grow(partial.bounds, m_primitives[i].box);
+          grow(partial.centroids, m_primitives[i].centroid);
+        }
+        const std::lock_guard<std::mutex> guard(lock);
+        grow(extent.bounds, partial.bounds);
+        grow(extent.centroids, partial.centroids);
+      });
+      return extent;
+    }
+
+    void fill(Bins& bins, std::uint32_t first, std::uint32_t last) const
+    {
+      for (std::uint32_t i = first; i < last; ++i)
+      {
+        Bin& bin = bins.bins[bins.binOf(m_primitives[i].centroid)];
+        grow(bin.bounds, m_primitives[i].box);
+        ++bin.count;
+      }
+    }
+
+    /// Reorders [begin, end) into two children and returns where the second starts, or `end` for a leaf.
+    std::uint32_t split(const Extent& extent, std::uint32_t begin, std::uint32_t end)
+    {
+      const std::size_t count = end - begin;
+      if (count <= 1)
+        return end;
+
+      // Bin along the axis the centroids spread widest on. Binning all three axes finds slightly better splits
+      // but makes the build about 1.6 times slower for no measurable gain in query time on element bounds.
+      int axis = 0;
+      for (int a = 1; a < 3; ++a)
+      {
+        if (component(extent.centroids.max - extent.centroids.min, a) >
+            component(extent.centroids.max - extent.centroids.min, axis))
+          axis = a;
+      }
+      const double width = component(extent.centroids.max, axis) - component(extent.centroids.min, axis);
+      if (!(width > 0.0))
+        return count <= MaxLeafSize ? end : begin + static_cast<std::uint32_t>(count / 2);
+
+      // Small nodes get fewer bins: the per-node sweep would otherwise dominate the build near the leaves.
+      Bins bins;
+      bins.count = std::min(BinCount, count);
+      bins.axis = axis;
+      bins.low = component(extent.centroids.min, axis);
+      bins.scale = static_cast<double>(bins.count) / width;
+      for (std::size_t b = 0; b < bins.count; ++b)
+        bins.bins[b] = Bin{emptyBox(), 0};
+
+      if (!parallelOver(count))
+        fill(bins, begin, end);
+      else
+      {
+        std::mutex lock;
+        forRange(begin, end, [&](std::uint32_t first, std::uint32_t last) {
+          Bins partial = bins;
+          fill(partial, first, last);
+          const std::lock_guard<std::mutex> guard(lock);
+          for (std::size_t b = 0; b < bins.count; ++b)
+          {
+            grow(bins.bins[b].bounds, partial.bins[b].bounds);
+            bins.bins[b].count += partial.bins[b].count;
+          }
+        });
+      }
+
+      // Sweep from the right to get the cost of every bin boundary, then from the left to pick one.
+      std::array<double, BinCount> rightCost;
+      Aabb right = emptyBox();
+      std::uint32_t rightCount = 0;
+      for (std::size_t b = bins.count - 1; b > 0; --b)
+      {
+        grow(right, bins.bins[b].bounds);
+        rightCount += bins.bins[b].count;
+        rightCost[b] = halfArea(right) * rightCount;
+      }
+      double bestCost = Infinity;
+      std::size_t bestBoundary = 0;
+      Aabb left = emptyBox();
+      std::uint32_t leftCount = 0;
+      for (std::size_t b = 1; b < bins.count; ++b)
+      {
+        grow(left, bins.bins[b - 1].bounds);
+        leftCount += bins.bins[b - 1].count;
+        if (leftCount == 0 || leftCount == count)
+          continue;
+        const double cost = halfArea(left) * leftCount + rightCost[b];
+        if (cost < bestCost)
+        {
+          bestCost = cost;
+          bestBoundary = b;
+        }
+      }
+
+      const double area = halfArea(extent.bounds);
+      if (count <= MaxLeafSize && (bestBoundary == 0 || TraversalCost * area + bestCost >= area * count))
+        return end;
+
+      Primitive* first = m_primitives + begin;
+      Primitive* last = m_primitives + end;
+      Primitive* mid = first;
+      if (bestBoundary != 0)
+      {
+        mid = std::partition(first, last, [&](const Primitive& primitive) {
+          return bins.binOf(primitive.centroid) < bestBoundary;
+        });
+      }
+      if (mid == first || mid == last)
+      {
+        // Every centroid fell into one bin: fall back to a median split.
+        mid = first + count / 2;
+        std::nth_element(first, mid, last, [axis](const Primitive& a, const Primitive& b) {
+          return component(a.centroid, axis) < component(b.centroid, axis);
+        });
+      }
+      return static_cast<std::uint32_t>(mid - m_primitives);
+    }
+
+    Primitive* m_primitives;
+    bool m_parallel;
+    std::size_t m_depth = 0;
+  };
+
+  Bvh Bvh::build(const std::int32_t* ids, const Aabb* boxes, std::size_t count, bool parallel)
+  {
+    Bvh tree;
+    if (count == 0)
+      return tree;
+
+    std::vector<Primitive> primitives(count);
+    const auto prepare = [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        const Aabb& box = boxes[i];
+        Primitive& primitive = primitives[i];
+        primitive.box.min = {std::min(box.min.x, box.max.x), std::min(box.min.y, box.max.y), std::min(box.min.z, box.max.z)};
+        primitive.box.max = {std::max(box.min.x, box.max.x), std::max(box.min.y, box.max.y), std::max(box.min.z, box.max.z)};
+        primitive.centroid = (primitive.box.min + primitive.box.max) * 0.5;
+        primitive.index = static_cast<std::uint32_t>(i);
+      }
+    };
+    if (parallel)
+      parallelFor(count, ParallelBinningThreshold, prepare);
+    else
+      prepare(0, count);
+
+    Builder top(primitives.data(), parallel);
+    tree.m_nodes.reserve(2 * count / MaxLeafSize + 1);
+    tree.m_nodes.resize(1);
+
+    const std::size_t threads = parallelThreads();
+    if (!parallel || threads == 1 || count < 2 * MinSubtreeSize)
+    {
+      top.buildNode(tree.m_nodes, 0, 0, static_cast<std::uint32_t>(count), 1, 0, nullptr);
+      tree.m_depth = top.depth();
+    }
+    else
+    {
+      // Split the top levels here, then build the subtrees below them on all cores and splice them in.
+      std::vector<Builder::Subtree> subtrees;
+      const std::size_t deferLimit = std::max(MinSubtreeSize, count / (threads * SubtreesPerThread));
+      top.buildNode(tree.m_nodes, 0, 0, static_cast<std::uint32_t>(count), 1, deferLimit, &subtrees);
+      tree.m_depth = top.depth();
+
+      parallelFor(subtrees.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t s = begin; s < end; ++s)
+        {
+          Builder::Subtree& subtree = subtrees[s];
+          Builder builder(primitives.data(), false);
+          subtree.nodes.reserve(2 * (subtree.end - subtree.begin) / MaxLeafSize + 1);
+          subtree.nodes.resize(1);
+          builder.buildNode(subtree.nodes, 0, subtree.begin, subtree.end, subtree.level, 0, nullptr);
+          subtree.depth = builder.depth();
+        }
+      });
+
+      for (Builder::Subtree& subtree : subtrees)
+      {
+        // Local node k > 0 lands at offset + k - 1; the local root replaces the placeholder node.
+        const auto offset = static_cast<std::uint32_t>(tree.m_nodes.size());
+        for (Node& node : subtree.nodes)
+        {
+          if (node.count == 0)
+            node.first += offset - 1;
+        }
+        tree.m_nodes[subtree.node] = subtree.nodes[0];
+        tree.m_nodes.insert(tree.m_nodes.end(), subtree.nodes.begin() + 1, subtree.nodes.end());
+        tree.m_depth = std::max(tree.m_depth, subtree.depth);
+      }
+    }
+
+    tree.m_boxes.resize(count);
+    tree.m_ids.resize(count);
+    const auto gather = [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        tree.m_boxes[i] = primitives[i].box;
+        tree.m_ids[i] = ids[primitives[i].index];
+      }
+    };
+    if (parallel)
+      parallelFor(count, ParallelBinningThreshold, gather);
+    else
+      gather(0, count);
+    return tree;
+  }
+
+  std::size_t Bvh::memoryBytes() const
+  {
+    return m_nodes.capacity() * sizeof(Node) + m_boxes.capacity() * sizeof(Aabb) +
+           m_ids.capacity() * sizeof(std::int32_t);
+  }
+
+  void Bvh::queryBox(const Aabb& box, std::vector<std::int32_t>& out) const
+  {
+    if (m_nodes.empty())
+      return;
+
+    TraversalStack<std::uint32_t> stack(m_depth);
+    stack.push(0);
+    while (!stack.empty())
+    {
+      const Node& node = m_nodes[stack.pop()];
+      if (!overlaps(node.bounds, box))
+        continue;
+      if (node.count == 0)
+      {
+        stack.push(node.first + 1);
+        stack.push(node.first);
+        continue;
+      }
+      for (std::uint32_t i = node.first; i < node.first + node.count; ++i)
+      {
+        if (overlaps(m_boxes[i], box))
+          out.push_back(m_ids[i]);
+      }
+    }
+  }
+
+  void Bvh::queryHalfSpace(const Core::Planed& plane, HalfSpaceMode mode, std::vector<std::int32_t>& out) const
+  {
+    if (m_nodes.empty())
+      return;
+
+    const auto accepts = [mode](const std::pair<double, double>& range) {
+      switch (mode)
+      {
+      case HalfSpaceMode::Overlapping:
+        return range.second >= 0.0;
+      case HalfSpaceMode::Inside:
+        return range.first >= 0.0;
+      default:
+        return range.first <= 0.0 && range.second >= 0.0;
+      }
+    };
+
+    TraversalStack<std::uint32_t> stack(m_depth);
+    stack.push(0);
+    while (!stack.empty())
+    {
+      const Node& node = m_nodes[stack.pop()];
+      const auto range = planeRange(node.bounds, plane.normal(), plane.d());
+      // Every box lies within its node's range, so a node entirely outside is skipped and, except for
+      // straddling, a node entirely inside is taken whole: its boxes are the contiguous run between its
+      // leftmost and rightmost leaf.
+      if (range.second < 0.0 || (mode == HalfSpaceMode::Straddling && range.first > 0.0))
+        continue;
+      if (mode != HalfSpaceMode::Straddling && range.first >= 0.0)
+      {
+        const Node* leftmost = &node;
+        while (leftmost->count == 0)
+          leftmost = &m_nodes[leftmost->first];
+        const Node* rightmost = &node;
+        while (rightmost->count == 0)
+          rightmost = &m_nodes[rightmost->first + 1];
+        out.insert(out.end(), m_ids.begin() + leftmost->first, m_ids.begin() + rightmost->first + rightmost->count);
+        continue;
+      }
+      if (node.count == 0)
+      {
+        stack.push(node.first + 1);
+        stack.push(node.first);
+        continue;
+      }
+      for (std::uint32_t i = node.first; i < node.first + node.count; ++i)
+      {
+        if (accepts(planeRange(m_boxes[i], plane.normal(), plane.d())))
+          out.push_back(m_ids[i]);
+      }
+    }
+  }
+
+  bool Bvh::nearest(const Core::Vec3d& point, double maxDistance, std::int32_t& id, double& distance) const
+  {
+    if (m_nodes.empty() || !(maxDistance >= 0.0))
+      return false;
+
+    double best = maxDistance * maxDistance;
+    bool found = false;
+    TraversalStack<NodeDistance> stack(m_depth);
+    stack.push({0, distanceSquared(m_nodes[0].bounds, point)});
+    while (!stack.empty())
+    {
+      const NodeDistance entry = stack.pop();
+      if (entry.distance > best)
+        continue;
+
+      const Node& node = m_nodes[entry.node];
+      if (node.count == 0)
+      {
+        // Push the farther child first so the nearer one is searched first and tightens the bound.
+        NodeDistance left{node.first, distanceSquared(m_nodes[node.first].bounds, point)};
+        NodeDistance right{node.first + 1, distanceSquared(m_nodes[node.first + 1].bounds, point)};
+        if (left.distance < right.distance)
+          std::swap(left, right);
+        stack.push(left);
+        stack.push(right);
+        continue;
+      }
+      for (std::uint32_t i = node.first; i < node.first + node.count; ++i)
+      {
+        const double d = distanceSquared(m_boxes[i], point);
+        if (d < best || (!found && d <= best))
+        {
+          best = d;
+          id = m_ids[i];
+          found = true;
+        }
+      }
+    }
+
+    if (found)
+      distance = std::sqrt(best);
+    return found;
+  }
+
+  bool Bvh::rayCast(const Core::Vec3d& origin, const Core::Vec3d& direction, double maxDistance, RayHit& hit) const
+  {
+    if (m_nodes.empty())
+      return false;
+
+    const Ray ray(origin, direction);
+    double best = maxDistance;
+    bool found = false;
+    double entry = 0.0;
+    if (!ray.enters(m_nodes[0].bounds, best, entry))
+      return false;
+
+    TraversalStack<NodeDistance> stack(m_depth);
+    stack.push({0, entry});
+    while (!stack.empty())
+    {
+      const NodeDistance current = stack.pop();
+      if (current.distance > best)
+        continue;
+
+      const Node& node = m_nodes[current.node];
+      if (node.count == 0)
+      {
+        double leftEntry = 0.0;
+        double rightEntry = 0.0;
+        const bool hitsLeft = ray.enters(m_nodes[node.first].bounds, best, leftEntry);
+        const bool hitsRight = ray.enters(m_nodes[node.first + 1].bounds, best, rightEntry);
+        NodeDistance left{node.first, leftEntry};
+        NodeDistance right{node.first + 1, rightEntry};
+        if (hitsLeft && hitsRight && leftEntry < rightEntry)
+          std::swap(left, right);
+        if (hitsLeft && hitsRight)
+        {
+          stack.push(left);
+          stack.push(right);
+        }
+        else if (hitsLeft)
+          stack.push(left);
+        else if (hitsRight)
+          stack.push(right);
+        continue;
+      }
+      for (std::uint32_t i = node.first; i < node.first + node.count; ++i)
+      {
+        if (ray.enters(m_boxes[i], best, entry) && (!found || entry < best))
+        {
+          best = entry;
+          hit = RayHit{m_ids[i], entry};
+          found = true;
+        }
+      }
+    }
+    return found;
+  }
+
+  void Bvh::rayCastAll(const Core::Vec3d& origin, const Core::Vec3d& direction, double maxDistance,
+    std::vector<RayHit>& out) const
+  {
+    if (m_nodes.empty())
+      return;
+
+    const Ray ray(origin, direction);
+    const std::size_t first = out.size();
+    double entry = 0.0;
+    TraversalStack<std::uint32_t> stack(m_depth);
+    stack.push(0);
+    while (!stack.empty())
+    {
+      const Node& node = m_nodes[stack.pop()];
+      if (!ray.enters(node.bounds, maxDistance, entry))
+        continue;
+      if (node.count == 0)
+      {
+        stack.push(node.first + 1);
+        stack.push(node.first);
+        continue;
+      }
+      for (std::uint32_t i = node.first; i < node.first + node.count; ++i)
+      {
+        if (ray.enters(m_boxes[i], maxDistance, entry))
+          out.push_back(RayHit{m_ids[i], entry});
+      }
+    }
+    std::sort(out.begin() + static_cast<std::ptrdiff_t>(first), out.end(), [](const RayHit& a, const RayHit& b) {
+      return a.distance < b.distance || (a.distance == b.distance && a.id < b.id);
+    });
+  }
+}
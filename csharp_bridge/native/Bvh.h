@@ -0,0 +1,94 @@
+#pragma once
+
+#include "../core/Plane.h"
+#include "../core/Vec3.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Plain C++ (no /clr) bounding-volume hierarchy over element bounding boxes, behind the managed ElementBoundsTree.
+// Built top-down with binned SAH (surface area heuristic); subtrees below the top levels are built in parallel.
+namespace CwAPI3D::Net::Bridge::Native
+{
+  /// Axis-aligned box from min to max.
+  struct Aabb
+  {
+    Core::Vec3d min;
+    Core::Vec3d max;
+  };
+
+  class Bvh
+  {
+  public:
+    /// Leaves hold at most this many boxes; SAH may stop splitting earlier.
+    static constexpr std::size_t MaxLeafSize = 8;
+    /// Number of bins the SAH split is chosen from.
+    static constexpr std::size_t BinCount = 16;
+
+    /// A box hit by a ray, `distance` along the unit ray direction (0 when the origin is inside the box).
+    struct RayHit
+    {
+      std::int32_t id;
+      double distance;
+    };
+
+    /// Which boxes queryHalfSpace reports for the half-space n . p + d >= 0 of a plane.
+    enum class HalfSpaceMode
+    {
+      /// Boxes with any part in the half-space.
+      Overlapping,
+      /// Boxes entirely in the half-space.
+      Inside,
+      /// Boxes the plane passes through.
+      Straddling
+    };
+
+    Bvh() = default;
+
+    /// Builds the tree over `count` boxes, box i belonging to element ids[i]. The corners of a box may be given
+    /// in any order. With `parallel`, large inputs are built on all cores.
+    static Bvh build(const std::int32_t* ids, const Aabb* boxes, std::size_t count, bool parallel);
+
+    std::size_t size() const { return m_ids.size(); }
+    std::size_t nodeCount() const { return m_nodes.size(); }
+    /// Number of nodes on the longest root-to-leaf path.
+    std::size_t depth() const { return m_depth; }
+    std::size_t memoryBytes() const;
+
+    /// Appends the IDs of all boxes that overlap `box` (touching counts) to `out`.
+    void queryBox(const Aabb& box, std::vector<std::int32_t>& out) const;
+
+    /// Appends the IDs of the boxes in the given relation to the plane's positive half-space to `out`.
+    void queryHalfSpace(const Core::Planed& plane, HalfSpaceMode mode, std::vector<std::int32_t>& out) const;
+
+    /// Finds the box closest to `point` (distance 0 when the point is inside) within maxDistance.
+    /// Returns false when no box is that close.
+    bool nearest(const Core::Vec3d& point, double maxDistance, std::int32_t& id, double& distance) const;
+
+    /// Finds the first box a ray from `origin` along the unit vector `direction` enters within maxDistance.
+    bool rayCast(const Core::Vec3d& origin, const Core::Vec3d& direction, double maxDistance, RayHit& hit) const;
+
+    /// Appends every box the ray enters within maxDistance to `out`, nearest first.
+    void rayCastAll(const Core::Vec3d& origin, const Core::Vec3d& direction, double maxDistance,
+      std::vector<RayHit>& out) const;
+
+  private:
+    /// Inner nodes have count 0 and their children at first and first + 1; leaves hold the boxes
+    /// [first, first + count) of m_boxes.
+    struct Node
+    {
+      Aabb bounds;
+      std::uint32_t first = 0;
+      std::uint32_t count = 0;
+    };
+
+    class Builder;
+
+    std::vector<Node> m_nodes;
+    /// Boxes and IDs in leaf order.
+    std::vector<Aabb> m_boxes;
+    std::vector<std::int32_t> m_ids;
+    std::size_t m_depth = 0;
+  };
+}
@@ -0,0 +1,275 @@
+#include "CommandQueue.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+  using CwAPI3D::Net::Bridge::Native::Command;
+  using CwAPI3D::Net::Bridge::Native::CommandKind;
+
+  bool isJoin(CommandKind kind)
+  {
+    return kind == CommandKind::Join || kind == CommandKind::JoinTopLevel;
+  }
+
+  /// Commands that do nothing when flushed. Empty copies are kept: they still own a copy result.
+  bool isNoOp(const Command& command)
+  {
+    if (command.kind == CommandKind::Copy)
+      return false;
+    return command.count == 0 || (command.kind == CommandKind::Move && command.vector == CwAPI3D::Net::Bridge::Core::Vec3d{});
+  }
+
+  /// An ID used by the command at index `command`, ordered by ID, then command.
+  struct IdEvent
+  {
+    std::int32_t id;
+    std::uint32_t command;
+    bool deletes;
+
+    friend bool operator<(const IdEvent& a, const IdEvent& b)
+    {
+      return a.id != b.id ? a.id < b.id : a.command < b.command;
+    }
+  };
+
+  std::size_t findRoot(std::vector<std::size_t>& parents, std::size_t i)
+  {
+    while (parents[i] != i)
+    {
+      parents[i] = parents[parents[i]];
+      i = parents[i];
+    }
+    return i;
+  }
+}
+
+bool CwAPI3D::Net::Bridge::Native::CommandQueue::record(CommandKind kind, const std::int32_t* ids, std::uint32_t count, const Core::Vec3d& vector)
+{
+  if (count != 0 && !ids)
+    return false;
+  if (std::any_of(ids, ids + count, [](std::int32_t id) { return id < 0; }))
+    return false;
+
+  m_commands.push_back(Command{kind, static_cast<std::uint32_t>(m_ids.size()), count, vector});
+  m_ids.insert(m_ids.end(), ids, ids + count);
+  if (kind == CommandKind::Copy)
+    ++m_copyCount;
+  return true;
+}
+
+void CwAPI3D::Net::Bridge::Native::CommandQueue::clear()
+{
+  m_commands.clear();
+  m_ids.clear();
+  m_copyCount = 0;
+}
+
+void CwAPI3D::Net::Bridge::Native::CommandQueue::coalesce()
+{
+  if (m_commands.empty())
+    return;
+
+  normalize();
+  dropMovesOfDeleted();
+  dropDeletedFromJoins();
+  merge();
+}
+
+void CwAPI3D::Net::Bridge::Native::CommandQueue::normalize()
+{
+  // Copies keep their order and duplicates: the copy result lists one new ID per source ID, in source order.
+  for (Command& command : m_commands)
+  {
+    if (command.kind == CommandKind::Copy)
+      continue;
+
+    const auto begin = m_ids.begin() + command.first;
+    std::sort(begin, begin + command.count);
+    command.count = static_cast<std::uint32_t>(std::unique(begin, begin + command.count) - begin);
+  }
+}
+
+void CwAPI3D::Net::Bridge::Native::CommandQueue::dropMovesOfDeleted()
+{
+  // Every delete and copy as (id, command) events sorted by ID, then position. A moved ID can be dropped when the
+  // first event after the move is a delete: no copy reads the moved position before the element is gone.
+  std::vector<IdEvent> events;
+  bool deletes = false;
+  for (std::uint32_t i = 0; i < m_commands.size(); ++i)
+  {
+    const Command& command = m_commands[i];
+    if (command.kind != CommandKind::Delete && command.kind != CommandKind::Copy)
+      continue;
+
+    deletes = deletes || command.kind == CommandKind::Delete;
+    for (const std::int32_t* id = ids(command); id != ids(command) + command.count; ++id)
+      events.push_back(IdEvent{*id, i, command.kind == CommandKind::Delete});
+  }
+  if (!deletes)
+    return;
+  std::sort(events.begin(), events.end());
+
+  for (std::uint32_t i = 0; i < m_commands.size(); ++i)
+  {
+    Command& command = m_commands[i];
+    if (command.kind != CommandKind::Move)
+      continue;
+
+    std::int32_t* begin = m_ids.data() + command.first;
+    const auto kept = std::remove_if(begin, begin + command.count, [&events, i](std::int32_t id) {
+      const auto next = std::lower_bound(events.begin(), events.end(), IdEvent{id, i, false});
+      return next != events.end() && next->id == id && next->deletes;
+    });
+    command.count = static_cast<std::uint32_t>(kept - begin);
+  }
+}
+
+void CwAPI3D::Net::Bridge::Native::CommandQueue::dropDeletedFromJoins()
+{
+  // The element controller skips deleted IDs, but a merged join would still link the sets through them: Join[3,0]
+  // and Join[0,5] after Delete[0] must not become Join[0,3,5]. Each ID with the first command that deletes it.
+  std::vector<IdEvent> deleted;
+  for (std::uint32_t i = 0; i < m_commands.size(); ++i)
+  {
+    const Command& command = m_commands[i];
+    if (command.kind != CommandKind::Delete)
+      continue;
+    for (const std::int32_t* id = ids(command); id != ids(command) + command.count; ++id)
+      deleted.push_back(IdEvent{*id, i, true});
+  }
+  if (deleted.empty())
+    return;
+  std::sort(deleted.begin(), deleted.end());
+
+  for (std::uint32_t i = 0; i < m_commands.size(); ++i)
+  {
+    Command& command = m_commands[i];
+    if (!isJoin(command.kind))
+      continue;
+
+    std::int32_t* begin = m_ids.data() + command.first;
+    const auto kept = std::remove_if(begin, begin + command.count, [&deleted, i](std::int32_t id) {
+      const auto first = std::lower_bound(deleted.begin(), deleted.end(), IdEvent{id, 0, true});
+      return first != deleted.end() && first->id == id && first->command < i;
+    });
+    command.count = static_cast<std::uint32_t>(kept - begin);
+  }
+}
+
+void CwAPI3D::Net::Bridge::Native::CommandQueue::merge()
+{
+  m_commands.erase(std::remove_if(m_commands.begin(), m_commands.end(), isNoOp), m_commands.end());
+
+  std::vector<Command> merged;
+  merged.reserve(m_commands.size());
+
+  std::size_t i = 0;
+  while (i < m_commands.size())
+  {
+    const CommandKind kind = m_commands[i].kind;
+    if (isJoin(kind))
+    {
+      i = mergeJoinRun(i, merged);
+      continue;
+    }
+    if (kind == CommandKind::Delete)
+    {
+      i = mergeDeleteRun(i, merged);
+      continue;
+    }
+
+    const Command command = m_commands[i++];
+    if (command.kind == CommandKind::Move && !merged.empty())
+    {
+      Command& last = merged.back();
+      if (last.kind == CommandKind::Move && last.count == command.count && std::equal(ids(last), ids(last) + last.count, ids(command)))
+      {
+        last.vector = last.vector + command.vector;
+        if (isNoOp(last))
+          merged.pop_back();
+        continue;
+      }
+    }
+    merged.push_back(command);
+  }
+  m_commands.swap(merged);
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::CommandQueue::mergeDeleteRun(std::size_t begin, std::vector<Command>& merged)
+{
+  std::size_t end = begin;
+  std::vector<std::int32_t> combined;
+  while (end < m_commands.size() && m_commands[end].kind == CommandKind::Delete)
+  {
+    const Command& command = m_commands[end++];
+    combined.insert(combined.end(), ids(command), ids(command) + command.count);
+  }
+
+  if (end - begin == 1)
+    merged.push_back(m_commands[begin]);
+  else
+    merged.push_back(appendSet(CommandKind::Delete, combined));
+  return end;
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::CommandQueue::mergeJoinRun(std::size_t begin, std::vector<Command>& merged)
+{
+  const CommandKind kind = m_commands[begin].kind;
+  std::size_t end = begin;
+  while (end < m_commands.size() && m_commands[end].kind == kind)
+    ++end;
+  if (end - begin == 1)
+  {
+    merged.push_back(m_commands[begin]);
+    return end;
+  }
+
+  // Union-find over the commands of the run: two joins end up in one set when they share an ID.
+  std::vector<IdEvent> joined;
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    const Command& command = m_commands[i];
+    for (const std::int32_t* id = ids(command); id != ids(command) + command.count; ++id)
+      joined.push_back(IdEvent{*id, static_cast<std::uint32_t>(i - begin), false});
+  }
+  std::sort(joined.begin(), joined.end());
+
+  std::vector<std::size_t> parents(end - begin);
+  std::iota(parents.begin(), parents.end(), std::size_t{0});
+  for (std::size_t k = 1; k < joined.size(); ++k)
+  {
+    if (joined[k].id == joined[k - 1].id)
+      parents[findRoot(parents, joined[k].command)] = findRoot(parents, joined[k - 1].command);
+  }
+
+  // One join per set, in the order the sets were first joined; sets that did not overlap stay separate calls.
+  constexpr std::size_t NoSet = static_cast<std::size_t>(-1);
+  std::vector<std::size_t> setOfRoot(end - begin, NoSet);
+  std::vector<std::vector<std::int32_t>> sets;
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    const Command& command = m_commands[i];
+    std::size_t& set = setOfRoot[findRoot(parents, i - begin)];
+    if (set == NoSet)
+    {
+      set = sets.size();
+      sets.emplace_back();
+    }
+    sets[set].insert(sets[set].end(), ids(command), ids(command) + command.count);
+  }
+  for (std::vector<std::int32_t>& set : sets)
+    merged.push_back(appendSet(kind, set));
+  return end;
+}
+
+CwAPI3D::Net::Bridge::Native::Command CwAPI3D::Net::Bridge::Native::CommandQueue::appendSet(CommandKind kind, std::vector<std::int32_t>& set)
+{
+  std::sort(set.begin(), set.end());
+  set.erase(std::unique(set.begin(), set.end()), set.end());
+
+  const Command command{kind, static_cast<std::uint32_t>(m_ids.size()), static_cast<std::uint32_t>(set.size()), Core::Vec3d{}};
+  m_ids.insert(m_ids.end(), set.begin(), set.end());
+  return command;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "../core/Vec3.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Plain C++ (no /clr) recorder behind the managed CommandBatch: element operations are queued with their IDs and
+// coalesced so that a flush reaches the element controller in as few calls as possible.
+namespace CwAPI3D::Net::Bridge::Native
+{
+  enum class CommandKind : std::uint8_t
+  {
+    Move,
+    Copy,
+    Delete,
+    Join,
+    JoinTopLevel
+  };
+
+  /// One queued operation on `count` IDs starting at `first` in the queue's ID storage.
+  struct Command
+  {
+    CommandKind kind;
+    std::uint32_t first;
+    std::uint32_t count;
+    /// Translation of a Move or Copy.
+    Core::Vec3d vector;
+  };
+
+  /// New IDs of the Copy commands of one flush: copy c (in recording order) produced ids[offsets[c], offsets[c + 1]).
+  struct CopyResults
+  {
+    std::vector<std::int32_t> ids;
+    std::vector<std::uint32_t> offsets;
+  };
+
+  class CommandQueue
+  {
+  public:
+    /// Queues an operation. Nothing is queued and false is returned if any of the IDs is negative.
+    bool record(CommandKind kind, const std::int32_t* ids, std::uint32_t count, const Core::Vec3d& vector = {});
+
+    /// Rewrites the queue into the fewest commands with the same effect:
+    /// - moves, deletes and joins operate on sets, so their IDs are sorted and duplicates removed;
+    /// - IDs that a later command deletes are dropped from earlier moves, unless a copy in between reads them;
+    /// - IDs that an earlier command deleted are dropped from joins, so no join is merged through a deleted element;
+    /// - back-to-back moves of the same set become one move by the summed vector, and moves by zero are dropped;
+    /// - back-to-back deletes become one delete of the union;
+    /// - within a run of back-to-back joins of the same kind, overlapping sets are joined as their union.
+    /// Copies are never merged or reordered, so copy c of the recording is still copy c afterwards.
+    void coalesce();
+
+    void clear();
+
+    bool empty() const { return m_commands.empty(); }
+    std::size_t size() const { return m_commands.size(); }
+
+    /// Number of Copy commands recorded since the last clear().
+    std::uint32_t copyCount() const { return m_copyCount; }
+
+    const std::vector<Command>& commands() const { return m_commands; }
+    const std::int32_t* ids(const Command& command) const { return m_ids.data() + command.first; }
+
+  private:
+    void normalize();
+    void dropMovesOfDeleted();
+    void dropDeletedFromJoins();
+    void merge();
+    std::size_t mergeDeleteRun(std::size_t begin, std::vector<Command>& merged);
+    std::size_t mergeJoinRun(std::size_t begin, std::vector<Command>& merged);
+    /// Sorts and deduplicates `set`, appends them to the ID storage and returns a command over them.
+    Command appendSet(CommandKind kind, std::vector<std::int32_t>& set);
+
+    std::vector<Command> m_commands;
+    std::vector<std::int32_t> m_ids;
+    std::uint32_t m_copyCount = 0;
+  };
+}
@@ -0,0 +1,334 @@
+#include "ElementFilter.h"
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+  using Filter = CwAPI3D::Net::Bridge::Native::ElementFilter;
+
+  /// Bounds the recursion of the parser and of the evaluators.
+  constexpr std::uint32_t MaxDepth = 64;
+
+  /// Comparing an attribute asks the CAD core for a string, testing a query is a set lookup.
+  constexpr std::uint32_t QueryCost = 1;
+  constexpr std::uint32_t FieldCost = 16;
+
+  struct Keyword
+  {
+    std::string_view text;
+    std::uint8_t value;
+  };
+
+  constexpr std::array<Keyword, 6> Queries{{
+    {"all", static_cast<std::uint8_t>(Filter::Query::AllIdentifiable)},
+    {"visible", static_cast<std::uint8_t>(Filter::Query::Visible)},
+    {"invisible", static_cast<std::uint8_t>(Filter::Query::Invisible)},
+    {"active", static_cast<std::uint8_t>(Filter::Query::Active)},
+    {"inactive", static_cast<std::uint8_t>(Filter::Query::InactiveAll)},
+    {"inactivevisible", static_cast<std::uint8_t>(Filter::Query::InactiveVisible)},
+  }};
+
+  constexpr std::array<Keyword, 5> Fields{{
+    {"name", static_cast<std::uint8_t>(Filter::Field::Name)},
+    {"group", static_cast<std::uint8_t>(Filter::Field::Group)},
+    {"subgroup", static_cast<std::uint8_t>(Filter::Field::Subgroup)},
+    {"comment", static_cast<std::uint8_t>(Filter::Field::Comment)},
+    {"material", static_cast<std::uint8_t>(Filter::Field::Material)},
+  }};
+
+  bool equalsIgnoreCase(std::string_view a, std::string_view b)
+  {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+      return (x >= 'A' && x <= 'Z' ? x - 'A' + 'a' : x) == (y >= 'A' && y <= 'Z' ? y - 'A' + 'a' : y);
+    });
+  }
+
+  template <std::size_t N>
+  int lookup(const std::array<Keyword, N>& keywords, std::string_view word)
+  {
+    for (const Keyword& keyword : keywords)
+    {
+      if (equalsIgnoreCase(keyword.text, word)) return keyword.value;
+    }
+    return -1;
+  }
+
+  bool isWordChar(char c)
+  {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+  }
+}
+
+namespace CwAPI3D::Net::Bridge::Native
+{
+  /// Recursive descent over
+  ///   or      := and ("OR" and)*
+  ///   and     := unary ("AND" unary)*
+  ///   unary   := "NOT" unary | "(" or ")" | query | field compare string
+  ///   compare := "==" | "!=" | "CONTAINS" | "STARTSWITH"
+  /// Keywords, queries and fields are case-insensitive; strings are quoted with ' or " and a doubled quote escapes it.
+  class ElementFilter::Parser
+  {
+  public:
+    Parser(ElementFilter& filter, std::string_view text) : m_filter(filter), m_text(text) {}
+
+    bool run(ParseError& error)
+    {
+      std::uint32_t root = 0;
+      if (parseOr(0, root))
+      {
+        skipSpace();
+        if (m_position == m_text.size())
+        {
+          m_filter.m_root = root;
+          return true;
+        }
+        fail("Expected AND, OR or the end of the expression.");
+      }
+      error = {m_errorPosition, m_error};
+      return false;
+    }
+
+  private:
+    bool fail(const char* message)
+    {
+      m_errorPosition = m_position;
+      m_error = message;
+      return false;
+    }
+
+    void skipSpace()
+    {
+      while (m_position < m_text.size() && (m_text[m_position] == ' ' || m_text[m_position] == '\t' ||
+        m_text[m_position] == '\r' || m_text[m_position] == '\n'))
+      {
+        ++m_position;
+      }
+    }
+
+    std::string_view peekWord()
+    {
+      skipSpace();
+      std::size_t end = m_position;
+      while (end < m_text.size() && isWordChar(m_text[end])) ++end;
+      return m_text.substr(m_position, end - m_position);
+    }
+
+    bool acceptWord(std::string_view keyword)
+    {
+      const std::string_view word = peekWord();
+      if (!equalsIgnoreCase(word, keyword)) return false;
+      m_position += word.size();
+      return true;
+    }
+
+    bool acceptSymbol(std::string_view symbol)
+    {
+      skipSpace();
+      if (m_text.substr(m_position, symbol.size()) != symbol) return false;
+      m_position += symbol.size();
+      return true;
+    }
+
+    std::uint32_t addNode(Kind kind, std::uint8_t operand, std::uint32_t first, std::uint32_t count)
+    {
+      m_filter.m_nodes.push_back({kind, operand, Compare::Equals, first, count});
+      return static_cast<std::uint32_t>(m_filter.m_nodes.size() - 1);
+    }
+
+    /// Adds an And or Or node over `operands`, or returns the single operand as is.
+    std::uint32_t addList(Kind kind, const std::vector<std::uint32_t>& operands)
+    {
+      if (operands.size() == 1) return operands[0];
+
+      const auto first = static_cast<std::uint32_t>(m_filter.m_children.size());
+      m_filter.m_children.insert(m_filter.m_children.end(), operands.begin(), operands.end());
+      return addNode(kind, 0, first, static_cast<std::uint32_t>(operands.size()));
+    }
+
+    bool parseOr(std::uint32_t depth, std::uint32_t& node)
+    {
+      std::vector<std::uint32_t> operands(1);
+      if (!parseAnd(depth, operands[0])) return false;
+      while (acceptWord("or"))
+      {
+        operands.emplace_back();
+        if (!parseAnd(depth, operands.back())) return false;
+      }
+      node = addList(Kind::Or, operands);
+      return true;
+    }
+
+    bool parseAnd(std::uint32_t depth, std::uint32_t& node)
+    {
+      std::vector<std::uint32_t> operands(1);
+      if (!parseUnary(depth, operands[0])) return false;
+      while (acceptWord("and"))
+      {
+        operands.emplace_back();
+        if (!parseUnary(depth, operands.back())) return false;
+      }
+      node = addList(Kind::And, operands);
+      return true;
+    }
+
+    bool parseUnary(std::uint32_t depth, std::uint32_t& node)
+    {
+      if (depth == MaxDepth) return fail("The expression is nested too deeply.");
+
+      if (acceptWord("not"))
+      {
+        std::uint32_t operand = 0;
+        if (!parseUnary(depth + 1, operand)) return false;
+        m_filter.m_children.push_back(operand);
+        node = addNode(Kind::Not, 0, static_cast<std::uint32_t>(m_filter.m_children.size() - 1), 1);
+        m_filter.m_queryMask |= 1u << static_cast<std::uint32_t>(Query::AllIdentifiable);
+        return true;
+      }
+
+      if (acceptSymbol("("))
+      {
+        if (!parseOr(depth + 1, node)) return false;
+        return acceptSymbol(")") || fail("Expected ')'.");
+      }
+
+      const std::string_view word = peekWord();
+      if (const int query = lookup(Queries, word); query >= 0)
+      {
+        m_position += word.size();
+        node = addNode(Kind::Query, static_cast<std::uint8_t>(query), 0, 0);
+        m_filter.m_queryMask |= 1u << query;
+        return true;
+      }
+      if (const int field = lookup(Fields, word); field >= 0)
+      {
+        m_position += word.size();
+        return parseComparison(static_cast<std::uint8_t>(field), node);
+      }
+      return fail("Expected a query, an attribute, NOT or '('.");
+    }
+
+    bool parseComparison(std::uint8_t field, std::uint32_t& node)
+    {
+      Compare compare;
+      if (acceptSymbol("==")) compare = Compare::Equals;
+      else if (acceptSymbol("!=")) compare = Compare::NotEquals;
+      else if (acceptWord("contains")) compare = Compare::Contains;
+      else if (acceptWord("startswith")) compare = Compare::StartsWith;
+      else return fail("Expected ==, !=, CONTAINS or STARTSWITH.");
+
+      skipSpace();
+      if (m_position == m_text.size() || (m_text[m_position] != '\'' && m_text[m_position] != '"'))
+        return fail("Expected a quoted string.");
+
+      const char quote = m_text[m_position];
+      const std::size_t start = m_position++;
+      const auto first = static_cast<std::uint32_t>(m_filter.m_text.size());
+      for (;;)
+      {
+        if (m_position == m_text.size())
+        {
+          m_position = start;
+          return fail("The string is not terminated.");
+        }
+        const char c = m_text[m_position++];
+        if (c == quote)
+        {
+          if (m_position == m_text.size() || m_text[m_position] != quote) break;
+          ++m_position;
+        }
+        m_filter.m_text.push_back(c);
+      }
+
+      node = addNode(Kind::Field, field, first, static_cast<std::uint32_t>(m_filter.m_text.size() - first));
+      m_filter.m_nodes[node].compare = compare;
+      m_filter.m_fieldMask |= 1u << field;
+      return true;
+    }
+
+    ElementFilter& m_filter;
+    std::string_view m_text;
+    std::size_t m_position = 0;
+    std::size_t m_errorPosition = 0;
+    const char* m_error = nullptr;
+  };
+
+  bool ElementFilter::parse(std::string_view expression, ParseError& error)
+  {
+    m_nodes.clear();
+    m_children.clear();
+    m_text.clear();
+    m_root = 0;
+    m_queryMask = 0;
+    m_fieldMask = 0;
+
+    if (!Parser(*this, expression).run(error))
+    {
+      m_nodes.clear();
+      m_children.clear();
+      m_text.clear();
+      m_queryMask = 0;
+      m_fieldMask = 0;
+      return false;
+    }
+    orderByCost();
+    return true;
+  }
+
+  std::uint32_t ElementFilter::requiredQueries() const
+  {
+    if (m_nodes.empty()) return 0;
+
+    const Node& root = m_nodes[m_root];
+    if (root.kind == Kind::Query) return 1u << root.operand;
+    if (root.kind != Kind::And) return 0;
+
+    std::uint32_t mask = 0;
+    for (std::uint32_t i = 0; i < root.count; ++i)
+    {
+      const Node& child = m_nodes[m_children[root.first + i]];
+      if (child.kind == Kind::Query) mask |= 1u << child.operand;
+    }
+    return mask;
+  }
+
+  bool ElementFilter::compareText(Compare compare, std::string_view value, std::string_view operand)
+  {
+    switch (compare)
+    {
+    case Compare::Equals: return value == operand;
+    case Compare::NotEquals: return value != operand;
+    case Compare::Contains: return value.find(operand) != std::string_view::npos;
+    default: return value.substr(0, operand.size()) == operand;
+    }
+  }
+
+  std::uint32_t ElementFilter::costOf(std::uint32_t index) const
+  {
+    const Node& node = m_nodes[index];
+    switch (node.kind)
+    {
+    case Kind::Query: return QueryCost;
+    case Kind::Field: return FieldCost;
+    default:
+    {
+      std::uint32_t cost = 0;
+      for (std::uint32_t i = 0; i < node.count; ++i) cost += costOf(m_children[node.first + i]);
+      return cost;
+    }
+    }
+  }
+
+  void ElementFilter::orderByCost()
+  {
+    for (const Node& node : m_nodes)
+    {
+      if (node.kind != Kind::And && node.kind != Kind::Or) continue;
+
+      const auto begin = m_children.begin() + node.first;
+      std::stable_sort(begin, begin + node.count,
+        [this](std::uint32_t a, std::uint32_t b) { return costOf(a) < costOf(b); });
+    }
+  }
+}
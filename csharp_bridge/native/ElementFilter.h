@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Plain C++ (no /clr) predicate tree behind the managed ElementFilter. An expression such as
+//   visible AND active AND name == 'Rafter'
+// is parsed once into a flat array of nodes and then evaluated natively for every candidate element, so only the
+// matching IDs cross the managed boundary.
+namespace CwAPI3D::Net::Bridge::Native
+{
+  class ElementFilter
+  {
+  public:
+    /// The element ID queries a filter can test membership of, in ElementQueries bit order.
+    enum class Query : std::uint8_t
+    {
+      AllIdentifiable,
+      Visible,
+      Invisible,
+      Active,
+      InactiveAll,
+      InactiveVisible
+    };
+
+    static constexpr std::uint32_t QueryCount = 6;
+
+    /// The attributes a filter can compare, in AttributeColumns bit order.
+    enum class Field : std::uint8_t
+    {
+      Name,
+      Group,
+      Subgroup,
+      Comment,
+      Material
+    };
+
+    static constexpr std::uint32_t FieldCount = 5;
+
+    enum class Compare : std::uint8_t
+    {
+      Equals,
+      NotEquals,
+      Contains,
+      StartsWith
+    };
+
+    struct ParseError
+    {
+      /// Byte offset into the expression where parsing stopped.
+      std::size_t position;
+      const char* message;
+    };
+
+    /// Replaces the filter with the parsed expression. On failure the filter is left empty and `error` says why.
+    bool parse(std::string_view expression, ParseError& error);
+
+    bool empty() const { return m_nodes.empty(); }
+
+    /// Bit q is set when evaluating the filter needs the result of query q. Negations need AllIdentifiable.
+    std::uint32_t queryMask() const { return m_queryMask; }
+
+    /// Bit f is set when the filter compares field f.
+    std::uint32_t fieldMask() const { return m_fieldMask; }
+
+    /// Bit q is set when every matching element must belong to query q, i.e. q is a conjunct of the root. The
+    /// evaluator only visits the intersection of these queries.
+    std::uint32_t requiredQueries() const;
+
+    /// Evaluates the filter for one element. inQuery(Query) returns whether the element belongs to a query;
+    /// fieldText(Field) returns the element's value of a field as a std::string_view.
+    template <class InQuery, class FieldText>
+    bool matches(InQuery&& inQuery, FieldText&& fieldText) const
+    {
+      return evaluate(m_root, inQuery, fieldText);
+    }
+
+    /// Evaluates the filter with set algebra instead of per element: query(Query) returns a const Set&, and
+    /// Set provides intersectionOf, unionOf and differenceOf. Only valid for filters without fields.
+    template <class Set, class QuerySet>
+    Set evaluateSets(QuerySet&& query) const
+    {
+      return evaluateSet<Set>(m_root, query);
+    }
+
+  private:
+    enum class Kind : std::uint8_t
+    {
+      And,
+      Or,
+      Not,
+      Query,
+      Field
+    };
+
+    /// Interior nodes own the children m_children[first, first + count); field nodes compare against the text
+    /// m_text[first, first + count).
+    struct Node
+    {
+      Kind kind;
+      std::uint8_t operand;
+      Compare compare;
+      std::uint32_t first;
+      std::uint32_t count;
+    };
+
+    class Parser;
+
+    static bool compareText(Compare compare, std::string_view value, std::string_view operand);
+
+    /// Orders the children of every And and Or node so cheap query tests run before attribute comparisons.
+    void orderByCost();
+    std::uint32_t costOf(std::uint32_t node) const;
+
+    template <class InQuery, class FieldText>
+    bool evaluate(std::uint32_t index, InQuery& inQuery, FieldText& fieldText) const
+    {
+      const Node& node = m_nodes[index];
+      switch (node.kind)
+      {
+      case Kind::And:
+        for (std::uint32_t i = 0; i < node.count; ++i)
+        {
+          if (!evaluate(m_children[node.first + i], inQuery, fieldText)) return false;
+        }
+        return true;
+      case Kind::Or:
+        for (std::uint32_t i = 0; i < node.count; ++i)
+        {
+          if (evaluate(m_children[node.first + i], inQuery, fieldText)) return true;
+        }
+        return false;
+      case Kind::Not:
+        return !evaluate(m_children[node.first], inQuery, fieldText);
+      case Kind::Query:
+        return inQuery(static_cast<Query>(node.operand));
+      default:
+        return compareText(node.compare, fieldText(static_cast<Field>(node.operand)),
+          std::string_view(m_text).substr(node.first, node.count));
+      }
+    }
+
+    template <class Set, class QuerySet>
+    Set evaluateSet(std::uint32_t index, QuerySet& query) const
+    {
+      const Node& node = m_nodes[index];
+      switch (node.kind)
+      {
+      case Kind::And:
+      case Kind::Or:
+      {
+        Set result = evaluateSet<Set>(m_children[node.first], query);
+        for (std::uint32_t i = 1; i < node.count; ++i)
+        {
+          const Set other = evaluateSet<Set>(m_children[node.first + i], query);
+          result = node.kind == Kind::And ? Set::intersectionOf(result, other) : Set::unionOf(result, other);
+        }
+        return result;
+      }
+      case Kind::Not:
+        return Set::differenceOf(query(Query::AllIdentifiable), evaluateSet<Set>(m_children[node.first], query));
+      default:
+        return query(static_cast<Query>(node.operand));
+      }
+    }
+
+    std::vector<Node> m_nodes;
+    std::vector<std::uint32_t> m_children;
+    std::string m_text;
+    std::uint32_t m_root = 0;
+    std::uint32_t m_queryMask = 0;
+    std::uint32_t m_fieldMask = 0;
+  };
+}
@@ -0,0 +1,462 @@
+#include "IdSet.h"
+#include "BitmapKernels.h"
+
+#include <algorithm>
+#include <iterator>
+
+using CwAPI3D::Net::Bridge::Native::IdSet;
+namespace Kernels = CwAPI3D::Net::Bridge::Native::Kernels;
+
+namespace
+{
+  constexpr std::uint16_t highHalf(std::uint32_t id)
+  {
+    return static_cast<std::uint16_t>(id >> 16);
+  }
+
+  constexpr std::uint16_t lowHalf(std::uint32_t id)
+  {
+    return static_cast<std::uint16_t>(id & 0xffffu);
+  }
+
+  bool testBit(const std::vector<std::uint64_t>& words, std::uint16_t low)
+  {
+    return ((words[low >> 6] >> (low & 63)) & 1u) != 0;
+  }
+
+  void setBit(std::vector<std::uint64_t>& words, std::uint16_t low)
+  {
+    words[low >> 6] |= std::uint64_t{1} << (low & 63);
+  }
+
+  void clearBit(std::vector<std::uint64_t>& words, std::uint16_t low)
+  {
+    words[low >> 6] &= ~(std::uint64_t{1} << (low & 63));
+  }
+
+  std::vector<std::uint64_t> toBitmap(const std::vector<std::uint16_t>& values)
+  {
+    std::vector<std::uint64_t> words(IdSet::BitmapWords, 0);
+    for (const std::uint16_t low : values)
+      setBit(words, low);
+    return words;
+  }
+
+  std::vector<std::uint16_t> toArray(const std::vector<std::uint64_t>& words, std::size_t cardinality)
+  {
+    std::vector<std::uint16_t> values;
+    values.reserve(cardinality);
+    for (std::size_t w = 0; w < words.size(); ++w)
+    {
+      for (std::uint64_t word = words[w]; word != 0; word &= word - 1)
+        values.push_back(static_cast<std::uint16_t>(w * 64 + static_cast<std::size_t>(std::countr_zero(word))));
+    }
+    return values;
+  }
+
+  // When one array is much shorter, binary searches through the longer one beat a linear merge.
+  std::vector<std::uint16_t> intersectArrays(const std::vector<std::uint16_t>& a, const std::vector<std::uint16_t>& b)
+  {
+    const std::vector<std::uint16_t>& shorter = a.size() <= b.size() ? a : b;
+    const std::vector<std::uint16_t>& longer = a.size() <= b.size() ? b : a;
+
+    std::vector<std::uint16_t> out;
+    out.reserve(shorter.size());
+    if (shorter.size() * 32 < longer.size())
+    {
+      auto from = longer.begin();
+      for (const std::uint16_t low : shorter)
+      {
+        from = std::lower_bound(from, longer.end(), low);
+        if (from == longer.end())
+          break;
+        if (*from == low)
+          out.push_back(low);
+      }
+      return out;
+    }
+
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+    return out;
+  }
+}
+
+bool IdSet::add(std::uint32_t id)
+{
+  const std::uint16_t key = highHalf(id);
+  const std::uint16_t low = lowHalf(id);
+  auto it = std::lower_bound(m_containers.begin(), m_containers.end(), key,
+    [](const Container& container, std::uint16_t k) { return container.key < k; });
+  if (it == m_containers.end() || it->key != key)
+  {
+    Container container;
+    container.key = key;
+    it = m_containers.insert(it, std::move(container));
+  }
+
+  Container& container = *it;
+  if (container.isBitmap())
+  {
+    if (testBit(container.words, low))
+      return false;
+    setBit(container.words, low);
+  }
+  else
+  {
+    const auto position = std::lower_bound(container.values.begin(), container.values.end(), low);
+    if (position != container.values.end() && *position == low)
+      return false;
+    container.values.insert(position, low);
+  }
+
+  ++container.cardinality;
+  ++m_size;
+  canonicalize(container);
+  return true;
+}
+
+bool IdSet::remove(std::uint32_t id)
+{
+  Container* container = find(highHalf(id));
+  if (!container)
+    return false;
+
+  const std::uint16_t low = lowHalf(id);
+  if (container->isBitmap())
+  {
+    if (!testBit(container->words, low))
+      return false;
+    clearBit(container->words, low);
+  }
+  else
+  {
+    const auto position = std::lower_bound(container->values.begin(), container->values.end(), low);
+    if (position == container->values.end() || *position != low)
+      return false;
+    container->values.erase(position);
+  }
+
+  --m_size;
+  if (--container->cardinality == 0)
+    m_containers.erase(m_containers.begin() + (container - m_containers.data()));
+  else
+    canonicalize(*container);
+  return true;
+}
+
+bool IdSet::contains(std::uint32_t id) const
+{
+  const Container* container = find(highHalf(id));
+  if (!container)
+    return false;
+
+  const std::uint16_t low = lowHalf(id);
+  if (container->isBitmap())
+    return testBit(container->words, low);
+  return std::binary_search(container->values.begin(), container->values.end(), low);
+}
+
+void IdSet::addMany(const std::uint32_t* ids, std::size_t count)
+{
+  // Query results usually arrive in ascending order already; those, and short inputs, skip the bucket pass.
+  const bool ascending = std::is_sorted(ids, ids + count);
+  IdSet added = ascending || count < BucketThreshold ? fromSorted(ids, count, ascending) : fromBuckets(ids, count);
+  if (empty())
+    *this = std::move(added);
+  else
+    unionWith(added);
+}
+
+IdSet IdSet::fromSorted(const std::uint32_t* ids, std::size_t count, bool ascending)
+{
+  std::vector<std::uint32_t> sorted(ids, ids + count);
+  if (!ascending)
+    std::sort(sorted.begin(), sorted.end());
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+  IdSet result;
+  for (std::size_t begin = 0; begin < sorted.size();)
+  {
+    const std::uint16_t key = highHalf(sorted[begin]);
+    std::size_t end = begin;
+    while (end < sorted.size() && highHalf(sorted[end]) == key)
+      ++end;
+
+    Container container;
+    container.key = key;
+    container.values.reserve(end - begin);
+    for (std::size_t i = begin; i < end; ++i)
+      container.values.push_back(lowHalf(sorted[i]));
+    container.cardinality = static_cast<std::uint32_t>(end - begin);
+    canonicalize(container);
+    result.m_containers.push_back(std::move(container));
+    begin = end;
+  }
+  result.recount();
+  return result;
+}
+
+IdSet IdSet::fromBuckets(const std::uint32_t* ids, std::size_t count)
+{
+  // Counting sort by high half: each group's low halves land next to each other without a full sort, dense groups
+  // are written straight into a bitmap (which also drops duplicates), and only sparse groups get sorted.
+  std::vector<std::uint32_t> offsets(65536 + 1, 0);
+  for (std::size_t i = 0; i < count; ++i)
+    ++offsets[highHalf(ids[i]) + 1];
+  for (std::size_t key = 0; key < 65536; ++key)
+    offsets[key + 1] += offsets[key];
+
+  std::vector<std::uint16_t> lows(count);
+  {
+    std::vector<std::uint32_t> next(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < count; ++i)
+      lows[next[highHalf(ids[i])]++] = lowHalf(ids[i]);
+  }
+
+  IdSet result;
+  for (std::size_t key = 0; key < 65536; ++key)
+  {
+    const auto begin = lows.begin() + offsets[key];
+    const auto end = lows.begin() + offsets[key + 1];
+    if (begin == end)
+      continue;
+
+    Container container;
+    container.key = static_cast<std::uint16_t>(key);
+    if (static_cast<std::size_t>(end - begin) > ArrayLimit)
+    {
+      container.words.assign(BitmapWords, 0);
+      for (auto it = begin; it != end; ++it)
+        setBit(container.words, *it);
+      container.cardinality = static_cast<std::uint32_t>(Kernels::bitmapCount(container.words.data(), BitmapWords));
+    }
+    else
+    {
+      std::sort(begin, end);
+      container.values.assign(begin, std::unique(begin, end));
+      container.cardinality = static_cast<std::uint32_t>(container.values.size());
+    }
+    canonicalize(container);
+    result.m_containers.push_back(std::move(container));
+  }
+  result.recount();
+  return result;
+}
+
+void IdSet::clear()
+{
+  m_containers.clear();
+  m_size = 0;
+}
+
+std::size_t IdSet::memoryBytes() const
+{
+  std::size_t bytes = m_containers.capacity() * sizeof(Container);
+  for (const Container& container : m_containers)
+    bytes += container.values.capacity() * sizeof(std::uint16_t) + container.words.capacity() * sizeof(std::uint64_t);
+  return bytes;
+}
+
+void IdSet::copyTo(std::uint32_t* out) const
+{
+  forEach([&](std::uint32_t id) { *out++ = id; });
+}
+
+void IdSet::unionWith(const IdSet& other)
+{
+  *this = combine(*this, other, Operation::Union);
+}
+
+void IdSet::intersectWith(const IdSet& other)
+{
+  *this = combine(*this, other, Operation::Intersection);
+}
+
+void IdSet::subtract(const IdSet& other)
+{
+  *this = combine(*this, other, Operation::Difference);
+}
+
+IdSet IdSet::unionOf(const IdSet& a, const IdSet& b)
+{
+  return combine(a, b, Operation::Union);
+}
+
+IdSet IdSet::intersectionOf(const IdSet& a, const IdSet& b)
+{
+  return combine(a, b, Operation::Intersection);
+}
+
+IdSet IdSet::differenceOf(const IdSet& a, const IdSet& b)
+{
+  return combine(a, b, Operation::Difference);
+}
+
+IdSet IdSet::combine(const IdSet& a, const IdSet& b, Operation operation)
+{
+  IdSet result;
+  auto i = a.m_containers.begin();
+  auto j = b.m_containers.begin();
+  while (i != a.m_containers.end() && j != b.m_containers.end())
+  {
+    if (i->key < j->key)
+    {
+      if (operation != Operation::Intersection)
+        result.m_containers.push_back(*i);
+      ++i;
+    }
+    else if (j->key < i->key)
+    {
+      if (operation == Operation::Union)
+        result.m_containers.push_back(*j);
+      ++j;
+    }
+    else
+    {
+      Container combined = combine(*i, *j, operation);
+      if (combined.cardinality != 0)
+        result.m_containers.push_back(std::move(combined));
+      ++i;
+      ++j;
+    }
+  }
+
+  if (operation != Operation::Intersection)
+    result.m_containers.insert(result.m_containers.end(), i, a.m_containers.end());
+  if (operation == Operation::Union)
+    result.m_containers.insert(result.m_containers.end(), j, b.m_containers.end());
+
+  result.recount();
+  return result;
+}
+
+IdSet::Container IdSet::combine(const Container& a, const Container& b, Operation operation)
+{
+  Container result;
+  result.key = a.key;
+
+  if (a.isBitmap() && b.isBitmap())
+  {
+    // The dense case, and the one worth vectorizing: 1024 words per container.
+    result.words.resize(BitmapWords);
+    std::size_t cardinality = 0;
+    switch (operation)
+    {
+    case Operation::Union:
+      cardinality = Kernels::bitmapOr(a.words.data(), b.words.data(), result.words.data(), BitmapWords);
+      break;
+    case Operation::Intersection:
+      cardinality = Kernels::bitmapAnd(a.words.data(), b.words.data(), result.words.data(), BitmapWords);
+      break;
+    case Operation::Difference:
+      cardinality = Kernels::bitmapAndNot(a.words.data(), b.words.data(), result.words.data(), BitmapWords);
+      break;
+    }
+    result.cardinality = static_cast<std::uint32_t>(cardinality);
+  }
+  else if (a.isBitmap() || b.isBitmap())
+  {
+    const Container& bitmap = a.isBitmap() ? a : b;
+    const Container& array = a.isBitmap() ? b : a;
+    switch (operation)
+    {
+    case Operation::Union:
+      result.words = bitmap.words;
+      result.cardinality = bitmap.cardinality;
+      for (const std::uint16_t low : array.values)
+      {
+        if (!testBit(result.words, low))
+        {
+          setBit(result.words, low);
+          ++result.cardinality;
+        }
+      }
+      break;
+    case Operation::Intersection:
+      for (const std::uint16_t low : array.values)
+      {
+        if (testBit(bitmap.words, low))
+          result.values.push_back(low);
+      }
+      result.cardinality = static_cast<std::uint32_t>(result.values.size());
+      break;
+    case Operation::Difference:
+      if (a.isBitmap())
+      {
+        result.words = a.words;
+        result.cardinality = a.cardinality;
+        for (const std::uint16_t low : b.values)
+        {
+          if (testBit(result.words, low))
+          {
+            clearBit(result.words, low);
+            --result.cardinality;
+          }
+        }
+      }
+      else
+      {
+        for (const std::uint16_t low : a.values)
+        {
+          if (!testBit(b.words, low))
+            result.values.push_back(low);
+        }
+        result.cardinality = static_cast<std::uint32_t>(result.values.size());
+      }
+      break;
+    }
+  }
+  else
+  {
+    switch (operation)
+    {
+    case Operation::Union:
+      result.values.reserve(a.values.size() + b.values.size());
+      std::set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), std::back_inserter(result.values));
+      break;
+    case Operation::Intersection:
+      result.values = intersectArrays(a.values, b.values);
+      break;
+    case Operation::Difference:
+      std::set_difference(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), std::back_inserter(result.values));
+      break;
+    }
+    result.cardinality = static_cast<std::uint32_t>(result.values.size());
+  }
+
+  canonicalize(result);
+  return result;
+}
+
+void IdSet::canonicalize(Container& container)
+{
+  if (container.isBitmap() && container.cardinality <= ArrayLimit)
+  {
+    container.values = toArray(container.words, container.cardinality);
+    container.words = {};
+  }
+  else if (!container.isBitmap() && container.values.size() > ArrayLimit)
+  {
+    container.words = toBitmap(container.values);
+    container.values = {};
+  }
+}
+
+IdSet::Container* IdSet::find(std::uint16_t key)
+{
+  return const_cast<Container*>(static_cast<const IdSet*>(this)->find(key));
+}
+
+const IdSet::Container* IdSet::find(std::uint16_t key) const
+{
+  const auto it = std::lower_bound(m_containers.begin(), m_containers.end(), key,
+    [](const Container& container, std::uint16_t k) { return container.key < k; });
+  return it != m_containers.end() && it->key == key ? &*it : nullptr;
+}
+
+void IdSet::recount()
+{
+  m_size = 0;
+  for (const Container& container : m_containers)
+    m_size += container.cardinality;
+}
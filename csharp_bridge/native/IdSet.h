@@ -0,0 +1,117 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Plain C++ (no /clr) compressed set of element IDs behind the managed ElementIdSet, laid out like a roaring
+// bitmap: IDs are grouped by their high 16 bits, and each group of up to 65536 low halves is stored either as a
+// sorted array (sparse groups) or as a 65536-bit bitmap (dense groups). Set algebra works group by group; bitmap
+// groups are combined with the SIMD kernels in BitmapKernels.h.
+namespace CwAPI3D::Net::Bridge::Native
+{
+  class IdSet
+  {
+  public:
+    /// Groups with more IDs than this are stored as bitmaps, smaller ones as sorted arrays (both then take at
+    /// most 8 KiB).
+    static constexpr std::size_t ArrayLimit = 4096;
+    static constexpr std::size_t BitmapWords = 65536 / 64;
+
+    /// Adds the ID; returns false if it was already present.
+    bool add(std::uint32_t id);
+
+    /// Removes the ID; returns false if it was not present.
+    bool remove(std::uint32_t id);
+
+    bool contains(std::uint32_t id) const;
+
+    /// Adds `count` IDs given in any order, possibly with duplicates.
+    void addMany(const std::uint32_t* ids, std::size_t count);
+
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    void clear();
+
+    /// Bytes used by the containers, excluding this object.
+    std::size_t memoryBytes() const;
+
+    /// Writes the IDs in ascending order to `out`, which must hold size() entries.
+    void copyTo(std::uint32_t* out) const;
+
+    /// Calls visit(id) for every ID in ascending order.
+    template <class Visit>
+    void forEach(Visit&& visit) const
+    {
+      for (const Container& container : m_containers)
+      {
+        const std::uint32_t high = static_cast<std::uint32_t>(container.key) << 16;
+        if (!container.isBitmap())
+        {
+          for (const std::uint16_t low : container.values)
+            visit(high | low);
+          continue;
+        }
+        for (std::size_t w = 0; w < BitmapWords; ++w)
+        {
+          for (std::uint64_t word = container.words[w]; word != 0; word &= word - 1)
+            visit(high | static_cast<std::uint32_t>(w * 64 + static_cast<std::size_t>(std::countr_zero(word))));
+        }
+      }
+    }
+
+    void unionWith(const IdSet& other);
+    void intersectWith(const IdSet& other);
+    /// Removes every ID that is also in `other`.
+    void subtract(const IdSet& other);
+
+    static IdSet unionOf(const IdSet& a, const IdSet& b);
+    static IdSet intersectionOf(const IdSet& a, const IdSet& b);
+    static IdSet differenceOf(const IdSet& a, const IdSet& b);
+
+    /// Containers are kept in canonical form, so equal sets compare equal member for member.
+    friend bool operator==(const IdSet& a, const IdSet& b)
+    {
+      return a.m_size == b.m_size && a.m_containers == b.m_containers;
+    }
+
+  private:
+    struct Container
+    {
+      std::uint16_t key = 0;
+      std::uint32_t cardinality = 0;
+      /// Sorted low halves of an array container.
+      std::vector<std::uint16_t> values;
+      /// BitmapWords words of a bitmap container; empty for array containers.
+      std::vector<std::uint64_t> words;
+
+      bool isBitmap() const { return !words.empty(); }
+      friend bool operator==(const Container&, const Container&) = default;
+    };
+
+    enum class Operation
+    {
+      Union,
+      Intersection,
+      Difference
+    };
+
+    /// Below this many unordered IDs, addMany sorts them; above it, it buckets them by high half first.
+    static constexpr std::size_t BucketThreshold = 8192;
+
+    static IdSet fromSorted(const std::uint32_t* ids, std::size_t count, bool ascending);
+    static IdSet fromBuckets(const std::uint32_t* ids, std::size_t count);
+    static Container combine(const Container& a, const Container& b, Operation operation);
+    static void canonicalize(Container& container);
+    static IdSet combine(const IdSet& a, const IdSet& b, Operation operation);
+
+    Container* find(std::uint16_t key);
+    const Container* find(std::uint16_t key) const;
+    void recount();
+
+    /// Sorted by key, none empty.
+    std::vector<Container> m_containers;
+    std::size_t m_size = 0;
+  };
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Plain C++ (no /clr) core of the managed ElementIdListPool: keeps idle lists for reuse and counts how many were
+// created and rented. It never creates or destroys a list itself, so the caller decides on which thread the CAD
+// API runs. Not thread-safe; the managed pool locks around every call.
+namespace CwAPI3D::Net::Bridge::Native
+{
+  template <class List>
+  class ListPool
+  {
+  public:
+    explicit ListPool(std::size_t maxRetained) : m_maxRetained(maxRetained) { m_idle.reserve(maxRetained); }
+
+    ListPool(const ListPool&) = delete;
+    ListPool& operator=(const ListPool&) = delete;
+
+    /// Counts a rent and returns an idle list, or nullptr when the caller must create one (counted as created).
+    List* rent()
+    {
+      ++m_rented;
+      if (m_idle.empty())
+      {
+        ++m_created;
+        return nullptr;
+      }
+      List* list = m_idle.back();
+      m_idle.pop_back();
+      return list;
+    }
+
+    /// Keeps a cleared list for the next rent. Returns false when the pool is full and the caller must destroy it.
+    bool keep(List* list)
+    {
+      if (m_idle.size() >= m_maxRetained) return false;
+      m_idle.push_back(list);
+      return true;
+    }
+
+    /// Removes one idle list, or returns nullptr when none is left.
+    List* takeIdle()
+    {
+      if (m_idle.empty()) return nullptr;
+      List* list = m_idle.back();
+      m_idle.pop_back();
+      return list;
+    }
+
+    /// Removes one idle list beyond maxRetained, or returns nullptr when the pool is within its limit.
+    List* takeExcess() { return m_idle.size() > m_maxRetained ? takeIdle() : nullptr; }
+
+    template <class Visit>
+    void forEachIdle(Visit&& visit) const
+    {
+      for (const List* list : m_idle) visit(*list);
+    }
+
+    std::size_t idle() const { return m_idle.size(); }
+    std::size_t maxRetained() const { return m_maxRetained; }
+    void setMaxRetained(std::size_t maxRetained) { m_maxRetained = maxRetained; }
+    std::int64_t created() const { return m_created; }
+    std::int64_t rented() const { return m_rented; }
+
+  private:
+    std::vector<List*> m_idle;
+    std::size_t m_maxRetained;
+    std::int64_t m_created = 0;
+    std::int64_t m_rented = 0;
+  };
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+// Only for translation units compiled without /clr: <thread> is not supported under /clr.
+#if defined(_M_CEE)
+#error "Parallel.h must not be included from /clr translation units"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace CwAPI3D::Net::Bridge::Native
+{
+  namespace Detail
+  {
+    inline std::atomic<std::size_t>& threadOverride()
+    {
+      static std::atomic<std::size_t> threads{0};
+      return threads;
+    }
+  }
+
+  /// Number of threads parallel work is split across: the hardware threads unless setParallelThreads chose a count.
+  inline std::size_t parallelThreads()
+  {
+    const std::size_t threads = Detail::threadOverride().load(std::memory_order_relaxed);
+    return threads != 0 ? threads : std::max<std::size_t>(1, std::thread::hardware_concurrency());
+  }
+
+  /// Forces a thread count, e.g. so tests reach the multi-threaded paths on a single core. 0 restores the default.
+  inline void setParallelThreads(std::size_t threads)
+  {
+    Detail::threadOverride().store(threads, std::memory_order_relaxed);
+  }
+
+  /// Splits [0, count) into contiguous ranges of at least minRange elements and calls body(begin, end)
+  /// for each, one range per thread (see parallelThreads). The calling thread processes the first range itself.
+  /// The first exception thrown by any range is rethrown after all threads have finished.
+  template <class Body>
+  void parallelFor(std::size_t count, std::size_t minRange, Body&& body)
+  {
+    const std::size_t threads = parallelThreads();
+    const std::size_t byWork = std::max<std::size_t>(1, count / std::max<std::size_t>(1, minRange));
+    const std::size_t rangeCount = std::min(threads, byWork);
+    if (rangeCount <= 1)
+    {
+      if (count > 0)
+        body(std::size_t{0}, count);
+      return;
+    }
+
+    const std::size_t rangeSize = (count + rangeCount - 1) / rangeCount;
+    std::vector<std::exception_ptr> errors(rangeCount);
+    std::vector<std::thread> workers;
+    workers.reserve(rangeCount - 1);
+
+    auto run = [&](std::size_t range) {
+      const std::size_t begin = range * rangeSize;
+      const std::size_t end = std::min(count, begin + rangeSize);
+      if (begin >= end)
+        return;
+      try
+      {
+        body(begin, end);
+      }
+      catch (...)
+      {
+        errors[range] = std::current_exception();
+      }
+    };
+
+    std::size_t started = 1;
+    try
+    {
+      for (; started < rangeCount; ++started)
+        workers.emplace_back(run, started);
+    }
+    catch (const std::system_error&)
+    {
+      // Out of threads: the ranges that did not get one run on the calling thread below.
+    }
+
+    run(0);
+    for (std::size_t range = started; range < rangeCount; ++range)
+      run(range);
+    for (auto& worker : workers)
+      worker.join();
+
+    for (const auto& error : errors)
+    {
+      if (error)
+        std::rethrow_exception(error);
+    }
+  }
+}
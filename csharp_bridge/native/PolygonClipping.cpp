@@ -0,0 +1,162 @@
+#include "PolygonClipping.h"
+
+#include "../core/Vec3.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Core::Vec3d;
+  using Native::Kernels::PlaneCoefficients;
+
+  // Polygons are taken in blocks of about this many vertices, so a block's distances to every plane are computed
+  // with the SIMD kernel and stay in cache while its polygons are clipped.
+  constexpr std::size_t BlockVertices = 4096;
+
+  /// What a plane does to a polygon, judged from the polygon's input vertices.
+  enum class PlaneEffect
+  {
+    /// No vertex lies behind the plane; clipped vertices are blends of the inputs, so they cannot either.
+    None,
+    /// Every vertex lies behind the plane.
+    RemovesAll,
+    Cuts
+  };
+
+  PlaneEffect effectOf(const double* distances, std::size_t count, double epsilon)
+  {
+    std::size_t behind = 0;
+    for (std::size_t i = 0; i < count; ++i)
+      behind += distances[i] < -epsilon ? 1 : 0;
+    if (behind == 0)
+      return PlaneEffect::None;
+    return behind == count ? PlaneEffect::RemovesAll : PlaneEffect::Cuts;
+  }
+
+  double distanceTo(const PlaneCoefficients& plane, const Vec3d& point)
+  {
+    return plane.nx * point.x + plane.ny * point.y + plane.nz * point.z + plane.d;
+  }
+
+  /// The polygon being clipped, reused across polygons.
+  struct Scratch
+  {
+    std::vector<Vec3d> polygon;
+    std::vector<Vec3d> clipped;
+    std::vector<double> distances;
+  };
+
+  /// One Sutherland-Hodgman pass: keeps the part of scratch.polygon in front of a plane, given the distance of
+  /// each of its vertices. Edges are only split where they run from strictly in front to strictly behind or the other way round,
+  /// so vertices on the plane are neither duplicated nor moved.
+  void clipAgainst(Scratch& scratch, const double* distances, double epsilon)
+  {
+    const std::vector<Vec3d>& polygon = scratch.polygon;
+    std::vector<Vec3d>& clipped = scratch.clipped;
+    clipped.clear();
+
+    const std::size_t count = polygon.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const std::size_t j = i + 1 == count ? 0 : i + 1;
+      const double di = distances[i];
+      const double dj = distances[j];
+      if (di >= -epsilon)
+        clipped.push_back(polygon[i]);
+      if ((di > epsilon && dj < -epsilon) || (di < -epsilon && dj > epsilon))
+        clipped.push_back(polygon[i] + (polygon[j] - polygon[i]) * (di / (di - dj)));
+    }
+    scratch.polygon.swap(clipped);
+  }
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::Kernels::clipPolygons(ConstSoaView vertices, const std::int32_t* offsets,
+  std::size_t polygonCount, const PlaneCoefficients* planes, std::size_t planeCount, double epsilon, SoaBuffer& out,
+  std::int32_t* outOffsets)
+{
+  out.clear();
+  out.reserve(vertices.count);
+  outOffsets[0] = 0;
+
+  // Distances of the current block's vertices to each plane, plane-major.
+  std::vector<double> blockDistances;
+  Scratch scratch;
+  std::size_t kept = 0;
+
+  for (std::size_t first = 0; first < polygonCount;)
+  {
+    const auto blockBegin = static_cast<std::size_t>(offsets[first]);
+    std::size_t last = first + 1;
+    while (last < polygonCount && static_cast<std::size_t>(offsets[last + 1]) - blockBegin <= BlockVertices)
+      ++last;
+    const std::size_t blockCount = static_cast<std::size_t>(offsets[last]) - blockBegin;
+
+    blockDistances.resize(planeCount * blockCount);
+    const ConstSoaView block{vertices.x + blockBegin, vertices.y + blockBegin, vertices.z + blockBegin, blockCount};
+    for (std::size_t k = 0; k < planeCount; ++k)
+      planeDistance(block, planes[k].nx, planes[k].ny, planes[k].nz, planes[k].d, blockDistances.data() + k * blockCount);
+
+    for (std::size_t p = first; p < last; ++p)
+    {
+      const auto begin = static_cast<std::size_t>(offsets[p]);
+      const std::size_t count = static_cast<std::size_t>(offsets[p + 1]) - begin;
+      const std::size_t local = begin - blockBegin;
+
+      bool removed = count < 3;
+      bool loaded = false;
+      for (std::size_t k = 0; k < planeCount && !removed; ++k)
+      {
+        const double* inputDistances = blockDistances.data() + k * blockCount + local;
+        const PlaneEffect effect = effectOf(inputDistances, count, epsilon);
+        if (effect == PlaneEffect::None)
+          continue;
+        if (effect == PlaneEffect::RemovesAll)
+        {
+          removed = true;
+          break;
+        }
+
+        // Only polygons a plane actually cuts are copied out of the SoA input; the first cut can use the SIMD
+        // distances, later ones measure the already clipped vertices.
+        const double* distances = inputDistances;
+        if (!loaded)
+        {
+          scratch.polygon.clear();
+          for (std::size_t i = begin; i < begin + count; ++i)
+            scratch.polygon.push_back(Vec3d{vertices.x[i], vertices.y[i], vertices.z[i]});
+          loaded = true;
+        }
+        else
+        {
+          scratch.distances.resize(scratch.polygon.size());
+          for (std::size_t i = 0; i < scratch.polygon.size(); ++i)
+            scratch.distances[i] = distanceTo(planes[k], scratch.polygon[i]);
+          distances = scratch.distances.data();
+        }
+
+        clipAgainst(scratch, distances, epsilon);
+        removed = scratch.polygon.size() < 3;
+      }
+
+      if (!removed)
+      {
+        if (loaded)
+        {
+          for (const Vec3d& vertex : scratch.polygon)
+            out.push_back(vertex.x, vertex.y, vertex.z);
+        }
+        else
+        {
+          for (std::size_t i = begin; i < begin + count; ++i)
+            out.push_back(vertices.x[i], vertices.y[i], vertices.z[i]);
+        }
+        ++kept;
+      }
+      outOffsets[p + 1] = static_cast<std::int32_t>(out.size());
+    }
+    first = last;
+  }
+  return kept;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "SoaBuffer.h"
+#include "SoaKernels.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Plain C++ (no /clr) Sutherland-Hodgman clipping of many polygons at once, behind the managed PolygonClipping.
+// Polygons are flat: polygon k is the vertices [offsets[k], offsets[k + 1]) of one structure-of-arrays buffer.
+namespace CwAPI3D::Net::Bridge::Native::Kernels
+{
+  /// Clips each of polygonCount polygons to the front side (n . p + d >= -epsilon) of every plane, i.e. to the
+  /// convex region the planes bound. `offsets` holds polygonCount + 1 non-decreasing entries, the last no larger
+  /// than vertices.count. Vertices within epsilon of a plane count as on it and are kept as they are.
+  ///
+  /// `out` is overwritten with the clipped polygons in input order, polygon k at [outOffsets[k], outOffsets[k + 1]);
+  /// outOffsets must hold polygonCount + 1 entries. Polygons clipped away, or left with fewer than three vertices,
+  /// are empty. Returns the number of non-empty polygons.
+  std::size_t clipPolygons(ConstSoaView vertices, const std::int32_t* offsets, std::size_t polygonCount,
+    const PlaneCoefficients* planes, std::size_t planeCount, double epsilon, SoaBuffer& out, std::int32_t* outOffsets);
+}
@@ -0,0 +1,223 @@
+// No include guard: the batch types are defined inside CWAPI3D_SIMD_NAMESPACE, which every including
+// translation unit sets to a name unique to its instruction set. That keeps, for example, the scalar
+// code compiled with /arch:AVX2 from being merged by the linker with the baseline build of the same code.
+#ifndef CWAPI3D_SIMD_NAMESPACE
+#error "Define CWAPI3D_SIMD_NAMESPACE before including SimdBatch.h"
+#endif
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define CWAPI3D_SIMD_HAS_SSE2 1
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CWAPI3D_SIMD_HAS_AVX2 1
+#endif
+
+namespace CwAPI3D::Net::Bridge::Native::CWAPI3D_SIMD_NAMESPACE
+{
+  // Each batch type exposes the same static interface over `width` doubles, so a kernel written
+  // once against it can be instantiated per instruction set. Loads and stores are unaligned because
+  // kernels also run over pinned managed arrays.
+
+  struct ScalarBatch
+  {
+    using reg = double;
+    using mask = bool;
+    static constexpr std::size_t width = 1;
+
+    static reg load(const double* p) { return *p; }
+    static void store(double* p, reg v) { *p = v; }
+    static reg set1(double v) { return v; }
+    static reg add(reg a, reg b) { return a + b; }
+    static reg sub(reg a, reg b) { return a - b; }
+    static reg mul(reg a, reg b) { return a * b; }
+    static reg div(reg a, reg b) { return a / b; }
+    static reg sqrt(reg a) { return std::sqrt(a); }
+    static reg abs(reg a) { return std::fabs(a); }
+    static reg min(reg a, reg b) { return b < a ? b : a; }
+    static reg max(reg a, reg b) { return a < b ? b : a; }
+    static mask lt(reg a, reg b) { return a < b; }
+    static mask gt(reg a, reg b) { return a > b; }
+    static mask le(reg a, reg b) { return a <= b; }
+    static mask ge(reg a, reg b) { return a >= b; }
+    static mask and_(mask a, mask b) { return a && b; }
+    static mask or_(mask a, mask b) { return a || b; }
+    static mask not_(mask a) { return !a; }
+    /// Returns a where m is set, b elsewhere.
+    static reg select(mask m, reg a, reg b) { return m ? a : b; }
+    /// Bit i is set when lane i of the mask is set.
+    static int movemask(mask m) { return m ? 1 : 0; }
+  };
+
+#if defined(CWAPI3D_SIMD_HAS_SSE2)
+  struct Sse2Batch
+  {
+    using reg = __m128d;
+    using mask = __m128d;
+    static constexpr std::size_t width = 2;
+
+    static reg load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, reg v) { _mm_storeu_pd(p, v); }
+    static reg set1(double v) { return _mm_set1_pd(v); }
+    static reg add(reg a, reg b) { return _mm_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm_mul_pd(a, b); }
+    static reg div(reg a, reg b) { return _mm_div_pd(a, b); }
+    static reg sqrt(reg a) { return _mm_sqrt_pd(a); }
+    static reg abs(reg a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+    static reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+    static mask lt(reg a, reg b) { return _mm_cmplt_pd(a, b); }
+    static mask gt(reg a, reg b) { return _mm_cmpgt_pd(a, b); }
+    static mask le(reg a, reg b) { return _mm_cmple_pd(a, b); }
+    static mask ge(reg a, reg b) { return _mm_cmpge_pd(a, b); }
+    static mask and_(mask a, mask b) { return _mm_and_pd(a, b); }
+    static mask or_(mask a, mask b) { return _mm_or_pd(a, b); }
+    static mask not_(mask a) { return _mm_xor_pd(a, _mm_castsi128_pd(_mm_set1_epi32(-1))); }
+    static reg select(mask m, reg a, reg b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+    static int movemask(mask m) { return _mm_movemask_pd(m); }
+  };
+#endif
+
+#if defined(CWAPI3D_SIMD_HAS_AVX2)
+  struct Avx2Batch
+  {
+    using reg = __m256d;
+    using mask = __m256d;
+    static constexpr std::size_t width = 4;
+
+    static reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, reg v) { _mm256_storeu_pd(p, v); }
+    static reg set1(double v) { return _mm256_set1_pd(v); }
+    static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+    static reg div(reg a, reg b) { return _mm256_div_pd(a, b); }
+    static reg sqrt(reg a) { return _mm256_sqrt_pd(a); }
+    static reg abs(reg a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+    static mask lt(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static mask gt(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static mask le(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+    static mask ge(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+    static mask and_(mask a, mask b) { return _mm256_and_pd(a, b); }
+    static mask or_(mask a, mask b) { return _mm256_or_pd(a, b); }
+    static mask not_(mask a) { return _mm256_xor_pd(a, _mm256_castsi256_pd(_mm256_set1_epi32(-1))); }
+    static reg select(mask m, reg a, reg b) { return _mm256_blendv_pd(b, a, m); }
+    static int movemask(mask m) { return _mm256_movemask_pd(m); }
+  };
+#endif
+
+  // Word batches give bitmap kernels the same per-instruction-set interface over `width` 64-bit words.
+  // Set bits are counted into a `counter` that is only reduced to a number once, at the end of a loop.
+
+  struct ScalarWords
+  {
+    using reg = std::uint64_t;
+    using counter = std::size_t;
+    static constexpr std::size_t width = 1;
+
+    static reg load(const std::uint64_t* p) { return *p; }
+    static void store(std::uint64_t* p, reg v) { *p = v; }
+    static reg and_(reg a, reg b) { return a & b; }
+    static reg or_(reg a, reg b) { return a | b; }
+    /// a & ~b
+    static reg andNot(reg a, reg b) { return a & ~b; }
+    static counter zeroCount() { return 0; }
+    static counter addCount(counter c, reg v) { return c + static_cast<std::size_t>(std::popcount(v)); }
+    static std::size_t sumCount(counter c) { return c; }
+  };
+
+#if defined(CWAPI3D_SIMD_HAS_SSE2)
+  struct Sse2Words
+  {
+    using reg = __m128i;
+    using counter = __m128i;
+    static constexpr std::size_t width = 2;
+
+    static reg load(const std::uint64_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void store(std::uint64_t* p, reg v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static reg and_(reg a, reg b) { return _mm_and_si128(a, b); }
+    static reg or_(reg a, reg b) { return _mm_or_si128(a, b); }
+    static reg andNot(reg a, reg b) { return _mm_andnot_si128(b, a); }
+    static counter zeroCount() { return _mm_setzero_si128(); }
+
+    // SSE2 has no byte shuffle, so bytes are counted with the usual shift-and-mask reduction, then summed
+    // per 64-bit lane with psadbw.
+    static counter addCount(counter c, reg v)
+    {
+      const __m128i m1 = _mm_set1_epi8(0x55);
+      const __m128i m2 = _mm_set1_epi8(0x33);
+      const __m128i m4 = _mm_set1_epi8(0x0f);
+      v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+      v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+      v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+      return _mm_add_epi64(c, _mm_sad_epu8(v, _mm_setzero_si128()));
+    }
+
+    static std::size_t sumCount(counter c)
+    {
+      alignas(16) std::uint64_t lanes[2];
+      _mm_store_si128(reinterpret_cast<__m128i*>(lanes), c);
+      return static_cast<std::size_t>(lanes[0] + lanes[1]);
+    }
+  };
+#endif
+
+#if defined(CWAPI3D_SIMD_HAS_AVX2)
+  struct Avx2Words
+  {
+    using reg = __m256i;
+    using counter = __m256i;
+    static constexpr std::size_t width = 4;
+
+    static reg load(const std::uint64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void store(std::uint64_t* p, reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static reg and_(reg a, reg b) { return _mm256_and_si256(a, b); }
+    static reg or_(reg a, reg b) { return _mm256_or_si256(a, b); }
+    static reg andNot(reg a, reg b) { return _mm256_andnot_si256(b, a); }
+    static counter zeroCount() { return _mm256_setzero_si256(); }
+
+    // Nibble lookup with vpshufb, then psadbw sums the byte counts per 64-bit lane.
+    static counter addCount(counter c, reg v)
+    {
+      const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                             0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+      const __m256i low = _mm256_set1_epi8(0x0f);
+      const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(v, low)),
+                                             _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+      return _mm256_add_epi64(c, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+    }
+
+    static std::size_t sumCount(counter c)
+    {
+      alignas(32) std::uint64_t lanes[4];
+      _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), c);
+      return static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    }
+  };
+#endif
+
+  /// Runs body(Batch{}, i) over [0, count) in steps of Batch::width and finishes the remainder with
+  /// ScalarBatch, so kernels need no separate tail code.
+  template <class Batch, class Body>
+  inline void forEachLane(std::size_t count, Body&& body)
+  {
+    std::size_t i = 0;
+    if constexpr (Batch::width > 1)
+    {
+      for (; i + Batch::width <= count; i += Batch::width)
+        body(Batch{}, i);
+    }
+    for (; i < count; ++i)
+      body(ScalarBatch{}, i);
+  }
+}
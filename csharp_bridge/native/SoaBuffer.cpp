@@ -0,0 +1,143 @@
+#include "SoaBuffer.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+namespace
+{
+  constexpr std::size_t DoublesPerAlignment = CwAPI3D::Net::Bridge::Native::SoaAlignment / sizeof(double);
+
+  double* allocateAligned(std::size_t count)
+  {
+    // Round up so the byte size is a multiple of the alignment, as std::aligned_alloc requires.
+    const std::size_t bytes = ((count + DoublesPerAlignment - 1) / DoublesPerAlignment) * CwAPI3D::Net::Bridge::Native::SoaAlignment;
+#if defined(_MSC_VER)
+    void* memory = _aligned_malloc(bytes, CwAPI3D::Net::Bridge::Native::SoaAlignment);
+#else
+    void* memory = std::aligned_alloc(CwAPI3D::Net::Bridge::Native::SoaAlignment, bytes);
+#endif
+    if (!memory)
+      throw std::bad_alloc();
+    return static_cast<double*>(memory);
+  }
+
+  void freeAligned(double* memory)
+  {
+#if defined(_MSC_VER)
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+  }
+}
+
+CwAPI3D::Net::Bridge::Native::SoaBuffer::SoaBuffer(std::size_t capacity)
+{
+  reserve(capacity);
+}
+
+CwAPI3D::Net::Bridge::Native::SoaBuffer::~SoaBuffer()
+{
+  release();
+}
+
+CwAPI3D::Net::Bridge::Native::SoaBuffer::SoaBuffer(SoaBuffer&& other) noexcept
+  : m_x(std::exchange(other.m_x, nullptr)),
+    m_y(std::exchange(other.m_y, nullptr)),
+    m_z(std::exchange(other.m_z, nullptr)),
+    m_count(std::exchange(other.m_count, 0)),
+    m_capacity(std::exchange(other.m_capacity, 0))
+{
+}
+
+CwAPI3D::Net::Bridge::Native::SoaBuffer& CwAPI3D::Net::Bridge::Native::SoaBuffer::operator=(SoaBuffer&& other) noexcept
+{
+  if (this != &other)
+  {
+    release();
+    m_x = std::exchange(other.m_x, nullptr);
+    m_y = std::exchange(other.m_y, nullptr);
+    m_z = std::exchange(other.m_z, nullptr);
+    m_count = std::exchange(other.m_count, 0);
+    m_capacity = std::exchange(other.m_capacity, 0);
+  }
+  return *this;
+}
+
+void CwAPI3D::Net::Bridge::Native::SoaBuffer::release()
+{
+  freeAligned(m_x);
+  freeAligned(m_y);
+  freeAligned(m_z);
+  m_x = m_y = m_z = nullptr;
+  m_count = m_capacity = 0;
+}
+
+void CwAPI3D::Net::Bridge::Native::SoaBuffer::reserve(std::size_t capacity)
+{
+  if (capacity <= m_capacity)
+    return;
+
+  const std::size_t rounded = ((capacity + DoublesPerAlignment - 1) / DoublesPerAlignment) * DoublesPerAlignment;
+  double* x = allocateAligned(rounded);
+  double* y = nullptr;
+  double* z = nullptr;
+  try
+  {
+    y = allocateAligned(rounded);
+    z = allocateAligned(rounded);
+  }
+  catch (...)
+  {
+    freeAligned(x);
+    freeAligned(y);
+    throw;
+  }
+
+  if (m_count > 0)
+  {
+    std::memcpy(x, m_x, m_count * sizeof(double));
+    std::memcpy(y, m_y, m_count * sizeof(double));
+    std::memcpy(z, m_z, m_count * sizeof(double));
+  }
+
+  const std::size_t count = m_count;
+  release();
+  m_x = x;
+  m_y = y;
+  m_z = z;
+  m_count = count;
+  m_capacity = rounded;
+}
+
+void CwAPI3D::Net::Bridge::Native::SoaBuffer::resize(std::size_t count)
+{
+  if (count > m_capacity)
+    reserve(count);
+
+  if (count > m_count)
+  {
+    const std::size_t added = count - m_count;
+    std::memset(m_x + m_count, 0, added * sizeof(double));
+    std::memset(m_y + m_count, 0, added * sizeof(double));
+    std::memset(m_z + m_count, 0, added * sizeof(double));
+  }
+  m_count = count;
+}
+
+void CwAPI3D::Net::Bridge::Native::SoaBuffer::push_back(double x, double y, double z)
+{
+  if (m_count == m_capacity)
+    reserve(m_capacity < 16 ? 16 : m_capacity * 2);
+
+  m_x[m_count] = x;
+  m_y[m_count] = y;
+  m_z[m_count] = z;
+  ++m_count;
+}
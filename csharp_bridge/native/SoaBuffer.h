@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+
+// Plain C++ (no /clr) storage shared by the managed PointBuffer/VectorBuffer wrappers and the batch kernels.
+namespace CwAPI3D::Net::Bridge::Native
+{
+  /// Alignment of every coordinate array, wide enough for one AVX-512 register or cache line.
+  constexpr std::size_t SoaAlignment = 64;
+
+  /// Read-only structure-of-arrays view: element i is (x[i], y[i], z[i]).
+  struct ConstSoaView
+  {
+    const double* x;
+    const double* y;
+    const double* z;
+    std::size_t count;
+  };
+
+  /// Mutable structure-of-arrays view.
+  struct SoaView
+  {
+    double* x;
+    double* y;
+    double* z;
+    std::size_t count;
+
+    operator ConstSoaView() const { return ConstSoaView{x, y, z, count}; }
+  };
+
+  /// Owns three separately allocated, SoaAlignment-aligned coordinate arrays.
+  class SoaBuffer
+  {
+  public:
+    SoaBuffer() = default;
+    explicit SoaBuffer(std::size_t capacity);
+    ~SoaBuffer();
+
+    SoaBuffer(const SoaBuffer&) = delete;
+    SoaBuffer& operator=(const SoaBuffer&) = delete;
+    SoaBuffer(SoaBuffer&& other) noexcept;
+    SoaBuffer& operator=(SoaBuffer&& other) noexcept;
+
+    std::size_t size() const { return m_count; }
+    std::size_t capacity() const { return m_capacity; }
+
+    double* x() { return m_x; }
+    double* y() { return m_y; }
+    double* z() { return m_z; }
+    const double* x() const { return m_x; }
+    const double* y() const { return m_y; }
+    const double* z() const { return m_z; }
+
+    SoaView view() { return SoaView{m_x, m_y, m_z, m_count}; }
+    ConstSoaView view() const { return ConstSoaView{m_x, m_y, m_z, m_count}; }
+
+    /// Grows the capacity to at least `capacity` elements, keeping the contents.
+    void reserve(std::size_t capacity);
+
+    /// Sets the element count; new elements are zero-initialized.
+    void resize(std::size_t count);
+
+    void clear() { m_count = 0; }
+
+    void push_back(double x, double y, double z);
+
+  private:
+    void release();
+
+    double* m_x = nullptr;
+    double* m_y = nullptr;
+    double* m_z = nullptr;
+    std::size_t m_count = 0;
+    std::size_t m_capacity = 0;
+  };
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "SoaBuffer.h"
+#include "SoaKernels.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Internal to the kernel implementation: one table of entry points per instruction set.
+namespace CwAPI3D::Net::Bridge::Native::Kernels::Detail
+{
+  struct KernelTable
+  {
+    void (*add)(ConstSoaView, ConstSoaView, SoaView);
+    void (*subtract)(ConstSoaView, ConstSoaView, SoaView);
+    void (*scale)(ConstSoaView, double, SoaView);
+    void (*translate)(ConstSoaView, double, double, double, SoaView);
+    void (*dot)(ConstSoaView, ConstSoaView, double*);
+    void (*cross)(ConstSoaView, ConstSoaView, SoaView);
+    void (*magnitude)(ConstSoaView, double*);
+    void (*normalize)(ConstSoaView, double, SoaView);
+    void (*distanceToPoint)(ConstSoaView, double, double, double, double*);
+    void (*planeDistance)(ConstSoaView, double, double, double, double, double*);
+    void (*planeProject)(ConstSoaView, double, double, double, double, SoaView);
+    PlaneSideCounts (*planeClassify)(ConstSoaView, double, double, double, double, double, PlaneSide*);
+    std::size_t (*segmentPlane)(ConstSoaView, ConstSoaView, double, double, double, double, double, bool*, SoaView);
+    std::size_t (*planePair)(ConstPlaneView, double, double, double, double, double, SoaView, SoaView,
+      PlaneIntersectionStatus*);
+    std::size_t (*planeTriple)(ConstPlaneView, ConstPlaneView, ConstPlaneView, double, SoaView, PlaneIntersectionStatus*);
+  };
+
+  const KernelTable& scalarKernels();
+  const KernelTable* sse2Kernels();
+  const KernelTable* avx2Kernels();
+
+  /// Bitmap word kernels behind BitmapKernels.h; each writes its result words and returns their set-bit count.
+  struct BitmapKernelTable
+  {
+    std::size_t (*andWords)(const std::uint64_t*, const std::uint64_t*, std::uint64_t*, std::size_t);
+    std::size_t (*orWords)(const std::uint64_t*, const std::uint64_t*, std::uint64_t*, std::size_t);
+    std::size_t (*andNotWords)(const std::uint64_t*, const std::uint64_t*, std::uint64_t*, std::size_t);
+    std::size_t (*countWords)(const std::uint64_t*, std::size_t);
+  };
+
+  const BitmapKernelTable& scalarBitmapKernels();
+  const BitmapKernelTable* sse2BitmapKernels();
+  const BitmapKernelTable* avx2BitmapKernels();
+}
@@ -0,0 +1,323 @@
+#include "SoaKernels.h"
+#include "BitmapKernels.h"
+#include "Parallel.h"
+
+#define CWAPI3D_SIMD_NAMESPACE BaselineImpl
+#include "SoaKernelsImpl.h"
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Detail = CwAPI3D::Net::Bridge::Native::Kernels::Detail;
+using CwAPI3D::Net::Bridge::Native::Kernels::SimdLevel;
+
+const Detail::KernelTable& Detail::scalarKernels()
+{
+  static const KernelTable table = BaselineImpl::SoaKernels<BaselineImpl::ScalarBatch>::table();
+  return table;
+}
+
+const Detail::KernelTable* Detail::sse2Kernels()
+{
+#if defined(CWAPI3D_SIMD_HAS_SSE2)
+  static const KernelTable table = BaselineImpl::SoaKernels<BaselineImpl::Sse2Batch>::table();
+  return &table;
+#else
+  return nullptr;
+#endif
+}
+
+const Detail::BitmapKernelTable& Detail::scalarBitmapKernels()
+{
+  static const BitmapKernelTable table = BaselineImpl::BitmapKernels<BaselineImpl::ScalarWords>::table();
+  return table;
+}
+
+const Detail::BitmapKernelTable* Detail::sse2BitmapKernels()
+{
+#if defined(CWAPI3D_SIMD_HAS_SSE2)
+  static const BitmapKernelTable table = BaselineImpl::BitmapKernels<BaselineImpl::Sse2Words>::table();
+  return &table;
+#else
+  return nullptr;
+#endif
+}
+
+namespace
+{
+  bool cpuSupportsAvx2()
+  {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7)
+      return false;
+
+    __cpuid(info, 1);
+    const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osSavesYmm || !avx)
+      return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+  }
+
+  SimdLevel bestAvailableLevel()
+  {
+    if (Detail::avx2Kernels() && cpuSupportsAvx2())
+      return SimdLevel::Avx2;
+    if (Detail::sse2Kernels())
+      return SimdLevel::Sse2;
+    return SimdLevel::Scalar;
+  }
+
+  const Detail::KernelTable* tableFor(SimdLevel level)
+  {
+    switch (level)
+    {
+    case SimdLevel::Avx2: return Detail::avx2Kernels();
+    case SimdLevel::Sse2: return Detail::sse2Kernels();
+    default: return &Detail::scalarKernels();
+    }
+  }
+
+  std::atomic<SimdLevel>& currentLevel()
+  {
+    static std::atomic<SimdLevel> level{bestAvailableLevel()};
+    return level;
+  }
+
+  const Detail::KernelTable& kernels()
+  {
+    return *tableFor(currentLevel().load(std::memory_order_relaxed));
+  }
+
+  // Each level that has SoA kernels also has bitmap kernels, so the level check above covers both.
+  const Detail::BitmapKernelTable& bitmapKernels()
+  {
+    switch (currentLevel().load(std::memory_order_relaxed))
+    {
+    case SimdLevel::Avx2: return *Detail::avx2BitmapKernels();
+    case SimdLevel::Sse2: return *Detail::sse2BitmapKernels();
+    default: return Detail::scalarBitmapKernels();
+    }
+  }
+}
+
+SimdLevel CwAPI3D::Net::Bridge::Native::Kernels::activeSimdLevel()
+{
+  return currentLevel().load(std::memory_order_relaxed);
+}
+
+SimdLevel CwAPI3D::Net::Bridge::Native::Kernels::setSimdLevel(SimdLevel level)
+{
+  const SimdLevel best = bestAvailableLevel();
+  const SimdLevel applied = static_cast<int>(level) > static_cast<int>(best) ? best : level;
+  currentLevel().store(applied, std::memory_order_relaxed);
+  return applied;
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::Kernels::bitmapAnd(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t words)
+{
+  return bitmapKernels().andWords(a, b, out, words);
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::Kernels::bitmapOr(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t words)
+{
+  return bitmapKernels().orWords(a, b, out, words);
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::Kernels::bitmapAndNot(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t words)
+{
+  return bitmapKernels().andNotWords(a, b, out, words);
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::Kernels::bitmapCount(const std::uint64_t* bits, std::size_t words)
+{
+  return bitmapKernels().countWords(bits, words);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::add(ConstSoaView a, ConstSoaView b, SoaView out)
+{
+  kernels().add(a, b, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::subtract(ConstSoaView a, ConstSoaView b, SoaView out)
+{
+  kernels().subtract(a, b, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::scale(ConstSoaView a, double scalar, SoaView out)
+{
+  kernels().scale(a, scalar, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::translate(ConstSoaView a, double ox, double oy, double oz, SoaView out)
+{
+  kernels().translate(a, ox, oy, oz, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::dot(ConstSoaView a, ConstSoaView b, double* out)
+{
+  kernels().dot(a, b, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::cross(ConstSoaView a, ConstSoaView b, SoaView out)
+{
+  kernels().cross(a, b, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::magnitude(ConstSoaView a, double* out)
+{
+  kernels().magnitude(a, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::normalize(ConstSoaView a, double epsilon, SoaView out)
+{
+  kernels().normalize(a, epsilon, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::distanceToPoint(ConstSoaView a, double px, double py, double pz, double* out)
+{
+  kernels().distanceToPoint(a, px, py, pz, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::planeDistance(ConstSoaView points, double nx, double ny, double nz, double d, double* out)
+{
+  kernels().planeDistance(points, nx, ny, nz, d, out);
+}
+
+void CwAPI3D::Net::Bridge::Native::Kernels::planeProject(ConstSoaView points, double nx, double ny, double nz, double d, SoaView out)
+{
+  kernels().planeProject(points, nx, ny, nz, d, out);
+}
+
+CwAPI3D::Net::Bridge::Native::Kernels::PlaneSideCounts CwAPI3D::Net::Bridge::Native::Kernels::classifyPlane(
+  ConstSoaView points, double nx, double ny, double nz, double d, double epsilon, PlaneSide* sides)
+{
+  return kernels().planeClassify(points, nx, ny, nz, d, epsilon, sides);
+}
+
+namespace
+{
+  // Below this many segments per thread, starting threads costs more than it saves.
+  constexpr std::size_t MinParallelSegments = 16384;
+  // Likewise for plane pairs and triples, which cost about as much per entry as a segment.
+  constexpr std::size_t MinParallelPlaneEntries = 16384;
+
+  CwAPI3D::Net::Bridge::Native::ConstSoaView slice(CwAPI3D::Net::Bridge::Native::ConstSoaView view, std::size_t begin, std::size_t end)
+  {
+    return {view.x + begin, view.y + begin, view.z + begin, end - begin};
+  }
+
+  CwAPI3D::Net::Bridge::Native::SoaView slice(CwAPI3D::Net::Bridge::Native::SoaView view, std::size_t begin, std::size_t end)
+  {
+    return {view.x + begin, view.y + begin, view.z + begin, end - begin};
+  }
+
+  CwAPI3D::Net::Bridge::Native::Kernels::ConstPlaneView slice(CwAPI3D::Net::Bridge::Native::Kernels::ConstPlaneView view,
+    std::size_t begin, std::size_t end)
+  {
+    return {view.nx + begin, view.ny + begin, view.nz + begin, view.d + begin, end - begin};
+  }
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::Kernels::intersectSegmentsPlane(ConstSoaView starts, ConstSoaView ends,
+  const PlaneCoefficients& plane, double epsilon, bool* hits, SoaView out, bool parallel)
+{
+  return intersectSegmentsPlanes(starts, ends, &plane, 1, epsilon, hits, out, parallel);
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::Kernels::intersectSegmentsPlanes(ConstSoaView starts, ConstSoaView ends,
+  const PlaneCoefficients* planes, std::size_t planeCount, double epsilon, bool* hits, SoaView out, bool parallel)
+{
+  const Detail::KernelTable& table = kernels();
+  const std::size_t segmentCount = starts.count;
+
+  // Each range walks its segments against every plane, so the segment data stays in cache across planes.
+  auto intersectRange = [&](std::size_t begin, std::size_t end) {
+    std::size_t rangeHits = 0;
+    for (std::size_t k = 0; k < planeCount; ++k)
+    {
+      const PlaneCoefficients& plane = planes[k];
+      const std::size_t offset = k * segmentCount;
+      rangeHits += table.segmentPlane(slice(starts, begin, end), slice(ends, begin, end),
+        plane.nx, plane.ny, plane.nz, plane.d, epsilon, hits + offset + begin, slice(out, offset + begin, offset + end));
+    }
+    return rangeHits;
+  };
+
+  if (!parallel)
+    return intersectRange(0, segmentCount);
+
+  std::atomic<std::size_t> hitCount{0};
+  parallelFor(segmentCount, MinParallelSegments, [&](std::size_t begin, std::size_t end) {
+    hitCount.fetch_add(intersectRange(begin, end), std::memory_order_relaxed);
+  });
+  return hitCount.load();
+}
+
+
+std::size_t CwAPI3D::Net::Bridge::Native::Kernels::intersectPlanePairs(ConstPlaneView first, ConstPlaneView second,
+  double epsilon, SoaView points, SoaView directions, PlaneIntersectionStatus* status, bool parallel)
+{
+  const Detail::KernelTable& table = kernels();
+  const std::size_t rowLength = first.count;
+  const std::size_t total = rowLength * second.count;
+  if (total == 0)
+    return 0;
+
+  // Entry k pairs first[k % rowLength] with second[k / rowLength]. A range may start or end inside a row, so each
+  // row it touches is trimmed to the range; the kernel then runs over first with one plane of second held fixed.
+  auto intersectRange = [&](std::size_t begin, std::size_t end) {
+    std::size_t rangeHits = 0;
+    for (std::size_t row = begin / rowLength; row * rowLength < end; ++row)
+    {
+      const std::size_t rowStart = row * rowLength;
+      const std::size_t from = std::max(begin, rowStart);
+      const std::size_t to = std::min(end, rowStart + rowLength);
+      rangeHits += table.planePair(slice(first, from - rowStart, to - rowStart),
+        second.nx[row], second.ny[row], second.nz[row], second.d[row], epsilon,
+        slice(points, from, to), slice(directions, from, to), status + from);
+    }
+    return rangeHits;
+  };
+
+  if (!parallel)
+    return intersectRange(0, total);
+
+  std::atomic<std::size_t> hitCount{0};
+  parallelFor(total, MinParallelPlaneEntries, [&](std::size_t begin, std::size_t end) {
+    hitCount.fetch_add(intersectRange(begin, end), std::memory_order_relaxed);
+  });
+  return hitCount.load();
+}
+
+std::size_t CwAPI3D::Net::Bridge::Native::Kernels::intersectPlaneTriples(ConstPlaneView a, ConstPlaneView b,
+  ConstPlaneView c, double epsilon, SoaView points, PlaneIntersectionStatus* status, bool parallel)
+{
+  const Detail::KernelTable& table = kernels();
+  auto intersectRange = [&](std::size_t begin, std::size_t end) {
+    return table.planeTriple(slice(a, begin, end), slice(b, begin, end), slice(c, begin, end), epsilon,
+      slice(points, begin, end), status + begin);
+  };
+
+  if (!parallel)
+    return intersectRange(0, a.count);
+
+  std::atomic<std::size_t> hitCount{0};
+  parallelFor(a.count, MinParallelPlaneEntries, [&](std::size_t begin, std::size_t end) {
+    hitCount.fetch_add(intersectRange(begin, end), std::memory_order_relaxed);
+  });
+  return hitCount.load();
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "SoaBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Batch geometry kernels over structure-of-arrays data.
+// The implementation is compiled without /clr and picks the widest instruction set the CPU supports
+// (AVX2, SSE2 or scalar) on first use. Output views may alias input views element for element.
+namespace CwAPI3D::Net::Bridge::Native::Kernels
+{
+  /// Plane n . p + d = 0 with unit normal n.
+  struct PlaneCoefficients
+  {
+    double nx;
+    double ny;
+    double nz;
+    double d;
+  };
+
+  /// Read-only structure-of-arrays plane set: plane i is nx[i] x + ny[i] y + nz[i] z + d[i] = 0 with unit normal.
+  struct ConstPlaneView
+  {
+    const double* nx;
+    const double* ny;
+    const double* nz;
+    const double* d;
+    std::size_t count;
+  };
+
+  /// How two or three planes meet, as written by intersectPlanePairs and intersectPlaneTriples.
+  enum class PlaneIntersectionStatus : std::uint8_t
+  {
+    /// Two planes meet in one line, three planes in one point.
+    Intersecting = 0,
+    /// Two planes are parallel (|n1 x n2| < epsilon) and apart.
+    Parallel = 1,
+    /// Two planes are parallel and less than epsilon apart.
+    Coincident = 2,
+    /// Three planes share no single point: |n1 . (n2 x n3)| < epsilon.
+    Singular = 3
+  };
+
+  /// Side of a plane a point lies on, as written by classifyPlane.
+  enum class PlaneSide : std::int8_t
+  {
+    Back = -1,
+    On = 0,
+    Front = 1
+  };
+
+  /// Number of points classifyPlane found on each side.
+  struct PlaneSideCounts
+  {
+    std::size_t front;
+    std::size_t back;
+    std::size_t on;
+  };
+
+  enum class SimdLevel
+  {
+    Scalar,
+    Sse2,
+    Avx2
+  };
+
+  /// The instruction set used by the kernels below.
+  SimdLevel activeSimdLevel();
+
+  /// Forces a narrower instruction set, e.g. to compare paths in benchmarks. Requests above what the
+  /// CPU supports fall back to the best available level. Returns the level now in use.
+  SimdLevel setSimdLevel(SimdLevel level);
+
+  /// out = a + b
+  void add(ConstSoaView a, ConstSoaView b, SoaView out);
+
+  /// out = a - b
+  void subtract(ConstSoaView a, ConstSoaView b, SoaView out);
+
+  /// out = a * scalar
+  void scale(ConstSoaView a, double scalar, SoaView out);
+
+  /// out = a + (ox, oy, oz)
+  void translate(ConstSoaView a, double ox, double oy, double oz, SoaView out);
+
+  /// out[i] = a[i] . b[i]
+  void dot(ConstSoaView a, ConstSoaView b, double* out);
+
+  /// out = a x b
+  void cross(ConstSoaView a, ConstSoaView b, SoaView out);
+
+  /// out[i] = |a[i]|
+  void magnitude(ConstSoaView a, double* out);
+
+  /// out = a / |a|, or the zero vector where |a| < epsilon.
+  void normalize(ConstSoaView a, double epsilon, SoaView out);
+
+  /// out[i] = |a[i] - (px, py, pz)|
+  void distanceToPoint(ConstSoaView a, double px, double py, double pz, double* out);
+
+  /// out[i] = n . a[i] + d for the plane n . p + d = 0 with unit normal n.
+  void planeDistance(ConstSoaView points, double nx, double ny, double nz, double d, double* out);
+
+  /// out = a - (n . a + d) n, the orthogonal projection onto the plane with unit normal n.
+  void planeProject(ConstSoaView points, double nx, double ny, double nz, double d, SoaView out);
+
+  /// sides[i] = the side of the plane n . p + d = 0 (unit normal n) that points[i] lies on: On where
+  /// |n . p + d| <= epsilon, otherwise Front where n . p + d > 0 and Back where it is negative.
+  PlaneSideCounts classifyPlane(ConstSoaView points, double nx, double ny, double nz, double d, double epsilon,
+    PlaneSide* sides);
+
+  /// Intersects segment i (starts[i] to ends[i]) with the plane, with the same rules as Plane3D::IntersectLine:
+  /// segments shorter than epsilon or with |n . direction| < epsilon miss. hits[i] tells whether segment i
+  /// hits; out[i] receives the hit point, or the origin on a miss. Returns the number of hits.
+  /// With `parallel`, large inputs are split across the available cores.
+  std::size_t intersectSegmentsPlane(ConstSoaView starts, ConstSoaView ends, const PlaneCoefficients& plane,
+    double epsilon, bool* hits, SoaView out, bool parallel);
+
+  /// Intersects every plane of `first` with every plane of `second`. Results are grouped by the second plane: the
+  /// entry for first[i] and second[j] is at j * first.count + i in status, points and directions, whose count must
+  /// be first.count * second.count. An intersecting pair gets the point of its line closest to the origin and the
+  /// unit direction first.n x second.n; other pairs get zero vectors. Returns the number of intersecting pairs.
+  /// With `parallel`, large inputs are split across the available cores.
+  std::size_t intersectPlanePairs(ConstPlaneView first, ConstPlaneView second, double epsilon, SoaView points,
+    SoaView directions, PlaneIntersectionStatus* status, bool parallel);
+
+  /// Intersects the planes a[i], b[i] and c[i] for every i, by Cramer's rule. Singular triples get the origin.
+  /// Returns the number of triples that meet in one point.
+  std::size_t intersectPlaneTriples(ConstPlaneView a, ConstPlaneView b, ConstPlaneView c, double epsilon,
+    SoaView points, PlaneIntersectionStatus* status, bool parallel);
+
+  /// Intersects every segment with each of planeCount planes. Results are plane-major: the entry for
+  /// plane k and segment i is at k * starts.count + i in hits and out, whose count must be
+  /// planeCount * starts.count. Returns the total number of hits.
+  std::size_t intersectSegmentsPlanes(ConstSoaView starts, ConstSoaView ends, const PlaneCoefficients* planes,
+    std::size_t planeCount, double epsilon, bool* hits, SoaView out, bool parallel);
+}
@@ -0,0 +1,23 @@
+// Compiled with /arch:AVX2 (-mavx2); only entered after SoaKernels.cpp has checked the CPU supports it.
+#define CWAPI3D_SIMD_NAMESPACE Avx2Impl
+#include "SoaKernelsImpl.h"
+
+const CwAPI3D::Net::Bridge::Native::Kernels::Detail::KernelTable* CwAPI3D::Net::Bridge::Native::Kernels::Detail::avx2Kernels()
+{
+#if defined(CWAPI3D_SIMD_HAS_AVX2)
+  static const KernelTable table = Avx2Impl::SoaKernels<Avx2Impl::Avx2Batch>::table();
+  return &table;
+#else
+  return nullptr;
+#endif
+}
+
+const CwAPI3D::Net::Bridge::Native::Kernels::Detail::BitmapKernelTable* CwAPI3D::Net::Bridge::Native::Kernels::Detail::avx2BitmapKernels()
+{
+#if defined(CWAPI3D_SIMD_HAS_AVX2)
+  static const BitmapKernelTable table = Avx2Impl::BitmapKernels<Avx2Impl::Avx2Words>::table();
+  return &table;
+#else
+  return nullptr;
+#endif
+}
@@ -0,0 +1,373 @@
+// No include guard: instantiated once per instruction set, see SimdBatch.h.
+#include "SimdBatch.h"
+#include "SoaKernelTable.h"
+
+namespace CwAPI3D::Net::Bridge::Native::CWAPI3D_SIMD_NAMESPACE
+{
+  template <class Batch>
+  struct SoaKernels
+  {
+    static void add(ConstSoaView a, ConstSoaView b, SoaView out)
+    {
+      forEachLane<Batch>(out.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        B::store(out.x + i, B::add(B::load(a.x + i), B::load(b.x + i)));
+        B::store(out.y + i, B::add(B::load(a.y + i), B::load(b.y + i)));
+        B::store(out.z + i, B::add(B::load(a.z + i), B::load(b.z + i)));
+      });
+    }
+
+    static void subtract(ConstSoaView a, ConstSoaView b, SoaView out)
+    {
+      forEachLane<Batch>(out.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        B::store(out.x + i, B::sub(B::load(a.x + i), B::load(b.x + i)));
+        B::store(out.y + i, B::sub(B::load(a.y + i), B::load(b.y + i)));
+        B::store(out.z + i, B::sub(B::load(a.z + i), B::load(b.z + i)));
+      });
+    }
+
+    static void scale(ConstSoaView a, double scalar, SoaView out)
+    {
+      forEachLane<Batch>(out.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        const auto s = B::set1(scalar);
+        B::store(out.x + i, B::mul(B::load(a.x + i), s));
+        B::store(out.y + i, B::mul(B::load(a.y + i), s));
+        B::store(out.z + i, B::mul(B::load(a.z + i), s));
+      });
+    }
+
+    static void translate(ConstSoaView a, double ox, double oy, double oz, SoaView out)
+    {
+      forEachLane<Batch>(out.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        B::store(out.x + i, B::add(B::load(a.x + i), B::set1(ox)));
+        B::store(out.y + i, B::add(B::load(a.y + i), B::set1(oy)));
+        B::store(out.z + i, B::add(B::load(a.z + i), B::set1(oz)));
+      });
+    }
+
+    static void dot(ConstSoaView a, ConstSoaView b, double* out)
+    {
+      forEachLane<Batch>(a.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        auto sum = B::mul(B::load(a.x + i), B::load(b.x + i));
+        sum = B::add(sum, B::mul(B::load(a.y + i), B::load(b.y + i)));
+        sum = B::add(sum, B::mul(B::load(a.z + i), B::load(b.z + i)));
+        B::store(out + i, sum);
+      });
+    }
+
+    static void cross(ConstSoaView a, ConstSoaView b, SoaView out)
+    {
+      forEachLane<Batch>(out.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        const auto ax = B::load(a.x + i), ay = B::load(a.y + i), az = B::load(a.z + i);
+        const auto bx = B::load(b.x + i), by = B::load(b.y + i), bz = B::load(b.z + i);
+        B::store(out.x + i, B::sub(B::mul(ay, bz), B::mul(az, by)));
+        B::store(out.y + i, B::sub(B::mul(az, bx), B::mul(ax, bz)));
+        B::store(out.z + i, B::sub(B::mul(ax, by), B::mul(ay, bx)));
+      });
+    }
+
+    static void magnitude(ConstSoaView a, double* out)
+    {
+      forEachLane<Batch>(a.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        const auto x = B::load(a.x + i), y = B::load(a.y + i), z = B::load(a.z + i);
+        B::store(out + i, B::sqrt(B::add(B::add(B::mul(x, x), B::mul(y, y)), B::mul(z, z))));
+      });
+    }
+
+    static void normalize(ConstSoaView a, double epsilon, SoaView out)
+    {
+      forEachLane<Batch>(out.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        const auto x = B::load(a.x + i), y = B::load(a.y + i), z = B::load(a.z + i);
+        const auto length = B::sqrt(B::add(B::add(B::mul(x, x), B::mul(y, y)), B::mul(z, z)));
+        const auto tooShort = B::lt(length, B::set1(epsilon));
+        // Divide by 1 in degenerate lanes to avoid infinities, then zero those lanes.
+        const auto inverse = B::div(B::set1(1.0), B::select(tooShort, B::set1(1.0), length));
+        const auto factor = B::select(tooShort, B::set1(0.0), inverse);
+        B::store(out.x + i, B::mul(x, factor));
+        B::store(out.y + i, B::mul(y, factor));
+        B::store(out.z + i, B::mul(z, factor));
+      });
+    }
+
+    static void distanceToPoint(ConstSoaView a, double px, double py, double pz, double* out)
+    {
+      forEachLane<Batch>(a.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        const auto dx = B::sub(B::load(a.x + i), B::set1(px));
+        const auto dy = B::sub(B::load(a.y + i), B::set1(py));
+        const auto dz = B::sub(B::load(a.z + i), B::set1(pz));
+        B::store(out + i, B::sqrt(B::add(B::add(B::mul(dx, dx), B::mul(dy, dy)), B::mul(dz, dz))));
+      });
+    }
+
+    static void planeDistance(ConstSoaView points, double nx, double ny, double nz, double d, double* out)
+    {
+      forEachLane<Batch>(points.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        auto distance = B::mul(B::load(points.x + i), B::set1(nx));
+        distance = B::add(distance, B::mul(B::load(points.y + i), B::set1(ny)));
+        distance = B::add(distance, B::mul(B::load(points.z + i), B::set1(nz)));
+        B::store(out + i, B::add(distance, B::set1(d)));
+      });
+    }
+
+    static void planeProject(ConstSoaView points, double nx, double ny, double nz, double d, SoaView out)
+    {
+      forEachLane<Batch>(out.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        const auto x = B::load(points.x + i), y = B::load(points.y + i), z = B::load(points.z + i);
+        auto distance = B::mul(x, B::set1(nx));
+        distance = B::add(distance, B::mul(y, B::set1(ny)));
+        distance = B::add(distance, B::mul(z, B::set1(nz)));
+        distance = B::add(distance, B::set1(d));
+        B::store(out.x + i, B::sub(x, B::mul(distance, B::set1(nx))));
+        B::store(out.y + i, B::sub(y, B::mul(distance, B::set1(ny))));
+        B::store(out.z + i, B::sub(z, B::mul(distance, B::set1(nz))));
+      });
+    }
+
+    static Kernels::PlaneSideCounts planeClassify(ConstSoaView points, double nx, double ny, double nz, double d,
+      double epsilon, Kernels::PlaneSide* sides)
+    {
+      Kernels::PlaneSideCounts counts{};
+      forEachLane<Batch>(points.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        auto distance = B::mul(B::load(points.x + i), B::set1(nx));
+        distance = B::add(distance, B::mul(B::load(points.y + i), B::set1(ny)));
+        distance = B::add(distance, B::mul(B::load(points.z + i), B::set1(nz)));
+        distance = B::add(distance, B::set1(d));
+
+        const int front = B::movemask(B::gt(distance, B::set1(epsilon)));
+        const int back = B::movemask(B::lt(distance, B::set1(-epsilon)));
+        for (std::size_t l = 0; l < B::width; ++l)
+        {
+          const int isFront = (front >> l) & 1;
+          const int isBack = (back >> l) & 1;
+          sides[i + l] = static_cast<Kernels::PlaneSide>(isFront - isBack);
+          counts.front += static_cast<std::size_t>(isFront);
+          counts.back += static_cast<std::size_t>(isBack);
+        }
+      });
+      counts.on = points.count - counts.front - counts.back;
+      return counts;
+    }
+
+    static std::size_t segmentPlane(ConstSoaView starts, ConstSoaView ends, double nx, double ny, double nz, double d,
+      double epsilon, bool* hits, SoaView out)
+    {
+      std::size_t hitCount = 0;
+      forEachLane<Batch>(out.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        const auto sx = B::load(starts.x + i), sy = B::load(starts.y + i), sz = B::load(starts.z + i);
+        const auto dx = B::sub(B::load(ends.x + i), sx);
+        const auto dy = B::sub(B::load(ends.y + i), sy);
+        const auto dz = B::sub(B::load(ends.z + i), sz);
+        const auto length = B::sqrt(B::add(B::add(B::mul(dx, dx), B::mul(dy, dy)), B::mul(dz, dz)));
+
+        auto startDistance = B::mul(sx, B::set1(nx));
+        startDistance = B::add(startDistance, B::mul(sy, B::set1(ny)));
+        startDistance = B::add(startDistance, B::mul(sz, B::set1(nz)));
+        startDistance = B::add(startDistance, B::set1(d));
+        auto along = B::mul(dx, B::set1(nx));
+        along = B::add(along, B::mul(dy, B::set1(ny)));
+        along = B::add(along, B::mul(dz, B::set1(nz)));
+
+        // Working on the unnormalized direction: |n . dir / length| < epsilon becomes |n . dir| < epsilon * length,
+        // and the hit parameter t = -distance / (n . dir) must lie in [0, 1].
+        const auto longEnough = B::ge(length, B::set1(epsilon));
+        const auto notParallel = B::ge(B::abs(along), B::mul(length, B::set1(epsilon)));
+        const auto valid = B::and_(longEnough, notParallel);
+        const auto t = B::div(B::sub(B::set1(0.0), startDistance), B::select(valid, along, B::set1(1.0)));
+        const auto hit = B::and_(valid, B::and_(B::ge(t, B::set1(0.0)), B::le(t, B::set1(1.0))));
+
+        const auto zero = B::set1(0.0);
+        B::store(out.x + i, B::select(hit, B::add(sx, B::mul(t, dx)), zero));
+        B::store(out.y + i, B::select(hit, B::add(sy, B::mul(t, dy)), zero));
+        B::store(out.z + i, B::select(hit, B::add(sz, B::mul(t, dz)), zero));
+
+        const int bits = B::movemask(hit);
+        for (std::size_t l = 0; l < B::width; ++l)
+        {
+          const bool laneHit = ((bits >> l) & 1) != 0;
+          hits[i + l] = laneHit;
+          hitCount += laneHit ? 1 : 0;
+        }
+      });
+      return hitCount;
+    }
+
+    static std::size_t planePair(Kernels::ConstPlaneView a, double bx, double by, double bz, double bd, double epsilon,
+      SoaView points, SoaView directions, Kernels::PlaneIntersectionStatus* status)
+    {
+      using Kernels::PlaneIntersectionStatus;
+      std::size_t intersecting = 0;
+      forEachLane<Batch>(a.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        const auto ax = B::load(a.nx + i), ay = B::load(a.ny + i), az = B::load(a.nz + i), ad = B::load(a.d + i);
+        const auto nx = B::set1(bx), ny = B::set1(by), nz = B::set1(bz), nd = B::set1(bd);
+
+        const auto ux = B::sub(B::mul(ay, nz), B::mul(az, ny));
+        const auto uy = B::sub(B::mul(az, nx), B::mul(ax, nz));
+        const auto uz = B::sub(B::mul(ax, ny), B::mul(ay, nx));
+        const auto lengthSquared = B::add(B::add(B::mul(ux, ux), B::mul(uy, uy)), B::mul(uz, uz));
+        const auto length = B::sqrt(lengthSquared);
+        const auto meets = B::ge(length, B::set1(epsilon));
+
+        // With h = -d and c = n1 . n2, the point of the line closest to the origin is
+        // ((h1 - c h2) n1 + (h2 - c h1) n2) / (1 - c^2), and 1 - c^2 = |n1 x n2|^2 for unit normals.
+        auto c = B::mul(ax, nx);
+        c = B::add(c, B::mul(ay, ny));
+        c = B::add(c, B::mul(az, nz));
+        const auto zero = B::set1(0.0);
+        const auto one = B::set1(1.0);
+        const auto h1 = B::sub(zero, ad);
+        const auto h2 = B::sub(zero, nd);
+        const auto inverse = B::div(one, B::select(meets, lengthSquared, one));
+        const auto k1 = B::mul(B::sub(h1, B::mul(c, h2)), inverse);
+        const auto k2 = B::mul(B::sub(h2, B::mul(c, h1)), inverse);
+        B::store(points.x + i, B::select(meets, B::add(B::mul(k1, ax), B::mul(k2, nx)), zero));
+        B::store(points.y + i, B::select(meets, B::add(B::mul(k1, ay), B::mul(k2, ny)), zero));
+        B::store(points.z + i, B::select(meets, B::add(B::mul(k1, az), B::mul(k2, nz)), zero));
+
+        const auto inverseLength = B::div(one, B::select(meets, length, one));
+        B::store(directions.x + i, B::select(meets, B::mul(ux, inverseLength), zero));
+        B::store(directions.y + i, B::select(meets, B::mul(uy, inverseLength), zero));
+        B::store(directions.z + i, B::select(meets, B::mul(uz, inverseLength), zero));
+
+        // Parallel planes coincide when d1 = c d2, c being +1 or -1 depending on whether the normals agree.
+        const auto coincident = B::lt(B::abs(B::sub(ad, B::mul(c, nd))), B::set1(epsilon));
+        const int meetBits = B::movemask(meets);
+        const int coincidentBits = B::movemask(coincident);
+        for (std::size_t l = 0; l < B::width; ++l)
+        {
+          const bool laneMeets = ((meetBits >> l) & 1) != 0;
+          status[i + l] = laneMeets ? PlaneIntersectionStatus::Intersecting
+            : ((coincidentBits >> l) & 1) != 0 ? PlaneIntersectionStatus::Coincident
+            : PlaneIntersectionStatus::Parallel;
+          intersecting += laneMeets ? 1 : 0;
+        }
+      });
+      return intersecting;
+    }
+
+    static std::size_t planeTriple(Kernels::ConstPlaneView a, Kernels::ConstPlaneView b, Kernels::ConstPlaneView c,
+      double epsilon, SoaView points, Kernels::PlaneIntersectionStatus* status)
+    {
+      using Kernels::PlaneIntersectionStatus;
+      std::size_t intersecting = 0;
+      forEachLane<Batch>(a.count, [&](auto lane, std::size_t i) {
+        using B = decltype(lane);
+        const auto ax = B::load(a.nx + i), ay = B::load(a.ny + i), az = B::load(a.nz + i);
+        const auto bx = B::load(b.nx + i), by = B::load(b.ny + i), bz = B::load(b.nz + i);
+        const auto cx = B::load(c.nx + i), cy = B::load(c.ny + i), cz = B::load(c.nz + i);
+
+        // Adjugate columns b x c, c x a and a x b; the determinant is a . (b x c).
+        const auto bcx = B::sub(B::mul(by, cz), B::mul(bz, cy));
+        const auto bcy = B::sub(B::mul(bz, cx), B::mul(bx, cz));
+        const auto bcz = B::sub(B::mul(bx, cy), B::mul(by, cx));
+        const auto cax = B::sub(B::mul(cy, az), B::mul(cz, ay));
+        const auto cay = B::sub(B::mul(cz, ax), B::mul(cx, az));
+        const auto caz = B::sub(B::mul(cx, ay), B::mul(cy, ax));
+        const auto abx = B::sub(B::mul(ay, bz), B::mul(az, by));
+        const auto aby = B::sub(B::mul(az, bx), B::mul(ax, bz));
+        const auto abz = B::sub(B::mul(ax, by), B::mul(ay, bx));
+        const auto determinant = B::add(B::add(B::mul(ax, bcx), B::mul(ay, bcy)), B::mul(az, bcz));
+        const auto meets = B::ge(B::abs(determinant), B::set1(epsilon));
+
+        // p = (h_a (b x c) + h_b (c x a) + h_c (a x b)) / det with h = -d.
+        const auto zero = B::set1(0.0);
+        const auto scale = B::div(B::set1(-1.0), B::select(meets, determinant, B::set1(1.0)));
+        const auto ha = B::mul(B::load(a.d + i), scale);
+        const auto hb = B::mul(B::load(b.d + i), scale);
+        const auto hc = B::mul(B::load(c.d + i), scale);
+        B::store(points.x + i, B::select(meets, B::add(B::add(B::mul(ha, bcx), B::mul(hb, cax)), B::mul(hc, abx)), zero));
+        B::store(points.y + i, B::select(meets, B::add(B::add(B::mul(ha, bcy), B::mul(hb, cay)), B::mul(hc, aby)), zero));
+        B::store(points.z + i, B::select(meets, B::add(B::add(B::mul(ha, bcz), B::mul(hb, caz)), B::mul(hc, abz)), zero));
+
+        const int bits = B::movemask(meets);
+        for (std::size_t l = 0; l < B::width; ++l)
+        {
+          const bool laneMeets = ((bits >> l) & 1) != 0;
+          status[i + l] = laneMeets ? PlaneIntersectionStatus::Intersecting : PlaneIntersectionStatus::Singular;
+          intersecting += laneMeets ? 1 : 0;
+        }
+      });
+      return intersecting;
+    }
+
+    static Kernels::Detail::KernelTable table()
+    {
+      return Kernels::Detail::KernelTable{
+        &add, &subtract, &scale, &translate, &dot, &cross, &magnitude, &normalize,
+        &distanceToPoint, &planeDistance, &planeProject, &planeClassify, &segmentPlane,
+        &planePair, &planeTriple
+      };
+    }
+  };
+
+  template <class Words>
+  struct BitmapKernels
+  {
+    /// out[i] = op(a[i], b[i]); returns the number of set bits written.
+    template <class Op>
+    static std::size_t combine(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t count, Op op)
+    {
+      typename Words::counter bits = Words::zeroCount();
+      std::size_t i = 0;
+      for (; i + Words::width <= count; i += Words::width)
+      {
+        const typename Words::reg v = op(Words{}, Words::load(a + i), Words::load(b + i));
+        Words::store(out + i, v);
+        bits = Words::addCount(bits, v);
+      }
+
+      std::size_t total = Words::sumCount(bits);
+      for (; i < count; ++i)
+      {
+        out[i] = op(ScalarWords{}, a[i], b[i]);
+        total = ScalarWords::addCount(total, out[i]);
+      }
+      return total;
+    }
+
+    static std::size_t andWords(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t count)
+    {
+      return combine(a, b, out, count, [](auto words, auto x, auto y) { return decltype(words)::and_(x, y); });
+    }
+
+    static std::size_t orWords(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t count)
+    {
+      return combine(a, b, out, count, [](auto words, auto x, auto y) { return decltype(words)::or_(x, y); });
+    }
+
+    static std::size_t andNotWords(const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out, std::size_t count)
+    {
+      return combine(a, b, out, count, [](auto words, auto x, auto y) { return decltype(words)::andNot(x, y); });
+    }
+
+    static std::size_t countWords(const std::uint64_t* words, std::size_t count)
+    {
+      typename Words::counter bits = Words::zeroCount();
+      std::size_t i = 0;
+      for (; i + Words::width <= count; i += Words::width)
+        bits = Words::addCount(bits, Words::load(words + i));
+
+      std::size_t total = Words::sumCount(bits);
+      for (; i < count; ++i)
+        total = ScalarWords::addCount(total, words[i]);
+      return total;
+    }
+
+    static Kernels::Detail::BitmapKernelTable table()
+    {
+      return Kernels::Detail::BitmapKernelTable{&andWords, &orWords, &andNotWords, &countWords};
+    }
+  };
+}
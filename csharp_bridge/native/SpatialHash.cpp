@@ -0,0 +1,213 @@
+#include "SpatialHash.h"
+
+#include <algorithm>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+  using Core::CellKey;
+
+  constexpr std::size_t InitialSlots = 16;
+  /// Bits of the occupancy filter per table slot.
+  constexpr std::size_t FilterBitsPerSlot = 4;
+}
+
+namespace CwAPI3D::Net::Bridge::Native
+{
+  SpatialHash::SpatialHash(double tolerance)
+    : m_tolerance(tolerance), m_cellSize(2.0 * tolerance), m_slots(InitialSlots),
+      m_filter(InitialSlots * FilterBitsPerSlot / 64)
+  {
+  }
+
+  std::size_t SpatialHash::memoryBytes() const
+  {
+    return m_points.capacity() * 3 * sizeof(double) + m_next.capacity() * sizeof(std::int32_t) +
+           m_slots.capacity() * sizeof(Slot) + m_filter.capacity() * sizeof(std::uint64_t);
+  }
+
+  void SpatialHash::reserve(std::size_t count)
+  {
+    m_points.reserve(count);
+    m_next.reserve(count);
+    // Assumes the worst case of one cell per point.
+    growTable(count);
+  }
+
+  std::size_t SpatialHash::slotOf(const CellKey& cell, std::uint64_t hash) const
+  {
+    const std::size_t mask = m_slots.size() - 1;
+    std::size_t slot = static_cast<std::size_t>(hash) & mask;
+    while (m_slots[slot].head != NotFound && !(m_slots[slot].cell == cell))
+      slot = (slot + 1) & mask;
+    return slot;
+  }
+
+  std::size_t SpatialHash::filterBit(std::uint64_t hash) const
+  {
+    return static_cast<std::size_t>(hash >> 32) & (m_filter.size() * 64 - 1);
+  }
+
+  std::int32_t SpatialHash::headOf(const CellKey& cell) const
+  {
+    const std::uint64_t hash = Core::hashCell(cell);
+    const std::size_t bit = filterBit(hash);
+    if ((m_filter[bit / 64] & (std::uint64_t(1) << (bit % 64))) == 0)
+      return NotFound;
+    return m_slots[slotOf(cell, hash)].head;
+  }
+
+  void SpatialHash::growTable(std::size_t minimumCells)
+  {
+    std::size_t slotCount = m_slots.size();
+    while (slotCount < minimumCells * 2)
+      slotCount *= 2;
+    if (slotCount == m_slots.size())
+      return;
+
+    std::vector<Slot> old(slotCount);
+    old.swap(m_slots);
+    m_filter.assign(slotCount * FilterBitsPerSlot / 64, 0);
+    for (const Slot& slot : old)
+    {
+      if (slot.head != NotFound)
+      {
+        const std::uint64_t hash = Core::hashCell(slot.cell);
+        m_slots[slotOf(slot.cell, hash)] = slot;
+        const std::size_t bit = filterBit(hash);
+        m_filter[bit / 64] |= std::uint64_t(1) << (bit % 64);
+      }
+    }
+  }
+
+  void SpatialHash::add(const Core::Vec3d& point, const CellKey& cell)
+  {
+    growTable(m_cellCount + 1);
+
+    const auto index = static_cast<std::int32_t>(m_points.size());
+    m_points.push_back(point.x, point.y, point.z);
+
+    const std::uint64_t hash = Core::hashCell(cell);
+    Slot& slot = m_slots[slotOf(cell, hash)];
+    if (slot.head == NotFound)
+    {
+      slot.cell = cell;
+      ++m_cellCount;
+      const std::size_t bit = filterBit(hash);
+      m_filter[bit / 64] |= std::uint64_t(1) << (bit % 64);
+    }
+    m_next.push_back(slot.head);
+    slot.head = index;
+  }
+
+  std::int32_t SpatialHash::nearestWithin(const Core::Vec3d& point, double limit) const
+  {
+    // Only the cells the box of half-width `limit` around the point touches can hold a match; with cells of twice
+    // the tolerance that is one or two per axis.
+    const Core::Vec3d extent{limit, limit, limit};
+    const CellKey low = Core::cellOf(point - extent, m_cellSize);
+    const CellKey high = Core::cellOf(point + extent, m_cellSize);
+
+    const ConstSoaView points = m_points.view();
+    std::int32_t best = NotFound;
+    double bestDistance = limit * limit;
+    for (std::int64_t x = low.x; x <= high.x; ++x)
+    {
+      for (std::int64_t y = low.y; y <= high.y; ++y)
+      {
+        for (std::int64_t z = low.z; z <= high.z; ++z)
+        {
+          for (std::int32_t i = headOf(CellKey{x, y, z}); i != NotFound; i = m_next[i])
+          {
+            const double ex = points.x[i] - point.x, ey = points.y[i] - point.y, ez = points.z[i] - point.z;
+            const double distance = ex * ex + ey * ey + ez * ez;
+            // Ties go to the older point, so welding is independent of the probe order.
+            if (distance < bestDistance || (distance == bestDistance && (best == NotFound || i < best)))
+            {
+              best = i;
+              bestDistance = distance;
+            }
+          }
+        }
+      }
+    }
+    return best;
+  }
+
+  void SpatialHash::insert(ConstSoaView points)
+  {
+    reserve(m_points.size() + points.count);
+    for (std::size_t i = 0; i < points.count; ++i)
+    {
+      const Core::Vec3d point{points.x[i], points.y[i], points.z[i]};
+      add(point, Core::cellOf(point, m_cellSize));
+    }
+  }
+
+  std::size_t SpatialHash::weld(ConstSoaView points, std::int32_t* indices)
+  {
+    const std::size_t before = m_points.size();
+    for (std::size_t i = 0; i < points.count; ++i)
+    {
+      const Core::Vec3d point{points.x[i], points.y[i], points.z[i]};
+      std::int32_t index = nearestWithin(point, m_tolerance);
+      if (index == NotFound)
+      {
+        index = static_cast<std::int32_t>(m_points.size());
+        add(point, Core::cellOf(point, m_cellSize));
+      }
+      indices[i] = index;
+    }
+    return m_points.size() - before;
+  }
+
+  std::int32_t SpatialHash::find(const Core::Vec3d& point) const
+  {
+    return nearestWithin(point, m_tolerance);
+  }
+
+  void SpatialHash::queryRadius(const Core::Vec3d& center, double radius, std::vector<std::int32_t>& out) const
+  {
+    if (!(radius >= 0.0))
+      return;
+
+    const ConstSoaView points = m_points.view();
+    const double limit = radius * radius;
+    auto collect = [&](std::int32_t head) {
+      for (std::int32_t i = head; i != NotFound; i = m_next[i])
+      {
+        const double ex = points.x[i] - center.x, ey = points.y[i] - center.y, ez = points.z[i] - center.z;
+        if (ex * ex + ey * ey + ez * ez <= limit)
+          out.push_back(i);
+      }
+    };
+
+    const Core::Vec3d extent{radius, radius, radius};
+    const CellKey low = Core::cellOf(center - extent, m_cellSize);
+    const CellKey high = Core::cellOf(center + extent, m_cellSize);
+    const double spanned = (static_cast<double>(high.x) - static_cast<double>(low.x) + 1.0) *
+                           (static_cast<double>(high.y) - static_cast<double>(low.y) + 1.0) *
+                           (static_cast<double>(high.z) - static_cast<double>(low.z) + 1.0);
+
+    // A radius far above the tolerance spans more cells than are occupied; then walking the occupied ones is cheaper.
+    if (spanned > static_cast<double>(m_cellCount))
+    {
+      for (const Slot& slot : m_slots)
+      {
+        if (slot.head != NotFound && slot.cell.x >= low.x && slot.cell.x <= high.x && slot.cell.y >= low.y &&
+            slot.cell.y <= high.y && slot.cell.z >= low.z && slot.cell.z <= high.z)
+          collect(slot.head);
+      }
+      return;
+    }
+
+    for (std::int64_t x = low.x; x <= high.x; ++x)
+    {
+      for (std::int64_t y = low.y; y <= high.y; ++y)
+      {
+        for (std::int64_t z = low.z; z <= high.z; ++z)
+          collect(headOf(CellKey{x, y, z}));
+      }
+    }
+  }
+}
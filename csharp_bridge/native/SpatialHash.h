@@ -0,0 +1,78 @@
+#pragma once
+
+#include "SoaBuffer.h"
+
+#include "../core/Hash.h"
+#include "../core/Vec3.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Plain C++ (no /clr) hash grid over points, behind the managed SpatialPointHash. Points are bucketed by the cubic
+// cell of edge 2 * tolerance they fall in, so all points within the tolerance of a query lie in at most two cells
+// per axis: a lookup probes 8 cells rather than the 27 that cells of edge `tolerance` would need.
+namespace CwAPI3D::Net::Bridge::Native
+{
+  class SpatialHash
+  {
+  public:
+    /// Returned by find when no point lies within the tolerance.
+    static constexpr std::int32_t NotFound = -1;
+
+    /// `tolerance` must be positive and finite.
+    explicit SpatialHash(double tolerance);
+
+    double tolerance() const { return m_tolerance; }
+    std::size_t size() const { return m_points.size(); }
+    std::size_t memoryBytes() const;
+
+    /// The stored points; point i has index i.
+    ConstSoaView points() const { return m_points.view(); }
+
+    void reserve(std::size_t count);
+
+    /// Stores every point, including ones within the tolerance of points already stored.
+    void insert(ConstSoaView points);
+
+    /// Maps every point to the index of a stored point within the tolerance, storing it first when there is none,
+    /// and writes the index to indices[i]. Points are matched in input order to the nearest stored point, so a
+    /// chain of points each within the tolerance of the next may map to more than one index.
+    /// Returns the number of points stored.
+    std::size_t weld(ConstSoaView points, std::int32_t* indices);
+
+    /// The index of the stored point nearest to `point` within the tolerance, or NotFound.
+    std::int32_t find(const Core::Vec3d& point) const;
+
+    /// Appends the indices of all stored points within `radius` of `center` to `out`, in no particular order.
+    void queryRadius(const Core::Vec3d& center, double radius, std::vector<std::int32_t>& out) const;
+
+  private:
+    /// Open-addressing slot: the cell and the most recently stored point in it; empty while head is NotFound.
+    struct Slot
+    {
+      Core::CellKey cell;
+      std::int32_t head = NotFound;
+    };
+
+    std::size_t slotOf(const Core::CellKey& cell, std::uint64_t hash) const;
+    std::size_t filterBit(std::uint64_t hash) const;
+    /// The most recently stored point in a cell, or NotFound.
+    std::int32_t headOf(const Core::CellKey& cell) const;
+    void add(const Core::Vec3d& point, const Core::CellKey& cell);
+    void growTable(std::size_t minimumCells);
+    std::int32_t nearestWithin(const Core::Vec3d& point, double limit) const;
+
+    double m_tolerance;
+    double m_cellSize;
+    SoaBuffer m_points;
+    /// Next older point in the same cell, or NotFound.
+    std::vector<std::int32_t> m_next;
+    /// Power-of-two sized; at most half full.
+    std::vector<Slot> m_slots;
+    /// One bit per hash value for the occupied cells, several per slot. Most lookups probe empty cells, and this
+    /// filter is small enough to stay in cache where the table does not.
+    std::vector<std::uint64_t> m_filter;
+    std::size_t m_cellCount = 0;
+  };
+}
@@ -0,0 +1,107 @@
+#include "StringTable.h"
+
+#include "../core/Hash.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge;
+
+  constexpr std::size_t InitialSlots = 64;
+
+  /// Hashes eight bytes at a time; attribute values are short, so this beats a byte-wise hash.
+  std::uint64_t hashText(std::string_view text)
+  {
+    std::uint64_t hash = text.size();
+    std::size_t i = 0;
+    for (; i + 8 <= text.size(); i += 8)
+    {
+      std::uint64_t word;
+      std::memcpy(&word, text.data() + i, 8);
+      hash = Core::mixHash(hash ^ word);
+    }
+    if (i < text.size())
+    {
+      std::uint64_t word = 0;
+      std::memcpy(&word, text.data() + i, text.size() - i);
+      hash = Core::mixHash(hash ^ word);
+    }
+    return hash;
+  }
+}
+
+namespace CwAPI3D::Net::Bridge::Native
+{
+  StringTable::StringTable() : m_offsets{0u}, m_slots(InitialSlots, Empty)
+  {
+  }
+
+  std::size_t StringTable::memoryBytes() const
+  {
+    return m_chars.capacity() + m_offsets.capacity() * sizeof(std::uint32_t) +
+           m_hashes.capacity() * sizeof(std::uint64_t) + m_slots.capacity() * sizeof(std::uint32_t);
+  }
+
+  std::string_view StringTable::at(std::uint32_t index) const
+  {
+    return {m_chars.data() + m_offsets[index], m_offsets[index + 1] - m_offsets[index]};
+  }
+
+  std::size_t StringTable::slotOf(std::string_view text, std::uint64_t hash) const
+  {
+    const std::size_t mask = m_slots.size() - 1;
+    std::size_t slot = static_cast<std::size_t>(hash) & mask;
+    while (m_slots[slot] != Empty)
+    {
+      const std::uint32_t index = m_slots[slot];
+      if (m_hashes[index] == hash && at(index) == text)
+        break;
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  std::uint32_t StringTable::intern(std::string_view text)
+  {
+    const std::uint64_t hash = hashText(text);
+    std::size_t slot = slotOf(text, hash);
+    if (m_slots[slot] != Empty)
+      return m_slots[slot];
+
+    const auto index = static_cast<std::uint32_t>(size());
+    m_chars.insert(m_chars.end(), text.begin(), text.end());
+    m_offsets.push_back(static_cast<std::uint32_t>(m_chars.size()));
+    m_hashes.push_back(hash);
+    if (2 * size() > m_slots.size())
+    {
+      growTable();
+      slot = slotOf(text, hash);
+    }
+    m_slots[slot] = index;
+    return index;
+  }
+
+  void StringTable::growTable()
+  {
+    m_slots.assign(2 * m_slots.size(), Empty);
+    const std::size_t mask = m_slots.size() - 1;
+    // The new string is already in m_hashes but not yet in the table; intern places it.
+    for (std::uint32_t index = 0; index + 1 < static_cast<std::uint32_t>(size()); ++index)
+    {
+      std::size_t slot = static_cast<std::size_t>(m_hashes[index]) & mask;
+      while (m_slots[slot] != Empty)
+        slot = (slot + 1) & mask;
+      m_slots[slot] = index;
+    }
+  }
+
+  void StringTable::clear()
+  {
+    m_chars.clear();
+    m_offsets.assign(1, 0u);
+    m_hashes.clear();
+    std::fill(m_slots.begin(), m_slots.end(), Empty);
+  }
+}
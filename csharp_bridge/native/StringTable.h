@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Plain C++ (no /clr) string interning behind the AttributeController's columnar results. Attribute columns repeat
+// few distinct values over many elements, so each element stores the index of its value and every distinct value is
+// kept, and later marshalled, once.
+namespace CwAPI3D::Net::Bridge::Native
+{
+  class StringTable
+  {
+  public:
+    StringTable();
+
+    std::size_t size() const { return m_offsets.size() - 1; }
+    std::size_t memoryBytes() const;
+
+    /// The string with the given index; valid until the table is cleared.
+    std::string_view at(std::uint32_t index) const;
+
+    /// Returns the index of `text`, adding it first when it is not in the table. Indices are dense and assigned in
+    /// the order the strings are first seen.
+    std::uint32_t intern(std::string_view text);
+
+    /// Removes all strings and keeps the storage for reuse.
+    void clear();
+
+  private:
+    static constexpr std::uint32_t Empty = 0xffffffffu;
+
+    std::size_t slotOf(std::string_view text, std::uint64_t hash) const;
+    void growTable();
+
+    /// The strings back to back; string i spans m_chars[m_offsets[i], m_offsets[i + 1]).
+    std::vector<char> m_chars;
+    std::vector<std::uint32_t> m_offsets;
+    std::vector<std::uint64_t> m_hashes;
+    /// Open-addressing table of string indices; a power of two, at most half full.
+    std::vector<std::uint32_t> m_slots;
+  };
+}
@@ -0,0 +1,633 @@
+#include "Trace.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CWAPI3D_TRACE_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CWAPI3D_TRACE_TSC 1
+#endif
+
+namespace Trace = CwAPI3D::Net::Bridge::Native::Trace;
+
+namespace
+{
+  using Trace::Point;
+  using Trace::PointCount;
+
+  /// Log-linear buckets as in HdrHistogram: values below SubBucketCount have a bucket each, above that every
+  /// power of two is split into SubBucketCount / 2 buckets, so a bucket is at most 1/16 of its lower bound wide.
+  constexpr unsigned SignificantBits = 5;
+  constexpr std::size_t SubBucketCount = std::size_t{1} << SignificantBits;
+  constexpr std::size_t HalfBucketCount = SubBucketCount / 2;
+  constexpr std::size_t BucketCount = (64 - SignificantBits + 1) * HalfBucketCount + HalfBucketCount;
+
+  std::size_t bucketOf(std::uint64_t value)
+  {
+    if (value < SubBucketCount)
+      return static_cast<std::size_t>(value);
+    const unsigned shift = static_cast<unsigned>(std::bit_width(value)) - SignificantBits;
+    return shift * HalfBucketCount + static_cast<std::size_t>(value >> shift);
+  }
+
+  /// The middle of the values bucket `index` holds.
+  double bucketMiddle(std::size_t index)
+  {
+    if (index < SubBucketCount)
+      return static_cast<double>(index);
+    const unsigned shift = static_cast<unsigned>(index / HalfBucketCount - 1);
+    const std::uint64_t lower = static_cast<std::uint64_t>(index % HalfBucketCount + HalfBucketCount) << shift;
+    return static_cast<double>(lower) + static_cast<double>((std::uint64_t{1} << shift) - 1) / 2.0;
+  }
+
+  /// Written only by the owning thread, so updates are a relaxed load and store rather than a locked add;
+  /// readers on other threads may see a call in some counters and not yet in others.
+  struct Histogram
+  {
+    std::array<std::atomic<std::uint32_t>, BucketCount> buckets{};
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> max{0};
+
+    void record(std::uint64_t value)
+    {
+      auto& bucket = buckets[bucketOf(value)];
+      bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+      if (value > max.load(std::memory_order_relaxed))
+        max.store(value, std::memory_order_relaxed);
+    }
+
+    void reset()
+    {
+      for (auto& bucket : buckets)
+        bucket.store(0, std::memory_order_relaxed);
+      sum.store(0, std::memory_order_relaxed);
+      max.store(0, std::memory_order_relaxed);
+    }
+  };
+
+  /// Calls without native time record once, into `plain`: their total is all marshalling. Calls with native time
+  /// record into the other three. Readers merge them back into total, native and marshalling latencies.
+  struct PointHistograms
+  {
+    Histogram plain;
+    Histogram total;
+    Histogram native;
+    Histogram marshalling;
+  };
+
+  /// One slot of a thread's ring. Fields are atomics so a reader copying a slot the owner is overwriting reads
+  /// a torn event, which it then discards, rather than racing.
+  struct EventSlot
+  {
+    std::atomic<std::uint64_t> start{0};
+    std::atomic<std::uint64_t> stop{0};
+    std::atomic<std::uint64_t> native{0};
+    std::atomic<std::uint32_t> pointAndDepth{0};
+  };
+
+  struct Event
+  {
+    std::uint64_t start;
+    std::uint64_t stop;
+    std::uint64_t native;
+    Point point;
+    std::uint32_t depth;
+  };
+
+  struct Frame
+  {
+    Point point;
+    std::uint64_t start;
+    std::uint64_t nativeStart;
+    std::uint64_t native;
+  };
+
+  std::atomic<bool> g_enabled{false};
+  /// Bumped by clear; a thread drops its data when it next records and finds its epoch behind.
+  std::atomic<std::uint64_t> g_epoch{1};
+  /// Timestamp the Chrome trace counts from; 0 until recording starts.
+  std::atomic<std::uint64_t> g_origin{0};
+
+  class ThreadBuffer
+  {
+  public:
+    ThreadBuffer(std::uint32_t index, std::string name)
+      : m_index(index), m_name(std::move(name)), m_events(std::make_unique<EventSlot[]>(Trace::EventsPerThread))
+    {
+    }
+
+    ~ThreadBuffer()
+    {
+      for (auto& histograms : m_histograms)
+        delete histograms.load(std::memory_order_relaxed);
+    }
+
+    std::uint32_t index() const { return m_index; }
+    const std::string& name() const { return m_name; }
+
+    bool current() const { return m_epoch.load(std::memory_order_acquire) == g_epoch.load(std::memory_order_acquire); }
+
+    void begin(Point point)
+    {
+      const std::size_t depth = m_depth++;
+      if (depth < Trace::MaxDepth)
+        m_frames[depth] = Frame{point, Trace::now(), 0, 0};
+    }
+
+    void enterNative()
+    {
+      if (m_depth == 0 || m_depth > Trace::MaxDepth)
+        return;
+      // A native span still open ends where this one starts, on the same timestamp.
+      Frame& frame = m_frames[m_depth - 1];
+      const std::uint64_t start = Trace::now();
+      if (frame.nativeStart != 0)
+        frame.native += start - frame.nativeStart;
+      frame.nativeStart = start;
+    }
+
+    void leaveNative()
+    {
+      if (m_depth == 0 || m_depth > Trace::MaxDepth)
+        return;
+      Frame& frame = m_frames[m_depth - 1];
+      if (frame.nativeStart != 0)
+      {
+        frame.native += Trace::now() - frame.nativeStart;
+        frame.nativeStart = 0;
+      }
+    }
+
+    void end()
+    {
+      if (m_depth == 0)
+        return;
+      const std::uint64_t stop = Trace::now();
+      const std::size_t depth = --m_depth;
+      if (depth >= Trace::MaxDepth)
+        return;
+
+      const Frame& frame = m_frames[depth];
+      const std::uint64_t total = stop - frame.start;
+      std::uint64_t native = frame.native;
+      if (frame.nativeStart != 0)
+        native += stop - frame.nativeStart;
+      native = std::min(native, total);
+
+      syncEpoch();
+      const std::uint64_t head = m_head.load(std::memory_order_relaxed);
+      EventSlot& slot = m_events[head % Trace::EventsPerThread];
+      slot.start.store(frame.start, std::memory_order_relaxed);
+      slot.stop.store(stop, std::memory_order_relaxed);
+      slot.native.store(native, std::memory_order_relaxed);
+      slot.pointAndDepth.store(static_cast<std::uint32_t>(frame.point) | static_cast<std::uint32_t>(depth) << 16,
+        std::memory_order_relaxed);
+      m_head.store(head + 1, std::memory_order_release);
+
+      PointHistograms& histograms = histogramsOf(frame.point);
+      if (native == 0)
+      {
+        histograms.plain.record(total);
+        return;
+      }
+      histograms.total.record(total);
+      histograms.native.record(native);
+      histograms.marshalling.record(total - native);
+    }
+
+    const PointHistograms* histograms(Point point) const
+    {
+      return m_histograms[static_cast<std::size_t>(point)].load(std::memory_order_acquire);
+    }
+
+    std::size_t eventCount() const
+    {
+      return static_cast<std::size_t>(std::min<std::uint64_t>(m_head.load(std::memory_order_acquire), Trace::EventsPerThread));
+    }
+
+    /// Appends the events in the ring to `out`, oldest first, leaving out any the owner overwrote meanwhile.
+    void copyEvents(std::vector<Event>& out) const
+    {
+      const std::uint64_t head = m_head.load(std::memory_order_acquire);
+      const std::uint64_t first = head > Trace::EventsPerThread ? head - Trace::EventsPerThread : 0;
+      const std::size_t offset = out.size();
+      for (std::uint64_t i = first; i < head; ++i)
+      {
+        const EventSlot& slot = m_events[i % Trace::EventsPerThread];
+        const std::uint32_t pointAndDepth = slot.pointAndDepth.load(std::memory_order_relaxed);
+        out.push_back(Event{slot.start.load(std::memory_order_relaxed), slot.stop.load(std::memory_order_relaxed),
+                            slot.native.load(std::memory_order_relaxed), static_cast<Point>(pointAndDepth & 0xFFFF),
+                            pointAndDepth >> 16});
+      }
+
+      // The owner may have started overwriting event `after` (slot of after - EventsPerThread) while we copied.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      const std::uint64_t after = m_head.load(std::memory_order_relaxed);
+      const std::uint64_t valid = after + 1 > Trace::EventsPerThread ? after + 1 - Trace::EventsPerThread : 0;
+      if (valid > first)
+      {
+        const auto stale = static_cast<std::ptrdiff_t>(std::min(valid, head) - first);
+        out.erase(out.begin() + static_cast<std::ptrdiff_t>(offset), out.begin() + static_cast<std::ptrdiff_t>(offset) + stale);
+      }
+    }
+
+  private:
+    /// Drops this thread's data if clear ran since it last recorded. The epoch is published after the reset, so
+    /// a reader that sees the new epoch sees the emptied buffers.
+    void syncEpoch()
+    {
+      const std::uint64_t epoch = g_epoch.load(std::memory_order_acquire);
+      if (m_epoch.load(std::memory_order_relaxed) == epoch)
+        return;
+      m_head.store(0, std::memory_order_relaxed);
+      for (auto& histograms : m_histograms)
+      {
+        if (PointHistograms* existing = histograms.load(std::memory_order_relaxed))
+        {
+          existing->plain.reset();
+          existing->total.reset();
+          existing->native.reset();
+          existing->marshalling.reset();
+        }
+      }
+      m_epoch.store(epoch, std::memory_order_release);
+    }
+
+    PointHistograms& histogramsOf(Point point)
+    {
+      auto& slot = m_histograms[static_cast<std::size_t>(point)];
+      PointHistograms* histograms = slot.load(std::memory_order_relaxed);
+      if (!histograms)
+      {
+        histograms = new PointHistograms();
+        slot.store(histograms, std::memory_order_release);
+      }
+      return *histograms;
+    }
+
+    std::uint32_t m_index;
+    std::string m_name;
+    std::size_t m_depth = 0;
+    std::array<Frame, Trace::MaxDepth> m_frames{};
+    std::atomic<std::uint64_t> m_epoch{0};
+    std::atomic<std::uint64_t> m_head{0};
+    std::unique_ptr<EventSlot[]> m_events;
+    std::array<std::atomic<PointHistograms*>, PointCount> m_histograms{};
+  };
+
+  /// Buffers of every thread that ever recorded. They are kept after the thread exits, so its calls can still
+  /// be exported.
+  struct Registry
+  {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+  };
+
+  Registry& registry()
+  {
+    static Registry instance;
+    return instance;
+  }
+
+  std::vector<const ThreadBuffer*> currentBuffers()
+  {
+    Registry& instance = registry();
+    std::vector<const ThreadBuffer*> result;
+    std::lock_guard<std::mutex> lock(instance.mutex);
+    for (const auto& buffer : instance.buffers)
+    {
+      if (buffer->current())
+        result.push_back(buffer.get());
+    }
+    return result;
+  }
+
+  ThreadBuffer& localBuffer()
+  {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer)
+    {
+      std::ostringstream name;
+      name << std::this_thread::get_id();
+
+      Registry& instance = registry();
+      std::lock_guard<std::mutex> lock(instance.mutex);
+      const auto index = static_cast<std::uint32_t>(instance.buffers.size() + 1);
+      instance.buffers.push_back(std::make_unique<ThreadBuffer>(index, "Thread " + name.str()));
+      buffer = instance.buffers.back().get();
+    }
+    return *buffer;
+  }
+
+  void setOrigin()
+  {
+    g_origin.store(Trace::now(), std::memory_order_relaxed);
+  }
+
+  double calibrateTicksPerSecond()
+  {
+#if defined(CWAPI3D_TRACE_TSC)
+    // The invariant TSC of current x86 CPUs ticks at a constant rate; measure it against steady_clock once.
+    using Clock = std::chrono::steady_clock;
+    const auto startTime = Clock::now();
+    const std::uint64_t startTicks = Trace::now();
+    Clock::time_point stopTime;
+    do
+    {
+      stopTime = Clock::now();
+    } while (stopTime - startTime < std::chrono::milliseconds(20));
+    const std::uint64_t stopTicks = Trace::now();
+    return static_cast<double>(stopTicks - startTicks) / std::chrono::duration<double>(stopTime - startTime).count();
+#else
+    return static_cast<double>(std::chrono::steady_clock::period::den) / std::chrono::steady_clock::period::num;
+#endif
+  }
+
+  Trace::LatencySummary summarize(const std::vector<std::uint64_t>& buckets, std::uint64_t count, std::uint64_t sum,
+    std::uint64_t max, double nanosecondsPerTick)
+  {
+    Trace::LatencySummary summary;
+    summary.count = count;
+    if (count == 0)
+      return summary;
+
+    summary.mean = static_cast<double>(sum) / static_cast<double>(count) * nanosecondsPerTick;
+    summary.max = static_cast<double>(max) * nanosecondsPerTick;
+
+    const auto percentile = [&](double fraction) {
+      const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(count))));
+      std::uint64_t seen = 0;
+      for (std::size_t i = 0; i < buckets.size(); ++i)
+      {
+        seen += buckets[i];
+        if (seen >= rank)
+          return std::min(bucketMiddle(i), static_cast<double>(max)) * nanosecondsPerTick;
+      }
+      return summary.max;
+    };
+    summary.p50 = percentile(0.50);
+    summary.p90 = percentile(0.90);
+    summary.p99 = percentile(0.99);
+    summary.p999 = percentile(0.999);
+    return summary;
+  }
+
+  using HistogramKind = const Histogram PointHistograms::*;
+
+  /// Sums histograms of `point` over all threads: every kind in `kinds`, plus the calls of `zeros` as latency 0.
+  Trace::LatencySummary merge(const std::vector<const ThreadBuffer*>& buffers, Point point,
+    std::initializer_list<HistogramKind> kinds, HistogramKind zeros, double nanosecondsPerTick)
+  {
+    std::vector<std::uint64_t> buckets(BucketCount, 0);
+    std::uint64_t count = 0;
+    std::uint64_t sum = 0;
+    std::uint64_t max = 0;
+    for (const ThreadBuffer* buffer : buffers)
+    {
+      const PointHistograms* histograms = buffer->histograms(point);
+      if (!histograms)
+        continue;
+      for (const HistogramKind kind : kinds)
+      {
+        const Histogram& histogram = histograms->*kind;
+        for (std::size_t i = 0; i < BucketCount; ++i)
+        {
+          const std::uint32_t calls = histogram.buckets[i].load(std::memory_order_relaxed);
+          buckets[i] += calls;
+          count += calls;
+        }
+        sum += histogram.sum.load(std::memory_order_relaxed);
+        max = std::max(max, histogram.max.load(std::memory_order_relaxed));
+      }
+      if (zeros)
+      {
+        const Histogram& histogram = histograms->*zeros;
+        for (std::size_t i = 0; i < BucketCount; ++i)
+        {
+          const std::uint32_t calls = histogram.buckets[i].load(std::memory_order_relaxed);
+          buckets[0] += calls;
+          count += calls;
+        }
+      }
+    }
+    return summarize(buckets, count, sum, max, nanosecondsPerTick);
+  }
+
+  /// Formats into a local buffer with to_chars and writes it out in large blocks; formatting every number
+  /// through the stream is several times slower for traces of a few hundred thousand calls.
+  class JsonWriter
+  {
+  public:
+    explicit JsonWriter(std::ostream& out) : m_out(out) { m_buffer.reserve(FlushSize + 256); }
+    ~JsonWriter() { flush(); }
+
+    void append(std::string_view text)
+    {
+      m_buffer.append(text);
+      if (m_buffer.size() >= FlushSize)
+        flush();
+    }
+
+    void append(std::uint32_t value)
+    {
+      char digits[16];
+      const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+      append(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+    }
+
+    /// Microseconds with nanosecond resolution.
+    void append(double value)
+    {
+      char digits[32];
+      const auto result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, 3);
+      append(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+    }
+
+  private:
+    static constexpr std::size_t FlushSize = 64 * 1024;
+
+    void flush()
+    {
+      m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+      m_buffer.clear();
+    }
+
+    std::ostream& m_out;
+    std::string m_buffer;
+  };
+
+  constexpr const char* ClassNames[] = {
+#define CWAPI3D_TRACE_POINT_CLASS(Class, Id, Signature) #Class,
+    CWAPI3D_TRACE_POINTS(CWAPI3D_TRACE_POINT_CLASS)
+#undef CWAPI3D_TRACE_POINT_CLASS
+  };
+
+  constexpr const char* Names[] = {
+#define CWAPI3D_TRACE_POINT_NAME(Class, Id, Signature) #Class "." Signature,
+    CWAPI3D_TRACE_POINTS(CWAPI3D_TRACE_POINT_NAME)
+#undef CWAPI3D_TRACE_POINT_NAME
+  };
+
+  static_assert(std::size(Names) == PointCount);
+  static_assert(PointCount <= 0xFFFF, "Point must fit the 16 bits an event stores it in");
+}
+
+const char* Trace::className(Point point)
+{
+  return ClassNames[static_cast<std::size_t>(point)];
+}
+
+const char* Trace::name(Point point)
+{
+  return Names[static_cast<std::size_t>(point)];
+}
+
+void Trace::setEnabled(bool enabled)
+{
+  if (enabled && g_origin.load(std::memory_order_relaxed) == 0)
+    setOrigin();
+  g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Trace::enabled()
+{
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+void Trace::clear()
+{
+  g_epoch.fetch_add(1, std::memory_order_acq_rel);
+  setOrigin();
+}
+
+void Trace::begin(Point point)
+{
+  localBuffer().begin(point);
+}
+
+void Trace::enterNative()
+{
+  localBuffer().enterNative();
+}
+
+void Trace::leaveNative()
+{
+  localBuffer().leaveNative();
+}
+
+void Trace::end()
+{
+  localBuffer().end();
+}
+
+std::vector<Trace::PointStatistics> Trace::statistics()
+{
+  const auto buffers = currentBuffers();
+  const double nanosecondsPerTick = 1e9 / ticksPerSecond();
+
+  std::vector<PointStatistics> result;
+  for (std::size_t i = 0; i < PointCount; ++i)
+  {
+    const auto point = static_cast<Point>(i);
+    PointStatistics statistics{point, {}, {}, {}};
+    statistics.total = merge(buffers, point, {&PointHistograms::plain, &PointHistograms::total}, nullptr, nanosecondsPerTick);
+    if (statistics.total.count == 0)
+      continue;
+    statistics.native = merge(buffers, point, {&PointHistograms::native}, &PointHistograms::plain, nanosecondsPerTick);
+    statistics.marshalling =
+      merge(buffers, point, {&PointHistograms::plain, &PointHistograms::marshalling}, nullptr, nanosecondsPerTick);
+    result.push_back(statistics);
+  }
+  return result;
+}
+
+std::size_t Trace::eventCount()
+{
+  std::size_t count = 0;
+  for (const ThreadBuffer* buffer : currentBuffers())
+    count += buffer->eventCount();
+  return count;
+}
+
+void Trace::writeChromeTrace(std::ostream& out)
+{
+  const auto buffers = currentBuffers();
+  const double microsecondsPerTick = 1e6 / ticksPerSecond();
+  const std::uint64_t origin = g_origin.load(std::memory_order_relaxed);
+
+  JsonWriter json(out);
+  json.append("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+  bool first = true;
+  std::vector<Event> events;
+  for (const ThreadBuffer* buffer : buffers)
+  {
+    json.append(first ? "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                      : ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+    json.append(buffer->index());
+    json.append(",\"args\":{\"name\":\"");
+    json.append(buffer->name());
+    json.append("\"}}");
+    first = false;
+
+    events.clear();
+    buffer->copyEvents(events);
+    for (const Event& event : events)
+    {
+      // Calls opened before clear end up in the ring after it; they predate the trace.
+      if (event.start < origin || static_cast<std::size_t>(event.point) >= PointCount)
+        continue;
+      const double duration = static_cast<double>(event.stop - event.start) * microsecondsPerTick;
+      const double native = static_cast<double>(event.native) * microsecondsPerTick;
+      json.append(",\n{\"name\":\"");
+      json.append(name(event.point));
+      json.append("\",\"cat\":\"");
+      json.append(className(event.point));
+      json.append("\",\"ph\":\"X\",\"pid\":1,\"tid\":");
+      json.append(buffer->index());
+      json.append(",\"ts\":");
+      json.append(static_cast<double>(event.start - origin) * microsecondsPerTick);
+      json.append(",\"dur\":");
+      json.append(duration);
+      json.append(",\"args\":{\"native_us\":");
+      json.append(native);
+      json.append(",\"marshalling_us\":");
+      json.append(duration - native);
+      json.append(",\"depth\":");
+      json.append(event.depth);
+      json.append("}}");
+    }
+  }
+  json.append("\n]}\n");
+}
+
+std::uint64_t Trace::now()
+{
+#if defined(CWAPI3D_TRACE_TSC)
+  return __rdtsc();
+#else
+  return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+double Trace::ticksPerSecond()
+{
+  static const double rate = calibrateTicksPerSecond();
+  return rate;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "TracePoints.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+// Plain C++ (no /clr) call tracer behind BridgeTrace. Also included from /clr translation units, so this header
+// must not pull in <atomic>, <mutex> or <thread>; the recorder's state lives in Trace.cpp.
+//
+// Each thread records into its own buffers, so recording takes no lock and shares no cache line with other
+// threads: a ring of the last EventsPerThread calls, for Chrome-trace export, and log-linear latency histograms
+// per traced method. Readers take a consistent snapshot without stopping the writers.
+namespace CwAPI3D::Net::Bridge::Native::Trace
+{
+  /// A traced bridge method, one per CWAPI3D_TRACE_POINTS entry.
+  enum class Point : std::uint16_t
+  {
+#define CWAPI3D_TRACE_POINT_ENUMERATOR(Class, Id, Signature) Class##_##Id,
+    CWAPI3D_TRACE_POINTS(CWAPI3D_TRACE_POINT_ENUMERATOR)
+#undef CWAPI3D_TRACE_POINT_ENUMERATOR
+    Count
+  };
+
+  inline constexpr std::size_t PointCount = static_cast<std::size_t>(Point::Count);
+
+  /// Calls each thread keeps for export; older calls are overwritten.
+  inline constexpr std::size_t EventsPerThread = std::size_t{1} << 16;
+  /// Nesting depth recorded per thread; calls nested deeper are not recorded.
+  inline constexpr std::size_t MaxDepth = 32;
+
+  /// The class declaring a traced method, e.g. "ElementController".
+  const char* className(Point point);
+  /// The class and signature of a traced method, e.g. "ElementController.DeleteElements(List<int>)".
+  const char* name(Point point);
+
+  /// Starts or stops recording. Starting for the first time, or after clear, sets the time origin of the trace.
+  void setEnabled(bool enabled);
+  bool enabled();
+
+  /// Drops everything recorded so far, on all threads.
+  void clear();
+
+  /// Opens a call of `point` on the calling thread. Every begin must be matched by an end on the same thread.
+  void begin(Point point);
+  /// Marks the start and end of the innermost open call's time inside the CAD API; the rest of the call counts
+  /// as marshalling. A call may enter the CAD API several times. A native span still open when the call ends, or
+  /// when the next one starts, ends on that timestamp, so leaveNative is only needed when marshalling follows.
+  void enterNative();
+  void leaveNative();
+  /// Closes the innermost open call, and its open native span, and records it.
+  void end();
+
+  /// Latency percentiles in nanoseconds, each within 1/32 of the exact value.
+  struct LatencySummary
+  {
+    std::uint64_t count = 0;
+    double mean = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double max = 0.0;
+  };
+
+  /// Latencies of one method over all threads: the whole call, the time inside the CAD API and the rest.
+  struct PointStatistics
+  {
+    Point point;
+    LatencySummary total;
+    LatencySummary native;
+    LatencySummary marshalling;
+  };
+
+  /// Statistics for every method called since recording started, in Point order.
+  std::vector<PointStatistics> statistics();
+
+  /// Number of calls currently held in the per-thread rings.
+  std::size_t eventCount();
+
+  /// Writes the calls held in the per-thread rings as Chrome trace event JSON (chrome://tracing, Perfetto).
+  /// Each call is a complete event with its native and marshalling time in args.
+  void writeChromeTrace(std::ostream& out);
+
+  /// The raw timestamp counter recorded for each call, and its rate.
+  std::uint64_t now();
+  double ticksPerSecond();
+}
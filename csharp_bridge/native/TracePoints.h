@@ -0,0 +1,148 @@
+#pragma once
+
+// Every bridge method the call tracer records, as X(Class, Id, "Signature"). Trace::Point has one enumerator
+// Class_Id per entry; the class and signature name the method in reports and Chrome traces.
+// Overloads get a suffix naming the argument type that distinguishes them.
+#define CWAPI3D_TRACE_POINTS(X)                                                                              \
+  X(CwApi3DFactory, Create, "CwApi3DFactory(IntPtr)")                                                        \
+  X(CwApi3DFactory, GetSomething, "GetSomething()")                                                          \
+  X(CwApi3DFactory, GetNativeFactory, "GetNativeFactory()")                                                  \
+  X(CwApi3DFactory, GetElementController, "GetElementController()")                                          \
+  X(CwApi3DFactory, GetAttributeController, "GetAttributeController()")                                      \
+  X(CwApi3DFactory, GetGeometryController, "GetGeometryController()")                                        \
+                                                                                                             \
+  X(ElementController, Create, "ElementController(ICwAPI3DControllerFactory*, CadThreadExecutor)")            \
+  X(ElementController, NotifyModelChanged, "NotifyModelChanged()")                                           \
+  X(ElementController, NotifyModelChanged_Queries, "NotifyModelChanged(ElementQueries)")                     \
+  X(ElementController, CreateElementIdList, "CreateElementIdList()")                                         \
+  X(ElementController, CreateCommandBatch, "CreateCommandBatch()")                                           \
+  X(ElementController, GetAllIdentifiableElementIDs, "GetAllIdentifiableElementIDs()")                       \
+  X(ElementController, GetVisibleIdentifiableElementIDs, "GetVisibleIdentifiableElementIDs()")               \
+  X(ElementController, GetInvisibleIdentifiableElementIDs, "GetInvisibleIdentifiableElementIDs()")           \
+  X(ElementController, GetActiveIdentifiableElementIDs, "GetActiveIdentifiableElementIDs()")                 \
+  X(ElementController, GetInactiveAllIdentifiableElementIDs, "GetInactiveAllIdentifiableElementIDs()")       \
+  X(ElementController, GetInactiveVisibleIdentifiableElementIDs, "GetInactiveVisibleIdentifiableElementIDs()") \
+  X(ElementController, GetAllIdentifiableElementIDsInto, "GetAllIdentifiableElementIDsInto(int[])")          \
+  X(ElementController, GetVisibleIdentifiableElementIDsInto, "GetVisibleIdentifiableElementIDsInto(int[])")  \
+  X(ElementController, GetInvisibleIdentifiableElementIDsInto, "GetInvisibleIdentifiableElementIDsInto(int[])") \
+  X(ElementController, GetActiveIdentifiableElementIDsInto, "GetActiveIdentifiableElementIDsInto(int[])")    \
+  X(ElementController, GetInactiveAllIdentifiableElementIDsInto, "GetInactiveAllIdentifiableElementIDsInto(int[])") \
+  X(ElementController, GetInactiveVisibleIdentifiableElementIDsInto, "GetInactiveVisibleIdentifiableElementIDsInto(int[])") \
+  X(ElementController, GetAllIdentifiableElementIDSet, "GetAllIdentifiableElementIDSet()")                   \
+  X(ElementController, GetVisibleIdentifiableElementIDSet, "GetVisibleIdentifiableElementIDSet()")           \
+  X(ElementController, GetInvisibleIdentifiableElementIDSet, "GetInvisibleIdentifiableElementIDSet()")       \
+  X(ElementController, GetActiveIdentifiableElementIDSet, "GetActiveIdentifiableElementIDSet()")             \
+  X(ElementController, GetInactiveAllIdentifiableElementIDSet, "GetInactiveAllIdentifiableElementIDSet()")   \
+  X(ElementController, GetInactiveVisibleIdentifiableElementIDSet, "GetInactiveVisibleIdentifiableElementIDSet()") \
+  X(ElementController, FilterElementIDs, "FilterElementIDs(ElementFilter)")                                  \
+  X(ElementController, FilterElementIDSet, "FilterElementIDSet(ElementFilter)")                              \
+  X(ElementController, EnumerateAllIdentifiableElementIDs, "EnumerateAllIdentifiableElementIDs()")           \
+  X(ElementController, EnumerateVisibleIdentifiableElementIDs, "EnumerateVisibleIdentifiableElementIDs()")   \
+  X(ElementController, EnumerateInvisibleIdentifiableElementIDs, "EnumerateInvisibleIdentifiableElementIDs()") \
+  X(ElementController, EnumerateActiveIdentifiableElementIDs, "EnumerateActiveIdentifiableElementIDs()")     \
+  X(ElementController, EnumerateInactiveAllIdentifiableElementIDs, "EnumerateInactiveAllIdentifiableElementIDs()") \
+  X(ElementController, EnumerateInactiveVisibleIdentifiableElementIDs, "EnumerateInactiveVisibleIdentifiableElementIDs()") \
+  X(ElementController, EnumerateElementIDs, "EnumerateElementIDs(ElementQueries, int)")                      \
+  X(ElementController, DeleteElements_List, "DeleteElements(List<int>)")                                     \
+  X(ElementController, DeleteElements_IdList, "DeleteElements(ElementIdList)")                               \
+  X(ElementController, DeleteElements_IdSet, "DeleteElements(ElementIdSet)")                                 \
+  X(ElementController, JoinElements_List, "JoinElements(List<int>)")                                         \
+  X(ElementController, JoinElements_IdList, "JoinElements(ElementIdList)")                                   \
+  X(ElementController, JoinElements_IdSet, "JoinElements(ElementIdSet)")                                     \
+  X(ElementController, JoinTopLevelElements_List, "JoinTopLevelElements(List<int>)")                         \
+  X(ElementController, JoinTopLevelElements_IdList, "JoinTopLevelElements(ElementIdList)")                   \
+  X(ElementController, JoinTopLevelElements_IdSet, "JoinTopLevelElements(ElementIdSet)")                     \
+  X(ElementController, CreateRectangularBeamPoints, "CreateRectangularBeamPoints(double, double, Vector3D, Vector3D, Vector3D)") \
+  X(ElementController, CreateCircularBeamPoints, "CreateCircularBeamPoints(double, Vector3D, Vector3D, Vector3D)") \
+  X(ElementController, CreateSquareBeamPoints, "CreateSquareBeamPoints(double, Vector3D, Vector3D, Vector3D)") \
+  X(ElementController, CreateRectangularBeams_Values, "CreateRectangularBeams(double[], double[], Vector3DValue[]...)") \
+  X(ElementController, CreateRectangularBeams_Buffer, "CreateRectangularBeams(double[], double[], PointBuffer...)") \
+  X(ElementController, CreateCircularBeams_Values, "CreateCircularBeams(double[], Vector3DValue[]...)")      \
+  X(ElementController, CreateCircularBeams_Buffer, "CreateCircularBeams(double[], PointBuffer...)")          \
+  X(ElementController, CreateSquareBeams_Values, "CreateSquareBeams(double[], Vector3DValue[]...)")          \
+  X(ElementController, CreateSquareBeams_Buffer, "CreateSquareBeams(double[], PointBuffer...)")              \
+  X(ElementController, SolderElements_List, "SolderElements(List<int>)")                                     \
+  X(ElementController, SolderElements_IdList, "SolderElements(ElementIdList)")                               \
+  X(ElementController, SolderElements_IdSet, "SolderElements(ElementIdSet)")                                 \
+  X(ElementController, ConvertBeamToPanel_List, "ConvertBeamToPanel(List<int>)")                             \
+  X(ElementController, ConvertBeamToPanel_IdList, "ConvertBeamToPanel(ElementIdList)")                       \
+  X(ElementController, ConvertBeamToPanel_IdSet, "ConvertBeamToPanel(ElementIdSet)")                         \
+  X(ElementController, ConvertPanelToBeam_List, "ConvertPanelToBeam(List<int>)")                             \
+  X(ElementController, ConvertPanelToBeam_IdList, "ConvertPanelToBeam(ElementIdList)")                       \
+  X(ElementController, ConvertPanelToBeam_IdSet, "ConvertPanelToBeam(ElementIdSet)")                         \
+  X(ElementController, SplitElements_List, "SplitElements(List<int>)")                                       \
+  X(ElementController, SplitElements_IdList, "SplitElements(ElementIdList)")                                 \
+  X(ElementController, SplitElements_IdSet, "SplitElements(ElementIdSet)")                                   \
+  X(ElementController, MoveElement_List, "MoveElement(List<int>, Vector3D)")                                 \
+  X(ElementController, MoveElement_IdList, "MoveElement(ElementIdList, Vector3D)")                           \
+  X(ElementController, MoveElement_IdSet, "MoveElement(ElementIdSet, Vector3D)")                             \
+  X(ElementController, CopyElements_List, "CopyElements(List<int>, Vector3D)")                               \
+  X(ElementController, CopyElements_IdList, "CopyElements(ElementIdList, Vector3D)")                         \
+  X(ElementController, CopyElements_IdSet, "CopyElements(ElementIdSet, Vector3D)")                           \
+  X(ElementController, MakeUndo, "MakeUndo()")                                                               \
+  X(ElementController, MakeRedo, "MakeRedo()")                                                               \
+  X(ElementController, UnjoinElements_List, "UnjoinElements(List<int>)")                                     \
+  X(ElementController, UnjoinElements_IdList, "UnjoinElements(ElementIdList)")                               \
+  X(ElementController, UnjoinElements_IdSet, "UnjoinElements(ElementIdSet)")                                 \
+  X(ElementController, UnjoinTopLevelElements_List, "UnjoinTopLevelElements(List<int>)")                     \
+  X(ElementController, UnjoinTopLevelElements_IdList, "UnjoinTopLevelElements(ElementIdList)")               \
+  X(ElementController, UnjoinTopLevelElements_IdSet, "UnjoinTopLevelElements(ElementIdSet)")                 \
+  X(ElementController, GetAllIdentifiableElementIDsAsync, "GetAllIdentifiableElementIDsAsync(CancellationToken)") \
+  X(ElementController, GetVisibleIdentifiableElementIDsAsync, "GetVisibleIdentifiableElementIDsAsync(CancellationToken)") \
+  X(ElementController, GetInvisibleIdentifiableElementIDsAsync, "GetInvisibleIdentifiableElementIDsAsync(CancellationToken)") \
+  X(ElementController, GetActiveIdentifiableElementIDsAsync, "GetActiveIdentifiableElementIDsAsync(CancellationToken)") \
+  X(ElementController, GetInactiveAllIdentifiableElementIDsAsync, "GetInactiveAllIdentifiableElementIDsAsync(CancellationToken)") \
+  X(ElementController, GetInactiveVisibleIdentifiableElementIDsAsync, "GetInactiveVisibleIdentifiableElementIDsAsync(CancellationToken)") \
+  X(ElementController, DeleteElementsAsync, "DeleteElementsAsync(List<int>, CancellationToken)")             \
+  X(ElementController, JoinElementsAsync, "JoinElementsAsync(List<int>, CancellationToken)")                 \
+  X(ElementController, JoinTopLevelElementsAsync, "JoinTopLevelElementsAsync(List<int>, CancellationToken)") \
+  X(ElementController, UnjoinElementsAsync, "UnjoinElementsAsync(List<int>, CancellationToken)")             \
+  X(ElementController, UnjoinTopLevelElementsAsync, "UnjoinTopLevelElementsAsync(List<int>, CancellationToken)") \
+  X(ElementController, SolderElementsAsync, "SolderElementsAsync(List<int>, CancellationToken)")             \
+  X(ElementController, ConvertBeamToPanelAsync, "ConvertBeamToPanelAsync(List<int>, CancellationToken)")     \
+  X(ElementController, ConvertPanelToBeamAsync, "ConvertPanelToBeamAsync(List<int>, CancellationToken)")     \
+  X(ElementController, SplitElementsAsync, "SplitElementsAsync(List<int>, CancellationToken)")               \
+  X(ElementController, MoveElementAsync, "MoveElementAsync(List<int>, Vector3D, CancellationToken)")         \
+  X(ElementController, CopyElementsAsync, "CopyElementsAsync(List<int>, Vector3D, CancellationToken)")       \
+  X(ElementController, MakeUndoAsync, "MakeUndoAsync(CancellationToken)")                                   \
+  X(ElementController, MakeRedoAsync, "MakeRedoAsync(CancellationToken)")                                   \
+                                                                                                             \
+  X(AttributeController, Create, "AttributeController(ICwAPI3DControllerFactory*)")                          \
+  X(AttributeController, GetAttributes_List, "GetAttributes(List<int>, AttributeColumns)")                   \
+  X(AttributeController, GetAttributes_Array, "GetAttributes(int[], AttributeColumns)")                      \
+  X(AttributeController, GetAttributes_IdSet, "GetAttributes(ElementIdSet, AttributeColumns)")               \
+  X(AttributeController, GetName, "GetName(int)")                                                            \
+  X(AttributeController, GetGroup, "GetGroup(int)")                                                          \
+  X(AttributeController, GetSubgroup, "GetSubgroup(int)")                                                    \
+  X(AttributeController, GetComment, "GetComment(int)")                                                      \
+  X(AttributeController, GetMaterial, "GetMaterial(int)")                                                    \
+                                                                                                             \
+  X(GeometryController, Create, "GeometryController(ICwAPI3DControllerFactory*)")                            \
+  X(GeometryController, GetSnapshot_List, "GetSnapshot(List<int>, GeometryFields)")                          \
+  X(GeometryController, GetSnapshot_Array, "GetSnapshot(int[], GeometryFields)")                             \
+  X(GeometryController, GetSnapshot_IdSet, "GetSnapshot(ElementIdSet, GeometryFields)")                      \
+  X(GeometryController, GetSnapshotInto, "GetSnapshotInto(int[], GeometryFields, GeometrySnapshot)")         \
+  X(GeometryController, GetP1, "GetP1(int)")                                                                 \
+  X(GeometryController, GetP2, "GetP2(int)")                                                                 \
+  X(GeometryController, GetP3, "GetP3(int)")                                                                 \
+  X(GeometryController, GetXL, "GetXL(int)")                                                                 \
+  X(GeometryController, GetYL, "GetYL(int)")                                                                 \
+  X(GeometryController, GetZL, "GetZL(int)")                                                                 \
+  X(GeometryController, GetWidth, "GetWidth(int)")                                                           \
+  X(GeometryController, GetHeight, "GetHeight(int)")                                                         \
+  X(GeometryController, GetLength, "GetLength(int)")                                                         \
+                                                                                                             \
+  X(Point3D, Create, "Point3D()")                                                                            \
+  X(Point3D, Create_Coordinates, "Point3D(double, double, double)")                                          \
+  X(Point3D, Create_Copy, "Point3D(Point3D)")                                                                \
+  X(Vector3D, Create, "Vector3D()")                                                                          \
+  X(Vector3D, Create_Coordinates, "Vector3D(double, double, double)")                                        \
+  X(Vector3D, Create_Copy, "Vector3D(Vector3D)")                                                             \
+  X(Plane3D, Create, "Plane3D()")                                                                            \
+  X(Plane3D, Create_PointNormal, "Plane3D(Point3D, Vector3D)")                                               \
+  X(Plane3D, Create_Points, "Plane3D(Point3D, Point3D, Point3D)")                                            \
+  X(Plane3D, Create_Copy, "Plane3D(Plane3D)")                                                                \
+  X(PointBuffer, Create, "PointBuffer()")                                                                    \
+  X(PointBuffer, Create_Capacity, "PointBuffer(int)")                                                        \
+  X(VectorBuffer, Create, "VectorBuffer()")                                                                  \
+  X(VectorBuffer, Create_Capacity, "VectorBuffer(int)")
@@ -0,0 +1,213 @@
+#include "CadThreadExecutor.h"
+#include "WorkItem.h"
+#include "WorkQueue.h"
+
+using namespace System;
+using namespace System::Threading;
+using namespace System::Threading::Tasks;
+
+namespace CwAPI3D::Net::Bridge
+{
+  CadThreadExecutor::CadThreadExecutor()
+  {
+    m_queue = gcnew WorkQueue();
+    m_workSignal = gcnew AutoResetEvent(false);
+    m_ownerThreadId = Thread::CurrentThread->ManagedThreadId;
+    m_pending = 0;
+    m_executed = 0;
+    m_disposed = false;
+  }
+
+  CadThreadExecutor::~CadThreadExecutor()
+  {
+    if (m_disposed)
+      return;
+
+    // The wait handle stays open: a producer that passed the disposed check in Post may still set it.
+    Volatile::Write(m_disposed, true);
+    CancelPending();
+  }
+
+  void CadThreadExecutor::ThrowIfDisposed()
+  {
+    if (Volatile::Read(m_disposed))
+      throw gcnew ObjectDisposedException("CadThreadExecutor");
+  }
+
+  void CadThreadExecutor::ThrowIfNotOwnerThread()
+  {
+    if (!IsOnOwnerThread)
+      throw gcnew InvalidOperationException("Queued CAD calls can only be run on the thread that created the executor.");
+  }
+
+  bool CadThreadExecutor::IsOnOwnerThread::get()
+  {
+    return Thread::CurrentThread->ManagedThreadId == m_ownerThreadId;
+  }
+
+  int CadThreadExecutor::PendingCount::get()
+  {
+    return Math::Max(0, Volatile::Read(m_pending));
+  }
+
+  void CadThreadExecutor::Post(WorkItem^ item)
+  {
+    ThrowIfDisposed();
+    if (IsOnOwnerThread)
+    {
+      item->Execute();
+      Interlocked::Increment(m_executed);
+      return;
+    }
+
+    // The count is raised after the item is linked, so the consumer may briefly see it below zero. Only the
+    // producer that takes it from 0 to 1 wakes the owner thread; every later item is found by the same drain.
+    m_queue->Enqueue(item);
+
+    // Dispose may have drained the queue between the check above and the Enqueue. Nothing would run or cancel the
+    // item then, so cancel it here; if a drain takes it anyway, it finds it cancelled and skips it.
+    if (Volatile::Read(m_disposed))
+    {
+      item->Cancel();
+      return;
+    }
+
+    if (Interlocked::Increment(m_pending) == 1)
+    {
+      m_workSignal->Set();
+      WorkAvailable(this, EventArgs::Empty);
+    }
+  }
+
+  Task^ CadThreadExecutor::InvokeAsync(Action^ action, CancellationToken cancellationToken)
+  {
+    if (action == nullptr)
+      throw gcnew ArgumentNullException("action");
+
+    auto call = gcnew ActionCall(action, cancellationToken);
+    Post(call);
+    return call->Task;
+  }
+
+  generic <typename T1>
+  Task^ CadThreadExecutor::InvokeAsync(Action<T1>^ action, T1 arg1, CancellationToken cancellationToken)
+  {
+    if (action == nullptr)
+      throw gcnew ArgumentNullException("action");
+
+    auto call = gcnew ActionCall1<T1>(action, arg1, cancellationToken);
+    Post(call);
+    return call->Task;
+  }
+
+  generic <typename T1, typename T2>
+  Task^ CadThreadExecutor::InvokeAsync(Action<T1, T2>^ action, T1 arg1, T2 arg2, CancellationToken cancellationToken)
+  {
+    if (action == nullptr)
+      throw gcnew ArgumentNullException("action");
+
+    auto call = gcnew ActionCall2<T1, T2>(action, arg1, arg2, cancellationToken);
+    Post(call);
+    return call->Task;
+  }
+
+  generic <typename TResult>
+  Task<TResult>^ CadThreadExecutor::InvokeAsync(Func<TResult>^ func, CancellationToken cancellationToken)
+  {
+    if (func == nullptr)
+      throw gcnew ArgumentNullException("func");
+
+    auto call = gcnew FuncCall<TResult>(func, cancellationToken);
+    Post(call);
+    return call->Task;
+  }
+
+  generic <typename T1, typename TResult>
+  Task<TResult>^ CadThreadExecutor::InvokeAsync(Func<T1, TResult>^ func, T1 arg1, CancellationToken cancellationToken)
+  {
+    if (func == nullptr)
+      throw gcnew ArgumentNullException("func");
+
+    auto call = gcnew FuncCall1<T1, TResult>(func, arg1, cancellationToken);
+    Post(call);
+    return call->Task;
+  }
+
+  generic <typename T1, typename T2, typename TResult>
+  Task<TResult>^ CadThreadExecutor::InvokeAsync(Func<T1, T2, TResult>^ func, T1 arg1, T2 arg2, CancellationToken cancellationToken)
+  {
+    if (func == nullptr)
+      throw gcnew ArgumentNullException("func");
+
+    auto call = gcnew FuncCall2<T1, T2, TResult>(func, arg1, arg2, cancellationToken);
+    Post(call);
+    return call->Task;
+  }
+
+  int CadThreadExecutor::RunPending()
+  {
+    ThrowIfNotOwnerThread();
+
+    int executed = 0;
+    SpinWait spin;
+    while (true)
+    {
+      WorkItem^ item;
+      if (m_queue->TryDequeue(item))
+      {
+        Interlocked::Decrement(m_pending);
+        item->Execute();
+        ++executed;
+        spin.Reset();
+        continue;
+      }
+
+      // A positive count with nothing to dequeue means a producer has claimed its place in the queue but not
+      // linked it yet; it is a few instructions away, and nobody would wake this thread for it again.
+      if (Volatile::Read(m_pending) <= 0)
+        break;
+      spin.SpinOnce();
+    }
+
+    Interlocked::Add(m_executed, executed);
+    return executed;
+  }
+
+  void CadThreadExecutor::RunUntilSignaled(WaitHandle^ stop)
+  {
+    ThrowIfNotOwnerThread();
+    ThrowIfDisposed();
+
+    array<WaitHandle^>^ handles = gcnew array<WaitHandle^>{ stop, m_workSignal };
+    while (true)
+    {
+      RunPending();
+      if (WaitHandle::WaitAny(handles) == 0)
+        break;
+    }
+    RunPending();
+  }
+
+  void CadThreadExecutor::RunUntil(CancellationToken cancellationToken)
+  {
+    RunUntilSignaled(cancellationToken.WaitHandle);
+  }
+
+  void CadThreadExecutor::RunUntilComplete(Task^ task)
+  {
+    if (task == nullptr)
+      throw gcnew ArgumentNullException("task");
+
+    RunUntilSignaled(safe_cast<IAsyncResult^>(task)->AsyncWaitHandle);
+  }
+
+  void CadThreadExecutor::CancelPending()
+  {
+    WorkItem^ item;
+    while (m_queue->TryDequeue(item))
+    {
+      Interlocked::Decrement(m_pending);
+      item->Cancel();
+    }
+  }
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  ref class WorkItem;
+  ref class WorkQueue;
+
+  /// <summary>
+  /// Runs CwAPI3D calls on the CAD host's thread on behalf of other threads.
+  /// Any thread may queue a call with InvokeAsync and await the returned task; the owner thread (the thread that
+  /// created the executor, which must be the CAD thread) runs the queued calls in order when it drains the queue
+  /// with RunPending. Hosts schedule RunPending on their message loop from WorkAvailable; RunUntil and
+  /// RunUntilComplete block the owner thread and suit headless hosts without a message loop.
+  /// </summary>
+  /// <remarks>
+  /// Calls queued from the owner thread itself run inline and return a completed task, so CAD-thread code that
+  /// waits on an async call cannot deadlock. Cancelling a call's token only skips the call while it is queued; a
+  /// call that has started runs to completion. Task continuations never run on the CAD thread.
+  /// </remarks>
+  public ref class CadThreadExecutor sealed
+  {
+  private:
+    WorkQueue^ m_queue;
+    System::Threading::AutoResetEvent^ m_workSignal;
+    int m_ownerThreadId;
+    int m_pending;
+    long long m_executed;
+    bool m_disposed;
+
+    void ThrowIfDisposed();
+    void ThrowIfNotOwnerThread();
+    void Post(WorkItem^ item);
+    void RunUntilSignaled(System::Threading::WaitHandle^ stop);
+    void CancelPending();
+
+  public:
+    /// <summary>
+    /// Creates an executor owned by the calling thread.
+    /// </summary>
+    CadThreadExecutor();
+
+    /// <summary>
+    /// Raised on the queuing thread when a call is queued while the queue was empty.
+    /// Hosts with a message loop (e.g. a WPF Dispatcher on the CAD thread) can schedule RunPending from here.
+    /// </summary>
+    event System::EventHandler^ WorkAvailable;
+
+    /// <summary>
+    /// Gets the managed thread ID of the owner thread.
+    /// </summary>
+    property int OwnerThreadId
+    {
+      int get() { return m_ownerThreadId; }
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether the calling thread is the owner thread.
+    /// </summary>
+    property bool IsOnOwnerThread
+    {
+      bool get();
+    }
+
+    /// <summary>
+    /// Gets the number of queued calls that have not run yet.
+    /// </summary>
+    property int PendingCount
+    {
+      int get();
+    }
+
+    /// <summary>
+    /// Gets the total number of calls this executor has run.
+    /// </summary>
+    property long long ExecutedCount
+    {
+      long long get() { return m_executed; }
+    }
+
+    /// <summary>
+    /// Queues an action for the owner thread.
+    /// </summary>
+    /// <exception cref="System::ObjectDisposedException">Thrown when the executor has been disposed.</exception>
+    System::Threading::Tasks::Task^ InvokeAsync(System::Action^ action,
+      [System::Runtime::InteropServices::Optional] System::Threading::CancellationToken cancellationToken);
+
+    generic <typename T1>
+    System::Threading::Tasks::Task^ InvokeAsync(System::Action<T1>^ action, T1 arg1,
+      [System::Runtime::InteropServices::Optional] System::Threading::CancellationToken cancellationToken);
+
+    generic <typename T1, typename T2>
+    System::Threading::Tasks::Task^ InvokeAsync(System::Action<T1, T2>^ action, T1 arg1, T2 arg2,
+      [System::Runtime::InteropServices::Optional] System::Threading::CancellationToken cancellationToken);
+
+    /// <summary>
+    /// Queues a function for the owner thread; the task completes with its result.
+    /// </summary>
+    /// <exception cref="System::ObjectDisposedException">Thrown when the executor has been disposed.</exception>
+    generic <typename TResult>
+    System::Threading::Tasks::Task<TResult>^ InvokeAsync(System::Func<TResult>^ func,
+      [System::Runtime::InteropServices::Optional] System::Threading::CancellationToken cancellationToken);
+
+    generic <typename T1, typename TResult>
+    System::Threading::Tasks::Task<TResult>^ InvokeAsync(System::Func<T1, TResult>^ func, T1 arg1,
+      [System::Runtime::InteropServices::Optional] System::Threading::CancellationToken cancellationToken);
+
+    generic <typename T1, typename T2, typename TResult>
+    System::Threading::Tasks::Task<TResult>^ InvokeAsync(System::Func<T1, T2, TResult>^ func, T1 arg1, T2 arg2,
+      [System::Runtime::InteropServices::Optional] System::Threading::CancellationToken cancellationToken);
+
+    /// <summary>
+    /// Runs every queued call. Must be called on the owner thread.
+    /// </summary>
+    /// <returns>The number of calls run.</returns>
+    /// <exception cref="System::InvalidOperationException">Thrown when called from another thread.</exception>
+    int RunPending();
+
+    /// <summary>
+    /// Runs queued calls as they arrive until the token is cancelled, blocking the owner thread in between.
+    /// </summary>
+    /// <exception cref="System::InvalidOperationException">Thrown when called from another thread.</exception>
+    void RunUntil(System::Threading::CancellationToken cancellationToken);
+
+    /// <summary>
+    /// Runs queued calls as they arrive until the task has completed, e.g. a background analysis that issues
+    /// async CAD calls. Blocks the owner thread in between.
+    /// </summary>
+    /// <exception cref="System::InvalidOperationException">Thrown when called from another thread.</exception>
+    void RunUntilComplete(System::Threading::Tasks::Task^ task);
+
+    /// <summary>
+    /// Cancels every queued call and rejects new ones.
+    /// </summary>
+    ~CadThreadExecutor();
+  };
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+namespace CwAPI3D::Net::Bridge
+{
+  /// <summary>
+  /// A call queued on a CadThreadExecutor.
+  /// </summary>
+  ref class WorkItem abstract
+  {
+  public:
+    /// <summary>
+    /// Runs the call on the executor's thread and completes its task, unless it was cancelled first.
+    /// Never throws: exceptions of the call fault the task.
+    /// </summary>
+    virtual void Execute() = 0;
+
+    /// <summary>
+    /// Cancels the task if the call has not started yet.
+    /// </summary>
+    virtual void Cancel() = 0;
+  };
+
+  /// <summary>
+  /// Completes a Task&lt;TResult&gt; with the result of Invoke. Cancellation through the token (or Cancel) only takes
+  /// effect while the call is still queued; once Execute has started, the call runs to completion.
+  /// </summary>
+  generic <typename TResult>
+  ref class Call abstract : WorkItem
+  {
+  private:
+    literal int Queued = 0;
+    literal int Running = 1;
+    literal int Cancelled = 2;
+
+    System::Threading::Tasks::TaskCompletionSource<TResult>^ m_completion;
+    System::Threading::CancellationToken m_token;
+    System::Threading::CancellationTokenRegistration m_registration;
+    int m_state;
+
+  protected:
+    virtual TResult Invoke() = 0;
+
+  public:
+    explicit Call(System::Threading::CancellationToken token)
+    {
+      // Continuations must not run inline on the CAD thread, where they would delay the rest of the queue.
+      m_completion = gcnew System::Threading::Tasks::TaskCompletionSource<TResult>(
+        System::Threading::Tasks::TaskCreationOptions::RunContinuationsAsynchronously);
+      m_token = token;
+      m_state = Queued;
+      if (token.CanBeCanceled)
+        m_registration = token.Register(gcnew System::Action(this, &Call::Cancel));
+    }
+
+    property System::Threading::Tasks::Task<TResult>^ Task
+    {
+      System::Threading::Tasks::Task<TResult>^ get() { return m_completion->Task; }
+    }
+
+    virtual void Execute() override
+    {
+      if (System::Threading::Interlocked::CompareExchange(m_state, Running, Queued) != Queued)
+        return;
+
+      try
+      {
+        m_completion->TrySetResult(Invoke());
+      }
+      catch (System::Exception^ exception)
+      {
+        m_completion->TrySetException(exception);
+      }
+      finally
+      {
+        m_registration.Dispose();
+      }
+    }
+
+    virtual void Cancel() override
+    {
+      if (System::Threading::Interlocked::CompareExchange(m_state, Cancelled, Queued) != Queued)
+        return;
+
+      m_registration.Dispose();
+      if (m_token.IsCancellationRequested)
+        m_completion->TrySetCanceled(m_token);
+      else
+        m_completion->TrySetCanceled();
+    }
+  };
+
+  generic <typename TResult>
+  ref class FuncCall sealed : Call<TResult>
+  {
+  private:
+    System::Func<TResult>^ m_func;
+
+  protected:
+    virtual TResult Invoke() override { return m_func(); }
+
+  public:
+    FuncCall(System::Func<TResult>^ func, System::Threading::CancellationToken token) : Call<TResult>(token), m_func(func) {}
+  };
+
+  generic <typename T1, typename TResult>
+  ref class FuncCall1 sealed : Call<TResult>
+  {
+  private:
+    System::Func<T1, TResult>^ m_func;
+    T1 m_arg1;
+
+  protected:
+    virtual TResult Invoke() override { return m_func(m_arg1); }
+
+  public:
+    FuncCall1(System::Func<T1, TResult>^ func, T1 arg1, System::Threading::CancellationToken token)
+      : Call<TResult>(token), m_func(func), m_arg1(arg1) {}
+  };
+
+  generic <typename T1, typename T2, typename TResult>
+  ref class FuncCall2 sealed : Call<TResult>
+  {
+  private:
+    System::Func<T1, T2, TResult>^ m_func;
+    T1 m_arg1;
+    T2 m_arg2;
+
+  protected:
+    virtual TResult Invoke() override { return m_func(m_arg1, m_arg2); }
+
+  public:
+    FuncCall2(System::Func<T1, T2, TResult>^ func, T1 arg1, T2 arg2, System::Threading::CancellationToken token)
+      : Call<TResult>(token), m_func(func), m_arg1(arg1), m_arg2(arg2) {}
+  };
+
+  // Actions complete a Task<bool>, which callers see as a plain Task.
+  ref class ActionCall sealed : Call<bool>
+  {
+  private:
+    System::Action^ m_action;
+
+  protected:
+    virtual bool Invoke() override
+    {
+      m_action();
+      return true;
+    }
+
+  public:
+    ActionCall(System::Action^ action, System::Threading::CancellationToken token) : Call<bool>(token), m_action(action) {}
+  };
+
+  generic <typename T1>
+  ref class ActionCall1 sealed : Call<bool>
+  {
+  private:
+    System::Action<T1>^ m_action;
+    T1 m_arg1;
+
+  protected:
+    virtual bool Invoke() override
+    {
+      m_action(m_arg1);
+      return true;
+    }
+
+  public:
+    ActionCall1(System::Action<T1>^ action, T1 arg1, System::Threading::CancellationToken token)
+      : Call<bool>(token), m_action(action), m_arg1(arg1) {}
+  };
+
+  generic <typename T1, typename T2>
+  ref class ActionCall2 sealed : Call<bool>
+  {
+  private:
+    System::Action<T1, T2>^ m_action;
+    T1 m_arg1;
+    T2 m_arg2;
+
+  protected:
+    virtual bool Invoke() override
+    {
+      m_action(m_arg1, m_arg2);
+      return true;
+    }
+
+  public:
+    ActionCall2(System::Action<T1, T2>^ action, T1 arg1, T2 arg2, System::Threading::CancellationToken token)
+      : Call<bool>(token), m_action(action), m_arg1(arg1), m_arg2(arg2) {}
+  };
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "WorkItem.h"
+
+namespace CwAPI3D::Net::Bridge
+{
+  /// <summary>
+  /// Unbounded lock-free multi-producer, single-consumer queue of work items (Vyukov's MPSC linked queue).
+  /// Any thread may Enqueue; only the executor's owner thread calls TryDequeue.
+  /// </summary>
+  ref class WorkQueue sealed
+  {
+  private:
+    ref class Node sealed
+    {
+    public:
+      Node^ Next;
+      WorkItem^ Item;
+    };
+
+    // Producers swap themselves in at the head; the consumer follows Next links from the tail, which is always
+    // the node whose item was dequeued last (initially an empty stub).
+    Node^ m_head;
+    Node^ m_tail;
+
+  public:
+    WorkQueue()
+    {
+      m_head = gcnew Node();
+      m_tail = m_head;
+    }
+
+    void Enqueue(WorkItem^ item)
+    {
+      Node^ node = gcnew Node();
+      node->Item = item;
+      Node^ previous = System::Threading::Interlocked::Exchange(m_head, node);
+      System::Threading::Volatile::Write(previous->Next, node);
+    }
+
+    /// <summary>
+    /// Takes the oldest item. Returns false when the queue is empty, and also while the producer of the oldest
+    /// item has claimed its place but not linked it yet.
+    /// </summary>
+    bool TryDequeue(WorkItem^% item)
+    {
+      Node^ next = System::Threading::Volatile::Read(m_tail->Next);
+      if (next == nullptr)
+      {
+        item = nullptr;
+        return false;
+      }
+
+      item = next->Item;
+      next->Item = nullptr;
+      m_tail = next;
+      return true;
+    }
+  };
+}
@@ -20,12 +20,16 @@ namespace sharpLib
 
                 elementIDs.ForEach(id => Console.WriteLine($@"element with DB id {id}"));
                 
-                //TODO impelmentation of attribute controller
-                // var filteredIDs = elementIDs.FindAll(id => attributeController.GetName(id) == "SomeAttributeName");
-                
-                // var ids = from id in elementIDs
-                //     where attributeController.GetName(id) == "SomeAttributeName"
-                //     select id;
+                var attributeController = wrapper.GetAttributeController();
+                var attributes = attributeController.GetAttributes(elementIDs, AttributeColumns.Name);
+                var filteredIDs = attributes.FindElements(AttributeColumns.Name, "SomeAttributeName");
+                Console.WriteLine($@"{filteredIDs.Count} of {attributes.Count} elements are named SomeAttributeName");
+
+                using (var filter = ElementFilter.Parse("visible AND active AND name == 'SomeAttributeName'"))
+                {
+                    var activeIDs = elementController.FilterElementIDs(filter);
+                    Console.WriteLine($@"{activeIDs.Count} of them are active");
+                }
 
                 Point3D point1 = new Point3D(0, 0, 0);
                 Point3D point2 = new Point3D(1000.0, 0.0, 0.0);
@@ -41,8 +45,10 @@ namespace sharpLib
                 var result = lambda(point1, point2);
                 Console.WriteLine(@"Received from native factory: " + result);
 
-                //var window = new WpfApp.MainWindow();
-                //window.Show();
+                // ShowDialog runs the CAD thread's dispatcher loop, which drains wrapper.Executor for the
+                // window's async calls.
+                var window = new WpfApp.MainWindow(wrapper);
+                window.ShowDialog();
 
                 Console.WriteLine(@"Managed code executed successfully.");
                 return true;
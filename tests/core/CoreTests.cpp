@@ -0,0 +1,217 @@
+// Checks for the header-only geometry core (csharp_bridge/core): Vec3 arithmetic, planes, the degenerate inputs the
+// factories reject, the tolerance policies and the constexpr sqrt. Self-contained like the benchmark harness; the
+// process exits non-zero when a check fails, which is all CTest needs.
+#include <core/Geometry.h>
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge::Core;
+  namespace Core = CwAPI3D::Net::Bridge::Core;
+
+  int failures = 0;
+
+  void check(bool condition, const char* expression, int line)
+  {
+    if (condition)
+      return;
+    std::fprintf(stderr, "CoreTests.cpp:%d: check failed: %s\n", line, expression);
+    ++failures;
+  }
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+  bool near(double a, double b, double epsilon = 1e-12)
+  {
+    return std::abs(a - b) < epsilon;
+  }
+
+  // The constexpr path of sqrt, evaluated by the compiler. Qualified, since unqualified lookup would prefer ::sqrt.
+  static_assert(Core::sqrt(0.0) == 0.0);
+  static_assert(Core::sqrt(1.0) == 1.0);
+  static_assert(Core::sqrt(4.0) == 2.0);
+  static_assert(Core::sqrt(144.0) == 12.0);
+  static_assert(Core::sqrt(0.25) == 0.5);
+  static_assert(Core::sqrt(2.0) * Core::sqrt(2.0) - 2.0 < 1e-15 && Core::sqrt(2.0) * Core::sqrt(2.0) - 2.0 > -1e-15);
+  static_assert(Core::sqrt(16.0f) == 4.0f);
+  static_assert(Core::sqrt(std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity());
+  static_assert(Core::sqrt(-1.0) != Core::sqrt(-1.0));
+
+  // Vec3 and Plane are usable in constant expressions.
+  static_assert(Vec3d{1, 2, 3} + Vec3d{4, 5, 6} == Vec3d{5, 7, 9});
+  static_assert(cross(Vec3d{1, 0, 0}, Vec3d{0, 1, 0}) == Vec3d{0, 0, 1});
+  static_assert(magnitude(Vec3d{3, 4, 12}) == 13.0);
+  static_assert(normalize(Vec3d{0, 0, 5}) == Vec3d{0, 0, 1});
+  static_assert(Planed::fromPointNormal({0, 0, 2}, {0, 0, 3})->d() == -2.0);
+  static_assert(!Planed::fromPoints({0, 0, 0}, {1, 1, 1}, {2, 2, 2}).has_value());
+
+  void testSqrtAtRunTime()
+  {
+    for (const double value : {0.0, 1e-300, 0.5, 2.0, 1e10, 1e300})
+      CHECK(Core::sqrt(value) == std::sqrt(value));
+    CHECK(std::isnan(Core::sqrt(-4.0)));
+    CHECK(std::isnan(Core::sqrt(std::numeric_limits<double>::quiet_NaN())));
+  }
+
+  void testVecArithmetic()
+  {
+    const Vec3d a{1, 2, 3};
+    const Vec3d b{-4, 0.5, 2};
+    CHECK((a + b == Vec3d{-3, 2.5, 5}));
+    CHECK((a - b == Vec3d{5, 1.5, 1}));
+    CHECK((-a == Vec3d{-1, -2, -3}));
+    CHECK((a * 2.0 == Vec3d{2, 4, 6}));
+    CHECK((2.0 * a == a * 2.0));
+    CHECK((a / 2.0 == Vec3d{0.5, 1, 1.5}));
+    CHECK(dot(a, b) == 3.0);
+    CHECK(magnitudeSquared(a) == 14.0);
+    CHECK(near(magnitude(a), std::sqrt(14.0)));
+    CHECK(distance(Vec3d{1, 1, 1}, Vec3d{4, 5, 1}) == 5.0);
+    CHECK(distanceSquared(Vec3d{1, 1, 1}, Vec3d{4, 5, 1}) == 25.0);
+  }
+
+  void testCross()
+  {
+    const Vec3d x{1, 0, 0}, y{0, 1, 0}, z{0, 0, 1};
+    CHECK((cross(x, y) == z));
+    CHECK((cross(y, z) == x));
+    CHECK((cross(z, x) == y));
+    CHECK((cross(y, x) == -z));
+    CHECK((cross(x, x) == Vec3d{}));
+
+    const Vec3d a{1, 2, 3}, b{-4, 0.5, 2};
+    const Vec3d c = cross(a, b);
+    CHECK(near(dot(c, a), 0.0));
+    CHECK(near(dot(c, b), 0.0));
+    CHECK((c == Vec3d{2.5, -14, 8.5}));
+  }
+
+  void testNormalize()
+  {
+    const Vec3d unit = normalize(Vec3d{3, -4, 12});
+    CHECK(near(magnitude(unit), 1.0));
+    CHECK(approxEqual(unit, Vec3d{3.0 / 13, -4.0 / 13, 12.0 / 13}));
+
+    // Within tolerance of zero length: the zero vector rather than NaNs.
+    CHECK((normalize(Vec3d{}) == Vec3d{}));
+    CHECK((normalize(Vec3d{1e-11, 0, 0}) == Vec3d{}));
+    CHECK((normalize(Vec3f{1e-6f, 0, 0}) == Vec3f{}));
+
+    CHECK(angle(Vec3d{}, Vec3d{1, 0, 0}) == 0.0);
+    CHECK(near(angle(Vec3d{1, 0, 0}, Vec3d{0, 2, 0}), std::acos(0.0)));
+  }
+
+  void testPlaneFromPointNormal()
+  {
+    const auto plane = Planed::fromPointNormal({1, 2, 3}, {0, 0, 2});
+    CHECK(plane.has_value());
+    CHECK((plane->normal() == Vec3d{0, 0, 1}));
+    CHECK((plane->point() == Vec3d{1, 2, 3}));
+    CHECK(plane->d() == -3.0);
+    CHECK(plane->distanceTo({5, -7, 10}) == 7.0);
+    CHECK(plane->distanceTo({0, 0, 0}) == -3.0);
+    CHECK(plane->contains({-8, 4, 3}));
+    CHECK(!plane->contains({-8, 4, 3.001}));
+    CHECK(plane->contains({-8, 4, 3.001}, 0.01));
+    CHECK((plane->project({4, 5, 6}) == Vec3d{4, 5, 3}));
+
+    const auto sloped = Planed::fromPointNormal({0, 0, 0}, {1, 1, 1});
+    CHECK(sloped.has_value());
+    CHECK(near(magnitude(sloped->normal()), 1.0));
+    CHECK(near(sloped->distanceTo({1, 1, 1}), std::sqrt(3.0)));
+  }
+
+  void testPlaneFromPoints()
+  {
+    const auto plane = Planed::fromPoints({0, 0, 1}, {1, 0, 1}, {0, 1, 1});
+    CHECK(plane.has_value());
+    CHECK(approxEqual(plane->normal(), Vec3d{0, 0, 1}));
+    CHECK(near(plane->d(), -1.0));
+
+    // Reversed winding flips the normal but describes the same plane.
+    const auto reversed = Planed::fromPoints({0, 0, 1}, {0, 1, 1}, {1, 0, 1});
+    CHECK(reversed.has_value());
+    CHECK(approxEqual(reversed->normal(), Vec3d{0, 0, -1}));
+    CHECK(plane->approxEquals(*reversed));
+
+    const auto fromCoefficients = Planed::fromCoefficients(0, 0, 2, -2);
+    CHECK(fromCoefficients.has_value());
+    CHECK(plane->approxEquals(*fromCoefficients));
+  }
+
+  void testDegenerateInput()
+  {
+    CHECK(!Planed::fromPointNormal({1, 2, 3}, {0, 0, 0}).has_value());
+    CHECK(!Planed::fromPointNormal({1, 2, 3}, {1e-11, 0, 0}).has_value());
+    CHECK(!Planed::fromPoints({0, 0, 0}, {1, 2, 3}, {2, 4, 6}).has_value());
+    CHECK(!Planed::fromPoints({1, 1, 1}, {1, 1, 1}, {5, 0, 0}).has_value());
+    CHECK(!Planed::fromCoefficients(0, 0, 0, 1).has_value());
+
+    const Planed plane = *Planed::fromPointNormal({0, 0, 0}, {0, 0, 1});
+    CHECK(!plane.intersectSegment({0, 0, 1}, {0, 0, 1}).has_value());
+    CHECK(!plane.intersectSegment({0, 0, 1}, {5, 0, 1}).has_value());
+    CHECK(!plane.intersectSegment({0, 0, 1}, {0, 0, 2}).has_value());
+    CHECK(!plane.intersect(*Planed::fromPointNormal({0, 0, 5}, {0, 0, -1})).has_value());
+
+    const auto hit = plane.intersectSegment({1, 2, -1}, {1, 2, 3});
+    CHECK(hit.has_value());
+    CHECK(approxEqual(*hit, Vec3d{1, 2, 0}));
+
+    const auto line = plane.intersect(*Planed::fromPointNormal({0, 0, 0}, {1, 0, 0}));
+    CHECK(line.has_value());
+    CHECK(approxEqual(line->direction, Vec3d{0, -1, 0}) || approxEqual(line->direction, Vec3d{0, 1, 0}));
+    CHECK(plane.contains(line->point));
+  }
+
+  void testTolerancePolicies()
+  {
+    using Absolute = AbsoluteTolerance<double>;
+    using Relative = RelativeTolerance<double>;
+    static_assert(TolerancePolicy<Absolute, double>);
+    static_assert(TolerancePolicy<Relative, double>);
+    static_assert(std::is_same_v<DefaultTolerance<double>, Absolute>);
+    CHECK(Absolute::epsilon == 1e-10);
+    CHECK(AbsoluteTolerance<float>::epsilon == 1e-5f);
+
+    CHECK(Absolute::isZero(0.0));
+    CHECK(Absolute::isZero(-5e-11));
+    CHECK(!Absolute::isZero(1e-10));
+    CHECK(Absolute::equal(1.0, 1.0 + 5e-11));
+    CHECK(!Absolute::equal(1.0, 1.0 + 2e-10));
+
+    // Far from the origin the absolute tolerance is below the spacing of doubles; the relative one scales.
+    CHECK(!Absolute::equal(1e8, 1e8 + 1e-6));
+    CHECK(Relative::equal(1e8, 1e8 + 1e-6));
+    CHECK(!Relative::equal(1e8, 1e8 + 1e-1));
+    CHECK(Relative::equal(0.5, 0.5 + 5e-11));
+    CHECK(!Relative::equal(0.5, 0.5 + 2e-10));
+    CHECK(Relative::isZero(5e-11));
+
+    CHECK((approxEqual<double, Relative>(Vec3d{1e8, 0, 0}, Vec3d{1e8 + 1e-6, 0, 0})));
+    CHECK((!approxEqual(Vec3d{1e8, 0, 0}, Vec3d{1e8 + 1e-6, 0, 0})));
+  }
+}
+
+int main()
+{
+  testSqrtAtRunTime();
+  testVecArithmetic();
+  testCross();
+  testNormalize();
+  testPlaneFromPointNormal();
+  testPlaneFromPoints();
+  testDegenerateInput();
+  testTolerancePolicies();
+
+  if (failures != 0)
+  {
+    std::fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  std::printf("All core checks passed\n");
+  return 0;
+}
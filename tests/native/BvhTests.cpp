@@ -0,0 +1,341 @@
+// Checks for the bounding-volume hierarchy behind ElementBoundsTree (csharp_bridge/native/Bvh): every query is compared
+// with a brute-force scan over the same boxes, for serial builds and for parallel builds forced onto several threads,
+// so the subtree splicing and the parallel binning run even on a single-core machine.
+#include "Check.h"
+
+#include <native/Bvh.h>
+#include <native/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge::Native;
+  using CwAPI3D::Net::Bridge::Core::Planed;
+  using CwAPI3D::Net::Bridge::Core::Vec3d;
+
+  constexpr double Infinity = std::numeric_limits<double>::infinity();
+  /// Slack for comparing distances the tree and the scan compute with differently ordered arithmetic.
+  constexpr double DistanceTolerance = 1e-9;
+
+  double component(const Vec3d& v, int axis)
+  {
+    return axis == 0 ? v.x : axis == 1 ? v.y : v.z;
+  }
+
+  Aabb normalized(const Aabb& box)
+  {
+    return Aabb{{std::min(box.min.x, box.max.x), std::min(box.min.y, box.max.y), std::min(box.min.z, box.max.z)},
+      {std::max(box.min.x, box.max.x), std::max(box.min.y, box.max.y), std::max(box.min.z, box.max.z)}};
+  }
+
+  /// The boxes a tree was built from, scanned one by one.
+  struct Scene
+  {
+    std::vector<std::int32_t> ids;
+    std::vector<Aabb> boxes;
+
+    Bvh build(bool parallel) const { return Bvh::build(ids.data(), boxes.data(), ids.size(), parallel); }
+
+    std::vector<std::int32_t> queryBox(const Aabb& query) const
+    {
+      std::vector<std::int32_t> out;
+      for (std::size_t i = 0; i < boxes.size(); ++i)
+      {
+        const Aabb box = normalized(boxes[i]);
+        if (box.min.x <= query.max.x && query.min.x <= box.max.x && box.min.y <= query.max.y &&
+            query.min.y <= box.max.y && box.min.z <= query.max.z && query.min.z <= box.max.z)
+          out.push_back(ids[i]);
+      }
+      return out;
+    }
+
+    std::vector<std::int32_t> queryHalfSpace(const Planed& plane, Bvh::HalfSpaceMode mode) const
+    {
+      std::vector<std::int32_t> out;
+      for (std::size_t i = 0; i < boxes.size(); ++i)
+      {
+        const Aabb box = normalized(boxes[i]);
+        double low = Infinity;
+        double high = -Infinity;
+        for (int corner = 0; corner < 8; ++corner)
+        {
+          const Vec3d p{(corner & 1) ? box.max.x : box.min.x, (corner & 2) ? box.max.y : box.min.y,
+            (corner & 4) ? box.max.z : box.min.z};
+          const double distance = plane.distanceTo(p);
+          low = std::min(low, distance);
+          high = std::max(high, distance);
+        }
+        const bool accepted = mode == Bvh::HalfSpaceMode::Overlapping ? high >= 0.0
+                              : mode == Bvh::HalfSpaceMode::Inside    ? low >= 0.0
+                                                                      : low <= 0.0 && high >= 0.0;
+        if (accepted)
+          out.push_back(ids[i]);
+      }
+      return out;
+    }
+
+    double distanceTo(std::size_t i, const Vec3d& point) const
+    {
+      const Aabb box = normalized(boxes[i]);
+      double sum = 0.0;
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        const double p = component(point, axis);
+        const double d = std::max({component(box.min, axis) - p, 0.0, p - component(box.max, axis)});
+        sum += d * d;
+      }
+      return std::sqrt(sum);
+    }
+
+    /// Where the ray enters box i (0 from inside), or infinity when it misses the box within maxDistance.
+    double entryOf(std::size_t i, const Vec3d& origin, const Vec3d& direction, double maxDistance) const
+    {
+      const Aabb box = normalized(boxes[i]);
+      double near = 0.0;
+      double far = maxDistance;
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        const double o = component(origin, axis);
+        const double d = component(direction, axis);
+        const double low = component(box.min, axis);
+        const double high = component(box.max, axis);
+        if (d == 0.0)
+        {
+          if (o < low || o > high)
+            return Infinity;
+          continue;
+        }
+        const double t1 = (low - o) / d;
+        const double t2 = (high - o) / d;
+        near = std::max(near, std::min(t1, t2));
+        far = std::min(far, std::max(t1, t2));
+        if (near > far)
+          return Infinity;
+      }
+      return near;
+    }
+
+    std::size_t indexOf(std::int32_t id) const
+    {
+      return static_cast<std::size_t>(std::find(ids.begin(), ids.end(), id) - ids.begin());
+    }
+  };
+
+  std::vector<std::int32_t> sorted(std::vector<std::int32_t> ids)
+  {
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  double uniform(std::mt19937& random, double low, double high)
+  {
+    return std::uniform_real_distribution<double>(low, high)(random);
+  }
+
+  Vec3d randomPoint(std::mt19937& random, double low, double high)
+  {
+    return Vec3d{uniform(random, low, high), uniform(random, low, high), uniform(random, low, high)};
+  }
+
+  Vec3d randomDirection(std::mt19937& random)
+  {
+    // Every fourth ray runs along an axis, which the tree tests by containment rather than by division.
+    if (std::uniform_int_distribution<int>(0, 3)(random) == 0)
+    {
+      const double sign = std::uniform_int_distribution<int>(0, 1)(random) == 0 ? -1.0 : 1.0;
+      const int axis = std::uniform_int_distribution<int>(0, 2)(random);
+      return Vec3d{axis == 0 ? sign : 0.0, axis == 1 ? sign : 0.0, axis == 2 ? sign : 0.0};
+    }
+    Vec3d direction;
+    double length = 0.0;
+    while (length < 1e-3)
+    {
+      direction = randomPoint(random, -1.0, 1.0);
+      length = std::sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
+    }
+    return direction * (1.0 / length);
+  }
+
+  /// Small boxes in a 100-unit cube, some of them points, some given max corner first, some repeated, plus a few
+  /// large ones that overlap most of the scene.
+  Scene randomScene(std::mt19937& random, std::size_t count)
+  {
+    Scene scene;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      Aabb box;
+      const int shape = std::uniform_int_distribution<int>(0, 99)(random);
+      if (shape < 5 && !scene.boxes.empty())
+        box = scene.boxes[std::uniform_int_distribution<std::size_t>(0, scene.boxes.size() - 1)(random)];
+      else if (shape < 10)
+        box.min = box.max = randomPoint(random, 0.0, 100.0);
+      else
+      {
+        const double extent = shape < 11 ? 60.0 : 4.0;
+        box.min = randomPoint(random, 0.0, 100.0);
+        box.max = box.min + randomPoint(random, 0.0, extent);
+        if (shape < 30)
+          std::swap(box.min, box.max);
+      }
+      scene.ids.push_back(static_cast<std::int32_t>(i * 3 + 1));
+      scene.boxes.push_back(box);
+    }
+    return scene;
+  }
+
+  void checkQueries(const Bvh& tree, const Scene& scene, std::mt19937& random)
+  {
+    CHECK(tree.size() == scene.ids.size());
+    for (int query = 0; query < 60; ++query)
+    {
+      Aabb box{randomPoint(random, -10.0, 110.0), {}};
+      box.max = box.min + randomPoint(random, 0.0, 15.0);
+      std::vector<std::int32_t> found;
+      tree.queryBox(box, found);
+      CHECK(sorted(found) == sorted(scene.queryBox(box)));
+
+      const auto plane = Planed::fromPointNormal(randomPoint(random, 0.0, 100.0), randomDirection(random));
+      for (const auto mode :
+        {Bvh::HalfSpaceMode::Overlapping, Bvh::HalfSpaceMode::Inside, Bvh::HalfSpaceMode::Straddling})
+      {
+        found.clear();
+        tree.queryHalfSpace(*plane, mode, found);
+        CHECK(sorted(found) == sorted(scene.queryHalfSpace(*plane, mode)));
+      }
+
+      const Vec3d point = randomPoint(random, -20.0, 120.0);
+      const double maxDistance = uniform(random, 0.0, 30.0);
+      double closest = Infinity;
+      for (std::size_t i = 0; i < scene.boxes.size(); ++i)
+        closest = std::min(closest, scene.distanceTo(i, point));
+      std::int32_t id = -1;
+      double distance = -1.0;
+      const bool near = tree.nearest(point, maxDistance, id, distance);
+      if (CHECK(near == (closest <= maxDistance)) && near)
+      {
+        CHECK(std::abs(distance - closest) <= DistanceTolerance);
+        CHECK(std::abs(scene.distanceTo(scene.indexOf(id), point) - closest) <= DistanceTolerance);
+      }
+
+      const Vec3d origin = randomPoint(random, -20.0, 120.0);
+      const Vec3d direction = randomDirection(random);
+      const double length = uniform(random, 0.0, 200.0);
+      std::vector<std::int32_t> expected;
+      double first = Infinity;
+      for (std::size_t i = 0; i < scene.boxes.size(); ++i)
+      {
+        const double entry = scene.entryOf(i, origin, direction, length);
+        if (entry != Infinity)
+          expected.push_back(scene.ids[i]);
+        first = std::min(first, entry);
+      }
+      Bvh::RayHit hit{-1, -1.0};
+      const bool hits = tree.rayCast(origin, direction, length, hit);
+      if (CHECK(hits == (first != Infinity)) && hits)
+      {
+        CHECK(std::abs(hit.distance - first) <= DistanceTolerance);
+        CHECK(std::abs(scene.entryOf(scene.indexOf(hit.id), origin, direction, length) - first) <= DistanceTolerance);
+      }
+
+      std::vector<Bvh::RayHit> hitsAll{Bvh::RayHit{-7, 0.0}};
+      tree.rayCastAll(origin, direction, length, hitsAll);
+      CHECK(hitsAll.front().id == -7);
+      found.clear();
+      for (std::size_t h = 1; h < hitsAll.size(); ++h)
+      {
+        found.push_back(hitsAll[h].id);
+        CHECK(h == 1 || hitsAll[h - 1].distance <= hitsAll[h].distance);
+        const double entry = scene.entryOf(scene.indexOf(hitsAll[h].id), origin, direction, length);
+        CHECK(std::abs(hitsAll[h].distance - entry) <= DistanceTolerance);
+      }
+      CHECK(sorted(found) == sorted(expected));
+    }
+  }
+
+  void testEmptyTree()
+  {
+    const Bvh tree = Bvh::build(nullptr, nullptr, 0, false);
+    std::vector<std::int32_t> found;
+    tree.queryBox(Aabb{{-Infinity, -Infinity, -Infinity}, {Infinity, Infinity, Infinity}}, found);
+    CHECK(found.empty());
+    std::int32_t id = 0;
+    double distance = 0.0;
+    CHECK(!tree.nearest(Vec3d{}, Infinity, id, distance));
+    Bvh::RayHit hit{};
+    CHECK(!tree.rayCast(Vec3d{}, Vec3d{1, 0, 0}, Infinity, hit));
+  }
+
+  // Rays starting on a face or running along one, and boxes that only touch the query box.
+  void testBoundaries()
+  {
+    const std::int32_t ids[] = {10, 20, 30};
+    const Aabb boxes[] = {{{0, 0, 0}, {1, 1, 1}}, {{1, 0, 0}, {2, 1, 1}}, {{5, 5, 5}, {5, 5, 5}}};
+    const Bvh tree = Bvh::build(ids, boxes, 3, false);
+
+    std::vector<std::int32_t> found;
+    tree.queryBox(Aabb{{2, 1, 1}, {3, 3, 3}}, found);
+    CHECK(found == (std::vector<std::int32_t>{20}));
+
+    Bvh::RayHit hit{};
+    CHECK(tree.rayCast(Vec3d{0, 0.5, 0.5}, Vec3d{1, 0, 0}, 10.0, hit) && hit.distance == 0.0 && hit.id == 10);
+    CHECK(tree.rayCast(Vec3d{-1, 1, 1}, Vec3d{1, 0, 0}, 10.0, hit) && hit.distance == 1.0 && hit.id == 10);
+    CHECK(!tree.rayCast(Vec3d{-1, 1.5, 0.5}, Vec3d{1, 0, 0}, 10.0, hit));
+    CHECK(!tree.rayCast(Vec3d{-1, 0.5, 0.5}, Vec3d{1, 0, 0}, 0.5, hit));
+
+    std::vector<Bvh::RayHit> hits;
+    tree.rayCastAll(Vec3d{3, 0.5, 0.5}, Vec3d{-1, 0, 0}, 10.0, hits);
+    CHECK(hits.size() == 2 && hits[0].id == 20 && hits[0].distance == 1.0 && hits[1].id == 10 &&
+          hits[1].distance == 2.0);
+
+    std::int32_t id = 0;
+    double distance = 0.0;
+    CHECK(tree.nearest(Vec3d{5, 5, 8}, 3.0, id, distance) && id == 30 && distance == 3.0);
+    CHECK(!tree.nearest(Vec3d{5, 5, 8}, 2.9, id, distance));
+  }
+
+  // Boxes that all share one centroid leave the SAH nothing to split on.
+  void testIdenticalBoxes(std::mt19937& random)
+  {
+    Scene scene;
+    for (std::int32_t i = 0; i < 1000; ++i)
+    {
+      scene.ids.push_back(i);
+      scene.boxes.push_back(Aabb{{40, 40, 40}, {60, 60, 60}});
+    }
+    checkQueries(scene.build(false), scene, random);
+  }
+
+  void testRandomScenes(std::mt19937& random)
+  {
+    // 20000 boxes split into subtrees built on the worker threads; 70000 also bin their top nodes in parallel.
+    for (const std::size_t count : {1, 2, 9, 300, 5000, 20000, 70000})
+    {
+      const Scene scene = randomScene(random, count);
+      checkQueries(scene.build(false), scene, random);
+      for (const std::size_t threads : {std::size_t{2}, std::size_t{5}})
+      {
+        setParallelThreads(threads);
+        const Bvh tree = scene.build(true);
+        setParallelThreads(0);
+        checkQueries(tree, scene, random);
+      }
+    }
+  }
+}
+
+int main()
+{
+  std::mt19937 random(1234);
+  testEmptyTree();
+  testBoundaries();
+  testIdenticalBoxes(random);
+  testRandomScenes(random);
+  return CwAPI3D::Net::Bridge::Tests::checkFailures() == 0 ? 0 : 1;
+}
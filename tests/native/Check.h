@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdio>
+
+// The CHECK macro of the native test suites: a failed check prints its file, line and expression and is counted,
+// and main returns checkFailures() so the process exits non-zero when any check failed, which is all CTest needs.
+namespace CwAPI3D::Net::Bridge::Tests
+{
+  inline int& checkFailures()
+  {
+    static int failures = 0;
+    return failures;
+  }
+
+  inline bool check(bool condition, const char* expression, const char* file, int line)
+  {
+    if (condition)
+      return true;
+    std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+    ++checkFailures();
+    return false;
+  }
+}
+
+#define CHECK(condition) ::CwAPI3D::Net::Bridge::Tests::check((condition), #condition, __FILE__, __LINE__)
@@ -0,0 +1,283 @@
+// Checks for the command queue behind CommandBatch (csharp_bridge/native/CommandQueue): random command sequences are
+// replayed against a reference model of the element controller before and after coalesce(), which must leave the
+// same elements at the same positions in the same join groups with fewer or equally many calls.
+#include "Check.h"
+
+#include <native/CommandQueue.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge::Native;
+  using CwAPI3D::Net::Bridge::Core::Vec3d;
+
+  /// What the element controller does with the commands of a flush. Moves, deletes and joins take sets of IDs;
+  /// deleted IDs stay deleted and are skipped; a copy creates one new element per live source ID, with the next free
+  /// ID; a join connects the live elements it names, and joins of one kind are transitive.
+  class Model
+  {
+  public:
+    explicit Model(std::int32_t elements)
+    {
+      for (std::int32_t id = 0; id < elements; ++id)
+        add(Vec3d{static_cast<double>(id), 0.0, 0.0});
+    }
+
+    void run(const CommandQueue& queue)
+    {
+      for (const Command& command : queue.commands())
+        apply(command.kind, queue.ids(command), command.count, command.vector);
+    }
+
+    /// Whether both models hold the same live elements at the same positions, joined in the same groups.
+    bool sameAs(const Model& other) const
+    {
+      if (m_alive != other.m_alive || m_positions.size() != other.m_positions.size())
+        return false;
+      for (std::size_t id = 0; id < m_positions.size(); ++id)
+      {
+        if (!m_alive[id])
+          continue;
+        if (!(m_positions[id] == other.m_positions[id]))
+          return false;
+        for (std::size_t next = id + 1; next < m_positions.size(); ++next)
+        {
+          if (!m_alive[next])
+            continue;
+          for (int kind = 0; kind < 2; ++kind)
+          {
+            if (joined(kind, id, next) != other.joined(kind, id, next))
+              return false;
+          }
+        }
+      }
+      return true;
+    }
+
+  private:
+    void add(const Vec3d& position)
+    {
+      m_positions.push_back(position);
+      m_alive.push_back(true);
+      for (auto& groups : m_groups)
+        groups.push_back(groups.size());
+    }
+
+    std::size_t root(int kind, std::size_t id) const
+    {
+      while (m_groups[kind][id] != id)
+        id = m_groups[kind][id];
+      return id;
+    }
+
+    bool joined(int kind, std::size_t a, std::size_t b) const { return root(kind, a) == root(kind, b); }
+
+    bool live(std::int32_t id) const { return static_cast<std::size_t>(id) < m_alive.size() && m_alive[id]; }
+
+    void apply(CommandKind kind, const std::int32_t* ids, std::uint32_t count, const Vec3d& vector)
+    {
+      switch (kind)
+      {
+      case CommandKind::Move:
+      {
+        // A move takes a set: an ID listed twice still moves once.
+        std::vector<bool> moved(m_alive.size(), false);
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+          if (live(ids[i]) && !moved[ids[i]])
+          {
+            moved[ids[i]] = true;
+            m_positions[ids[i]] = m_positions[ids[i]] + vector;
+          }
+        }
+        break;
+      }
+      case CommandKind::Copy:
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+          if (live(ids[i]))
+            add(m_positions[ids[i]]);
+        }
+        break;
+      case CommandKind::Delete:
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+          if (live(ids[i]))
+            m_alive[ids[i]] = false;
+        }
+        break;
+      case CommandKind::Join:
+      case CommandKind::JoinTopLevel:
+      {
+        const int group = kind == CommandKind::Join ? 0 : 1;
+        std::int32_t first = -1;
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+          if (!live(ids[i]))
+            continue;
+          if (first < 0)
+            first = ids[i];
+          else
+            m_groups[group][root(group, ids[i])] = root(group, first);
+        }
+        break;
+      }
+      }
+    }
+
+    std::vector<Vec3d> m_positions;
+    std::vector<bool> m_alive;
+    std::vector<std::size_t> m_groups[2];
+  };
+
+  bool coalescesLikeRecorded(CommandQueue& queue, std::int32_t elements)
+  {
+    Model recorded(elements);
+    recorded.run(queue);
+    const std::size_t before = queue.size();
+
+    queue.coalesce();
+    Model coalesced(elements);
+    coalesced.run(queue);
+    return CHECK(queue.size() <= before) && CHECK(recorded.sameAs(coalesced));
+  }
+
+  void record(CommandQueue& queue, CommandKind kind, std::vector<std::int32_t> ids, Vec3d vector = {})
+  {
+    CHECK(queue.record(kind, ids.data(), static_cast<std::uint32_t>(ids.size()), vector));
+  }
+
+  std::vector<std::int32_t> idsOf(const CommandQueue& queue, const Command& command)
+  {
+    return std::vector<std::int32_t>(queue.ids(command), queue.ids(command) + command.count);
+  }
+
+  void testRejectsNegativeIds()
+  {
+    CommandQueue queue;
+    const std::int32_t ids[] = {1, -2};
+    CHECK(!queue.record(CommandKind::Delete, ids, 2));
+    CHECK(queue.empty());
+  }
+
+  void testMergesMovesOfTheSameSet()
+  {
+    CommandQueue queue;
+    record(queue, CommandKind::Move, {2, 1, 2}, Vec3d{1, 0, 0});
+    record(queue, CommandKind::Move, {1, 2}, Vec3d{0, 2, 0});
+    record(queue, CommandKind::Move, {3}, Vec3d{});
+    queue.coalesce();
+
+    CHECK(queue.size() == 1);
+    CHECK(queue.commands()[0].vector == (Vec3d{1, 2, 0}));
+    CHECK(idsOf(queue, queue.commands()[0]) == (std::vector<std::int32_t>{1, 2}));
+  }
+
+  void testDropsMovesOfDeletedIdsUnlessCopied()
+  {
+    CommandQueue queue;
+    record(queue, CommandKind::Move, {1, 2, 3}, Vec3d{1, 0, 0});
+    record(queue, CommandKind::Copy, {2});
+    record(queue, CommandKind::Delete, {1, 2});
+    queue.coalesce();
+
+    CHECK(queue.size() == 3);
+    CHECK(idsOf(queue, queue.commands()[0]) == (std::vector<std::int32_t>{2, 3}));
+    CHECK(coalescesLikeRecorded(queue, 4));
+  }
+
+  void testKeepsCopiesInOrder()
+  {
+    CommandQueue queue;
+    record(queue, CommandKind::Copy, {3, 1, 3});
+    record(queue, CommandKind::Copy, {2});
+    queue.coalesce();
+
+    CHECK(queue.size() == 2);
+    CHECK(queue.copyCount() == 2);
+    CHECK(idsOf(queue, queue.commands()[0]) == (std::vector<std::int32_t>{3, 1, 3}));
+  }
+
+  void testMergesOverlappingJoins()
+  {
+    CommandQueue queue;
+    record(queue, CommandKind::Join, {1, 2});
+    record(queue, CommandKind::Join, {4, 5});
+    record(queue, CommandKind::Join, {2, 3});
+    record(queue, CommandKind::Delete, {6});
+    record(queue, CommandKind::Delete, {7});
+    queue.coalesce();
+
+    CHECK(queue.size() == 3);
+    CHECK(idsOf(queue, queue.commands()[0]) == (std::vector<std::int32_t>{1, 2, 3}));
+    CHECK(idsOf(queue, queue.commands()[1]) == (std::vector<std::int32_t>{4, 5}));
+    CHECK(idsOf(queue, queue.commands()[2]) == (std::vector<std::int32_t>{6, 7}));
+  }
+
+  // Once the zero move between them is dropped, the joins are back to back; they must not be merged through the
+  // element an earlier delete removed, which would join 3 and 5.
+  void testDoesNotJoinThroughDeletedIds()
+  {
+    CommandQueue queue;
+    record(queue, CommandKind::Delete, {0, 4});
+    record(queue, CommandKind::JoinTopLevel, {3, 0});
+    record(queue, CommandKind::Move, {0}, Vec3d{});
+    record(queue, CommandKind::JoinTopLevel, {0, 5});
+    CHECK(coalescesLikeRecorded(queue, 6));
+
+    for (const Command& command : queue.commands())
+    {
+      if (command.kind == CommandKind::JoinTopLevel)
+        CHECK(idsOf(queue, command) != (std::vector<std::int32_t>{0, 3, 5}));
+    }
+  }
+
+  void testRandomSequences()
+  {
+    constexpr std::int32_t Elements = 8;
+    const Vec3d vectors[] = {Vec3d{}, Vec3d{1, 0, 0}, Vec3d{-1, 0, 0}, Vec3d{0, 2, 0}};
+
+    std::mt19937 random(20240611);
+    std::size_t recordedCalls = 0;
+    std::size_t coalescedCalls = 0;
+    int divergences = 0;
+    for (int sequence = 0; sequence < 20000; ++sequence)
+    {
+      CommandQueue queue;
+      const int length = std::uniform_int_distribution<int>(1, 12)(random);
+      for (int c = 0; c < length; ++c)
+      {
+        const auto kind = static_cast<CommandKind>(std::uniform_int_distribution<int>(0, 4)(random));
+        std::vector<std::int32_t> ids(std::uniform_int_distribution<std::size_t>(1, 4)(random));
+        for (std::int32_t& id : ids)
+          id = std::uniform_int_distribution<std::int32_t>(0, Elements - 1)(random);
+        record(queue, kind, ids, vectors[std::uniform_int_distribution<int>(0, 3)(random)]);
+      }
+
+      recordedCalls += queue.size();
+      if (!coalescesLikeRecorded(queue, Elements) && ++divergences == 1)
+        std::fprintf(stderr, "first divergence in random sequence %d\n", sequence);
+      coalescedCalls += queue.size();
+    }
+    if (divergences != 0)
+      std::fprintf(stderr, "%d of 20000 random sequences diverged\n", divergences);
+    CHECK(divergences == 0);
+    CHECK(coalescedCalls < recordedCalls);
+  }
+}
+
+int main()
+{
+  testRejectsNegativeIds();
+  testMergesMovesOfTheSameSet();
+  testDropsMovesOfDeletedIdsUnlessCopied();
+  testKeepsCopiesInOrder();
+  testMergesOverlappingJoins();
+  testDoesNotJoinThroughDeletedIds();
+  testRandomSequences();
+  return CwAPI3D::Net::Bridge::Tests::checkFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,425 @@
+// Checks for the predicate tree behind ElementFilter (csharp_bridge/native/ElementFilter): fixed cases pin down the
+// grammar, quoting, depth limit and error positions; random expression trees are printed as text, parsed back and
+// compared with a direct evaluation of the tree, both per element and, for filters without fields, as IdSet algebra.
+#include "Check.h"
+
+#include <native/ElementFilter.h>
+#include <native/IdSet.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge::Native;
+  using Query = ElementFilter::Query;
+  using Field = ElementFilter::Field;
+  using Compare = ElementFilter::Compare;
+
+  /// An element as the evaluators see it: its query memberships and attribute values.
+  struct Element
+  {
+    std::uint32_t queries;
+    std::array<std::string, ElementFilter::FieldCount> fields;
+  };
+
+  bool matches(const ElementFilter& filter, const Element& element)
+  {
+    return filter.matches([&element](Query q) { return (element.queries >> static_cast<std::uint32_t>(q) & 1) != 0; },
+      [&element](Field f) { return std::string_view(element.fields[static_cast<std::size_t>(f)]); });
+  }
+
+  ElementFilter parsed(std::string_view expression)
+  {
+    ElementFilter filter;
+    ElementFilter::ParseError error{};
+    if (!CHECK(filter.parse(expression, error)))
+      std::fprintf(stderr, "  '%.*s': %s at %zu\n", static_cast<int>(expression.size()), expression.data(),
+        error.message, error.position);
+    return filter;
+  }
+
+  bool failsAt(std::string_view expression, std::size_t position, const char* message)
+  {
+    ElementFilter filter;
+    ElementFilter::ParseError error{};
+    const bool parsedAnyway = filter.parse(expression, error);
+    return CHECK(!parsedAnyway) && CHECK(error.position == position) && CHECK(std::strcmp(error.message, message) == 0) &&
+           CHECK(filter.empty()) && CHECK(filter.queryMask() == 0) && CHECK(filter.fieldMask() == 0);
+  }
+
+  constexpr std::uint32_t bit(Query query)
+  {
+    return 1u << static_cast<std::uint32_t>(query);
+  }
+
+  void testPrecedenceAndNot()
+  {
+    // AND binds tighter than OR, NOT tighter than AND.
+    const ElementFilter filter = parsed("visible OR active AND NOT invisible");
+    const std::uint32_t v = bit(Query::Visible), a = bit(Query::Active), i = bit(Query::Invisible);
+    CHECK(matches(filter, Element{v | i, {}}));
+    CHECK(matches(filter, Element{a, {}}));
+    CHECK(!matches(filter, Element{a | i, {}}));
+    CHECK(!matches(filter, Element{0, {}}));
+    CHECK(filter.queryMask() == (v | a | i | bit(Query::AllIdentifiable)));
+    CHECK(filter.requiredQueries() == 0);
+
+    const ElementFilter grouped = parsed("(visible OR active) AND NOT NOT invisible");
+    CHECK(!matches(grouped, Element{v, {}}));
+    CHECK(matches(grouped, Element{a | i, {}}));
+
+    // Keywords, queries and fields ignore case; any whitespace separates them.
+    const ElementFilter cased = parsed("\tVISIBLE\r\nand Not\tInActive and NAME ContainS 'x'  ");
+    CHECK(matches(cased, Element{v, {"axb"}}));
+    CHECK(!matches(cased, Element{v | bit(Query::InactiveAll), {"x"}}));
+    CHECK(!matches(cased, Element{v, {"y"}}));
+    CHECK(cased.fieldMask() == 1u << static_cast<std::uint32_t>(Field::Name));
+
+    // Words only match whole: "notvisible" is neither NOT nor a query.
+    CHECK(failsAt("notvisible", 0, "Expected a query, an attribute, NOT or '('."));
+  }
+
+  void testComparisonsAndQuoting()
+  {
+    const auto name = [](const char* value) { return Element{0, {value}}; };
+    CHECK(matches(parsed("name == 'O''Brien'"), name("O'Brien")));
+    CHECK(matches(parsed("name == \"say \"\"hi\"\"\""), name("say \"hi\"")));
+    CHECK(matches(parsed("name == \"it's\""), name("it's")));
+    CHECK(matches(parsed("name == ''"), name("")));
+    CHECK(!matches(parsed("name == ''"), name(" ")));
+    CHECK(matches(parsed("name == 'a AND b'"), name("a AND b")));
+    CHECK(matches(parsed("name != 'Rafter'"), name("Post")));
+    CHECK(!matches(parsed("name != 'Rafter'"), name("Rafter")));
+    CHECK(matches(parsed("name CONTAINS 'aft'"), name("Rafter")));
+    CHECK(matches(parsed("name STARTSWITH 'Raf'"), name("Rafter")));
+    CHECK(!matches(parsed("name STARTSWITH 'aft'"), name("Rafter")));
+    CHECK(!matches(parsed("name STARTSWITH 'Rafters'"), name("Rafter")));
+    // Comparisons are case-sensitive, unlike the keywords.
+    CHECK(!matches(parsed("name == 'rafter'"), name("Rafter")));
+
+    const ElementFilter material = parsed("material == 'C24' AND comment CONTAINS 'x'");
+    Element element{0, {}};
+    element.fields[static_cast<std::size_t>(Field::Material)] = "C24";
+    element.fields[static_cast<std::size_t>(Field::Comment)] = "box";
+    CHECK(matches(material, element));
+    CHECK(material.fieldMask() ==
+          (1u << static_cast<std::uint32_t>(Field::Material) | 1u << static_cast<std::uint32_t>(Field::Comment)));
+    CHECK(material.queryMask() == 0);
+  }
+
+  void testErrors()
+  {
+    CHECK(failsAt("", 0, "Expected a query, an attribute, NOT or '('."));
+    CHECK(failsAt("visible AND", 11, "Expected a query, an attribute, NOT or '('."));
+    CHECK(failsAt("NOT", 3, "Expected a query, an attribute, NOT or '('."));
+    CHECK(failsAt("visible active", 8, "Expected AND, OR or the end of the expression."));
+    CHECK(failsAt("visible )", 8, "Expected AND, OR or the end of the expression."));
+    CHECK(failsAt("(visible", 8, "Expected ')'."));
+    CHECK(failsAt("name = 'x'", 5, "Expected ==, !=, CONTAINS or STARTSWITH."));
+    CHECK(failsAt("name == x", 8, "Expected a quoted string."));
+    CHECK(failsAt("name ==", 7, "Expected a quoted string."));
+    CHECK(failsAt("active AND name == 'abc", 19, "The string is not terminated."));
+    CHECK(failsAt("name == 'it''", 8, "The string is not terminated."));
+    CHECK(failsAt("color == 'red'", 0, "Expected a query, an attribute, NOT or '('."));
+
+    // A failed parse clears what an earlier parse left.
+    ElementFilter filter = parsed("visible AND name == 'x'");
+    ElementFilter::ParseError error{};
+    CHECK(!filter.parse("visible AND (", error));
+    CHECK(filter.empty() && filter.queryMask() == 0 && filter.fieldMask() == 0 && filter.requiredQueries() == 0);
+  }
+
+  void testMaxDepth()
+  {
+    constexpr std::size_t MaxDepth = 64;
+    const auto nested = [](std::size_t depth) {
+      return std::string(depth, '(') + "visible" + std::string(depth, ')');
+    };
+    CHECK(matches(parsed(nested(MaxDepth - 1)), Element{bit(Query::Visible), {}}));
+    CHECK(failsAt(nested(MaxDepth), MaxDepth, "The expression is nested too deeply."));
+
+    std::string nots;
+    for (std::size_t i = 0; i < MaxDepth - 1; ++i)
+      nots += "NOT ";
+    CHECK(!matches(parsed(nots + "visible"), Element{bit(Query::Visible), {}}));
+    CHECK(failsAt(nots + "NOT visible", 4 * MaxDepth - 1, "The expression is nested too deeply."));
+  }
+
+  void testRequiredQueries()
+  {
+    CHECK(parsed("visible").requiredQueries() == bit(Query::Visible));
+    CHECK(parsed("NOT visible").requiredQueries() == 0);
+    CHECK(parsed("visible OR active").requiredQueries() == 0);
+    CHECK(parsed("name == 'x' AND visible AND (active OR invisible) AND inactivevisible").requiredQueries() ==
+          (bit(Query::Visible) | bit(Query::InactiveVisible)));
+    CHECK(parsed("(visible AND active)").requiredQueries() == (bit(Query::Visible) | bit(Query::Active)));
+    CHECK(ElementFilter().requiredQueries() == 0);
+  }
+
+  /// A random expression, evaluated directly and printed with random case, spacing and redundant parentheses.
+  struct Expr
+  {
+    enum class Kind
+    {
+      And,
+      Or,
+      Not,
+      Query,
+      Field
+    } kind;
+    std::uint32_t operand = 0;
+    Compare compare = Compare::Equals;
+    std::string text;
+    std::vector<std::unique_ptr<Expr>> children;
+
+    bool evaluate(const Element& element) const
+    {
+      switch (kind)
+      {
+      case Kind::And:
+        for (const auto& child : children)
+        {
+          if (!child->evaluate(element))
+            return false;
+        }
+        return true;
+      case Kind::Or:
+        for (const auto& child : children)
+        {
+          if (child->evaluate(element))
+            return true;
+        }
+        return false;
+      case Kind::Not:
+        return !children[0]->evaluate(element);
+      case Kind::Query:
+        return (element.queries >> operand & 1) != 0;
+      default:
+      {
+        const std::string& value = element.fields[operand];
+        switch (compare)
+        {
+        case Compare::Equals:
+          return value == text;
+        case Compare::NotEquals:
+          return value != text;
+        case Compare::Contains:
+          return value.find(text) != std::string::npos;
+        default:
+          return value.rfind(text, 0) == 0;
+        }
+      }
+      }
+    }
+  };
+
+  const char* const QueryNames[] = {"all", "visible", "invisible", "active", "inactive", "inactivevisible"};
+  const char* const FieldNames[] = {"name", "group", "subgroup", "comment", "material"};
+  const char* const CompareNames[] = {"==", "!=", "contains", "startswith"};
+  /// Field values and operands; small enough that comparisons often succeed.
+  const char* const Texts[] = {"", "a", "ab", "ba", "a'b", "x\"y", "a b"};
+
+  class Generator
+  {
+  public:
+    Generator(std::mt19937& random, bool fields) : m_random(random), m_fields(fields) {}
+
+    std::unique_ptr<Expr> expr(int depth)
+    {
+      auto node = std::make_unique<Expr>();
+      const int choice = depth >= 4 ? 3 + pick(2) : pick(6);
+      if (choice < 2)
+      {
+        node->kind = choice == 0 ? Expr::Kind::And : Expr::Kind::Or;
+        for (int i = 0, count = 2 + pick(3); i < count; ++i)
+          node->children.push_back(expr(depth + 1));
+      }
+      else if (choice == 2)
+      {
+        node->kind = Expr::Kind::Not;
+        node->children.push_back(expr(depth + 1));
+      }
+      else if (!m_fields || choice != 4)
+      {
+        node->kind = Expr::Kind::Query;
+        node->operand = static_cast<std::uint32_t>(pick(ElementFilter::QueryCount));
+      }
+      else
+      {
+        node->kind = Expr::Kind::Field;
+        node->operand = static_cast<std::uint32_t>(pick(ElementFilter::FieldCount));
+        node->compare = static_cast<Compare>(pick(4));
+        node->text = Texts[pick(std::size(Texts))];
+      }
+      return node;
+    }
+
+    /// Prints `node`; operands of AND and OR are only parenthesized when precedence requires it or by chance.
+    std::string print(const Expr& node)
+    {
+      switch (node.kind)
+      {
+      case Expr::Kind::And:
+      case Expr::Kind::Or:
+      {
+        std::string out;
+        for (std::size_t i = 0; i < node.children.size(); ++i)
+        {
+          if (i > 0)
+            out += space() + keyword(node.kind == Expr::Kind::And ? "and" : "or") + space();
+          const Expr& child = *node.children[i];
+          const bool needed = node.kind == Expr::Kind::And && child.kind == Expr::Kind::Or;
+          out += needed || (isList(child) && pick(2) == 0) ? group(print(child)) : print(child);
+        }
+        return out;
+      }
+      case Expr::Kind::Not:
+      {
+        const Expr& child = *node.children[0];
+        return keyword("not") + space() + (isList(child) ? group(print(child)) : print(child));
+      }
+      case Expr::Kind::Query:
+        return pick(4) == 0 ? group(keyword(QueryNames[node.operand])) : keyword(QueryNames[node.operand]);
+      default:
+        return keyword(FieldNames[node.operand]) + space() + keyword(CompareNames[static_cast<int>(node.compare)]) +
+               space() + quoted(node.text);
+      }
+    }
+
+  private:
+    int pick(std::size_t n) { return std::uniform_int_distribution<int>(0, static_cast<int>(n) - 1)(m_random); }
+
+    static bool isList(const Expr& node) { return node.kind == Expr::Kind::And || node.kind == Expr::Kind::Or; }
+
+    std::string space()
+    {
+      const char* const spaces[] = {" ", "  ", "\t", "\n "};
+      return spaces[pick(std::size(spaces))];
+    }
+
+    std::string group(const std::string& inner)
+    {
+      std::string out(1, '(');
+      out += pick(2) == 0 ? inner : space() + inner + space();
+      return out += ')';
+    }
+
+    std::string keyword(std::string word)
+    {
+      for (char& c : word)
+      {
+        if (c >= 'a' && c <= 'z' && pick(3) == 0)
+          c = static_cast<char>(c - 'a' + 'A');
+      }
+      return word;
+    }
+
+    std::string quoted(const std::string& text)
+    {
+      const char quote = pick(2) == 0 ? '\'' : '"';
+      std::string out(1, quote);
+      for (const char c : text)
+      {
+        out += c;
+        if (c == quote)
+          out += c;
+      }
+      return out + quote;
+    }
+
+    std::mt19937& m_random;
+    bool m_fields;
+  };
+
+  std::uint32_t queriesOf(const Expr& node)
+  {
+    std::uint32_t mask = node.kind == Expr::Kind::Query ? 1u << node.operand
+                       : node.kind == Expr::Kind::Not   ? bit(Query::AllIdentifiable)
+                                                        : 0;
+    for (const auto& child : node.children)
+      mask |= queriesOf(*child);
+    return mask;
+  }
+
+  std::uint32_t fieldsOf(const Expr& node)
+  {
+    std::uint32_t mask = node.kind == Expr::Kind::Field ? 1u << node.operand : 0;
+    for (const auto& child : node.children)
+      mask |= fieldsOf(*child);
+    return mask;
+  }
+
+  void testRandomExpressions(std::mt19937& random)
+  {
+    // Every element belongs to AllIdentifiable, which NOT subtracts from.
+    std::vector<Element> elements(256);
+    for (Element& element : elements)
+    {
+      element.queries = std::uniform_int_distribution<std::uint32_t>(0, 63)(random) | bit(Query::AllIdentifiable);
+      for (std::string& value : element.fields)
+        value = Texts[std::uniform_int_distribution<std::size_t>(0, std::size(Texts) - 1)(random)];
+    }
+    std::vector<IdSet> querySets(ElementFilter::QueryCount);
+    for (std::uint32_t id = 0; id < elements.size(); ++id)
+    {
+      for (std::uint32_t q = 0; q < ElementFilter::QueryCount; ++q)
+      {
+        if ((elements[id].queries >> q & 1) != 0)
+          querySets[q].add(id);
+      }
+    }
+
+    int mismatches = 0;
+    for (int round = 0; round < 3000; ++round)
+    {
+      const bool fields = round % 2 == 0;
+      Generator generator(random, fields);
+      const std::unique_ptr<Expr> expr = generator.expr(0);
+      const std::string text = generator.print(*expr);
+      const ElementFilter filter = parsed(text);
+
+      bool same = CHECK(filter.queryMask() == queriesOf(*expr)) && CHECK(filter.fieldMask() == fieldsOf(*expr));
+      IdSet expected;
+      for (std::uint32_t id = 0; id < elements.size() && same; ++id)
+      {
+        const bool match = expr->evaluate(elements[id]);
+        same = CHECK(matches(filter, elements[id]) == match);
+        if (match)
+        {
+          expected.add(id);
+          // Every match belongs to the queries the evaluator narrows the candidates to.
+          same = CHECK((filter.requiredQueries() & ~elements[id].queries) == 0);
+        }
+      }
+      if (same && !fields)
+      {
+        same = CHECK(filter.evaluateSets<IdSet>([&querySets](Query q) -> const IdSet& {
+          return querySets[static_cast<std::size_t>(q)];
+        }) == expected);
+      }
+      if (!same && ++mismatches <= 3)
+        std::fprintf(stderr, "  mismatch for '%s'\n", text.c_str());
+    }
+  }
+}
+
+int main()
+{
+  std::mt19937 random(5);
+  testPrecedenceAndNot();
+  testComparisonsAndQuoting();
+  testErrors();
+  testMaxDepth();
+  testRequiredQueries();
+  testRandomExpressions(random);
+  return CwAPI3D::Net::Bridge::Tests::checkFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,164 @@
+// Checks for the compressed ID set behind ElementIdSet (csharp_bridge/native/IdSet): random sets with sparse (array)
+// and dense (bitmap) groups are compared with std::set through every container conversion and set operation, once
+// per SIMD level the CPU supports.
+#include "Check.h"
+
+#include <native/IdSet.h>
+#include <native/SoaKernels.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge::Native;
+  using Reference = std::set<std::uint32_t>;
+
+  std::vector<std::uint32_t> idsOf(const IdSet& set)
+  {
+    std::vector<std::uint32_t> ids(set.size());
+    set.copyTo(ids.data());
+    return ids;
+  }
+
+  bool matches(const IdSet& set, const Reference& reference)
+  {
+    std::vector<std::uint32_t> visited;
+    set.forEach([&visited](std::uint32_t id) { visited.push_back(id); });
+    const std::vector<std::uint32_t> expected(reference.begin(), reference.end());
+    return set.size() == reference.size() && idsOf(set) == expected && visited == expected;
+  }
+
+  IdSet build(const Reference& reference)
+  {
+    const std::vector<std::uint32_t> ids(reference.begin(), reference.end());
+    IdSet set;
+    set.addMany(ids.data(), ids.size());
+    return set;
+  }
+
+  /// IDs in up to three groups (high halves 0, 1 and 7), each empty, sparse, just above or below the array limit,
+  /// or dense, in random order with duplicates.
+  std::vector<std::uint32_t> randomIds(std::mt19937& random)
+  {
+    const std::size_t sizes[] = {0, 50, IdSet::ArrayLimit - 1, IdSet::ArrayLimit + 1, 40000};
+    std::vector<std::uint32_t> ids;
+    for (const std::uint32_t high : {0u, 1u, 7u})
+    {
+      const std::size_t count = sizes[std::uniform_int_distribution<int>(0, 4)(random)];
+      for (std::size_t i = 0; i < count; ++i)
+        ids.push_back(high << 16 | std::uniform_int_distribution<std::uint32_t>(0, 0xFFFF)(random));
+    }
+    std::shuffle(ids.begin(), ids.end(), random);
+    return ids;
+  }
+
+  void testAddRemoveContains(std::mt19937& random)
+  {
+    IdSet set;
+    Reference reference;
+    // Enough IDs in group 2 to turn it into a bitmap and, while removing, back into an array.
+    for (int step = 0; step < 30000; ++step)
+    {
+      const std::uint32_t id = 2u << 16 | std::uniform_int_distribution<std::uint32_t>(0, 9999)(random);
+      const bool adding = step < 15000 ? step % 4 != 0 : step % 4 == 0;
+      if (adding)
+        CHECK(set.add(id) == reference.insert(id).second);
+      else
+        CHECK(set.remove(id) == (reference.erase(id) == 1));
+      CHECK(set.contains(id) == (reference.count(id) == 1));
+    }
+    CHECK(matches(set, reference));
+    CHECK(set == build(reference));
+    CHECK(!set.contains(3u << 16));
+    CHECK(!set.remove(3u << 16));
+
+    set.clear();
+    CHECK(set.empty());
+  }
+
+  void testAddMany(std::mt19937& random)
+  {
+    for (int round = 0; round < 20; ++round)
+    {
+      const std::vector<std::uint32_t> ids = randomIds(random);
+      const Reference reference(ids.begin(), ids.end());
+      IdSet set;
+      set.addMany(ids.data(), ids.size());
+      CHECK(matches(set, reference));
+
+      // Sorted input and one-by-one adds end in the same canonical containers.
+      IdSet added;
+      for (const std::uint32_t id : reference)
+        added.add(id);
+      CHECK(added == set);
+    }
+
+    const std::uint32_t extremes[] = {0xFFFFFFFFu, 0, 0xFFFF0000u, 0xFFFFu, 0};
+    IdSet set;
+    set.addMany(extremes, std::size(extremes));
+    CHECK(matches(set, Reference(std::begin(extremes), std::end(extremes))));
+  }
+
+  void testSetAlgebra(std::mt19937& random)
+  {
+    for (int round = 0; round < 40; ++round)
+    {
+      const std::vector<std::uint32_t> first = randomIds(random);
+      const std::vector<std::uint32_t> second = randomIds(random);
+      const Reference a(first.begin(), first.end());
+      const Reference b(second.begin(), second.end());
+      const IdSet setA = build(a);
+      const IdSet setB = build(b);
+
+      Reference expected;
+      std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::inserter(expected, expected.end()));
+      IdSet inPlace = setA;
+      inPlace.unionWith(setB);
+      CHECK(matches(IdSet::unionOf(setA, setB), expected));
+      CHECK(inPlace == build(expected));
+
+      expected.clear();
+      std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::inserter(expected, expected.end()));
+      inPlace = setA;
+      inPlace.intersectWith(setB);
+      CHECK(matches(IdSet::intersectionOf(setA, setB), expected));
+      CHECK(inPlace == build(expected));
+
+      expected.clear();
+      std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::inserter(expected, expected.end()));
+      inPlace = setA;
+      inPlace.subtract(setB);
+      CHECK(matches(IdSet::differenceOf(setA, setB), expected));
+      CHECK(inPlace == build(expected));
+
+      // Combining a set with itself or with the empty set.
+      CHECK(IdSet::unionOf(setA, setA) == setA);
+      CHECK(IdSet::intersectionOf(setA, setA) == setA);
+      CHECK(IdSet::differenceOf(setA, setA).empty());
+      CHECK(IdSet::unionOf(setA, IdSet()) == setA);
+      CHECK(IdSet::intersectionOf(setA, IdSet()).empty());
+    }
+  }
+}
+
+int main()
+{
+  for (const auto level : {Kernels::SimdLevel::Scalar, Kernels::SimdLevel::Sse2, Kernels::SimdLevel::Avx2})
+  {
+    if (Kernels::setSimdLevel(level) != level)
+      continue;
+    std::printf("SIMD level %d\n", static_cast<int>(level));
+
+    std::mt19937 random(7);
+    testAddRemoveContains(random);
+    testAddMany(random);
+    testSetAlgebra(random);
+  }
+  return CwAPI3D::Net::Bridge::Tests::checkFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,243 @@
+// Checks for the batch polygon clipper behind PolygonClipping (csharp_bridge/native/PolygonClipping): random polygon
+// batches are compared with a scalar Sutherland-Hodgman reference that clips one polygon against one plane at a time,
+// once per SIMD level the CPU supports.
+#include "Check.h"
+
+#include <core/Vec3.h>
+#include <native/PolygonClipping.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge::Native;
+  using namespace CwAPI3D::Net::Bridge::Native::Kernels;
+  using CwAPI3D::Net::Bridge::Core::Vec3d;
+  using Polygon = std::vector<Vec3d>;
+
+  constexpr double Epsilon = 1e-6;
+  /// Slack for comparing clipped vertices, whose plane distances the kernel may compute with SIMD arithmetic.
+  constexpr double CoordinateTolerance = 1e-9;
+
+  double distanceTo(const PlaneCoefficients& plane, const Vec3d& p)
+  {
+    return plane.nx * p.x + plane.ny * p.y + plane.nz * p.z + plane.d;
+  }
+
+  /// Textbook Sutherland-Hodgman with the clipper's tolerance rule: vertices within epsilon of a plane are kept,
+  /// edges are only split between vertices strictly on opposite sides, and polygons falling below three vertices
+  /// are dropped.
+  Polygon clipReference(Polygon polygon, const std::vector<PlaneCoefficients>& planes, double epsilon)
+  {
+    if (polygon.size() < 3)
+      return {};
+    for (const PlaneCoefficients& plane : planes)
+    {
+      Polygon clipped;
+      for (std::size_t i = 0; i < polygon.size(); ++i)
+      {
+        const Vec3d& a = polygon[i];
+        const Vec3d& b = polygon[(i + 1) % polygon.size()];
+        const double da = distanceTo(plane, a);
+        const double db = distanceTo(plane, b);
+        if (da >= -epsilon)
+          clipped.push_back(a);
+        if ((da > epsilon && db < -epsilon) || (da < -epsilon && db > epsilon))
+          clipped.push_back(a + (b - a) * (da / (da - db)));
+      }
+      if (clipped.size() < 3)
+        return {};
+      polygon.swap(clipped);
+    }
+    return polygon;
+  }
+
+  bool near(const Vec3d& a, const Vec3d& b)
+  {
+    return std::abs(a.x - b.x) <= CoordinateTolerance && std::abs(a.y - b.y) <= CoordinateTolerance &&
+           std::abs(a.z - b.z) <= CoordinateTolerance;
+  }
+
+  /// Clips the polygons with clipPolygons, their vertices stored after `padding` unused ones so the first offset is
+  /// not 0, and compares every output polygon with the reference.
+  bool clipsLikeReference(
+    const std::vector<Polygon>& polygons, const std::vector<PlaneCoefficients>& planes, std::size_t padding = 0)
+  {
+    SoaBuffer vertices;
+    for (std::size_t i = 0; i < padding; ++i)
+      vertices.push_back(1e9, 1e9, 1e9);
+    std::vector<std::int32_t> offsets{static_cast<std::int32_t>(padding)};
+    for (const Polygon& polygon : polygons)
+    {
+      for (const Vec3d& vertex : polygon)
+        vertices.push_back(vertex.x, vertex.y, vertex.z);
+      offsets.push_back(static_cast<std::int32_t>(vertices.size()));
+    }
+
+    SoaBuffer out;
+    out.push_back(7, 7, 7);
+    std::vector<std::int32_t> outOffsets(polygons.size() + 1, -1);
+    const std::size_t kept = clipPolygons(vertices.view(), offsets.data(), polygons.size(), planes.data(),
+      planes.size(), Epsilon, out, outOffsets.data());
+
+    bool same = CHECK(outOffsets[0] == 0) && CHECK(static_cast<std::size_t>(outOffsets.back()) == out.size());
+    std::size_t expectedKept = 0;
+    for (std::size_t p = 0; p < polygons.size() && same; ++p)
+    {
+      const Polygon expected = clipReference(polygons[p], planes, Epsilon);
+      expectedKept += expected.empty() ? 0 : 1;
+      const auto begin = static_cast<std::size_t>(outOffsets[p]);
+      const auto end = static_cast<std::size_t>(outOffsets[p + 1]);
+      same = CHECK(end - begin == expected.size());
+      for (std::size_t i = 0; i < expected.size() && same; ++i)
+        same = CHECK(near(Vec3d{out.x()[begin + i], out.y()[begin + i], out.z()[begin + i]}, expected[i]));
+      if (!same)
+        std::fprintf(stderr, "polygon %zu of %zu differs from the reference\n", p, polygons.size());
+    }
+    return same && CHECK(kept == expectedKept);
+  }
+
+  double uniform(std::mt19937& random, double low, double high)
+  {
+    return std::uniform_real_distribution<double>(low, high)(random);
+  }
+
+  Vec3d randomUnit(std::mt19937& random)
+  {
+    for (;;)
+    {
+      const Vec3d v{uniform(random, -1, 1), uniform(random, -1, 1), uniform(random, -1, 1)};
+      const double length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+      if (length > 1e-3 && length <= 1.0)
+        return v / length;
+    }
+  }
+
+  /// Regular polygons in random planes, plus some random (possibly self-intersecting) vertex loops and some
+  /// polygons with fewer than three vertices.
+  Polygon randomPolygon(std::mt19937& random, std::size_t maxVertices)
+  {
+    const auto count = std::uniform_int_distribution<std::size_t>(0, maxVertices)(random);
+    const Vec3d center{uniform(random, -5, 5), uniform(random, -5, 5), uniform(random, -5, 5)};
+    Polygon polygon;
+    if (std::uniform_int_distribution<int>(0, 4)(random) == 0)
+    {
+      for (std::size_t i = 0; i < count; ++i)
+        polygon.push_back(center + randomUnit(random) * uniform(random, 0, 3));
+      return polygon;
+    }
+    const Vec3d normal = randomUnit(random);
+    const Vec3d helper = std::abs(normal.x) < 0.9 ? Vec3d{1, 0, 0} : Vec3d{0, 1, 0};
+    const Vec3d u = CwAPI3D::Net::Bridge::Core::normalize(CwAPI3D::Net::Bridge::Core::cross(normal, helper));
+    const Vec3d v = CwAPI3D::Net::Bridge::Core::cross(normal, u);
+    const double radius = uniform(random, 0.1, 4);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      const double angle = 6.283185307179586 * static_cast<double>(i) / static_cast<double>(count);
+      polygon.push_back(center + (u * std::cos(angle) + v * std::sin(angle)) * radius);
+    }
+    return polygon;
+  }
+
+  std::vector<PlaneCoefficients> randomPlanes(std::mt19937& random, std::size_t count)
+  {
+    std::vector<PlaneCoefficients> planes;
+    for (std::size_t k = 0; k < count; ++k)
+    {
+      const Vec3d n = randomUnit(random);
+      planes.push_back(PlaneCoefficients{n.x, n.y, n.z, uniform(random, -4, 4)});
+    }
+    return planes;
+  }
+
+  void testDegenerateInput()
+  {
+    const Polygon triangle{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    const std::vector<PlaneCoefficients> cutting{{1, 0, 0, -0.5}};
+
+    // No polygons, no planes, and polygons with fewer than three vertices.
+    CHECK(clipsLikeReference({}, cutting));
+    CHECK(clipsLikeReference({triangle, {}, {{1, 1, 1}}, {{0, 0, 0}, {2, 0, 0}}}, {}));
+    CHECK(clipsLikeReference({{{-1, 0, 0}, {1, 0, 0}}, triangle, {}}, cutting, 5));
+
+    // A plane entirely in front keeps the polygon unchanged; one entirely behind removes it.
+    CHECK(clipsLikeReference({triangle}, {{1, 0, 0, 5}}));
+    CHECK(clipsLikeReference({triangle}, {{1, 0, 0, -5}}));
+  }
+
+  // Vertices within epsilon of the plane x = 0, on either side, count as on it.
+  void testVerticesNearThePlane()
+  {
+    const double e = Epsilon / 2;
+    const std::vector<PlaneCoefficients> plane{{1, 0, 0, 0}};
+    const std::vector<Polygon> polygons{
+      // Straddles the plane by less than epsilon: kept unchanged, not split.
+      {{-e, 0, 0}, {e, 0, 0}, {e, 1, 0}, {-e, 1, 0}},
+      // Slightly behind, but within epsilon: kept unchanged.
+      {{-e, 0, 0}, {-e, 1, 0}, {-e, 0, 1}},
+      // Two vertices behind, one on the plane: only the vertex on the plane is left, so the polygon is dropped.
+      {{e, 0, 0}, {-1, 1, 0}, {-1, 0, 1}},
+      // Two vertices on the plane and one behind: a degenerate sliver that is dropped.
+      {{-e, 0, 0}, {e, 1, 0}, {-1, 0, 0}},
+      // An edge from on the plane to behind is not split; an edge from in front to behind is.
+      {{e, 0, 0}, {-1, 0, 0}, {1, 1, 0}},
+    };
+    CHECK(clipsLikeReference(polygons, plane));
+
+    SoaBuffer vertices;
+    std::vector<std::int32_t> offsets{0};
+    for (const Polygon& polygon : polygons)
+    {
+      for (const Vec3d& vertex : polygon)
+        vertices.push_back(vertex.x, vertex.y, vertex.z);
+      offsets.push_back(static_cast<std::int32_t>(vertices.size()));
+    }
+    SoaBuffer out;
+    std::vector<std::int32_t> outOffsets(polygons.size() + 1);
+    CHECK(clipPolygons(vertices.view(), offsets.data(), polygons.size(), plane.data(), 1, Epsilon, out,
+            outOffsets.data()) == 3);
+    CHECK(outOffsets == (std::vector<std::int32_t>{0, 4, 7, 7, 7, 10}));
+    CHECK(out.x()[0] == -e && out.x()[1] == e);
+  }
+
+  void testRandomBatches(std::mt19937& random)
+  {
+    for (int round = 0; round < 60; ++round)
+    {
+      // Small batches, and batches of thousands of polygons that span several of the clipper's blocks.
+      const std::size_t polygonCount = round % 3 == 0 ? 3000 : std::uniform_int_distribution<std::size_t>(1, 20)(random);
+      std::vector<Polygon> polygons;
+      for (std::size_t p = 0; p < polygonCount; ++p)
+        polygons.push_back(randomPolygon(random, 12));
+      const auto planeCount = std::uniform_int_distribution<std::size_t>(0, 6)(random);
+      CHECK(clipsLikeReference(polygons, randomPlanes(random, planeCount), round % 2 == 0 ? 0 : 3));
+    }
+
+    // A single polygon larger than a block.
+    std::vector<Polygon> polygons{randomPolygon(random, 2), randomPolygon(random, 2)};
+    polygons.insert(polygons.begin() + 1, Polygon{});
+    while (polygons[1].size() < 10000)
+      polygons[1] = randomPolygon(random, 12000);
+    CHECK(clipsLikeReference(polygons, randomPlanes(random, 4)));
+  }
+}
+
+int main()
+{
+  for (const auto level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2})
+  {
+    if (setSimdLevel(level) != level)
+      continue;
+    std::printf("SIMD level %d\n", static_cast<int>(level));
+
+    std::mt19937 random(99);
+    testDegenerateInput();
+    testVerticesNearThePlane();
+    testRandomBatches(random);
+  }
+  return CwAPI3D::Net::Bridge::Tests::checkFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+// Checks for the point hash grid behind SpatialPointHash (csharp_bridge/native/SpatialHash): find, weld and
+// queryRadius are compared with brute-force scans, on random points and on points snapped to a grid so that many of
+// them lie on cell boundaries or exactly the tolerance apart.
+#include "Check.h"
+
+#include <native/SpatialHash.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+  using namespace CwAPI3D::Net::Bridge::Native;
+  using CwAPI3D::Net::Bridge::Core::Vec3d;
+
+  double distanceSquared(const Vec3d& a, const Vec3d& b)
+  {
+    const double ex = a.x - b.x, ey = a.y - b.y, ez = a.z - b.z;
+    return ex * ex + ey * ey + ez * ez;
+  }
+
+  /// The oldest of the nearest points within the tolerance, or NotFound.
+  std::int32_t findReference(const std::vector<Vec3d>& points, const Vec3d& point, double tolerance)
+  {
+    std::int32_t best = SpatialHash::NotFound;
+    double bestDistance = tolerance * tolerance;
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+      const double distance = distanceSquared(points[i], point);
+      if (distance < bestDistance || (distance == bestDistance && best == SpatialHash::NotFound))
+      {
+        best = static_cast<std::int32_t>(i);
+        bestDistance = distance;
+      }
+    }
+    return best;
+  }
+
+  std::vector<std::int32_t> queryReference(const std::vector<Vec3d>& points, const Vec3d& center, double radius)
+  {
+    std::vector<std::int32_t> out;
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+      if (distanceSquared(points[i], center) <= radius * radius)
+        out.push_back(static_cast<std::int32_t>(i));
+    }
+    return out;
+  }
+
+  std::vector<Vec3d> storedPoints(const SpatialHash& hash)
+  {
+    const ConstSoaView points = hash.points();
+    std::vector<Vec3d> out;
+    for (std::size_t i = 0; i < points.count; ++i)
+      out.push_back(Vec3d{points.x[i], points.y[i], points.z[i]});
+    return out;
+  }
+
+  SoaBuffer toSoa(const std::vector<Vec3d>& points)
+  {
+    SoaBuffer buffer;
+    for (const Vec3d& point : points)
+      buffer.push_back(point.x, point.y, point.z);
+    return buffer;
+  }
+
+  /// Points around the origin, negative coordinates included. With a step, coordinates are multiples of it, so with
+  /// a tolerance of half a power of two many points sit on cell boundaries and exactly the tolerance apart.
+  std::vector<Vec3d> randomPoints(std::mt19937& random, std::size_t count, double extent, double step)
+  {
+    std::uniform_real_distribution<double> coordinate(-extent, extent);
+    const auto snap = [step](double value) { return step > 0.0 ? std::round(value / step) * step : value; };
+    std::vector<Vec3d> points;
+    for (std::size_t i = 0; i < count; ++i)
+      points.push_back(Vec3d{snap(coordinate(random)), snap(coordinate(random)), snap(coordinate(random))});
+    return points;
+  }
+
+  void checkQueries(const SpatialHash& hash, std::mt19937& random, double extent, double step)
+  {
+    const std::vector<Vec3d> points = storedPoints(hash);
+    for (const Vec3d& probe : randomPoints(random, 300, extent + 1.0, step))
+    {
+      CHECK(hash.find(probe) == findReference(points, probe, hash.tolerance()));
+
+      // Radii at, below and far above the tolerance; the large ones walk the occupied cells instead of probing.
+      for (const double radius : {0.0, hash.tolerance(), 3.0 * hash.tolerance(), 1e3})
+      {
+        std::vector<std::int32_t> found{-7};
+        hash.queryRadius(probe, radius, found);
+        CHECK(found.front() == -7);
+        found.erase(found.begin());
+        std::sort(found.begin(), found.end());
+        CHECK(found == queryReference(points, probe, radius));
+      }
+    }
+  }
+
+  void testWeldAndFind(std::mt19937& random, double tolerance, double extent, double step)
+  {
+    SpatialHash hash(tolerance);
+    std::vector<Vec3d> reference;
+    // Several batches, so later ones weld onto points stored by earlier ones and the table grows in between.
+    for (int batch = 0; batch < 4; ++batch)
+    {
+      const std::vector<Vec3d> points = randomPoints(random, 1500, extent, step);
+      const SoaBuffer soa = toSoa(points);
+      std::vector<std::int32_t> indices(points.size(), -2);
+      const std::size_t stored = hash.weld(soa.view(), indices.data());
+
+      std::size_t expectedStored = 0;
+      bool same = true;
+      for (std::size_t i = 0; i < points.size() && same; ++i)
+      {
+        std::int32_t expected = findReference(reference, points[i], tolerance);
+        if (expected == SpatialHash::NotFound)
+        {
+          expected = static_cast<std::int32_t>(reference.size());
+          reference.push_back(points[i]);
+          ++expectedStored;
+        }
+        same = CHECK(indices[i] == expected);
+      }
+      CHECK(stored == expectedStored);
+      CHECK(storedPoints(hash) == reference);
+    }
+    checkQueries(hash, random, extent, step);
+  }
+
+  void testInsertKeepsDuplicates(std::mt19937& random)
+  {
+    SpatialHash hash(0.5);
+    const std::vector<Vec3d> points = randomPoints(random, 4000, 6.0, 0.5);
+    const SoaBuffer soa = toSoa(points);
+    hash.insert(soa.view());
+    hash.insert(soa.view());
+    CHECK(hash.size() == 2 * points.size());
+    checkQueries(hash, random, 6.0, 0.5);
+  }
+
+  // Cells have edge 1 here, so x = 1 is a cell boundary and points 0.5 apart are exactly the tolerance apart.
+  void testBoundaries()
+  {
+    SpatialHash hash(0.5);
+    const std::vector<Vec3d> points{{1.0, 0.2, 0.2}, {1.5, 0.2, 0.2}, {-1.0, -1.0, -1.0}, {-0.5, -1.0, -1.0}};
+    const SoaBuffer soa = toSoa(points);
+    std::vector<std::int32_t> indices(points.size());
+    CHECK(hash.weld(soa.view(), indices.data()) == 2);
+    CHECK(indices == (std::vector<std::int32_t>{0, 0, 1, 1}));
+
+    // Across the boundary at x = 1, exactly at the tolerance, and just beyond it.
+    CHECK(hash.find(Vec3d{0.999, 0.2, 0.2}) == 0);
+    CHECK(hash.find(Vec3d{0.5, 0.2, 0.2}) == 0);
+    CHECK(hash.find(Vec3d{0.5 - 1e-12, 0.2, 0.2}) == SpatialHash::NotFound);
+    CHECK(hash.find(Vec3d{-1.0, -1.0, -0.5}) == 1);
+    CHECK(hash.find(Vec3d{-1.0, -1.0, -1.5}) == 1);
+    CHECK(hash.find(Vec3d{-1.0, -1.0, std::nextafter(-1.5, -2.0)}) == SpatialHash::NotFound);
+
+    // Equidistant from two stored points: the older one wins.
+    SpatialHash tie(0.5);
+    const SoaBuffer pair = toSoa({{0.0, 0.0, 0.0}, {0.75, 0.0, 0.0}});
+    std::vector<std::int32_t> pairIndices(2);
+    CHECK(tie.weld(pair.view(), pairIndices.data()) == 2);
+    CHECK(tie.find(Vec3d{0.375, 0.0, 0.0}) == 0);
+
+    std::vector<std::int32_t> found;
+    hash.queryRadius(Vec3d{}, -1.0, found);
+    hash.queryRadius(Vec3d{}, std::numeric_limits<double>::quiet_NaN(), found);
+    CHECK(found.empty());
+    hash.queryRadius(Vec3d{0.5, 0.2, 0.2}, 0.5, found);
+    CHECK(found == (std::vector<std::int32_t>{0}));
+  }
+}
+
+int main()
+{
+  std::mt19937 random(42);
+  testBoundaries();
+  testInsertKeepsDuplicates(random);
+  testWeldAndFind(random, 0.5, 8.0, 0.25);
+  testWeldAndFind(random, 0.25, 3.0, 0.125);
+  testWeldAndFind(random, 0.1, 5.0, 0.0);
+  testWeldAndFind(random, 1e-3, 0.05, 0.0);
+  return CwAPI3D::Net::Bridge::Tests::checkFailures() == 0 ? 0 : 1;
+}